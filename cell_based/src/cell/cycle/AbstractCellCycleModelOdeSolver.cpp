@@ -126,3 +126,8 @@ bool AbstractCellCycleModelOdeSolver::IsAdaptive()
 #endif //CHASTE_CVODE
     return adaptive;
 }
+
+boost::shared_ptr<const AbstractIvpOdeSolver> AbstractCellCycleModelOdeSolver::GetIvpOdeSolver() const
+{
+    return mpOdeSolver;
+}
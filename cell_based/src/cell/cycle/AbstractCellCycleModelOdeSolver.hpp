@@ -177,6 +177,12 @@ public:
      * The base class version just returns true iff the solver is the CvodeAdaptor class.
      */
     virtual bool IsAdaptive();
+
+    /**
+     * @return the underlying ODE solver (empty if the solver has not been set up).
+     * Used by CellCycleModelOdeBatchSolver to find out which scheme to apply.
+     */
+    boost::shared_ptr<const AbstractIvpOdeSolver> GetIvpOdeSolver() const;
 };
 
 #endif /*ABSTRACTCELLCYCLEMODELODESOLVER_HPP_*/
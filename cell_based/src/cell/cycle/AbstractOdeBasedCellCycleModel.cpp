@@ -124,10 +124,19 @@ void AbstractOdeBasedCellCycleModel::ResetForDivision()
     mDivideTime = DBL_MAX;
 }
 
+bool AbstractOdeBasedCellCycleModel::IsSolvingOdes() const
+{
+    return (!mReadyToDivide);
+}
+
 double AbstractOdeBasedCellCycleModel::GetOdeStopTime()
 {
     double stop_time = DOUBLE_UNSET;
-    if (mpOdeSolver->StoppingEventOccurred())
+    if (mBatchStoppingTime != DOUBLE_UNSET)
+    {
+        stop_time = mBatchStoppingTime;
+    }
+    else if (mpOdeSolver->StoppingEventOccurred())
     {
         stop_time = mpOdeSolver->GetStoppingTime();
     }
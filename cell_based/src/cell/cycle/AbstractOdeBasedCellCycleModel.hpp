@@ -116,6 +116,13 @@ public:
      */
     virtual ~AbstractOdeBasedCellCycleModel();
 
+    /**
+     * Overridden IsSolvingOdes() method.
+     *
+     * @return whether the cell is not yet ready to divide
+     */
+    virtual bool IsSolvingOdes() const;
+
     /**
      * Get the time at which the ODE stopping event occurred.
      * Only called in those subclasses for which stopping events
@@ -163,10 +163,19 @@ void AbstractOdeBasedPhaseBasedCellCycleModel::ResetForDivision()
     mDivideTime = DBL_MAX;
 }
 
+bool AbstractOdeBasedPhaseBasedCellCycleModel::IsSolvingOdes() const
+{
+    return (!mFinishedRunningOdes && mCurrentCellCyclePhase != M_PHASE);
+}
+
 double AbstractOdeBasedPhaseBasedCellCycleModel::GetOdeStopTime()
 {
     double stop_time = DOUBLE_UNSET;
-    if (mpOdeSolver->StoppingEventOccurred())
+    if (mBatchStoppingTime != DOUBLE_UNSET)
+    {
+        stop_time = mBatchStoppingTime;
+    }
+    else if (mpOdeSolver->StoppingEventOccurred())
     {
         stop_time = mpOdeSolver->GetStoppingTime();
     }
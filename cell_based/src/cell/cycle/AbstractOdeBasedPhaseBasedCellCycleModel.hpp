@@ -128,6 +128,13 @@ public:
      */
     virtual void UpdateCellCyclePhase();
 
+    /**
+     * Overridden IsSolvingOdes() method.
+     *
+     * @return whether the ODEs are still running and the cell is not in M phase
+     */
+    virtual bool IsSolvingOdes() const;
+
     /**
      * Get the time at which the ODE stopping event occurred.
      * Only called in those subclasses for which stopping events
@@ -0,0 +1,259 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "CellCycleModelOdeBatchSolver.hpp"
+
+#include <algorithm>
+#include <map>
+#include <typeinfo>
+
+#include "RungeKutta4IvpOdeSolver.hpp"
+#include "EulerIvpOdeSolver.hpp"
+#include "TimeStepper.hpp"
+
+bool CellCycleModelOdeBatchSolver::BatchKey::operator<(const BatchKey& rOther) const
+{
+    if (systemType != rOther.systemType)
+    {
+        return systemType < rOther.systemType;
+    }
+    if (useRungeKutta4 != rOther.useRungeKutta4)
+    {
+        return useRungeKutta4 < rOther.useRungeKutta4;
+    }
+    if (timeStep != rOther.timeStep)
+    {
+        return timeStep < rOther.timeStep;
+    }
+    return startTime < rOther.startTime;
+}
+
+CellCycleModelOdeBatchSolver::CellCycleModelOdeBatchSolver()
+    : mNumSystemsSolved(0)
+{
+}
+
+void CellCycleModelOdeBatchSolver::SolveToTime(const std::vector<CellCycleModelOdeHandler*>& rHandlers, double currentTime)
+{
+    mNumSystemsSolved = 0;
+
+    // Sort the handlers whose ODEs need advancing into groups that can be solved together
+    std::map<BatchKey, std::vector<CellCycleModelOdeHandler*> > groups;
+    for (std::vector<CellCycleModelOdeHandler*>::const_iterator iter = rHandlers.begin();
+         iter != rHandlers.end();
+         ++iter)
+    {
+        CellCycleModelOdeHandler* p_handler = *iter;
+        if (p_handler == NULL
+            || p_handler->mpOdeSystem == NULL
+            || !p_handler->mpOdeSolver
+            || !p_handler->mpOdeSolver->IsSetUp()
+            || p_handler->mStoppingEventPending
+            || p_handler->mLastTime >= currentTime
+            || !p_handler->IsSolvingOdes())
+        {
+            continue;
+        }
+
+        // Only the explicit one-step schemes are batched
+        boost::shared_ptr<const AbstractIvpOdeSolver> p_solver = p_handler->mpOdeSolver->GetIvpOdeSolver();
+        BatchKey key;
+        if (boost::dynamic_pointer_cast<const RungeKutta4IvpOdeSolver>(p_solver))
+        {
+            key.useRungeKutta4 = true;
+        }
+        else if (boost::dynamic_pointer_cast<const EulerIvpOdeSolver>(p_solver))
+        {
+            key.useRungeKutta4 = false;
+        }
+        else
+        {
+            continue;
+        }
+
+        p_handler->AdjustOdeParameters(currentTime);
+
+        // Leave systems that are already at a stopping event to the unbatched solver, which reports this
+        if (p_handler->mpOdeSystem->CalculateStoppingEvent(p_handler->mLastTime, p_handler->mpOdeSystem->rGetStateVariables()))
+        {
+            continue;
+        }
+
+        key.systemType = typeid(*(p_handler->mpOdeSystem)).name();
+        key.timeStep = p_handler->GetDt();
+        key.startTime = p_handler->mLastTime;
+        groups[key].push_back(p_handler);
+    }
+
+    for (std::map<BatchKey, std::vector<CellCycleModelOdeHandler*> >::iterator iter = groups.begin();
+         iter != groups.end();
+         ++iter)
+    {
+        mNumSystemsSolved += iter->second.size();
+        SolveGroup(iter->second, iter->first, currentTime);
+    }
+}
+
+void CellCycleModelOdeBatchSolver::EvaluateYDerivatives(const std::vector<CellCycleModelOdeHandler*>& rHandlers,
+                                                        double time,
+                                                        const std::vector<double>& rY,
+                                                        std::vector<double>& rDy)
+{
+    const unsigned num_variables = mSystemY.size();
+    for (unsigned system=0; system<rHandlers.size(); system++)
+    {
+        const unsigned offset = system*num_variables;
+        mSystemY.assign(rY.begin() + offset, rY.begin() + offset + num_variables);
+        rHandlers[system]->mpOdeSystem->EvaluateYDerivatives(time, mSystemY, mSystemDy);
+        std::copy(mSystemDy.begin(), mSystemDy.end(), rDy.begin() + offset);
+    }
+}
+
+void CellCycleModelOdeBatchSolver::SolveGroup(std::vector<CellCycleModelOdeHandler*>& rHandlers, const BatchKey& rKey, double endTime)
+{
+    const unsigned num_variables = rHandlers[0]->mpOdeSystem->GetNumberOfStateVariables();
+    mSystemY.resize(num_variables);
+    mSystemDy.resize(num_variables);
+
+    // Gather the state variables into contiguous storage
+    unsigned size = rHandlers.size()*num_variables;
+    mY.resize(size);
+    mDy.resize(size);
+    if (rKey.useRungeKutta4)
+    {
+        mYki.resize(size);
+        mK1.resize(size);
+        mK2.resize(size);
+        mK3.resize(size);
+    }
+    for (unsigned system=0; system<rHandlers.size(); system++)
+    {
+        const std::vector<double>& r_state = rHandlers[system]->mpOdeSystem->rGetStateVariables();
+        assert(r_state.size() == num_variables);
+        std::copy(r_state.begin(), r_state.end(), mY.begin() + system*num_variables);
+    }
+
+    TimeStepper stepper(rKey.startTime, endTime, rKey.timeStep);
+    while (!stepper.IsTimeAtEnd() && !rHandlers.empty())
+    {
+        const double time = stepper.GetTime();
+        const double dt = stepper.GetNextTimeStep();
+        size = rHandlers.size()*num_variables;
+
+        // The arithmetic matches RungeKutta4IvpOdeSolver and EulerIvpOdeSolver exactly
+        if (rKey.useRungeKutta4)
+        {
+            EvaluateYDerivatives(rHandlers, time, mY, mDy);
+            for (unsigned i=0; i<size; i++)
+            {
+                mK1[i] = dt*mDy[i];
+                mYki[i] = mY[i] + 0.5*mK1[i];
+            }
+
+            EvaluateYDerivatives(rHandlers, time+0.5*dt, mYki, mDy);
+            for (unsigned i=0; i<size; i++)
+            {
+                mK2[i] = dt*mDy[i];
+                mYki[i] = mY[i] + 0.5*mK2[i];
+            }
+
+            EvaluateYDerivatives(rHandlers, time+0.5*dt, mYki, mDy);
+            for (unsigned i=0; i<size; i++)
+            {
+                mK3[i] = dt*mDy[i];
+                mYki[i] = mY[i] + mK3[i];
+            }
+
+            EvaluateYDerivatives(rHandlers, time+dt, mYki, mDy);
+            for (unsigned i=0; i<size; i++)
+            {
+                double k4 = dt*mDy[i];
+                mY[i] = mY[i] + (mK1[i]+2*mK2[i]+2*mK3[i]+k4)/6.0;
+            }
+        }
+        else
+        {
+            EvaluateYDerivatives(rHandlers, time, mY, mDy);
+            for (unsigned i=0; i<size; i++)
+            {
+                mY[i] = mY[i] + dt*mDy[i];
+            }
+        }
+        stepper.AdvanceOneTimeStep();
+
+        /*
+         * Check for stopping events. A system that has stopped is written back
+         * immediately and removed from the batch by moving the last system
+         * into its place.
+         */
+        const double new_time = stepper.GetTime();
+        for (unsigned system=rHandlers.size(); system-- > 0; )
+        {
+            CellCycleModelOdeHandler* p_handler = rHandlers[system];
+            const unsigned offset = system*num_variables;
+            mSystemY.assign(mY.begin() + offset, mY.begin() + offset + num_variables);
+            if (p_handler->mpOdeSystem->CalculateStoppingEvent(new_time, mSystemY))
+            {
+                p_handler->mpOdeSystem->SetStateVariables(mSystemY);
+                p_handler->mLastTime = new_time;
+                p_handler->mBatchStoppingTime = new_time;
+                p_handler->mStoppingEventPending = true;
+
+                const unsigned last_offset = (rHandlers.size()-1)*num_variables;
+                if (offset != last_offset)
+                {
+                    std::copy(mY.begin() + last_offset, mY.begin() + last_offset + num_variables, mY.begin() + offset);
+                    rHandlers[system] = rHandlers.back();
+                }
+                rHandlers.pop_back();
+            }
+        }
+    }
+
+    // Scatter the results back to the systems that reached the end time
+    for (unsigned system=0; system<rHandlers.size(); system++)
+    {
+        const unsigned offset = system*num_variables;
+        mSystemY.assign(mY.begin() + offset, mY.begin() + offset + num_variables);
+        rHandlers[system]->mpOdeSystem->SetStateVariables(mSystemY);
+        rHandlers[system]->mLastTime = endTime;
+        rHandlers[system]->mBatchStoppingTime = DOUBLE_UNSET;
+    }
+}
+
+unsigned CellCycleModelOdeBatchSolver::GetNumSystemsSolved() const
+{
+    return mNumSystemsSolved;
+}
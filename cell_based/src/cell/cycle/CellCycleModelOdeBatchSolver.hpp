@@ -0,0 +1,168 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef CELLCYCLEMODELODEBATCHSOLVER_HPP_
+#define CELLCYCLEMODELODEBATCHSOLVER_HPP_
+
+#include <vector>
+#include <string>
+
+#include "CellCycleModelOdeHandler.hpp"
+
+/**
+ * Advances the ODE systems of many cell-cycle or SRN models together.
+ *
+ * Normally each model integrates its own ODE system lazily, through
+ * CellCycleModelOdeHandler::SolveOdeToTime(), using a solver object that is
+ * shared (as a singleton) between all cells with the same model. This class
+ * instead takes a collection of handlers, groups those whose ODE systems are
+ * of the same type and are at the same time with the same time step, gathers
+ * their state variables into contiguous arrays, advances each group with a
+ * single explicit Runge-Kutta (or forward Euler) kernel, and scatters the
+ * results back. A subsequent call to SolveOdeToTime() on any of the handlers
+ * then has nothing left to do, or simply reports the stopping event that was
+ * found.
+ *
+ * The kernels apply exactly the same arithmetic as RungeKutta4IvpOdeSolver and
+ * EulerIvpOdeSolver, so results are identical to the unbatched solve. Systems
+ * using any other solver (e.g. CVODE or backward Euler) are left to be solved
+ * in the usual way.
+ *
+ * All working memory belongs to the batch solver object, and no singleton
+ * state is touched, so separate instances may be used concurrently on
+ * disjoint sets of handlers.
+ */
+class CellCycleModelOdeBatchSolver
+{
+private:
+
+    /** Identifies a group of ODE systems that can be advanced together. */
+    struct BatchKey
+    {
+        /** The type of the ODE system. */
+        std::string systemType;
+
+        /** Whether to use the Runge-Kutta (rather than forward Euler) kernel. */
+        bool useRungeKutta4;
+
+        /** The time step. */
+        double timeStep;
+
+        /** The time from which to solve. */
+        double startTime;
+
+        /**
+         * Ordering operator, so keys can be used in a std::map.
+         *
+         * @param rOther the key to compare with
+         * @return whether this key comes before rOther
+         */
+        bool operator<(const BatchKey& rOther) const;
+    };
+
+    /** State variables of the systems in the current group, stored system by system. */
+    std::vector<double> mY;
+
+    /** Intermediate state variables for the Runge-Kutta stages. */
+    std::vector<double> mYki;
+
+    /** First Runge-Kutta increment. */
+    std::vector<double> mK1;
+
+    /** Second Runge-Kutta increment. */
+    std::vector<double> mK2;
+
+    /** Third Runge-Kutta increment. */
+    std::vector<double> mK3;
+
+    /** Derivatives of the state variables. */
+    std::vector<double> mDy;
+
+    /** Scratch space for the state variables of a single system. */
+    std::vector<double> mSystemY;
+
+    /** Scratch space for the derivatives of a single system. */
+    std::vector<double> mSystemDy;
+
+    /** The number of ODE systems advanced by the most recent call to SolveToTime(). */
+    unsigned mNumSystemsSolved;
+
+    /**
+     * Evaluate the derivatives of every system in a group.
+     *
+     * @param rHandlers the handlers in the group
+     * @param time the time at which to evaluate the derivatives
+     * @param rY the state variables of all the systems
+     * @param rDy filled in with the derivatives of all the systems
+     */
+    void EvaluateYDerivatives(const std::vector<CellCycleModelOdeHandler*>& rHandlers,
+                              double time,
+                              const std::vector<double>& rY,
+                              std::vector<double>& rDy);
+
+    /**
+     * Advance a group of ODE systems of the same type from the same start time.
+     *
+     * @param rHandlers the handlers in the group (reordered as systems reach stopping events)
+     * @param rKey the properties shared by the group
+     * @param endTime the time up to which to solve
+     */
+    void SolveGroup(std::vector<CellCycleModelOdeHandler*>& rHandlers, const BatchKey& rKey, double endTime);
+
+public:
+
+    /**
+     * Constructor.
+     */
+    CellCycleModelOdeBatchSolver();
+
+    /**
+     * Advance the ODE systems of the given handlers to the given time, where
+     * the handlers would do so themselves on their next update. Handlers whose
+     * ODEs are not running, or which use a solver that cannot be batched, are
+     * skipped.
+     *
+     * @param rHandlers the ODE handlers (cell-cycle or SRN models) to consider
+     * @param currentTime the time up to which to solve
+     */
+    void SolveToTime(const std::vector<CellCycleModelOdeHandler*>& rHandlers, double currentTime);
+
+    /**
+     * @return the number of ODE systems advanced by the most recent call to SolveToTime()
+     */
+    unsigned GetNumSystemsSolved() const;
+};
+
+#endif /*CELLCYCLEMODELODEBATCHSOLVER_HPP_*/
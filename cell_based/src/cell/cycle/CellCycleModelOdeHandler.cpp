@@ -41,7 +41,9 @@ CellCycleModelOdeHandler::CellCycleModelOdeHandler(double lastTime,
       mpOdeSystem(NULL),
       mpOdeSolver(pOdeSolver),
       mLastTime(lastTime),
-      mFinishedRunningOdes(false)
+      mFinishedRunningOdes(false),
+      mStoppingEventPending(false),
+      mBatchStoppingTime(DOUBLE_UNSET)
 {
 }
 
@@ -58,7 +60,9 @@ CellCycleModelOdeHandler::CellCycleModelOdeHandler(const CellCycleModelOdeHandle
         mpOdeSystem(rHandler.mpOdeSystem),
         mpOdeSolver(rHandler.mpOdeSolver),
         mLastTime(rHandler.mLastTime),
-        mFinishedRunningOdes(rHandler.mFinishedRunningOdes)
+        mFinishedRunningOdes(rHandler.mFinishedRunningOdes),
+        mStoppingEventPending(false),
+        mBatchStoppingTime(DOUBLE_UNSET)
 {
 }
 
@@ -100,9 +104,17 @@ double CellCycleModelOdeHandler::GetDt()
 
 bool CellCycleModelOdeHandler::SolveOdeToTime(double currentTime)
 {
+    if (mStoppingEventPending)
+    {
+        // A batched solve has already run the ODEs up to a stopping event at mLastTime
+        mStoppingEventPending = false;
+        return true;
+    }
+
     bool stopping_event_occurred = false;
     if (mLastTime < currentTime)
     {
+        mBatchStoppingTime = DOUBLE_UNSET;
         AdjustOdeParameters(currentTime);
 
         mpOdeSolver->SolveAndUpdateStateVariable(mpOdeSystem, mLastTime, currentTime, GetDt());
@@ -124,6 +136,11 @@ void CellCycleModelOdeHandler::AdjustOdeParameters(double currentTime)
 {
 }
 
+bool CellCycleModelOdeHandler::IsSolvingOdes() const
+{
+    return !mFinishedRunningOdes;
+}
+
 void CellCycleModelOdeHandler::SetLastTime(double lastTime)
 {
     mLastTime = lastTime;
@@ -40,6 +40,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <boost/noncopyable.hpp>
 
 #include "ChasteSerialization.hpp"
+#include "ChasteSerializationVersion.hpp"
 #include "AbstractOdeSystem.hpp"
 #include "AbstractCellCycleModelOdeSolver.hpp"
 #include "SimulationTime.hpp"
@@ -51,6 +52,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  */
 class CellCycleModelOdeHandler
 {
+    friend class CellCycleModelOdeBatchSolver;
+
 private:
 
     /** Needed for serialization. */
@@ -69,6 +72,11 @@ private:
         archive & mLastTime;
         archive & mDt;
         archive & mFinishedRunningOdes;
+        if (version > 0)
+        {
+            archive & mStoppingEventPending;
+            archive & mBatchStoppingTime;
+        }
     }
 
     /**
@@ -110,6 +118,21 @@ protected:
      */
     bool mFinishedRunningOdes;
 
+    /**
+     * Whether a CellCycleModelOdeBatchSolver has run the ODEs up to a stopping
+     * event (at mLastTime) that has not yet been reported by SolveOdeToTime().
+     * This is archived, since a BatchedOdeSolverModifier sets it at the end of a
+     * time step and so it may still be pending when a checkpoint is taken.
+     */
+    bool mStoppingEventPending;
+
+    /**
+     * The time of the stopping event found by the most recent batched solve of
+     * this system, or DOUBLE_UNSET if that solve did not stop or the most recent
+     * solve was not batched.
+     */
+    double mBatchStoppingTime;
+
     /**
      * Solves the ODE system to a given time.
      *
@@ -127,6 +150,14 @@ protected:
      */
     virtual void AdjustOdeParameters(double currentTime);
 
+    /**
+     * @return whether the ODEs would be advanced the next time this model is
+     * updated, and so may be advanced in advance by a CellCycleModelOdeBatchSolver.
+     * Defaults to !mFinishedRunningOdes; models that pause their ODEs for other
+     * reasons should override this.
+     */
+    virtual bool IsSolvingOdes() const;
+
 public:
 
     /**
@@ -206,4 +237,6 @@ public:
 
 };
 
+BOOST_CLASS_VERSION(CellCycleModelOdeHandler, 1)
+
 #endif /*CELLCYCLEMODELODEHANDLER_HPP_*/
@@ -42,14 +42,16 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 UniformlyDistributedCellCycleModel::UniformlyDistributedCellCycleModel()
     : AbstractSimpleCellCycleModel(),
       mMinCellCycleDuration(12.0), // Hours
-      mMaxCellCycleDuration(14.0)  // Hours
+      mMaxCellCycleDuration(14.0), // Hours
+      mUseCounterBasedRandomStream(false)
 {
 }
 
 UniformlyDistributedCellCycleModel::UniformlyDistributedCellCycleModel(const UniformlyDistributedCellCycleModel& rModel)
    : AbstractSimpleCellCycleModel(rModel),
      mMinCellCycleDuration(rModel.mMinCellCycleDuration),
-     mMaxCellCycleDuration(rModel.mMaxCellCycleDuration)
+     mMaxCellCycleDuration(rModel.mMaxCellCycleDuration),
+     mUseCounterBasedRandomStream(rModel.mUseCounterBasedRandomStream)
 {
     /*
      * Set each member variable of the new cell-cycle model that inherits
@@ -81,6 +83,12 @@ void UniformlyDistributedCellCycleModel::SetCellCycleDuration()
     {
         mCellCycleDuration = DBL_MAX;
     }
+    else if (mUseCounterBasedRandomStream)
+    {
+        unsigned time_step = SimulationTime::Instance()->GetTimeStepsElapsed();
+        CounterBasedRandomStream stream = p_gen->GetStream(mpCell->GetCellId(), time_step);
+        mCellCycleDuration = mMinCellCycleDuration + (mMaxCellCycleDuration - mMinCellCycleDuration) * stream.ranf(); // U[MinCCD,MaxCCD]
+    }
     else
     {
         mCellCycleDuration = mMinCellCycleDuration + (mMaxCellCycleDuration - mMinCellCycleDuration) * p_gen->ranf(); // U[MinCCD,MaxCCD]
@@ -107,6 +115,16 @@ void UniformlyDistributedCellCycleModel::SetMaxCellCycleDuration(double maxCellC
     mMaxCellCycleDuration = maxCellCycleDuration;
 }
 
+void UniformlyDistributedCellCycleModel::SetUseCounterBasedRandomStream(bool useCounterBasedRandomStream)
+{
+    mUseCounterBasedRandomStream = useCounterBasedRandomStream;
+}
+
+bool UniformlyDistributedCellCycleModel::GetUseCounterBasedRandomStream()
+{
+    return mUseCounterBasedRandomStream;
+}
+
 double UniformlyDistributedCellCycleModel::GetAverageTransitCellCycleTime()
 {
     return 0.5*(mMinCellCycleDuration + mMaxCellCycleDuration);
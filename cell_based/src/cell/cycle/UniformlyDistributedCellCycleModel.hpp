@@ -65,6 +65,13 @@ private:
      */
     double mMaxCellCycleDuration;
 
+    /**
+     * Whether to draw the cell cycle duration from a counter-based random stream
+     * keyed by the cell ID and time step, rather than from the shared generator.
+     * Defaults to false.
+     */
+    bool mUseCounterBasedRandomStream;
+
     /** Needed for serialization. */
     friend class boost::serialization::access;
     /**
@@ -83,6 +90,10 @@ private:
         archive & p_wrapper;
         archive & mMinCellCycleDuration;
         archive & mMaxCellCycleDuration;
+        if (version > 0)
+        {
+            archive & mUseCounterBasedRandomStream;
+        }
     }
 
 protected:
@@ -148,6 +159,22 @@ public:
      */
     void SetMaxCellCycleDuration(double maxCellCycleDuration);
 
+    /**
+     * Set whether to draw cell cycle durations from a counter-based random stream
+     * (see RandomNumberGenerator::GetStream()) keyed by the cell ID and the number
+     * of time steps elapsed. The duration given to each cell then depends only on
+     * the seed, the cell and the time, and not on the order in which cells are
+     * initialised or divide.
+     *
+     * @param useCounterBasedRandomStream whether to use a counter-based stream (defaults to true)
+     */
+    void SetUseCounterBasedRandomStream(bool useCounterBasedRandomStream=true);
+
+    /**
+     * @return mUseCounterBasedRandomStream
+     */
+    bool GetUseCounterBasedRandomStream();
+
     /**
      * Overridden GetAverageTransitCellCycleTime() method.
      *
@@ -170,6 +197,8 @@ public:
     virtual void OutputCellCycleModelParameters(out_stream& rParamsFile);
 };
 
+BOOST_CLASS_VERSION(UniformlyDistributedCellCycleModel, 1)
+
 #include "SerializationExportWrapper.hpp"
 // Declare identifier for the serializer
 CHASTE_CLASS_EXPORT(UniformlyDistributedCellCycleModel)
@@ -82,15 +82,6 @@ AbstractSrnModel* DeltaNotchSrnModel::CreateSrnModel()
     return new DeltaNotchSrnModel(*this);
 }
 
-void DeltaNotchSrnModel::SimulateToCurrentTime()
-{
-    // Custom behaviour
-    UpdateDeltaNotch();
-
-    // Run the ODE simulation as needed
-    AbstractOdeSrnModel::SimulateToCurrentTime();
-}
-
 void DeltaNotchSrnModel::Initialise()
 {
     AbstractOdeSrnModel::Initialise(new DeltaNotchOdeSystem);
@@ -105,6 +96,11 @@ void DeltaNotchSrnModel::UpdateDeltaNotch()
     mpOdeSystem->SetParameter("Mean Delta", mean_delta);
 }
 
+void DeltaNotchSrnModel::AdjustOdeParameters(double currentTime)
+{
+    UpdateDeltaNotch();
+}
+
 double DeltaNotchSrnModel::GetNotch()
 {
     assert(mpOdeSystem != NULL);
@@ -105,16 +105,19 @@ public:
     void Initialise(); // override
 
     /**
-     * Overridden SimulateToTime() method for custom behaviour.
-     *
-     * \todo #2752 say what it does in this class
+     * Update the current levels of Delta and Notch in the cell.
      */
-    void SimulateToCurrentTime();
+    void UpdateDeltaNotch();
 
     /**
-     * Update the current levels of Delta and Notch in the cell.
+     * Overridden AdjustOdeParameters() method, which reads the mean neighbouring
+     * Delta level from CellData just before the ODEs are advanced. This is the only
+     * place it is read, so the ODEs see the same value whether they are advanced by
+     * SimulateToCurrentTime() or by a CellCycleModelOdeBatchSolver.
+     *
+     * @param currentTime the time up to which the system will be solved
      */
-    void UpdateDeltaNotch();
+    void AdjustOdeParameters(double currentTime);
 
     /**
      * @return the current Notch level in this cell.
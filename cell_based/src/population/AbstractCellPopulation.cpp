@@ -45,6 +45,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "PetscTools.hpp"
 #include "SmartPointers.hpp"
 #include "CellAncestor.hpp"
+#include "CellWritersHdf5Writer.hpp"
+#include "SimulationTime.hpp"
 
 // Cell writers
 #include "BoundaryNodeWriter.hpp"
@@ -74,7 +76,8 @@ AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::AbstractCellPopulation( Abstract
       mCells(rCells.begin(), rCells.end()),
       mCentroid(zero_vector<double>(SPACE_DIM)),
       mpCellPropertyRegistry(CellPropertyRegistry::Instance()->TakeOwnership()),
-      mOutputResultsForChasteVisualizer(true)
+      mOutputResultsForChasteVisualizer(true),
+      mUseHdf5Output(false)
 {
     /*
      * To avoid double-counting problems, clear the passed-in cells vector.
@@ -106,7 +109,8 @@ AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::AbstractCellPopulation( Abstract
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::AbstractCellPopulation(AbstractMesh<ELEMENT_DIM, SPACE_DIM>& rMesh)
-    : mrMesh(rMesh)
+    : mrMesh(rMesh),
+      mUseHdf5Output(false)
 {
 }
 
@@ -461,10 +465,13 @@ void AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::UpdateCellProcessLocation()
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::CloseRoundRobinWritersFiles()
 {
-    typedef AbstractCellWriter<ELEMENT_DIM, SPACE_DIM> cell_writer_t;
-    BOOST_FOREACH(boost::shared_ptr<cell_writer_t> p_cell_writer, mCellWriters)
+    if (!mpCellWritersHdf5Writer)
     {
-        p_cell_writer->CloseFile();
+        typedef AbstractCellWriter<ELEMENT_DIM, SPACE_DIM> cell_writer_t;
+        BOOST_FOREACH(boost::shared_ptr<cell_writer_t> p_cell_writer, mCellWriters)
+        {
+            p_cell_writer->CloseFile();
+        }
     }
 
     typedef AbstractCellPopulationWriter<ELEMENT_DIM, SPACE_DIM> pop_writer_t;
@@ -477,10 +484,18 @@ void AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::CloseRoundRobinWritersFiles
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::CloseWritersFiles()
 {
-    typedef AbstractCellWriter<ELEMENT_DIM, SPACE_DIM> cell_writer_t;
-    BOOST_FOREACH(boost::shared_ptr<cell_writer_t> p_cell_writer, mCellWriters)
+    if (mpCellWritersHdf5Writer)
     {
-        p_cell_writer->CloseFile();
+        mpCellWritersHdf5Writer->Close();
+        mpCellWritersHdf5Writer.reset();
+    }
+    else
+    {
+        typedef AbstractCellWriter<ELEMENT_DIM, SPACE_DIM> cell_writer_t;
+        BOOST_FOREACH(boost::shared_ptr<cell_writer_t> p_cell_writer, mCellWriters)
+        {
+            p_cell_writer->CloseFile();
+        }
     }
 
     typedef AbstractCellPopulationWriter<ELEMENT_DIM, SPACE_DIM> pop_writer_t;
@@ -522,11 +537,18 @@ void AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::OpenWritersFiles(OutputFile
         }
     }
 
-    // Open output files for any cell writers
-    typedef AbstractCellWriter<ELEMENT_DIM, SPACE_DIM> cell_writer_t;
-    BOOST_FOREACH(boost::shared_ptr<cell_writer_t> p_cell_writer, mCellWriters)
+    // Open output files for any cell writers, or a single HDF5 file for all of them
+    if (mUseHdf5Output && !mCellWriters.empty())
     {
-        p_cell_writer->OpenOutputFile(rOutputFileHandler);
+        mpCellWritersHdf5Writer.reset(new CellWritersHdf5Writer<ELEMENT_DIM, SPACE_DIM>(rOutputFileHandler, "cell_writers.h5", mCellWriters));
+    }
+    else
+    {
+        typedef AbstractCellWriter<ELEMENT_DIM, SPACE_DIM> cell_writer_t;
+        BOOST_FOREACH(boost::shared_ptr<cell_writer_t> p_cell_writer, mCellWriters)
+        {
+            p_cell_writer->OpenOutputFile(rOutputFileHandler);
+        }
     }
 
     // Open output files and write headers for any population writers
@@ -551,9 +573,12 @@ void AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::OpenRoundRobinWritersFilesF
 {
     typedef AbstractCellWriter<ELEMENT_DIM, SPACE_DIM> cell_writer_t;
     typedef AbstractCellPopulationWriter<ELEMENT_DIM, SPACE_DIM> pop_writer_t;
-    BOOST_FOREACH(boost::shared_ptr<cell_writer_t> p_cell_writer, mCellWriters)
+    if (!mpCellWritersHdf5Writer)
     {
-        p_cell_writer->OpenOutputFileForAppend(rOutputFileHandler);
+        BOOST_FOREACH(boost::shared_ptr<cell_writer_t> p_cell_writer, mCellWriters)
+        {
+            p_cell_writer->OpenOutputFileForAppend(rOutputFileHandler);
+        }
     }
     BOOST_FOREACH(boost::shared_ptr<pop_writer_t> p_pop_writer, mCellPopulationWriters)
     {
@@ -580,9 +605,12 @@ void AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::WriteResultsToFiles(const s
             // The master process writes time stamps
             if (PetscTools::AmMaster())
             {
-                BOOST_FOREACH(boost::shared_ptr<cell_writer_t> p_cell_writer, mCellWriters)
+                if (!mpCellWritersHdf5Writer)
                 {
-                    p_cell_writer->WriteTimeStamp();
+                    BOOST_FOREACH(boost::shared_ptr<cell_writer_t> p_cell_writer, mCellWriters)
+                    {
+                        p_cell_writer->WriteTimeStamp();
+                    }
                 }
                 BOOST_FOREACH(boost::shared_ptr<pop_writer_t> p_pop_writer, mCellPopulationWriters)
                 {
@@ -597,14 +625,20 @@ void AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::WriteResultsToFiles(const s
                 AcceptPopulationWriter(*pop_writer_iter);
             }
 
-            AcceptCellWritersAcrossPopulation();
+            if (!mpCellWritersHdf5Writer && !mCellWriters.empty())
+            {
+                AcceptCellWritersAcrossPopulation();
+            }
 
             // The top-most process adds a newline
             if (PetscTools::AmTopMost())
             {
-                BOOST_FOREACH(boost::shared_ptr<cell_writer_t> p_cell_writer, mCellWriters)
+                if (!mpCellWritersHdf5Writer)
                 {
-                    p_cell_writer->WriteNewline();
+                    BOOST_FOREACH(boost::shared_ptr<cell_writer_t> p_cell_writer, mCellWriters)
+                    {
+                        p_cell_writer->WriteNewline();
+                    }
                 }
                 BOOST_FOREACH(boost::shared_ptr<pop_writer_t> p_pop_writer, mCellPopulationWriters)
                 {
@@ -615,6 +649,13 @@ void AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::WriteResultsToFiles(const s
         }
         PetscTools::EndRoundRobin();
 
+        // Outside the round robin, collect the cell writers' data on each process and write them collectively
+        if (mpCellWritersHdf5Writer)
+        {
+            AcceptCellWritersAcrossPopulation();
+            mpCellWritersHdf5Writer->WriteRows(SimulationTime::Instance()->GetTime());
+        }
+
         // Outside the round robin, deal with population count writers
         typedef AbstractCellPopulationCountWriter<ELEMENT_DIM, SPACE_DIM> count_writer_t;
 
@@ -658,12 +699,25 @@ void AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::AcceptCellWritersAcrossPopu
     for (typename AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::Iterator cell_iter = this->Begin();
          cell_iter != this->End();
          ++cell_iter)
+    {
+        AcceptCellWritersForCell(*cell_iter);
+    }
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::AcceptCellWritersForCell(CellPtr pCell)
+{
+    if (mpCellWritersHdf5Writer)
+    {
+        mpCellWritersHdf5Writer->AddCell(pCell, this);
+    }
+    else
     {
         for (typename std::vector<boost::shared_ptr<AbstractCellWriter<ELEMENT_DIM, SPACE_DIM> > >::iterator cell_writer_iter = mCellWriters.begin();
              cell_writer_iter != mCellWriters.end();
              ++cell_writer_iter)
         {
-            AcceptCellWriter(*cell_writer_iter, *cell_iter);
+            AcceptCellWriter(*cell_writer_iter, pCell);
         }
     }
 }
@@ -758,6 +812,18 @@ void AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::SetOutputResultsForChasteVi
     mOutputResultsForChasteVisualizer = outputResultsForChasteVisualizer;
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::SetUseHdf5Output(bool useHdf5Output)
+{
+    mUseHdf5Output = useHdf5Output;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+bool AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::GetUseHdf5Output()
+{
+    return mUseHdf5Output;
+}
+
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 bool AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>::IsRoomToDivide(CellPtr pCell)
 {
@@ -45,6 +45,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <boost/shared_ptr.hpp>
 
 #include "ChasteSerialization.hpp"
+#include "ChasteSerializationVersion.hpp"
 #include "ClassIsAbstract.hpp"
 
 #include <boost/serialization/vector.hpp>
@@ -62,6 +63,9 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "AbstractCellPopulationWriter.hpp"
 #include "AbstractCellWriter.hpp"
 
+// Forward declaration keeps HDF5 headers out of every file that includes this one
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM> class CellWritersHdf5Writer;
+
 /**
  * An abstract facade class encapsulating a cell population.
  *
@@ -92,6 +96,10 @@ private:
         archive & mCellWriters;
         archive & mCellPopulationWriters;
         archive & mCellPopulationCountWriters;
+        if (version > 0)
+        {
+            archive & mUseHdf5Output;
+        }
     }
 
     /**
@@ -148,6 +156,15 @@ protected:
     /** A list of cell population count writers. */
     std::vector<boost::shared_ptr<AbstractCellPopulationCountWriter<ELEMENT_DIM, SPACE_DIM> > > mCellPopulationCountWriters;
 
+    /**
+     * Whether to write the output of mCellWriters to a single HDF5 file, rather than one text file
+     * per cell writer (defaults to false).
+     */
+    bool mUseHdf5Output;
+
+    /** The HDF5 writer used for the output of mCellWriters when mUseHdf5Output is true (only set while files are open). */
+    boost::shared_ptr<CellWritersHdf5Writer<ELEMENT_DIM, SPACE_DIM> > mpCellWritersHdf5Writer;
+
     /**
      * Check consistency of our internal data structures.
      *
@@ -181,6 +198,14 @@ protected:
      */
     virtual void AcceptCellWritersAcrossPopulation();
 
+    /**
+     * Pass a single cell to every cell writer, or add its row to the HDF5 output
+     * if that is being used. Called for each cell by #AcceptCellWritersAcrossPopulation.
+     *
+     * @param pCell the cell
+     */
+    void AcceptCellWritersForCell(CellPtr pCell);
+
 public:
 
     /**
@@ -721,6 +746,23 @@ public:
      */
     void SetOutputResultsForChasteVisualizer(bool outputResultsForChasteVisualizer);
 
+    /**
+     * Set mUseHdf5Output. If true, the cell writers' data are written collectively to the
+     * HDF5 file cell_writers.h5 instead of to one text file per cell writer. The text files
+     * can be recovered using CellWritersHdf5ToTxtConverter. Population writers and
+     * population count writers still write text files. Must be called before the
+     * simulation opens its output files, which throws if any cell writer does not
+     * support HDF5 output (see AbstractCellWriter::GetNumHdf5Values()).
+     *
+     * @param useHdf5Output the new value of mUseHdf5Output
+     */
+    void SetUseHdf5Output(bool useHdf5Output);
+
+    /**
+     * @return mUseHdf5Output
+     */
+    bool GetUseHdf5Output();
+
     /**
      * @return The width (maximum distance to centroid) of the cell population
      *     in each dimension
@@ -832,6 +874,23 @@ public:
 
 TEMPLATED_CLASS_IS_ABSTRACT_1_UNSIGNED(AbstractCellPopulation)
 
+namespace boost {
+namespace serialization {
+/**
+ * Specify a version number for archive backwards compatibility.
+ *
+ * This is how to do BOOST_CLASS_VERSION(AbstractCellPopulation, 1)
+ * with a templated class.
+ */
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+struct version<AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM> >
+{
+    ///Macro to set the version number of templated archive in known versions of Boost
+    CHASTE_VERSION_CONTENT(1);
+};
+} // namespace serialization
+} // namespace boost
+
 //////////////////////////////////////////////////////////////////////////////
 //         Iterator class implementation - most methods are inlined         //
 //////////////////////////////////////////////////////////////////////////////
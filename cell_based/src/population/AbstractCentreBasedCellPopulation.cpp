@@ -228,13 +228,8 @@ void AbstractCentreBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::AcceptCellWriters
          node_iter != this->rGetMesh().GetNodeIteratorEnd();
          ++node_iter)
     {
-        for (typename std::vector<boost::shared_ptr<AbstractCellWriter<ELEMENT_DIM, SPACE_DIM> > >::iterator cell_writer_iter = this->mCellWriters.begin();
-             cell_writer_iter != this->mCellWriters.end();
-             ++cell_writer_iter)
-        {
-            CellPtr cell_from_node = this->GetCellUsingLocationIndex(node_iter->GetIndex());
-            this->AcceptCellWriter(*cell_writer_iter, cell_from_node);
-        }
+        CellPtr cell_from_node = this->GetCellUsingLocationIndex(node_iter->GetIndex());
+        this->AcceptCellWritersForCell(cell_from_node);
     }
 }
 
@@ -73,7 +73,10 @@ CaBasedCellPopulation<DIM>::CaBasedCellPopulation(PottsMesh<DIM>& rMesh,
                                                         bool deleteMesh,
                                                         bool validate)
     : AbstractOnLatticeCellPopulation<DIM>(rMesh, rCells, locationIndices, deleteMesh),
-      mLatticeCarryingCapacity(latticeCarryingCapacity)
+      mLatticeCarryingCapacity(latticeCarryingCapacity),
+      mUseKineticMonteCarlo(false),
+      mKmcNumLeaves(0),
+      mNumKmcEvents(0)
 {
     mAvailableSpaces = std::vector<unsigned>(this->GetNumNodes(), latticeCarryingCapacity);
     mpCaBasedDivisionRule.reset(new ExclusionCaBasedDivisionRule<DIM>());
@@ -108,7 +111,10 @@ CaBasedCellPopulation<DIM>::CaBasedCellPopulation(PottsMesh<DIM>& rMesh,
 
 template<unsigned DIM>
 CaBasedCellPopulation<DIM>::CaBasedCellPopulation(PottsMesh<DIM>& rMesh)
-    : AbstractOnLatticeCellPopulation<DIM>(rMesh)
+    : AbstractOnLatticeCellPopulation<DIM>(rMesh),
+      mUseKineticMonteCarlo(false),
+      mKmcNumLeaves(0),
+      mNumKmcEvents(0)
 {
 }
 
@@ -269,9 +275,299 @@ unsigned CaBasedCellPopulation<DIM>::RemoveDeadCells()
     return num_removed;
 }
 
+template<unsigned DIM>
+void CaBasedCellPopulation<DIM>::SwitchCellsAtLocations(unsigned nodeIndex, unsigned neighbourIndex)
+{
+    bool is_cell_on_node_index = mAvailableSpaces[nodeIndex] == 0 ? true : false;
+    bool is_cell_on_neighbour_location_index = mAvailableSpaces[neighbourIndex] == 0 ? true : false;
+
+    if (is_cell_on_node_index && is_cell_on_neighbour_location_index)
+    {
+        // Swap the cells associated with the node and the neighbour node
+        CellPtr p_cell = this->GetCellUsingLocationIndex(nodeIndex);
+        CellPtr p_neighbour_cell = this->GetCellUsingLocationIndex(neighbourIndex);
+
+        // Remove the cells from their current location
+        RemoveCellUsingLocationIndex(nodeIndex, p_cell);
+        RemoveCellUsingLocationIndex(neighbourIndex, p_neighbour_cell);
+
+        // Add cells to their new locations
+        AddCellUsingLocationIndex(nodeIndex, p_neighbour_cell);
+        AddCellUsingLocationIndex(neighbourIndex, p_cell);
+    }
+    else if (is_cell_on_node_index && !is_cell_on_neighbour_location_index)
+    {
+        // Move the cell associated with the node to the neighbour node
+        CellPtr p_cell = this->GetCellUsingLocationIndex(nodeIndex);
+        RemoveCellUsingLocationIndex(nodeIndex, p_cell);
+        AddCellUsingLocationIndex(neighbourIndex, p_cell);
+    }
+    else if (!is_cell_on_node_index && is_cell_on_neighbour_location_index)
+    {
+        // Move the cell associated with the neighbour node onto the node
+        CellPtr p_neighbour_cell = this->GetCellUsingLocationIndex(neighbourIndex);
+        RemoveCellUsingLocationIndex(neighbourIndex, p_neighbour_cell);
+        AddCellUsingLocationIndex(nodeIndex, p_neighbour_cell);
+    }
+    else
+    {
+        NEVER_REACHED;
+    }
+}
+
+template<unsigned DIM>
+double CaBasedCellPopulation<DIM>::CalculateKmcEvents(unsigned nodeIndex, std::vector<KmcEvent>* pEvents)
+{
+    double total_rate = 0.0;
+    if (pEvents)
+    {
+        pEvents->clear();
+    }
+
+    std::set<unsigned> neighbouring_node_indices = static_cast<PottsMesh<DIM>& >((this->mrMesh)).GetMooreNeighbouringNodeIndices(nodeIndex);
+    if (neighbouring_node_indices.empty())
+    {
+        return total_rate;
+    }
+
+    // Moves of each cell at this node into available neighbouring sites
+    if (!mUpdateRuleCollection.empty() && mAvailableSpaces[nodeIndex] < mLatticeCarryingCapacity)
+    {
+        std::set<CellPtr> cells = this->GetCellsUsingLocationIndex(nodeIndex);
+        for (std::set<CellPtr>::iterator cell_iter = cells.begin();
+             cell_iter != cells.end();
+             ++cell_iter)
+        {
+            for (std::set<unsigned>::iterator iter = neighbouring_node_indices.begin();
+                 iter != neighbouring_node_indices.end();
+                 ++iter)
+            {
+                if (IsSiteAvailable(*iter, *cell_iter))
+                {
+                    double rate = 0.0;
+                    for (typename std::vector<boost::shared_ptr<AbstractCaUpdateRule<DIM> > >::iterator iterRule = mUpdateRuleCollection.begin();
+                         iterRule != mUpdateRuleCollection.end();
+                         ++iterRule)
+                    {
+                        rate += (*iterRule)->EvaluateProbability(nodeIndex, *iter, *this, 1.0, 1, *cell_iter);
+                    }
+                    if (rate < 0)
+                    {
+                        EXCEPTION("The rate of cellular movement is smaller than zero. Check the parameters of your update rules.");
+                    }
+                    if (rate > 0)
+                    {
+                        total_rate += rate;
+                        if (pEvents)
+                        {
+                            KmcEvent event = {rate, *cell_iter, *iter};
+                            pEvents->push_back(event);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /*
+     * Switches initiated at this node. In the fixed-time-step scheme each node
+     * is visited once per time step and tests one neighbour chosen uniformly at
+     * random, so the rate of switching with each neighbour is the switching
+     * probability per unit time divided by the number of neighbours.
+     */
+    if (!mSwitchingUpdateRuleCollection.empty())
+    {
+        assert(mLatticeCarryingCapacity == 1);
+        double num_neighbours = (double) neighbouring_node_indices.size();
+
+        for (std::set<unsigned>::iterator iter = neighbouring_node_indices.begin();
+             iter != neighbouring_node_indices.end();
+             ++iter)
+        {
+            if (mAvailableSpaces[nodeIndex] == 0 || mAvailableSpaces[*iter] == 0)
+            {
+                double rate = 0.0;
+                for (typename std::vector<boost::shared_ptr<AbstractCaSwitchingUpdateRule<DIM> > >::iterator iterRule = mSwitchingUpdateRuleCollection.begin();
+                     iterRule != mSwitchingUpdateRuleCollection.end();
+                     ++iterRule)
+                {
+                    rate += (*iterRule)->EvaluateSwitchingProbability(nodeIndex, *iter, *this, 1.0, 1);
+                }
+                assert(rate >= 0);
+                rate /= num_neighbours;
+
+                if (rate > 0)
+                {
+                    total_rate += rate;
+                    if (pEvents)
+                    {
+                        KmcEvent event = {rate, CellPtr(), *iter};
+                        pEvents->push_back(event);
+                    }
+                }
+            }
+        }
+    }
+
+    return total_rate;
+}
+
+template<unsigned DIM>
+void CaBasedCellPopulation<DIM>::UpdateKmcPropensity(unsigned nodeIndex)
+{
+    unsigned position = mKmcNumLeaves + nodeIndex;
+    mKmcPropensityTree[position] = CalculateKmcEvents(nodeIndex, NULL);
+
+    // Propagate the change up to the root
+    for (position /= 2; position >= 1; position /= 2)
+    {
+        mKmcPropensityTree[position] = mKmcPropensityTree[2*position] + mKmcPropensityTree[2*position+1];
+    }
+}
+
+template<unsigned DIM>
+void CaBasedCellPopulation<DIM>::InitialiseKineticMonteCarlo()
+{
+    unsigned num_nodes = this->mrMesh.GetNumNodes();
+
+    mKmcNumLeaves = 1;
+    while (mKmcNumLeaves < num_nodes)
+    {
+        mKmcNumLeaves *= 2;
+    }
+    mKmcPropensityTree.assign(2*mKmcNumLeaves, 0.0);
+
+    for (unsigned node_index=0; node_index<num_nodes; node_index++)
+    {
+        mKmcPropensityTree[mKmcNumLeaves + node_index] = CalculateKmcEvents(node_index, NULL);
+    }
+    for (unsigned position=mKmcNumLeaves-1; position>=1; position--)
+    {
+        mKmcPropensityTree[position] = mKmcPropensityTree[2*position] + mKmcPropensityTree[2*position+1];
+    }
+
+    mKmcAvailableSpaces = mAvailableSpaces;
+}
+
+template<unsigned DIM>
+void CaBasedCellPopulation<DIM>::UpdateCellLocationsKineticMonteCarlo(double dt)
+{
+    PottsMesh<DIM>& r_mesh = static_cast<PottsMesh<DIM>& >(this->mrMesh);
+    unsigned num_nodes = r_mesh.GetNumNodes();
+
+    if (mKmcPropensityTree.empty() || mKmcAvailableSpaces.size() != num_nodes)
+    {
+        InitialiseKineticMonteCarlo();
+    }
+    else
+    {
+        /*
+         * Cells may have been born or killed since the last call, so bring the
+         * rates at any node whose occupancy has changed (and at its neighbours)
+         * up to date.
+         */
+        std::set<unsigned> changed_nodes;
+        for (unsigned node_index=0; node_index<num_nodes; node_index++)
+        {
+            if (mAvailableSpaces[node_index] != mKmcAvailableSpaces[node_index])
+            {
+                changed_nodes.insert(node_index);
+                std::set<unsigned> neighbours = r_mesh.GetMooreNeighbouringNodeIndices(node_index);
+                changed_nodes.insert(neighbours.begin(), neighbours.end());
+            }
+        }
+        for (std::set<unsigned>::iterator iter = changed_nodes.begin();
+             iter != changed_nodes.end();
+             ++iter)
+        {
+            UpdateKmcPropensity(*iter);
+        }
+    }
+
+    RandomNumberGenerator* p_gen = RandomNumberGenerator::Instance();
+    std::vector<KmcEvent> events;
+    double time = 0.0;
+
+    while (mKmcPropensityTree[1] > 0.0)
+    {
+        // Draw the waiting time until the next event; as the process is memoryless any overshoot can be discarded
+        time += p_gen->ExponentialRandomDeviate(mKmcPropensityTree[1]);
+        if (time > dt)
+        {
+            break;
+        }
+
+        // Select the node at which the event occurs by descending the sum tree
+        double target_rate = p_gen->ranf()*mKmcPropensityTree[1];
+        unsigned position = 1;
+        while (position < mKmcNumLeaves)
+        {
+            if (target_rate < mKmcPropensityTree[2*position] || mKmcPropensityTree[2*position+1] <= 0.0)
+            {
+                position = 2*position;
+            }
+            else
+            {
+                target_rate -= mKmcPropensityTree[2*position];
+                position = 2*position + 1;
+            }
+        }
+        unsigned node_index = position - mKmcNumLeaves;
+
+        // Select the event at this node
+        double node_rate = CalculateKmcEvents(node_index, &events);
+        if (events.empty())
+        {
+            // The stored rate was out of date (e.g. a rule depends on more than site occupancy)
+            UpdateKmcPropensity(node_index);
+            continue;
+        }
+        double event_rate = p_gen->ranf()*node_rate;
+        unsigned chosen_event = 0;
+        for (double cumulative_rate = events[0].rate;
+             cumulative_rate <= event_rate && chosen_event+1 < events.size();
+             cumulative_rate += events[chosen_event].rate)
+        {
+            chosen_event++;
+        }
+
+        const KmcEvent& r_event = events[chosen_event];
+        if (r_event.pCell)
+        {
+            this->MoveCellInLocationMap(r_event.pCell, node_index, r_event.target);
+        }
+        else
+        {
+            SwitchCellsAtLocations(node_index, r_event.target);
+        }
+        mNumKmcEvents++;
+
+        // Only the two nodes involved and their neighbours can have changed rates
+        std::set<unsigned> affected_nodes = r_mesh.GetMooreNeighbouringNodeIndices(node_index);
+        std::set<unsigned> target_neighbours = r_mesh.GetMooreNeighbouringNodeIndices(r_event.target);
+        affected_nodes.insert(target_neighbours.begin(), target_neighbours.end());
+        affected_nodes.insert(node_index);
+        affected_nodes.insert(r_event.target);
+        for (std::set<unsigned>::iterator iter = affected_nodes.begin();
+             iter != affected_nodes.end();
+             ++iter)
+        {
+            UpdateKmcPropensity(*iter);
+        }
+    }
+
+    mKmcAvailableSpaces = mAvailableSpaces;
+}
+
 template<unsigned DIM>
 void CaBasedCellPopulation<DIM>::UpdateCellLocations(double dt)
 {
+    if (mUseKineticMonteCarlo)
+    {
+        UpdateCellLocationsKineticMonteCarlo(dt);
+        return;
+    }
+
     /*
      * Here we loop over the nodes and calculate the probability of moving
      * and then select the node to move to.
@@ -436,39 +732,7 @@ void CaBasedCellPopulation<DIM>::UpdateCellLocations(double dt)
 
                     if (random_number < probability_of_switch)
                     {
-                        if (is_cell_on_node_index && is_cell_on_neighbour_location_index)
-                        {
-                            // Swap the cells associated with the node and the neighbour node
-                            CellPtr p_cell = this->GetCellUsingLocationIndex(node_index);
-                            CellPtr p_neighbour_cell = this->GetCellUsingLocationIndex(neighbour_location_index);
-
-                            // Remove the cells from their current location
-                            RemoveCellUsingLocationIndex(node_index, p_cell);
-                            RemoveCellUsingLocationIndex(neighbour_location_index, p_neighbour_cell);
-
-                            // Add cells to their new locations
-                            AddCellUsingLocationIndex(node_index, p_neighbour_cell);
-                            AddCellUsingLocationIndex(neighbour_location_index, p_cell);
-                        }
-                        else if (is_cell_on_node_index && !is_cell_on_neighbour_location_index)
-                        {
-                            // Nove the cells associated with the node to the neighbour node
-                            CellPtr p_cell = this->GetCellUsingLocationIndex(node_index);
-                            RemoveCellUsingLocationIndex(node_index, p_cell);
-                            AddCellUsingLocationIndex(neighbour_location_index, p_cell);
-                        }
-                        else if (!is_cell_on_node_index && is_cell_on_neighbour_location_index)
-                        {
-                            // Move the cell associated with the neighbour node onto the node
-                            CellPtr p_neighbour_cell = this->GetCellUsingLocationIndex(neighbour_location_index);
-                            RemoveCellUsingLocationIndex(neighbour_location_index, p_neighbour_cell);
-                            AddCellUsingLocationIndex(node_index, p_neighbour_cell);
-                        }
-                        else
-                        {
-                            NEVER_REACHED;
-                        }
-
+                        SwitchCellsAtLocations(node_index, neighbour_location_index);
                     }
                 }
             }
@@ -476,6 +740,25 @@ void CaBasedCellPopulation<DIM>::UpdateCellLocations(double dt)
     }
 }
 
+template<unsigned DIM>
+void CaBasedCellPopulation<DIM>::SetUseKineticMonteCarlo(bool useKineticMonteCarlo)
+{
+    mUseKineticMonteCarlo = useKineticMonteCarlo;
+    mKmcPropensityTree.clear();
+}
+
+template<unsigned DIM>
+bool CaBasedCellPopulation<DIM>::GetUseKineticMonteCarlo() const
+{
+    return mUseKineticMonteCarlo;
+}
+
+template<unsigned DIM>
+unsigned CaBasedCellPopulation<DIM>::GetNumKineticMonteCarloEvents() const
+{
+    return mNumKmcEvents;
+}
+
 template<unsigned DIM>
 bool CaBasedCellPopulation<DIM>::IsCellAssociatedWithADeletedLocation(CellPtr pCell)
 {
@@ -537,12 +820,14 @@ template<unsigned DIM>
 void CaBasedCellPopulation<DIM>::AddUpdateRule(boost::shared_ptr<AbstractCaUpdateRule<DIM> > pUpdateRule)
 {
     mUpdateRuleCollection.push_back(pUpdateRule);
+    mKmcPropensityTree.clear();
 }
 
 template<unsigned DIM>
 void CaBasedCellPopulation<DIM>::RemoveAllUpdateRules()
 {
     mUpdateRuleCollection.clear();
+    mKmcPropensityTree.clear();
 }
 
 template<unsigned DIM>
@@ -555,12 +840,14 @@ template<unsigned DIM>
 void CaBasedCellPopulation<DIM>::AddSwitchingUpdateRule(boost::shared_ptr<AbstractCaSwitchingUpdateRule<DIM> > pUpdateRule)
 {
     mSwitchingUpdateRuleCollection.push_back(pUpdateRule);
+    mKmcPropensityTree.clear();
 }
 
 template<unsigned DIM>
 void CaBasedCellPopulation<DIM>::RemoveAllSwitchingUpdateRules()
 {
     mSwitchingUpdateRuleCollection.clear();
+    mKmcPropensityTree.clear();
 }
 
 template<unsigned DIM>
@@ -91,6 +91,44 @@ private:
      * This is a specialisation for Ca models. */
     boost::shared_ptr<AbstractCaBasedDivisionRule<DIM> > mpCaBasedDivisionRule;
 
+    /**
+     * Whether to update cell locations using the event-driven kinetic Monte
+     * Carlo (Gillespie) scheme rather than the fixed-time-step sweeps.
+     * Defaults to false.
+     */
+    bool mUseKineticMonteCarlo;
+
+    /**
+     * Binary sum tree of the total event rate at each node, used by the
+     * kinetic Monte Carlo scheme. The leaf for node i is stored at
+     * mKmcNumLeaves + i and each internal entry holds the sum of its two
+     * children, so entry 1 holds the total rate over the lattice.
+     */
+    std::vector<double> mKmcPropensityTree;
+
+    /** Number of leaves in mKmcPropensityTree (a power of two). */
+    unsigned mKmcNumLeaves;
+
+    /**
+     * Copy of mAvailableSpaces taken when the propensities were last
+     * brought up to date, used to detect births and deaths between calls.
+     */
+    std::vector<unsigned> mKmcAvailableSpaces;
+
+    /** The number of kinetic Monte Carlo events executed so far. */
+    unsigned mNumKmcEvents;
+
+    /** A single event (move or switch) that may occur at a node in the kinetic Monte Carlo scheme. */
+    struct KmcEvent
+    {
+        /** The rate of the event. */
+        double rate;
+        /** The cell to move to the target node, or an empty pointer if this is a switch. */
+        CellPtr pCell;
+        /** The index of the neighbouring node involved in the event. */
+        unsigned target;
+    };
+
     /**
      * Set the empty sites by taking in a set of which nodes indices are empty sites.
      *
@@ -98,6 +136,50 @@ private:
      */
     void SetEmptySites(const std::set<unsigned>& rEmptySiteIndices);
 
+    /**
+     * Swap the occupants of two neighbouring nodes (or move a cell to an empty
+     * node) as dictated by the switching update rules. At least one of the
+     * nodes must be occupied. Only used when mLatticeCarryingCapacity is 1.
+     *
+     * @param nodeIndex the index of the first node
+     * @param neighbourIndex the index of the second node
+     */
+    void SwitchCellsAtLocations(unsigned nodeIndex, unsigned neighbourIndex);
+
+    /**
+     * Compute the rates of all events initiated at a given node, as used by
+     * the kinetic Monte Carlo scheme. Rates are obtained by evaluating the
+     * update rules with a unit time step, so the rules' probabilities must be
+     * linear in the time step (as is the case for all the built-in rules).
+     *
+     * @param nodeIndex the index of the node
+     * @param pEvents if not NULL, filled with the individual events
+     * @return the total rate of events at this node
+     */
+    double CalculateKmcEvents(unsigned nodeIndex, std::vector<KmcEvent>* pEvents);
+
+    /**
+     * Recompute the total event rate at a given node and update the sum tree.
+     *
+     * @param nodeIndex the index of the node
+     */
+    void UpdateKmcPropensity(unsigned nodeIndex);
+
+    /**
+     * Build the sum tree of event rates over the whole lattice.
+     */
+    void InitialiseKineticMonteCarlo();
+
+    /**
+     * Update cell locations using the kinetic Monte Carlo scheme. Events are
+     * executed one at a time, with exponentially distributed waiting times,
+     * until the time step is exhausted; after each event only the rates of the
+     * affected nodes and their neighbours are recomputed.
+     *
+     * @param dt time step
+     */
+    void UpdateCellLocationsKineticMonteCarlo(double dt);
+
     friend class boost::serialization::access;
     /**
      * Serialize the object and its member variables.
@@ -419,6 +501,33 @@ public:
      */
     const std::vector<boost::shared_ptr<AbstractCaSwitchingUpdateRule<DIM> > >& rGetSwitchingUpdateRuleCollection() const;
 
+    /**
+     * Set whether to update cell locations using the event-driven kinetic Monte
+     * Carlo scheme. In this mode, rather than visiting every cell and node each
+     * time step, the population keeps the total rate of moves and switches at
+     * each node in a sum tree and executes events one at a time, so the cost of
+     * a time step scales with the number of events rather than with the size
+     * of the lattice. This is most useful for sparse or slowly moving populations.
+     *
+     * The update rules are evaluated with a unit time step to obtain rates, so
+     * their probabilities must be linear in the time step. Rates are only
+     * recomputed when the occupancy of a node or its neighbours changes, so the
+     * rules should depend only on which sites are occupied.
+     *
+     * @param useKineticMonteCarlo whether to use the kinetic Monte Carlo scheme (defaults to true)
+     */
+    void SetUseKineticMonteCarlo(bool useKineticMonteCarlo=true);
+
+    /**
+     * @return whether cell locations are updated using the kinetic Monte Carlo scheme
+     */
+    bool GetUseKineticMonteCarlo() const;
+
+    /**
+     * @return the number of kinetic Monte Carlo events executed so far
+     */
+    unsigned GetNumKineticMonteCarloEvents() const;
+
     /**
      * Outputs CellPopulation parameters to file
      *
@@ -33,6 +33,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 */
 
+#include <algorithm>
 #include "MeshBasedCellPopulation.hpp"
 #include "TrianglesMeshWriter.hpp"
 #include "VtkMeshWriter.hpp"
@@ -71,7 +72,9 @@ MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::MeshBasedCellPopulation(MutableM
       mAreaBasedDampingConstantParameter(0.1),
       mWriteVtkAsPoints(false),
       mOutputMeshInVtk(false),
-      mHasVariableRestLength(false)
+      mHasVariableRestLength(false),
+      mVoronoiTessellationIsOutOfDate(false),
+      mNumVoronoiCellsUpdated(0)
 {
     mpMutableMesh = static_cast<MutableMesh<ELEMENT_DIM,SPACE_DIM>* >(&(this->mrMesh));
 
@@ -98,6 +101,8 @@ MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::MeshBasedCellPopulation(MutableM
     mpMutableMesh = static_cast<MutableMesh<ELEMENT_DIM,SPACE_DIM>* >(&(this->mrMesh));
     mpVoronoiTessellation = NULL;
     mDeleteMesh = true;
+    mVoronoiTessellationIsOutOfDate = false;
+    mNumVoronoiCellsUpdated = 0;
 }
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
@@ -441,7 +446,20 @@ void MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::TessellateIfNeeded()
             this-> template HasWriter<CellPopulationAreaWriter>() ||
             this-> template HasWriter<CellVolumesWriter>())
         {
-            CreateVoronoiTessellation();
+            if (UseVoronoiGeometryCache())
+            {
+                /*
+                 * Only update the areas and edge lengths of those Voronoi elements whose Delaunay
+                 * neighbourhood has changed. The full tessellation is only needed by the writers,
+                 * so is recreated when results are next written to file.
+                 */
+                UpdateVoronoiGeometryCache();
+                mVoronoiTessellationIsOutOfDate = true;
+            }
+            else
+            {
+                CreateVoronoiTessellation();
+            }
         }
         CellBasedEventHandler::EndEvent(CellBasedEventHandler::TESSELLATION);
     }
@@ -574,6 +592,11 @@ void MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::WriteResultsToFiles(const s
         TessellateIfNeeded(); // Update isn't run on time-step zero
     }
 
+    if (mVoronoiTessellationIsOutOfDate)
+    {
+        CreateVoronoiTessellation();
+    }
+
     AbstractCentreBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::WriteResultsToFiles(rDirectory);
 }
 
@@ -768,7 +791,20 @@ double MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::GetVolumeOfCell(CellPtr p
 {
     double cell_volume = 0;
 
-    if (ELEMENT_DIM == SPACE_DIM)
+    if (ELEMENT_DIM == SPACE_DIM && UseVoronoiGeometryCache())
+    {
+        // Ensure that the flat arrays of Voronoi geometry have been filled in
+        if (mVoronoiCellVolumes.empty())
+        {
+            UpdateVoronoiGeometryCache();
+            mVoronoiTessellationIsOutOfDate = true;
+        }
+
+        unsigned node_index = this->GetLocationIndexUsingCell(pCell);
+        assert(node_index < mVoronoiCellVolumes.size());
+        cell_volume = mVoronoiCellVolumes[node_index];
+    }
+    else if (ELEMENT_DIM == SPACE_DIM)
     {
         // Ensure that the Voronoi tessellation exists
         if (mpVoronoiTessellation == NULL)
@@ -946,6 +982,7 @@ template<>
 void MeshBasedCellPopulation<2>::CreateVoronoiTessellation()
 {
     delete mpVoronoiTessellation;
+    mVoronoiTessellationIsOutOfDate = false;
 
     // Check if the mesh associated with this cell population is periodic
     bool is_mesh_periodic = false;
@@ -957,6 +994,9 @@ void MeshBasedCellPopulation<2>::CreateVoronoiTessellation()
     else
     {
         mpVoronoiTessellation = new VertexMesh<2, 2>(static_cast<MutableMesh<2, 2> &>((this->mrMesh)), is_mesh_periodic);
+
+        // Keep the flat arrays of Voronoi geometry consistent with the new tessellation
+        UpdateVoronoiGeometryCache();
     }
 }
 /**
@@ -1017,13 +1057,274 @@ void MeshBasedCellPopulation<1, 3>::CreateVoronoiTessellation()
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 VertexMesh<ELEMENT_DIM,SPACE_DIM>* MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::GetVoronoiTessellation()
 {
+    if (mVoronoiTessellationIsOutOfDate)
+    {
+        CreateVoronoiTessellation();
+    }
     assert(mpVoronoiTessellation!=NULL);
     return mpVoronoiTessellation;
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+const std::vector<double>& MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::rGetVoronoiCellVolumes() const
+{
+    return mVoronoiCellVolumes;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+const std::vector<double>& MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::rGetVoronoiCellSurfaceAreas() const
+{
+    return mVoronoiCellSurfaceAreas;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+unsigned MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::GetNumVoronoiCellsUpdated() const
+{
+    return mNumVoronoiCellsUpdated;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+bool MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::UseVoronoiGeometryCache()
+{
+    return (ELEMENT_DIM == 2) && (SPACE_DIM == 2) && (dynamic_cast<Cylindrical2dMesh*>(&(this->mrMesh)) == NULL);
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::ClearVoronoiGeometryCache()
+{
+    mVoronoiCacheElementNodes.clear();
+    mVoronoiCacheNodeLocations.clear();
+    mVoronoiCircumcentres.clear();
+    mVoronoiCellVolumes.clear();
+    mVoronoiCellSurfaceAreas.clear();
+    mVoronoiEdgeOffsets.clear();
+    mVoronoiEdgeNeighbours.clear();
+    mVoronoiEdgeLengths.clear();
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::UpdateVoronoiGeometryCache()
+{
+    assert(UseVoronoiGeometryCache());
+
+    MutableMesh<ELEMENT_DIM,SPACE_DIM>& r_mesh = rGetMesh();
+    unsigned num_nodes = r_mesh.GetNumAllNodes();
+    unsigned num_elements = r_mesh.GetNumAllElements();
+    unsigned old_num_nodes = mVoronoiCacheNodeLocations.size();
+    unsigned old_num_elements = mVoronoiCircumcentres.size();
+
+    // Record which nodes have moved, or are new, since the last update
+    std::vector<bool> node_is_affected(num_nodes, false);
+    for (unsigned node_index=0; node_index<num_nodes; node_index++)
+    {
+        const c_vector<double, SPACE_DIM>& r_location = r_mesh.GetNode(node_index)->rGetLocation();
+        if (node_index >= old_num_nodes)
+        {
+            node_is_affected[node_index] = true;
+            mVoronoiCacheNodeLocations.push_back(r_location);
+        }
+        else if (norm_inf(r_location - mVoronoiCacheNodeLocations[node_index]) != 0.0)
+        {
+            node_is_affected[node_index] = true;
+            mVoronoiCacheNodeLocations[node_index] = r_location;
+        }
+    }
+    mVoronoiCacheNodeLocations.resize(num_nodes);
+
+    // Find the elements that have been altered by a remesh or contain a node that has moved
+    bool connectivity_has_changed = (num_elements != old_num_elements) || (num_nodes != old_num_nodes);
+    for (unsigned i=(ELEMENT_DIM+1)*num_elements; i<mVoronoiCacheElementNodes.size(); i++)
+    {
+        // Nodes of elements that no longer exist have lost a Voronoi vertex
+        if (mVoronoiCacheElementNodes[i] < num_nodes)
+        {
+            node_is_affected[mVoronoiCacheElementNodes[i]] = true;
+        }
+    }
+    mVoronoiCacheElementNodes.resize((ELEMENT_DIM+1)*num_elements, UNSIGNED_UNSET);
+    mVoronoiCircumcentres.resize(num_elements, zero_vector<double>(SPACE_DIM));
+
+    c_matrix<double, SPACE_DIM, ELEMENT_DIM> jacobian;
+    c_matrix<double, ELEMENT_DIM, SPACE_DIM> inverse_jacobian;
+    double jacobian_det;
+
+    for (unsigned elem_index=0; elem_index<num_elements; elem_index++)
+    {
+        Element<ELEMENT_DIM,SPACE_DIM>* p_element = r_mesh.GetElement(elem_index);
+        bool element_is_dirty = (elem_index >= old_num_elements);
+
+        for (unsigned local_index=0; local_index<ELEMENT_DIM+1; local_index++)
+        {
+            unsigned& r_cached_node = mVoronoiCacheElementNodes[(ELEMENT_DIM+1)*elem_index + local_index];
+            unsigned node_index = p_element->IsDeleted() ? UNSIGNED_UNSET : p_element->GetNodeGlobalIndex(local_index);
+
+            if (r_cached_node != node_index)
+            {
+                // The Voronoi elements of both the old and the new node lose or gain a vertex
+                if (r_cached_node < num_nodes)
+                {
+                    node_is_affected[r_cached_node] = true;
+                }
+                r_cached_node = node_index;
+                element_is_dirty = true;
+                connectivity_has_changed = true;
+            }
+            if (node_index != UNSIGNED_UNSET && node_is_affected[node_index])
+            {
+                element_is_dirty = true;
+            }
+        }
+
+        if (element_is_dirty && !p_element->IsDeleted())
+        {
+            r_mesh.GetInverseJacobianForElement(elem_index, jacobian, jacobian_det, inverse_jacobian);
+            c_vector<double, SPACE_DIM+1> circumsphere = p_element->CalculateCircumsphere(jacobian, inverse_jacobian);
+            for (unsigned j=0; j<SPACE_DIM; j++)
+            {
+                mVoronoiCircumcentres[elem_index](j) = circumsphere(j);
+            }
+
+            // Every node of a dirty element has a Voronoi element that needs recomputing
+            for (unsigned local_index=0; local_index<ELEMENT_DIM+1; local_index++)
+            {
+                node_is_affected[p_element->GetNodeGlobalIndex(local_index)] = true;
+            }
+        }
+    }
+
+    // If the connectivity has changed, rebuild the offsets and neighbours of the Voronoi edges
+    std::vector<unsigned> old_edge_offsets;
+    std::vector<double> old_edge_lengths;
+    if (connectivity_has_changed || mVoronoiEdgeOffsets.size() != num_nodes+1)
+    {
+        old_edge_offsets.swap(mVoronoiEdgeOffsets);
+        old_edge_lengths.swap(mVoronoiEdgeLengths);
+        mVoronoiEdgeNeighbours.clear();
+        mVoronoiEdgeOffsets.reserve(num_nodes+1);
+        mVoronoiEdgeOffsets.push_back(0);
+
+        for (unsigned node_index=0; node_index<num_nodes; node_index++)
+        {
+            std::set<unsigned> neighbours;
+            Node<SPACE_DIM>* p_node = r_mesh.GetNode(node_index);
+            for (typename Node<SPACE_DIM>::ContainingElementIterator elem_iter = p_node->ContainingElementsBegin();
+                 elem_iter != p_node->ContainingElementsEnd();
+                 ++elem_iter)
+            {
+                Element<ELEMENT_DIM,SPACE_DIM>* p_element = r_mesh.GetElement(*elem_iter);
+                for (unsigned local_index=0; local_index<ELEMENT_DIM+1; local_index++)
+                {
+                    unsigned neighbour_index = p_element->GetNodeGlobalIndex(local_index);
+                    if (neighbour_index != node_index)
+                    {
+                        neighbours.insert(neighbour_index);
+                    }
+                }
+            }
+            mVoronoiEdgeNeighbours.insert(mVoronoiEdgeNeighbours.end(), neighbours.begin(), neighbours.end());
+            mVoronoiEdgeOffsets.push_back(mVoronoiEdgeNeighbours.size());
+        }
+        mVoronoiEdgeLengths.resize(mVoronoiEdgeNeighbours.size(), DBL_MAX);
+
+        // Unaffected nodes keep the same neighbours, so their edge lengths may be copied across
+        for (unsigned node_index=0; node_index<std::min(num_nodes, old_num_nodes); node_index++)
+        {
+            if (!node_is_affected[node_index] && node_index+1 < old_edge_offsets.size())
+            {
+                assert(old_edge_offsets[node_index+1] - old_edge_offsets[node_index] == mVoronoiEdgeOffsets[node_index+1] - mVoronoiEdgeOffsets[node_index]);
+                std::copy(old_edge_lengths.begin() + old_edge_offsets[node_index],
+                          old_edge_lengths.begin() + old_edge_offsets[node_index+1],
+                          mVoronoiEdgeLengths.begin() + mVoronoiEdgeOffsets[node_index]);
+            }
+        }
+    }
+
+    // Recompute the geometry of the Voronoi element of each affected node
+    mVoronoiCellVolumes.resize(num_nodes, 0.0);
+    mVoronoiCellSurfaceAreas.resize(num_nodes, 0.0);
+    mNumVoronoiCellsUpdated = 0;
+
+    for (unsigned node_index=0; node_index<num_nodes; node_index++)
+    {
+        if (!node_is_affected[node_index])
+        {
+            continue;
+        }
+        mNumVoronoiCellsUpdated++;
+
+        Node<SPACE_DIM>* p_node = r_mesh.GetNode(node_index);
+        const c_vector<double, SPACE_DIM>& r_node_location = p_node->rGetLocation();
+
+        // Order the vertices of this Voronoi element anticlockwise, as in the VertexMesh constructor
+        std::vector<std::pair<double, unsigned> > angle_index_list;
+        for (typename Node<SPACE_DIM>::ContainingElementIterator elem_iter = p_node->ContainingElementsBegin();
+             elem_iter != p_node->ContainingElementsEnd();
+             ++elem_iter)
+        {
+            c_vector<double, SPACE_DIM> centre_to_vertex = r_mesh.GetVectorFromAtoB(r_node_location, mVoronoiCircumcentres[*elem_iter]);
+            angle_index_list.push_back(std::pair<double, unsigned>(atan2(centre_to_vertex(1), centre_to_vertex(0)), *elem_iter));
+        }
+        std::sort(angle_index_list.begin(), angle_index_list.end());
+
+        // Compute the area and perimeter of the Voronoi element as in VertexMesh::GetVolumeOfElement() and GetSurfaceAreaOfElement()
+        double volume = 0.0;
+        double surface_area = 0.0;
+        unsigned num_vertices = angle_index_list.size();
+        if (num_vertices > 0)
+        {
+            const c_vector<double, SPACE_DIM>& r_first_vertex = mVoronoiCircumcentres[angle_index_list[0].second];
+            c_vector<double, SPACE_DIM> pos_1 = zero_vector<double>(SPACE_DIM);
+            for (unsigned local_index=0; local_index<num_vertices; local_index++)
+            {
+                const c_vector<double, SPACE_DIM>& r_this_vertex = mVoronoiCircumcentres[angle_index_list[local_index].second];
+                const c_vector<double, SPACE_DIM>& r_next_vertex = mVoronoiCircumcentres[angle_index_list[(local_index+1)%num_vertices].second];
+                c_vector<double, SPACE_DIM> pos_2 = r_mesh.GetVectorFromAtoB(r_first_vertex, r_next_vertex);
+
+                volume += 0.5*(pos_1[0]*pos_2[1] - pos_2[0]*pos_1[1]);
+                surface_area += norm_2(r_mesh.GetVectorFromAtoB(r_this_vertex, r_next_vertex));
+                pos_1 = pos_2;
+            }
+        }
+        mVoronoiCellVolumes[node_index] = volume;
+        mVoronoiCellSurfaceAreas[node_index] = surface_area;
+
+        // Compute the length of each Voronoi edge, which joins the circumcentres of the two elements sharing the Delaunay edge
+        for (unsigned edge_index=mVoronoiEdgeOffsets[node_index]; edge_index<mVoronoiEdgeOffsets[node_index+1]; edge_index++)
+        {
+            unsigned neighbour_index = mVoronoiEdgeNeighbours[edge_index];
+            std::vector<unsigned> shared_elements;
+            for (typename Node<SPACE_DIM>::ContainingElementIterator elem_iter = p_node->ContainingElementsBegin();
+                 elem_iter != p_node->ContainingElementsEnd();
+                 ++elem_iter)
+            {
+                if (r_mesh.GetNode(neighbour_index)->rGetContainingElementIndices().count(*elem_iter) != 0)
+                {
+                    shared_elements.push_back(*elem_iter);
+                }
+            }
+
+            if (shared_elements.size() == 2)
+            {
+                mVoronoiEdgeLengths[edge_index] = norm_2(r_mesh.GetVectorFromAtoB(mVoronoiCircumcentres[shared_elements[0]],
+                                                                                  mVoronoiCircumcentres[shared_elements[1]]));
+            }
+            else
+            {
+                // This edge is on the boundary of the mesh, so the Voronoi edge is unbounded
+                mVoronoiEdgeLengths[edge_index] = DBL_MAX;
+            }
+        }
+    }
+}
+
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 double MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::GetVolumeOfVoronoiElement(unsigned index)
 {
+    if (index < mVoronoiCellVolumes.size())
+    {
+        return mVoronoiCellVolumes[index];
+    }
+
     unsigned element_index = mpVoronoiTessellation->GetVoronoiElementIndexCorrespondingToDelaunayNodeIndex(index);
     double volume = mpVoronoiTessellation->GetVolumeOfElement(element_index);
     return volume;
@@ -1032,6 +1333,11 @@ double MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::GetVolumeOfVoronoiElement
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 double MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::GetSurfaceAreaOfVoronoiElement(unsigned index)
 {
+    if (index < mVoronoiCellSurfaceAreas.size())
+    {
+        return mVoronoiCellSurfaceAreas[index];
+    }
+
     unsigned element_index = mpVoronoiTessellation->GetVoronoiElementIndexCorrespondingToDelaunayNodeIndex(index);
     double surface_area = mpVoronoiTessellation->GetSurfaceAreaOfElement(element_index);
     return surface_area;
@@ -1040,6 +1346,20 @@ double MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::GetSurfaceAreaOfVoronoiEl
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 double MeshBasedCellPopulation<ELEMENT_DIM,SPACE_DIM>::GetVoronoiEdgeLength(unsigned index1, unsigned index2)
 {
+    if (index1+1 < mVoronoiEdgeOffsets.size())
+    {
+        // Look up the edge in the flat arrays of Voronoi geometry
+        std::vector<unsigned>::const_iterator begin = mVoronoiEdgeNeighbours.begin() + mVoronoiEdgeOffsets[index1];
+        std::vector<unsigned>::const_iterator end = mVoronoiEdgeNeighbours.begin() + mVoronoiEdgeOffsets[index1+1];
+        std::vector<unsigned>::const_iterator iter = std::lower_bound(begin, end, index2);
+
+        if (iter != end && *iter == index2 && mVoronoiEdgeLengths[iter - mVoronoiEdgeNeighbours.begin()] != DBL_MAX)
+        {
+            return mVoronoiEdgeLengths[iter - mVoronoiEdgeNeighbours.begin()];
+        }
+        EXCEPTION("Spring iterator tried to calculate interaction between degenerate cells on the boundary of the mesh.  Have you set ghost layers correctly?");
+    }
+
     unsigned element_index1 = mpVoronoiTessellation->GetVoronoiElementIndexCorrespondingToDelaunayNodeIndex(index1);
     unsigned element_index2 = mpVoronoiTessellation->GetVoronoiElementIndexCorrespondingToDelaunayNodeIndex(index2);
     try
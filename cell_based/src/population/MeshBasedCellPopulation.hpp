@@ -82,6 +82,7 @@ private:
          */
         delete mpVoronoiTessellation;
         mpVoronoiTessellation = NULL;
+        ClearVoronoiGeometryCache();
 
         archive & mSpringRestLengths;
         archive & mUseAreaBasedDampingConstant;
@@ -145,8 +146,69 @@ protected:
     /** Node pairs for force calculations. */
     std::vector< std::pair<Node<SPACE_DIM>*, Node<SPACE_DIM>* > > mNodePairs;
 
+    /**
+     * Whether mpVoronoiTessellation is older than the flat arrays of Voronoi geometry
+     * below, and so must be recreated before it is next accessed. This is the case
+     * when TessellateIfNeeded() has only updated the flat arrays.
+     */
+    bool mVoronoiTessellationIsOutOfDate;
+
+    /**
+     * The node indices of each element of mrMesh at the last call to UpdateVoronoiGeometryCache(),
+     * stored contiguously with ELEMENT_DIM+1 entries per element (UNSIGNED_UNSET for deleted elements).
+     */
+    std::vector<unsigned> mVoronoiCacheElementNodes;
+
+    /** The location of each node of mrMesh at the last call to UpdateVoronoiGeometryCache(). */
+    std::vector<c_vector<double, SPACE_DIM> > mVoronoiCacheNodeLocations;
+
+    /** The circumcentre of each element of mrMesh, i.e. the vertices of the Voronoi tessellation. */
+    std::vector<c_vector<double, SPACE_DIM> > mVoronoiCircumcentres;
+
+    /** The area of the Voronoi element associated with each node of mrMesh, indexed by node. */
+    std::vector<double> mVoronoiCellVolumes;
+
+    /** The perimeter of the Voronoi element associated with each node of mrMesh, indexed by node. */
+    std::vector<double> mVoronoiCellSurfaceAreas;
+
+    /**
+     * Offsets into mVoronoiEdgeNeighbours and mVoronoiEdgeLengths: the Voronoi edges of the
+     * element associated with node i are stored in entries mVoronoiEdgeOffsets[i] to
+     * mVoronoiEdgeOffsets[i+1]-1.
+     */
+    std::vector<unsigned> mVoronoiEdgeOffsets;
+
+    /** The Delaunay neighbour across each Voronoi edge, sorted by index for each node. */
+    std::vector<unsigned> mVoronoiEdgeNeighbours;
+
+    /** The length of each Voronoi edge, or DBL_MAX if the edge is on the boundary of the mesh and so unbounded. */
+    std::vector<double> mVoronoiEdgeLengths;
+
+    /** The number of Voronoi elements whose geometry was recomputed at the last call to UpdateVoronoiGeometryCache(). */
+    unsigned mNumVoronoiCellsUpdated;
+
 #undef COVERAGE_IGNORE // Avoid prototypes being treated as code by gcov
 
+    /**
+     * @return whether the flat arrays of Voronoi geometry may be used in place of
+     * mpVoronoiTessellation. This is currently the case for 2D meshes that are not
+     * periodic.
+     */
+    bool UseVoronoiGeometryCache();
+
+    /**
+     * Update the flat arrays of Voronoi geometry (element areas, perimeters and edge lengths)
+     * from mrMesh. Only those Voronoi elements whose Delaunay neighbourhood has changed since
+     * the last call, either because a containing element has been altered by a remesh or
+     * because one of its nodes has moved, are recomputed.
+     */
+    void UpdateVoronoiGeometryCache();
+
+    /**
+     * Empty the flat arrays of Voronoi geometry, so that they are rebuilt in full on the next update.
+     */
+    void ClearVoronoiGeometryCache();
+
     /**
      * Update mIsGhostNode if required by a remesh.
      *
@@ -371,10 +433,30 @@ public:
     void CreateVoronoiTessellation();
 
     /**
-     * @return a reference to mpVoronoiTessellation.
+     * @return a reference to mpVoronoiTessellation. If only the flat arrays of Voronoi
+     * geometry have been kept up to date, the tessellation is recreated first.
      */
     VertexMesh<ELEMENT_DIM, SPACE_DIM>* GetVoronoiTessellation();
 
+    /**
+     * @return the area of the Voronoi element associated with each node of the mesh, indexed
+     * by node. This is only filled in for 2D non-periodic meshes, once the tessellation has been
+     * created or TessellateIfNeeded() has been called.
+     */
+    const std::vector<double>& rGetVoronoiCellVolumes() const;
+
+    /**
+     * @return the perimeter of the Voronoi element associated with each node of the mesh, indexed
+     * by node. See rGetVoronoiCellVolumes().
+     */
+    const std::vector<double>& rGetVoronoiCellSurfaceAreas() const;
+
+    /**
+     * @return the number of Voronoi elements whose geometry was recomputed the last time the flat
+     * arrays of Voronoi geometry were updated.
+     */
+    unsigned GetNumVoronoiCellsUpdated() const;
+
     /**
      * @return the volume (or area in 2D, or length in 1D) of the element of mpVoronoiTessellation associated with
      * the node with this global index in the Delaunay mesh.
@@ -264,13 +264,8 @@ void MeshBasedCellPopulationWithGhostNodes<DIM>::AcceptCellWritersAcrossPopulati
         // If it isn't a ghost node then there might be cell writers attached
         if (! this->IsGhostNode(node_iter->GetIndex()))
         {
-            for (typename std::vector<boost::shared_ptr<AbstractCellWriter<DIM, DIM> > >::iterator cell_writer_iter = this->mCellWriters.begin();
-                 cell_writer_iter != this->mCellWriters.end();
-                 ++cell_writer_iter)
-            {
-                CellPtr cell_from_node = this->GetCellUsingLocationIndex(node_iter->GetIndex());
-                this->AcceptCellWriter(*cell_writer_iter, cell_from_node);
-            }
+            CellPtr cell_from_node = this->GetCellUsingLocationIndex(node_iter->GetIndex());
+            this->AcceptCellWritersForCell(cell_from_node);
         }
     }
 }
@@ -34,6 +34,10 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include "NodeBasedCellPopulation.hpp"
+
+#include <algorithm>
+#include <boost/functional/hash.hpp>
+
 #include "MathsCustomFunctions.hpp"
 #include "VtkMeshWriter.hpp"
 
@@ -55,7 +59,13 @@ NodeBasedCellPopulation<DIM>::NodeBasedCellPopulation(NodesOnlyMesh<DIM>& rMesh,
       mDeleteMesh(deleteMesh),
       mUseVariableRadii(false),
       mLoadBalanceMesh(false),
-      mLoadBalanceFrequency(100)
+      mLoadBalanceFrequency(100),
+      mUseVerletLists(false),
+      mVerletSkin(0.2*rMesh.GetMaximumInteractionDistance()),
+      mTuneVerletSkin(false),
+      mVerletListIsValid(false),
+      mUpdatesSinceVerletRebuild(0),
+      mNodeReorderingFrequency(0)
 {
     mpNodesOnlyMesh = static_cast<NodesOnlyMesh<DIM>* >(&(this->mrMesh));
 
@@ -71,7 +81,13 @@ NodeBasedCellPopulation<DIM>::NodeBasedCellPopulation(NodesOnlyMesh<DIM>& rMesh)
       mDeleteMesh(true),
       mUseVariableRadii(false), // will be set by serialize() method
       mLoadBalanceMesh(false),
-      mLoadBalanceFrequency(100)
+      mLoadBalanceFrequency(100),
+      mUseVerletLists(false),
+      mVerletSkin(0.2*rMesh.GetMaximumInteractionDistance()),
+      mTuneVerletSkin(false),
+      mVerletListIsValid(false),
+      mUpdatesSinceVerletRebuild(0),
+      mNodeReorderingFrequency(0)
 {
     mpNodesOnlyMesh = static_cast<NodesOnlyMesh<DIM>* >(&(this->mrMesh));
 }
@@ -102,6 +118,9 @@ template<unsigned DIM>
 void NodeBasedCellPopulation<DIM>::Clear()
 {
     mNodePairs.clear();
+    mVerletListIsValid = false;
+    mVerletReferenceLocations.clear();
+    mVerletBirths.clear();
 }
 
 template<unsigned DIM>
@@ -137,29 +156,69 @@ void NodeBasedCellPopulation<DIM>::SetNode(unsigned nodeIndex, ChastePoint<DIM>&
 template<unsigned DIM>
 void NodeBasedCellPopulation<DIM>::Update(bool hasHadBirthsOrDeaths)
 {
-    UpdateCellProcessLocation();
+    // Halo nodes are recreated every time step in parallel, so the Verlet list is only reused sequentially
+    bool use_verlet_list = mUseVerletLists && PetscTools::IsSequential();
+
+    // Reordering reallocates the nodes, so the pairs must be recalculated
+    bool reorder_nodes = (mNodeReorderingFrequency > 0)
+                         && (SimulationTime::Instance()->GetTimeStepsElapsed() % mNodeReorderingFrequency == 0);
+
+    if (use_verlet_list && mVerletListIsValid && !reorder_nodes)
+    {
+        AddBirthsToVerletList();
+        mVerletListIsValid = !IsVerletListStale();
+    }
+    else
+    {
+        mVerletListIsValid = false;
+    }
+
+    if (!mVerletListIsValid)
+    {
+        // Size the boxes to include the skin (this discards the box collection if the skin has changed)
+        mpNodesOnlyMesh->SetVerletSkin(use_verlet_list ? mVerletSkin : 0.0);
+    }
 
-    mpNodesOnlyMesh->UpdateBoxCollection();
+    UpdateCellProcessLocation();
 
-    if (mLoadBalanceMesh)
+    if (mVerletListIsValid)
     {
-        if ((SimulationTime::Instance()->GetTimeStepsElapsed() % mLoadBalanceFrequency) == 0)
+        mUpdatesSinceVerletRebuild++;
+    }
+    else
+    {
+        if (reorder_nodes)
+        {
+            mpNodesOnlyMesh->ReorderNodesAlongMortonCurve();
+        }
+
+        mpNodesOnlyMesh->UpdateBoxCollection();
+
+        if (mLoadBalanceMesh)
         {
-            mpNodesOnlyMesh->LoadBalanceMesh();
+            if ((SimulationTime::Instance()->GetTimeStepsElapsed() % mLoadBalanceFrequency) == 0)
+            {
+                mpNodesOnlyMesh->LoadBalanceMesh();
 
-            UpdateCellProcessLocation();
+                UpdateCellProcessLocation();
 
-            mpNodesOnlyMesh->UpdateBoxCollection();
+                mpNodesOnlyMesh->UpdateBoxCollection();
+            }
         }
-    }
 
-    RefreshHaloCells();
+        RefreshHaloCells();
 
-    mpNodesOnlyMesh->CalculateInteriorNodePairs(mNodePairs);
+        mpNodesOnlyMesh->CalculateInteriorNodePairs(mNodePairs);
 
-    AddReceivedHaloCells();
+        AddReceivedHaloCells();
 
-    mpNodesOnlyMesh->CalculateBoundaryNodePairs(mNodePairs);
+        mpNodesOnlyMesh->CalculateBoundaryNodePairs(mNodePairs);
+
+        if (use_verlet_list)
+        {
+            BuildVerletList();
+        }
+    }
 
     /*
      * Update cell radii based on CellData
@@ -240,6 +299,12 @@ unsigned NodeBasedCellPopulation<DIM>::RemoveDeadCells()
         }
     }
 
+    // The deleted nodes may be freed before the next Update(), so patch the Verlet list now
+    if (num_removed > 0 && mVerletListIsValid)
+    {
+        RemoveDeletedNodesFromVerletList();
+    }
+
     return num_removed;
 }
 
@@ -339,6 +404,288 @@ void NodeBasedCellPopulation<DIM>::SetLoadBalanceFrequency(unsigned loadBalanceF
     mLoadBalanceFrequency = loadBalanceFrequency;
 }
 
+template<unsigned DIM>
+void NodeBasedCellPopulation<DIM>::SetNodeReorderingFrequency(unsigned nodeReorderingFrequency)
+{
+    mNodeReorderingFrequency = nodeReorderingFrequency;
+}
+
+template<unsigned DIM>
+unsigned NodeBasedCellPopulation<DIM>::GetNodeReorderingFrequency() const
+{
+    return mNodeReorderingFrequency;
+}
+
+template<unsigned DIM>
+void NodeBasedCellPopulation<DIM>::SetUseVerletLists(bool useVerletLists)
+{
+    mUseVerletLists = useVerletLists;
+    mVerletListIsValid = false;
+}
+
+template<unsigned DIM>
+bool NodeBasedCellPopulation<DIM>::GetUseVerletLists() const
+{
+    return mUseVerletLists;
+}
+
+template<unsigned DIM>
+void NodeBasedCellPopulation<DIM>::SetVerletSkin(double verletSkin)
+{
+    assert(verletSkin > 0.0);
+    mVerletSkin = verletSkin;
+    mVerletListIsValid = false;
+}
+
+template<unsigned DIM>
+double NodeBasedCellPopulation<DIM>::GetVerletSkin() const
+{
+    return mVerletSkin;
+}
+
+template<unsigned DIM>
+void NodeBasedCellPopulation<DIM>::SetTuneVerletSkin(bool tuneVerletSkin)
+{
+    mTuneVerletSkin = tuneVerletSkin;
+}
+
+template<unsigned DIM>
+bool NodeBasedCellPopulation<DIM>::GetTuneVerletSkin() const
+{
+    return mTuneVerletSkin;
+}
+
+template<unsigned DIM>
+void NodeBasedCellPopulation<DIM>::BuildVerletList()
+{
+    const double verlet_radius = mpNodesOnlyMesh->GetMaximumInteractionDistance() + mVerletSkin;
+
+    // Keep only the pairs within the Verlet radius, preserving their order
+    unsigned num_kept = 0;
+    for (unsigned i=0; i<mNodePairs.size(); i++)
+    {
+        c_vector<double, DIM> node_to_node_vector = mpNodesOnlyMesh->GetVectorFromAtoB(mNodePairs[i].first->rGetLocation(),
+                                                                                      mNodePairs[i].second->rGetLocation());
+        if (norm_2(node_to_node_vector) < verlet_radius)
+        {
+            mNodePairs[num_kept++] = mNodePairs[i];
+        }
+    }
+    mNodePairs.resize(num_kept);
+
+    mVerletReferenceLocations.clear();
+    mVerletReferenceLocations.reserve(mpNodesOnlyMesh->GetNumNodes());
+    for (typename AbstractMesh<DIM, DIM>::NodeIterator node_iter = mpNodesOnlyMesh->GetNodeIteratorBegin();
+         node_iter != mpNodesOnlyMesh->GetNodeIteratorEnd();
+         ++node_iter)
+    {
+        mVerletReferenceLocations.push_back(std::make_pair(&(*node_iter), node_iter->rGetLocation()));
+    }
+
+    mVerletBirths.clear();
+    mVerletListIsValid = true;
+    mUpdatesSinceVerletRebuild = 0;
+}
+
+template<unsigned DIM>
+bool NodeBasedCellPopulation<DIM>::IsVerletListStale()
+{
+    if (mVerletReferenceLocations.size() != mpNodesOnlyMesh->GetNumNodes())
+    {
+        return true;
+    }
+
+    double max_displacement = 0.0;
+    for (unsigned i=0; i<mVerletReferenceLocations.size(); i++)
+    {
+        c_vector<double, DIM> displacement = mpNodesOnlyMesh->GetVectorFromAtoB(mVerletReferenceLocations[i].second,
+                                                                                mVerletReferenceLocations[i].first->rGetLocation());
+        max_displacement = std::max(max_displacement, norm_2(displacement));
+    }
+
+    // The nodes have moved once per time step since the list was built
+    unsigned num_steps = mUpdatesSinceVerletRebuild + 1;
+    bool is_stale = (max_displacement > 0.5*mVerletSkin);
+
+    // A list that lasts much longer than intended is rebuilt too, so that the skin can shrink
+    if (mTuneVerletSkin && (is_stale || num_steps >= 2*mVerletTargetUpdatesBetweenRebuilds))
+    {
+        const double interaction_distance = mpNodesOnlyMesh->GetMaximumInteractionDistance();
+        double skin = 2.0*mVerletTargetUpdatesBetweenRebuilds*max_displacement/num_steps;
+        skin = std::max(0.05*interaction_distance, std::min(0.5*interaction_distance, skin));
+
+        // Only change the skin (and so the boxes) if it is noticeably different
+        if (fabs(skin - mVerletSkin) > 0.1*mVerletSkin)
+        {
+            mVerletSkin = skin;
+            is_stale = true;
+        }
+    }
+
+    return is_stale;
+}
+
+template<unsigned DIM>
+void NodeBasedCellPopulation<DIM>::AddBirthsToVerletList()
+{
+    if (mVerletBirths.empty())
+    {
+        return;
+    }
+
+    std::map<Node<DIM>*, std::vector<Node<DIM>*> > new_nodes_by_parent;
+    for (unsigned i=0; i<mVerletBirths.size(); i++)
+    {
+        new_nodes_by_parent[mVerletBirths[i].first].push_back(mVerletBirths[i].second);
+    }
+
+    // Each new node takes its parent's reference location
+    unsigned num_reference_locations = mVerletReferenceLocations.size();
+    for (unsigned i=0; i<num_reference_locations; i++)
+    {
+        typename std::map<Node<DIM>*, std::vector<Node<DIM>*> >::iterator it = new_nodes_by_parent.find(mVerletReferenceLocations[i].first);
+        if (it != new_nodes_by_parent.end())
+        {
+            for (unsigned j=0; j<it->second.size(); j++)
+            {
+                mVerletReferenceLocations.push_back(std::make_pair(it->second[j], mVerletReferenceLocations[i].second));
+            }
+        }
+    }
+
+    /*
+     * Pair each new node with its parent's partners, including any new nodes of those
+     * partners, and with its parent and siblings.
+     */
+    unsigned num_pairs = mNodePairs.size();
+    for (unsigned i=0; i<num_pairs; i++)
+    {
+        Node<DIM>* p_node_a = mNodePairs[i].first;
+        Node<DIM>* p_node_b = mNodePairs[i].second;
+        typename std::map<Node<DIM>*, std::vector<Node<DIM>*> >::iterator it_a = new_nodes_by_parent.find(p_node_a);
+        typename std::map<Node<DIM>*, std::vector<Node<DIM>*> >::iterator it_b = new_nodes_by_parent.find(p_node_b);
+
+        if (it_a != new_nodes_by_parent.end())
+        {
+            for (unsigned j=0; j<it_a->second.size(); j++)
+            {
+                mNodePairs.push_back(std::make_pair(it_a->second[j], p_node_b));
+                if (it_b != new_nodes_by_parent.end())
+                {
+                    for (unsigned k=0; k<it_b->second.size(); k++)
+                    {
+                        mNodePairs.push_back(std::make_pair(it_a->second[j], it_b->second[k]));
+                    }
+                }
+            }
+        }
+        if (it_b != new_nodes_by_parent.end())
+        {
+            for (unsigned k=0; k<it_b->second.size(); k++)
+            {
+                mNodePairs.push_back(std::make_pair(p_node_a, it_b->second[k]));
+            }
+        }
+    }
+    for (typename std::map<Node<DIM>*, std::vector<Node<DIM>*> >::iterator it = new_nodes_by_parent.begin();
+         it != new_nodes_by_parent.end();
+         ++it)
+    {
+        for (unsigned j=0; j<it->second.size(); j++)
+        {
+            mNodePairs.push_back(std::make_pair(it->first, it->second[j]));
+            for (unsigned k=j+1; k<it->second.size(); k++)
+            {
+                mNodePairs.push_back(std::make_pair(it->second[j], it->second[k]));
+            }
+        }
+    }
+
+    // Likewise for node neighbours; handling the births in turn picks up new nodes of neighbours
+    for (unsigned i=0; i<mVerletBirths.size(); i++)
+    {
+        Node<DIM>* p_parent_node = mVerletBirths[i].first;
+        Node<DIM>* p_new_node = mVerletBirths[i].second;
+        if (p_parent_node->HasNodeAttributes() && p_parent_node->GetNeighboursSetUp())
+        {
+            std::vector<unsigned> parent_neighbours = p_parent_node->rGetNeighbours();
+            for (unsigned j=0; j<parent_neighbours.size(); j++)
+            {
+                this->GetNode(parent_neighbours[j])->AddNeighbour(p_new_node->GetIndex());
+                p_new_node->AddNeighbour(parent_neighbours[j]);
+            }
+            p_parent_node->AddNeighbour(p_new_node->GetIndex());
+            p_new_node->AddNeighbour(p_parent_node->GetIndex());
+            p_new_node->SetNeighboursSetUp(true);
+        }
+    }
+
+    mVerletBirths.clear();
+}
+
+template<unsigned DIM>
+void NodeBasedCellPopulation<DIM>::RemoveDeletedNodesFromVerletList()
+{
+    // If a parent or new node has died before it could be patched in, start afresh
+    for (unsigned i=0; i<mVerletBirths.size(); i++)
+    {
+        if (mVerletBirths[i].first->IsDeleted() || mVerletBirths[i].second->IsDeleted())
+        {
+            mVerletListIsValid = false;
+            return;
+        }
+    }
+
+    unsigned num_kept = 0;
+    for (unsigned i=0; i<mNodePairs.size(); i++)
+    {
+        if (!mNodePairs[i].first->IsDeleted() && !mNodePairs[i].second->IsDeleted())
+        {
+            mNodePairs[num_kept++] = mNodePairs[i];
+        }
+    }
+    mNodePairs.resize(num_kept);
+
+    num_kept = 0;
+    for (unsigned i=0; i<mVerletReferenceLocations.size(); i++)
+    {
+        Node<DIM>* p_node = mVerletReferenceLocations[i].first;
+        if (!p_node->IsDeleted())
+        {
+            mVerletReferenceLocations[num_kept++] = mVerletReferenceLocations[i];
+        }
+        else if (p_node->HasNodeAttributes() && p_node->GetNeighboursSetUp())
+        {
+            // Neighbour lists are symmetric, so only the deleted node's neighbours refer to it
+            unsigned index = p_node->GetIndex();
+            std::vector<unsigned>& r_neighbours = p_node->rGetNeighbours();
+            for (unsigned j=0; j<r_neighbours.size(); j++)
+            {
+                Node<DIM>* p_neighbour = this->GetNode(r_neighbours[j]);
+                if (!p_neighbour->IsDeleted())
+                {
+                    std::vector<unsigned>& r_neighbour_neighbours = p_neighbour->rGetNeighbours();
+                    r_neighbour_neighbours.erase(std::remove(r_neighbour_neighbours.begin(), r_neighbour_neighbours.end(), index),
+                                                 r_neighbour_neighbours.end());
+                }
+            }
+        }
+    }
+    mVerletReferenceLocations.resize(num_kept);
+}
+
+template<unsigned DIM>
+void NodeBasedCellPopulation<DIM>::SetHaloCellDataItems(const std::vector<std::string>& rHaloCellDataItems)
+{
+    mHaloCellDataItems = rHaloCellDataItems;
+}
+
+template<unsigned DIM>
+const std::vector<std::string>& NodeBasedCellPopulation<DIM>::rGetHaloCellDataItems() const
+{
+    return mHaloCellDataItems;
+}
+
 template<unsigned DIM>
 double NodeBasedCellPopulation<DIM>::GetWidth(const unsigned& rDimension)
 {
@@ -695,6 +1042,11 @@ CellPtr NodeBasedCellPopulation<DIM>::AddCell(CellPtr pNewCell, const c_vector<d
 
     p_new_node->SetRadius(p_parent_node->GetRadius());
 
+    if (mVerletListIsValid)
+    {
+        mVerletBirths.push_back(std::pair<Node<DIM>*, Node<DIM>*>(p_parent_node, p_new_node));
+    }
+
     // Return pointer to new cell
     return p_created_cell;
 }
@@ -772,25 +1124,22 @@ void NodeBasedCellPopulation<DIM>::NonBlockingSendCellsToNeighbourProcesses()
     if (!PetscTools::AmTopMost())
     {
         boost::shared_ptr<std::vector<std::pair<CellPtr, Node<DIM>* > > > p_cells_right(&mCellsToSendRight, null_deleter());
-        int tag = SmallPow(2u, 1+ PetscTools::GetMyRank() ) * SmallPow (3u, 1 + PetscTools::GetMyRank() + 1);
-        mRightCommunicator.ISendObject(p_cells_right, PetscTools::GetMyRank() + 1, tag);
+        mRightCommunicator.ISendObject(p_cells_right, PetscTools::GetMyRank() + 1, mNonBlockingCellCommunicationTag);
     }
     if (!PetscTools::AmMaster())
     {
-        int tag = SmallPow (2u, 1 + PetscTools::GetMyRank() ) * SmallPow (3u, 1 + PetscTools::GetMyRank() - 1);
         boost::shared_ptr<std::vector<std::pair<CellPtr, Node<DIM>* > > > p_cells_left(&mCellsToSendLeft, null_deleter());
-        mLeftCommunicator.ISendObject(p_cells_left, PetscTools::GetMyRank() - 1, tag);
+        mLeftCommunicator.ISendObject(p_cells_left, PetscTools::GetMyRank() - 1, mNonBlockingCellCommunicationTag);
     }
     // Now post receives to start receiving data before returning.
+    // (Messages either way between a pair of processes have a different source, so can share a tag.)
     if (!PetscTools::AmTopMost())
     {
-        int tag = SmallPow (3u, 1 + PetscTools::GetMyRank() ) * SmallPow (2u, 1+ PetscTools::GetMyRank() + 1);
-        mRightCommunicator.IRecvObject(PetscTools::GetMyRank() + 1, tag);
+        mRightCommunicator.IRecvObject(PetscTools::GetMyRank() + 1, mNonBlockingCellCommunicationTag);
     }
     if (!PetscTools::AmMaster())
     {
-        int tag = SmallPow (3u, 1 + PetscTools::GetMyRank() ) * SmallPow (2u, 1+ PetscTools::GetMyRank() - 1);
-        mLeftCommunicator.IRecvObject(PetscTools::GetMyRank() - 1, tag);
+        mLeftCommunicator.IRecvObject(PetscTools::GetMyRank() - 1, mNonBlockingCellCommunicationTag);
     }
 }
 
@@ -910,13 +1259,152 @@ void NodeBasedCellPopulation<DIM>::RefreshHaloCells()
     mHaloCellLocationMap.clear();
     mLocationHaloCellMap.clear();
 
-    std::vector<unsigned> halos_to_send_right = mpNodesOnlyMesh->rGetHaloNodesToSendRight();
-    AddCellsToSendRight(halos_to_send_right);
+    PackHaloRecords(mpNodesOnlyMesh->rGetHaloNodesToSendRight(), mHaloRecordsToSendRight, mFullHaloCellsToSendRight, mHaloCellSignaturesSentRight);
+    PackHaloRecords(mpNodesOnlyMesh->rGetHaloNodesToSendLeft(), mHaloRecordsToSendLeft, mFullHaloCellsToSendLeft, mHaloCellSignaturesSentLeft);
+
+    // Post non-blocking sends of the records, and of any cells the neighbours don't already hold
+    assert(mHaloRecordRequests.empty());
+    const unsigned rank = PetscTools::GetMyRank();
+    if (!PetscTools::AmTopMost())
+    {
+        boost::shared_ptr<std::vector<CellPtr> > p_cells_right(&mFullHaloCellsToSendRight, null_deleter());
+        mRightHaloCellCommunicator.ISendObject(p_cells_right, rank + 1, mHaloCellTag);
+
+        mHaloRecordRequests.push_back(MPI_Request());
+        MPI_Isend(mHaloRecordsToSendRight.empty() ? NULL : &mHaloRecordsToSendRight[0], mHaloRecordsToSendRight.size(),
+                  MPI_DOUBLE, rank + 1, mHaloRecordTag, PetscTools::GetWorld(), &mHaloRecordRequests.back());
+    }
+    if (!PetscTools::AmMaster())
+    {
+        boost::shared_ptr<std::vector<CellPtr> > p_cells_left(&mFullHaloCellsToSendLeft, null_deleter());
+        mLeftHaloCellCommunicator.ISendObject(p_cells_left, rank - 1, mHaloCellTag);
+
+        mHaloRecordRequests.push_back(MPI_Request());
+        MPI_Isend(mHaloRecordsToSendLeft.empty() ? NULL : &mHaloRecordsToSendLeft[0], mHaloRecordsToSendLeft.size(),
+                  MPI_DOUBLE, rank - 1, mHaloRecordTag, PetscTools::GetWorld(), &mHaloRecordRequests.back());
+    }
+
+    // Start receiving the whole cells
+    if (!PetscTools::AmTopMost())
+    {
+        mRightHaloCellCommunicator.IRecvObject(rank + 1, mHaloCellTag);
+    }
+    if (!PetscTools::AmMaster())
+    {
+        mLeftHaloCellCommunicator.IRecvObject(rank - 1, mHaloCellTag);
+    }
+}
+
+template<unsigned DIM>
+unsigned NodeBasedCellPopulation<DIM>::GetHaloRecordSize() const
+{
+    // Cell ID, node index, birth time, radius, location, then CellData items
+    return 4 + DIM + mHaloCellDataItems.size();
+}
+
+template<unsigned DIM>
+std::size_t NodeBasedCellPopulation<DIM>::GetHaloCellSignature(CellPtr pCell)
+{
+    std::size_t signature = 0;
+    boost::hash_combine(signature, pCell->HasApoptosisBegun());
+    boost::hash_combine(signature, pCell->IsDead());
+
+    // Properties are shared objects, so a changed property means a different pointer
+    CellPropertyCollection& r_properties = pCell->rGetCellPropertyCollection();
+    for (CellPropertyCollection::Iterator it = r_properties.Begin(); it != r_properties.End(); ++it)
+    {
+        boost::hash_combine(signature, it->get());
+    }
+    return signature;
+}
+
+template<unsigned DIM>
+void NodeBasedCellPopulation<DIM>::PackHaloRecords(const std::vector<unsigned>& rNodeIndices,
+                                                   std::vector<double>& rRecords,
+                                                   std::vector<CellPtr>& rFullCells,
+                                                   std::map<unsigned, std::size_t>& rSignaturesSent)
+{
+    const unsigned record_size = GetHaloRecordSize();
+    rRecords.resize(rNodeIndices.size()*record_size);
+    rFullCells.clear();
+
+    std::map<unsigned, std::size_t> signatures_sent_now;
+    for (unsigned i=0; i<rNodeIndices.size(); i++)
+    {
+        Node<DIM>* p_node = this->GetNode(rNodeIndices[i]);
+        CellPtr p_cell = this->GetCellUsingLocationIndex(rNodeIndices[i]);
+        const unsigned cell_id = p_cell->GetCellId();
+
+        // Only send the whole cell if the neighbour doesn't already have it as it is now
+        std::size_t signature = GetHaloCellSignature(p_cell);
+        std::map<unsigned, std::size_t>::const_iterator it = rSignaturesSent.find(cell_id);
+        if (it == rSignaturesSent.end() || it->second != signature)
+        {
+            rFullCells.push_back(p_cell);
+        }
+        signatures_sent_now[cell_id] = signature;
+
+        double* p_record = &rRecords[i*record_size];
+        p_record[0] = cell_id;
+        p_record[1] = p_node->GetIndex();
+        p_record[2] = p_cell->GetBirthTime();
+        p_record[3] = p_node->HasNodeAttributes() ? p_node->GetRadius() : DOUBLE_UNSET;
+        for (unsigned d=0; d<DIM; d++)
+        {
+            p_record[4+d] = p_node->rGetLocation()[d];
+        }
+        if (!mHaloCellDataItems.empty())
+        {
+            boost::shared_ptr<CellData> p_cell_data = p_cell->GetCellData();
+            for (unsigned j=0; j<mHaloCellDataItems.size(); j++)
+            {
+                p_record[4+DIM+j] = p_cell_data->GetItem(mHaloCellDataItems[j]);
+            }
+        }
+    }
+    rSignaturesSent.swap(signatures_sent_now);
+}
+
+template<unsigned DIM>
+void NodeBasedCellPopulation<DIM>::UnpackHaloRecords(const std::vector<double>& rRecords,
+                                                     const std::map<unsigned, CellPtr>& rCellsById,
+                                                     std::map<unsigned, CellPtr>& rHaloCellsById)
+{
+    const unsigned record_size = GetHaloRecordSize();
+    assert(rRecords.size() % record_size == 0);
+    for (unsigned i=0; i<rRecords.size(); i+=record_size)
+    {
+        const double* p_record = &rRecords[i];
+        const unsigned cell_id = (unsigned)p_record[0];
+
+        std::map<unsigned, CellPtr>::const_iterator it = rCellsById.find(cell_id);
+        assert(it != rCellsById.end()); // The sender keeps track of what we hold
+        CellPtr p_cell = it->second;
+        rHaloCellsById[cell_id] = p_cell;
+
+        p_cell->SetBirthTime(p_record[2]);
+        if (!mHaloCellDataItems.empty())
+        {
+            boost::shared_ptr<CellData> p_cell_data = p_cell->GetCellData();
+            for (unsigned j=0; j<mHaloCellDataItems.size(); j++)
+            {
+                p_cell_data->SetItem(mHaloCellDataItems[j], p_record[4+DIM+j]);
+            }
+        }
 
-    std::vector<unsigned> halos_to_send_left = mpNodesOnlyMesh->rGetHaloNodesToSendLeft();
-    AddCellsToSendLeft(halos_to_send_left);
+        c_vector<double, DIM> location;
+        for (unsigned d=0; d<DIM; d++)
+        {
+            location[d] = p_record[4+d];
+        }
+        boost::shared_ptr<Node<DIM> > p_node(new Node<DIM>((unsigned)p_record[1], location));
+        if (p_record[3] != DOUBLE_UNSET)
+        {
+            p_node->SetRadius(p_record[3]);
+        }
 
-    NonBlockingSendCellsToNeighbourProcesses();
+        AddHaloCell(p_cell, p_node);
+    }
 }
 
 template<unsigned DIM>
@@ -944,28 +1432,53 @@ void NodeBasedCellPopulation<DIM>::AddCellsToSendLeft(std::vector<unsigned>& cel
 template<unsigned DIM>
 void NodeBasedCellPopulation<DIM>::AddReceivedHaloCells()
 {
-    GetReceivedCells();
-
+    // The cells we can refer to are those sent in full now, plus the halo cells from last time
+    std::map<unsigned, CellPtr> cells_by_id;
+    cells_by_id.swap(mHaloCellsById);
+    std::vector<boost::shared_ptr<std::vector<CellPtr> > > full_cells;
     if (!PetscTools::AmMaster())
     {
-        for (typename std::vector<std::pair<CellPtr, Node<DIM>* > >::iterator iter = mpCellsRecvLeft->begin();
-                iter != mpCellsRecvLeft->end();
-                ++iter)
+        full_cells.push_back(mLeftHaloCellCommunicator.GetRecvObject());
+    }
+    if (!PetscTools::AmTopMost())
+    {
+        full_cells.push_back(mRightHaloCellCommunicator.GetRecvObject());
+    }
+    for (unsigned i=0; i<full_cells.size(); i++)
+    {
+        for (std::vector<CellPtr>::iterator it = full_cells[i]->begin(); it != full_cells[i]->end(); ++it)
         {
-            boost::shared_ptr<Node<DIM> > p_node(iter->second);
-            AddHaloCell(iter->first, p_node);
-
+            cells_by_id[(*it)->GetCellId()] = *it;
         }
     }
-    if (!PetscTools::AmTopMost())
+
+    // Receive the records, whose length we find out by probing
+    const unsigned rank = PetscTools::GetMyRank();
+    for (unsigned side=0; side<2; side++)
     {
-        for (typename std::vector<std::pair<CellPtr, Node<DIM>* > >::iterator iter = mpCellsRecvRight->begin();
-                iter != mpCellsRecvRight->end();
-                ++iter)
+        if ((side == 0 && PetscTools::AmMaster()) || (side == 1 && PetscTools::AmTopMost()))
         {
-            boost::shared_ptr<Node<DIM> > p_node(iter->second);
-            AddHaloCell(iter->first, p_node);
+            continue;
         }
+        const unsigned source = (side == 0) ? rank - 1 : rank + 1;
+
+        MPI_Status status;
+        MPI_Probe(source, mHaloRecordTag, PetscTools::GetWorld(), &status);
+        int num_doubles;
+        MPI_Get_count(&status, MPI_DOUBLE, &num_doubles);
+
+        std::vector<double> records(num_doubles);
+        double dummy;
+        MPI_Recv(records.empty() ? &dummy : &records[0], num_doubles, MPI_DOUBLE, source, mHaloRecordTag, PetscTools::GetWorld(), &status);
+
+        UnpackHaloRecords(records, cells_by_id, mHaloCellsById);
+    }
+
+    // Our sends must be complete before the buffers are next refilled
+    if (!mHaloRecordRequests.empty())
+    {
+        MPI_Waitall(mHaloRecordRequests.size(), &mHaloRecordRequests[0], MPI_STATUSES_IGNORE);
+        mHaloRecordRequests.clear();
     }
 
     mpNodesOnlyMesh->AddHaloNodesToBoxes();
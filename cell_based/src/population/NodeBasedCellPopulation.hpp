@@ -100,6 +100,51 @@ private:
     /** The tag used to send and recieve cell information */
     static const unsigned mCellCommunicationTag = 123;
 
+    /** The tag used by NonBlockingSendCellsToNeighbourProcesses() */
+    static const unsigned mNonBlockingCellCommunicationTag = 124;
+
+    /** The tag used to send and receive halo records (see RefreshHaloCells()) */
+    static const unsigned mHaloRecordTag = 125;
+
+    /** The tag used to send and receive halo cells that the neighbour does not already hold */
+    static const unsigned mHaloCellTag = 126;
+
+    /** Names of the CellData items sent with each halo cell every time step */
+    std::vector<std::string> mHaloCellDataItems;
+
+    /** Fixed-layout halo records to send to the right process; see PackHaloRecords() */
+    std::vector<double> mHaloRecordsToSendRight;
+
+    /** Fixed-layout halo records to send to the left process; see PackHaloRecords() */
+    std::vector<double> mHaloRecordsToSendLeft;
+
+    /** Requests for the halo record sends in progress */
+    std::vector<MPI_Request> mHaloRecordRequests;
+
+    /** The halo cells that the right process does not hold an up-to-date copy of */
+    std::vector<CellPtr> mFullHaloCellsToSendRight;
+
+    /** The halo cells that the left process does not hold an up-to-date copy of */
+    std::vector<CellPtr> mFullHaloCellsToSendLeft;
+
+    /** A communicator to send whole halo cells to the right hand process */
+    ObjectCommunicator<std::vector<CellPtr> > mRightHaloCellCommunicator;
+
+    /** A communicator to send whole halo cells to the left hand process */
+    ObjectCommunicator<std::vector<CellPtr> > mLeftHaloCellCommunicator;
+
+    /**
+     * The signatures (see GetHaloCellSignature()) of the halo cells sent to the right process
+     * at the last halo exchange, indexed by cell ID.
+     */
+    std::map<unsigned, std::size_t> mHaloCellSignaturesSentRight;
+
+    /** As #mHaloCellSignaturesSentRight, for the left process */
+    std::map<unsigned, std::size_t> mHaloCellSignaturesSentLeft;
+
+    /** The halo cells received at the last halo exchange, indexed by cell ID */
+    std::map<unsigned, CellPtr> mHaloCellsById;
+
     /** Pointers to halo cells */
     std::vector<CellPtr> mHaloCells;
 
@@ -115,6 +160,33 @@ private:
     /** The frequency at which the mesh is rebalanced */
     unsigned mLoadBalanceFrequency;
 
+    /** Whether to reuse #mNodePairs over several time steps as a Verlet list; see SetUseVerletLists(). */
+    bool mUseVerletLists;
+
+    /** The distance beyond the maximum interaction distance within which node pairs are kept in the Verlet list. */
+    double mVerletSkin;
+
+    /** Whether to adjust #mVerletSkin each time the Verlet list is rebuilt. */
+    bool mTuneVerletSkin;
+
+    /** Whether #mNodePairs currently holds a valid Verlet list. */
+    bool mVerletListIsValid;
+
+    /** The number of calls to Update() that have reused the Verlet list since it was built. */
+    unsigned mUpdatesSinceVerletRebuild;
+
+    /** The nodes in the Verlet list, each with its location when the list was built. */
+    std::vector<std::pair<Node<DIM>*, c_vector<double, DIM> > > mVerletReferenceLocations;
+
+    /** The parent and new nodes of each cell division since the last call to Update(). */
+    std::vector<std::pair<Node<DIM>*, Node<DIM>*> > mVerletBirths;
+
+    /** The number of time steps between Verlet list rebuilds aimed for when tuning #mVerletSkin. */
+    static const unsigned mVerletTargetUpdatesBetweenRebuilds = 10;
+
+    /** The frequency, in time steps, with which nodes are reordered along a space-filling curve (0 for never). */
+    unsigned mNodeReorderingFrequency;
+
     /** Needed for serialization. */
     friend class boost::serialization::access;
     /**
@@ -196,6 +268,80 @@ private:
      */
     void AddReceivedHaloCells();
 
+    /**
+     * Pack the halo records for a set of local nodes to send to a neighbouring process.
+     *
+     * Each record is a fixed-layout block of doubles: the cell ID, node index, cell birth
+     * time, node radius, node location and then each of #mHaloCellDataItems.  Only the cells
+     * that the neighbour was not sent at the last exchange, or whose properties have changed
+     * since, are also added to the list of cells to be sent in full.
+     *
+     * @param rNodeIndices  the nodes whose cells are halos on the neighbouring process
+     * @param rRecords  filled in with the records
+     * @param rFullCells  filled in with the cells to send in full
+     * @param rSignaturesSent  the signatures of cells sent last time; updated to those sent now
+     */
+    void PackHaloRecords(const std::vector<unsigned>& rNodeIndices,
+                         std::vector<double>& rRecords,
+                         std::vector<CellPtr>& rFullCells,
+                         std::map<unsigned, std::size_t>& rSignaturesSent);
+
+    /**
+     * Create halo nodes and cells from records received from a neighbouring process.
+     *
+     * @param rRecords  the records, as packed by PackHaloRecords()
+     * @param rCellsById  the cells available on this process (received in full now or previously)
+     * @param rHaloCellsById  the halo cells now held, to which those in these records are added
+     */
+    void UnpackHaloRecords(const std::vector<double>& rRecords,
+                           const std::map<unsigned, CellPtr>& rCellsById,
+                           std::map<unsigned, CellPtr>& rHaloCellsById);
+
+    /**
+     * @return the number of doubles in each halo record.
+     */
+    unsigned GetHaloRecordSize() const;
+
+    /**
+     * A cheap summary of the state of a cell which isn't included in its halo record (its
+     * properties, such as mutation state and proliferative type, and whether it is dying),
+     * used to decide whether a neighbour needs to be sent an updated copy.
+     *
+     * @param pCell the cell
+     * @return the signature
+     */
+    std::size_t GetHaloCellSignature(CellPtr pCell);
+
+    /**
+     * Discard the node pairs that are further apart than the maximum interaction distance
+     * plus skin, and record the location of every node, so that #mNodePairs can be reused
+     * as a Verlet list.
+     */
+    void BuildVerletList();
+
+    /**
+     * Check whether the Verlet list must be rebuilt: some node has moved more than half the
+     * skin since it was built, or nodes have been added or removed other than through
+     * AddCell() and RemoveDeadCells(). If skin tuning is switched on, also choose the skin
+     * for the next list so that it lasts roughly #mVerletTargetUpdatesBetweenRebuilds steps.
+     *
+     * @return whether the list is stale.
+     */
+    bool IsVerletListStale();
+
+    /**
+     * Add the pairs and neighbours of new nodes to the Verlet list. A new node is given the
+     * reference location of its parent and a copy of its parent's pairs, which contain every
+     * node it can reach before the list goes stale.
+     */
+    void AddBirthsToVerletList();
+
+    /**
+     * Remove nodes marked as deleted from the Verlet list, and from the neighbours of the
+     * other nodes. Must be called before the deleted nodes are freed.
+     */
+    void RemoveDeletedNodesFromVerletList();
+
     /**
      * Add a single halo cell with its node to the halo structures on this process.
      * @param pCell the cell to add.
@@ -402,6 +548,85 @@ public:
      */
     void SetLoadBalanceFrequency(unsigned loadBalanceFrequency);
 
+    /**
+     * Set the frequency, in number of time steps, with which the nodes on each process are reordered
+     * along a space-filling curve (see NodesOnlyMesh::ReorderNodesAlongMortonCurve()) when the
+     * population is updated. This keeps nodes that are close in space close in memory as cells
+     * divide, which speeds up the force calculation. Node indices are unchanged.
+     *
+     * @param nodeReorderingFrequency the frequency for reordering (0, the default, for never).
+     */
+    void SetNodeReorderingFrequency(unsigned nodeReorderingFrequency);
+
+    /**
+     * @return #mNodeReorderingFrequency
+     */
+    unsigned GetNodeReorderingFrequency() const;
+
+    /**
+     * Set whether to reuse the node pairs over several time steps as a Verlet list.
+     *
+     * Pairs are then found within the maximum interaction distance plus a skin distance,
+     * and only recalculated once some node has moved more than half the skin. Cell births
+     * and deaths are patched into the existing list. Forces must ignore pairs further apart
+     * than the maximum interaction distance (for example by setting a cut-off length), since
+     * the pairs kept differ from those found by the box collection alone.
+     *
+     * The list is only reused when running sequentially; in parallel the pairs are still
+     * recalculated every time step.
+     *
+     * @param useVerletLists whether to use Verlet lists (defaults to true).
+     */
+    void SetUseVerletLists(bool useVerletLists=true);
+
+    /**
+     * @return #mUseVerletLists
+     */
+    bool GetUseVerletLists() const;
+
+    /**
+     * Set the Verlet skin distance.
+     *
+     * @param verletSkin the new skin distance (defaults to a fifth of the maximum interaction distance).
+     */
+    void SetVerletSkin(double verletSkin);
+
+    /**
+     * @return #mVerletSkin
+     */
+    double GetVerletSkin() const;
+
+    /**
+     * Set whether to choose the Verlet skin automatically each time the list is rebuilt, from how
+     * far nodes have moved. This cannot be used with a periodic mesh, whose width must be a
+     * multiple of the box size.
+     *
+     * @param tuneVerletSkin whether to tune the skin (defaults to true).
+     */
+    void SetTuneVerletSkin(bool tuneVerletSkin=true);
+
+    /**
+     * @return #mTuneVerletSkin
+     */
+    bool GetTuneVerletSkin() const;
+
+    /**
+     * Set which CellData items are sent to neighbouring processes for halo cells every time step.
+     *
+     * Halo cells are only sent in full when a neighbouring process first needs them or their
+     * properties change; otherwise just their location, radius, birth time and these items
+     * are sent.  Any other CellData of a halo cell may therefore be out of date.  Each item
+     * must be present on every cell.
+     *
+     * @param rHaloCellDataItems the names of the CellData items
+     */
+    void SetHaloCellDataItems(const std::vector<std::string>& rHaloCellDataItems);
+
+    /**
+     * @return the names of the CellData items sent with halo cells every time step.
+     */
+    const std::vector<std::string>& rGetHaloCellDataItems() const;
+
     /**
      * Overridden GetWidth() method.
      *
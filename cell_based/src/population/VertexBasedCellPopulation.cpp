@@ -516,6 +516,18 @@ void VertexBasedCellPopulation<DIM>::SetOutputCellRearrangementLocations(bool ou
     mOutputCellRearrangementLocations = outputCellRearrangementLocations;
 }
 
+template<unsigned DIM>
+void VertexBasedCellPopulation<DIM>::SetUseGeometryCache(bool useGeometryCache)
+{
+    mpMutableVertexMesh->SetUseGeometryCache(useGeometryCache);
+}
+
+template<unsigned DIM>
+bool VertexBasedCellPopulation<DIM>::GetUseGeometryCache() const
+{
+    return mpMutableVertexMesh->GetUseGeometryCache();
+}
+
 template<unsigned DIM>
 void VertexBasedCellPopulation<DIM>::OutputCellPopulationParameters(out_stream& rParamsFile)
 {
@@ -412,6 +412,21 @@ public:
      */
     void SetOutputCellRearrangementLocations(bool outputCellRearrangementLocations);
 
+    /**
+     * Set whether the mesh caches the geometry (volume, surface area, centroid and
+     * edges) of each element between node movements; see VertexMesh::SetUseGeometryCache().
+     * OffLatticeSimulation invalidates the cache whenever it moves nodes directly, e.g.
+     * when imposing boundary conditions. Not archived.
+     *
+     * @param useGeometryCache whether to use the cache (defaults to true)
+     */
+    void SetUseGeometryCache(bool useGeometryCache=true);
+
+    /**
+     * @return whether the mesh caches element geometry
+     */
+    bool GetUseGeometryCache() const;
+
     /**
      * Overridden OutputCellPopulationParameters() method.
      *
@@ -0,0 +1,141 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "CachedDiffusionEllipticSolver.hpp"
+
+template<unsigned DIM>
+CachedDiffusionEllipticSolver<DIM>::CachedDiffusionEllipticSolver(TetrahedralMesh<DIM,DIM>* pMesh,
+                                                                  AbstractLinearEllipticPde<DIM,DIM>* pPde,
+                                                                  BoundaryConditionsContainer<DIM,DIM,1>* pBoundaryConditions)
+    : SimpleLinearEllipticSolver<DIM, DIM>(pMesh, pPde, pBoundaryConditions),
+      mDiffusionMatrix(NULL),
+      mAssemblingDiffusionMatrix(false),
+      mNumDiffusionMatrixAssemblies(0)
+{
+}
+
+template<unsigned DIM>
+CachedDiffusionEllipticSolver<DIM>::~CachedDiffusionEllipticSolver()
+{
+    ResetDiffusionMatrix();
+}
+
+template<unsigned DIM>
+void CachedDiffusionEllipticSolver<DIM>::ResetDiffusionMatrix()
+{
+    if (mDiffusionMatrix)
+    {
+        PetscTools::Destroy(mDiffusionMatrix);
+        mDiffusionMatrix = NULL;
+    }
+}
+
+template<unsigned DIM>
+unsigned CachedDiffusionEllipticSolver<DIM>::GetNumDiffusionMatrixAssemblies() const
+{
+    return mNumDiffusionMatrixAssemblies;
+}
+
+template<unsigned DIM>
+c_matrix<double, 1*(DIM+1), 1*(DIM+1)> CachedDiffusionEllipticSolver<DIM>::ComputeMatrixTerm(
+        c_vector<double, DIM+1>& rPhi,
+        c_matrix<double, DIM, DIM+1>& rGradPhi,
+        ChastePoint<DIM>& rX,
+        c_vector<double, 1>& rU,
+        c_matrix<double, 1, DIM>& rGradU,
+        Element<DIM, DIM>* pElement)
+{
+    if (mAssemblingDiffusionMatrix)
+    {
+        c_matrix<double, DIM, DIM> pde_diffusion_term = this->mpEllipticPde->ComputeDiffusionTerm(rX);
+        return prod( trans(rGradPhi), c_matrix<double, DIM, DIM+1>(prod(pde_diffusion_term, rGradPhi)) );
+    }
+    else
+    {
+        /*
+         * Note that the element matrix is returned even if the coefficient is zero,
+         * so that every entry of the diffusion operator is present in the LHS matrix
+         * when the two are added in SetupLinearSystem().
+         */
+        return -this->mpEllipticPde->ComputeLinearInUCoeffInSourceTerm(rX, pElement)*outer_prod(rPhi, rPhi);
+    }
+}
+
+template<unsigned DIM>
+void CachedDiffusionEllipticSolver<DIM>::SetupLinearSystem(Vec currentSolution, bool computeMatrix)
+{
+    LinearSystem* p_linear_system = this->mpLinearSystem;
+    assert(p_linear_system->rGetLhsMatrix() != NULL);
+    assert(p_linear_system->rGetRhsVector() != NULL);
+
+    // Assemble and store the diffusion operator the first time round
+    if (mDiffusionMatrix == NULL)
+    {
+        mAssemblingDiffusionMatrix = true;
+        this->SetMatrixToAssemble(p_linear_system->rGetLhsMatrix(), true);
+        this->AssembleMatrix();
+        mAssemblingDiffusionMatrix = false;
+
+        p_linear_system->FinaliseLhsMatrix();
+        MatDuplicate(p_linear_system->rGetLhsMatrix(), MAT_COPY_VALUES, &mDiffusionMatrix);
+        mNumDiffusionMatrixAssemblies++;
+    }
+
+    // Assemble the source terms only
+    this->SetMatrixToAssemble(p_linear_system->rGetLhsMatrix(), true);
+    this->SetVectorToAssemble(p_linear_system->rGetRhsVector(), true);
+    this->Assemble();
+
+    // Add the Neumann boundary conditions, which are assumed to be natural Neumann BCs
+    this->mNaturalNeumannSurfaceTermAssembler.SetVectorToAssemble(p_linear_system->rGetRhsVector(), false);
+    this->mNaturalNeumannSurfaceTermAssembler.Assemble();
+
+    p_linear_system->FinaliseRhsVector();
+    p_linear_system->FinaliseLhsMatrix();
+
+    // Add on the stored diffusion operator, whose non-zeros are a subset of those in the LHS matrix
+    MatAXPY(p_linear_system->rGetLhsMatrix(), 1.0, mDiffusionMatrix, SUBSET_NONZERO_PATTERN);
+
+    // Add Dirichlet BCs
+    this->mpBoundaryConditions->ApplyDirichletToLinearProblem(*p_linear_system, true);
+
+    p_linear_system->FinaliseRhsVector();
+    p_linear_system->FinaliseLhsMatrix();
+}
+
+// Explicit instantiation
+template class CachedDiffusionEllipticSolver<1>;
+template class CachedDiffusionEllipticSolver<2>;
+template class CachedDiffusionEllipticSolver<3>;
@@ -0,0 +1,134 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef CACHEDDIFFUSIONELLIPTICSOLVER_HPP_
+#define CACHEDDIFFUSIONELLIPTICSOLVER_HPP_
+
+#include "SimpleLinearEllipticSolver.hpp"
+#include "TetrahedralMesh.hpp"
+
+/**
+ * A linear elliptic solver intended to be kept alive across many solves on a
+ * fixed mesh, such as the coarse PDE mesh used by CellBasedPdeHandler.
+ *
+ * The diffusion part of the LHS matrix is assembled once, on the first call to
+ * Solve(), and stored. On each subsequent solve only the source terms (the
+ * linear-in-u contribution to the matrix and the constant-in-u contribution to
+ * the vector) are assembled; the stored diffusion operator is then added on and
+ * the boundary conditions are imposed as usual. Since the LinearSystem is also
+ * kept, the KSP object is reused and the previous solution may be passed in as
+ * an initial guess.
+ *
+ * This is only valid if the diffusion term of the PDE does not change in time
+ * and the mesh is not altered between solves. Call ResetDiffusionMatrix() if
+ * either of these assumptions is broken.
+ */
+template<unsigned DIM>
+class CachedDiffusionEllipticSolver : public SimpleLinearEllipticSolver<DIM, DIM>
+{
+private:
+
+    /** The assembled diffusion operator (before boundary conditions are applied), or NULL if not yet assembled. */
+    Mat mDiffusionMatrix;
+
+    /** Whether ComputeMatrixTerm() should currently return the diffusion term only (used when filling mDiffusionMatrix). */
+    bool mAssemblingDiffusionMatrix;
+
+    /** The number of times the diffusion operator has been assembled (for testing). */
+    unsigned mNumDiffusionMatrixAssemblies;
+
+protected:
+
+    /**
+     * Overridden ComputeMatrixTerm() method. Returns either the diffusion term
+     * or the linear-in-u source term, depending on which part of the matrix is
+     * currently being assembled.
+     *
+     * @param rPhi The basis functions, rPhi(i) = phi_i, i=1..numBases
+     * @param rGradPhi Basis gradients, rGradPhi(i,j) = d(phi_j)/d(X_i)
+     * @param rX The point in space
+     * @param rU The unknown as a vector, u(i) = u_i
+     * @param rGradU The gradient of the unknown as a matrix, rGradU(i,j) = d(u_i)/d(X_j)
+     * @param pElement Pointer to the element
+     *
+     * @return The matrix term for the stiffness matrix
+     */
+    virtual c_matrix<double, 1*(DIM+1), 1*(DIM+1)> ComputeMatrixTerm(
+        c_vector<double, DIM+1>& rPhi,
+        c_matrix<double, DIM, DIM+1>& rGradPhi,
+        ChastePoint<DIM>& rX,
+        c_vector<double, 1>& rU,
+        c_matrix<double, 1, DIM>& rGradU,
+        Element<DIM, DIM>* pElement);
+
+    /**
+     * Overridden SetupLinearSystem() method. Assembles the diffusion operator if
+     * it is not already stored, then assembles the source terms and adds the two.
+     *
+     * @param currentSolution The current solution (not used)
+     * @param computeMatrix Whether to compute the LHS matrix of the linear system
+     */
+    void SetupLinearSystem(Vec currentSolution, bool computeMatrix);
+
+public:
+
+    /**
+     * Constructor.
+     *
+     * @param pMesh pointer to the mesh
+     * @param pPde pointer to the PDE
+     * @param pBoundaryConditions pointer to the boundary conditions
+     */
+    CachedDiffusionEllipticSolver(TetrahedralMesh<DIM,DIM>* pMesh,
+                                  AbstractLinearEllipticPde<DIM,DIM>* pPde,
+                                  BoundaryConditionsContainer<DIM,DIM,1>* pBoundaryConditions);
+
+    /**
+     * Destructor.
+     */
+    virtual ~CachedDiffusionEllipticSolver();
+
+    /**
+     * Discard the stored diffusion operator, so that it is reassembled on the next solve.
+     */
+    void ResetDiffusionMatrix();
+
+    /**
+     * @return the number of times the diffusion operator has been assembled.
+     */
+    unsigned GetNumDiffusionMatrixAssemblies() const;
+};
+
+#endif /*CACHEDDIFFUSIONELLIPTICSOLVER_HPP_*/
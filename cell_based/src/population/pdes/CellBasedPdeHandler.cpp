@@ -54,6 +54,7 @@ CellBasedPdeHandler<DIM>::CellBasedPdeHandler(AbstractCellPopulation<DIM>* pCell
       mSetBcsOnCoarseBoundary(true),
       mNumRadialIntervals(UNSIGNED_UNSET),
       mpCoarsePdeMesh(NULL),
+      mReuseCoarsePdeSolvers(false),
       mDeleteMemberPointersInDestructor(deleteMemberPointersInDestructor)
 {
     // We must be using a CellPopulation with at least one cell
@@ -70,6 +71,8 @@ CellBasedPdeHandler<DIM>::~CellBasedPdeHandler()
      * subclass of AbstractCellBasedSimulation, which deletes the cell
      * population upon destruction if restored from an archive.
      */
+    ClearCoarsePdeSolvers();
+
     if (mDeleteMemberPointersInDestructor)
     {
         for (unsigned i=0; i<mPdeAndBcCollection.size(); i++)
@@ -254,6 +257,9 @@ void CellBasedPdeHandler<DIM>::UseCoarsePdeMesh(double stepSize, ChasteCuboid<DI
         }
     }
 
+    // Any persistent solvers refer to the old coarse mesh, if there was one
+    ClearCoarsePdeSolvers();
+
     // Create a regular coarse tetrahedral mesh
     mpCoarsePdeMesh = new TetrahedralMesh<DIM,DIM>;
     switch (DIM)
@@ -339,8 +345,15 @@ void CellBasedPdeHandler<DIM>::SolvePdeAndWriteResultsToFile(unsigned samplingTi
         // Get pointer to this PdeAndBoundaryConditions object
         PdeAndBoundaryConditions<DIM>* p_pde_and_bc = mPdeAndBcCollection[pde_index];
 
+        // Record whether this PDE is solved using a persistent solver, which holds its own boundary conditions
+        bool reuse_solver = CanReuseCoarsePdeSolver(pde_index);
+
         // Set up boundary conditions
-        std::auto_ptr<BoundaryConditionsContainer<DIM,DIM,1> > p_bcc = ConstructBoundaryConditionsContainer(p_pde_and_bc, p_mesh);
+        std::auto_ptr<BoundaryConditionsContainer<DIM,DIM,1> > p_bcc;
+        if (!reuse_solver)
+        {
+            p_bcc = ConstructBoundaryConditionsContainer(p_pde_and_bc, p_mesh);
+        }
 
         // If the solution at the previous timestep exists...
         PetscInt previous_solution_size = 0;
@@ -386,17 +399,34 @@ void CellBasedPdeHandler<DIM>::SolvePdeAndWriteResultsToFile(unsigned samplingTi
             // Pass in already updated CellPdeElementMap to speed up finding cells.
             p_pde_and_bc->SetUpSourceTermsForAveragedSourcePde(p_mesh, &mCellPdeElementMap);
 
-            SimpleLinearEllipticSolver<DIM,DIM> solver(p_mesh, p_pde_and_bc->GetPde(), p_bcc.get());
+            // Either use the persistent solver for this PDE, creating it if necessary, or a temporary one
+            std::auto_ptr<SimpleLinearEllipticSolver<DIM,DIM> > p_temporary_solver;
+            SimpleLinearEllipticSolver<DIM,DIM>* p_solver;
+            if (reuse_solver)
+            {
+                if (mCoarsePdeSolvers.find(pde_index) == mCoarsePdeSolvers.end())
+                {
+                    BoundaryConditionsContainer<DIM,DIM,1>* p_persistent_bcc = ConstructBoundaryConditionsContainer(p_pde_and_bc, p_mesh).release();
+                    mCoarsePdeBoundaryConditions[pde_index] = p_persistent_bcc;
+                    mCoarsePdeSolvers[pde_index] = new CachedDiffusionEllipticSolver<DIM>(p_mesh, p_pde_and_bc->GetPde(), p_persistent_bcc);
+                }
+                p_solver = mCoarsePdeSolvers[pde_index];
+            }
+            else
+            {
+                p_temporary_solver.reset(new SimpleLinearEllipticSolver<DIM,DIM>(p_mesh, p_pde_and_bc->GetPde(), p_bcc.get()));
+                p_solver = p_temporary_solver.get();
+            }
 
             // If we have an initial guess, use this when solving the system...
             if (is_previous_solution_size_correct)
             {
-                p_pde_and_bc->SetSolution(solver.Solve(initial_guess));
+                p_pde_and_bc->SetSolution(p_solver->Solve(initial_guess));
                 PetscTools::Destroy(initial_guess);
             }
             else // ...otherwise do not supply one
             {
-                p_pde_and_bc->SetSolution(solver.Solve());
+                p_pde_and_bc->SetSolution(p_solver->Solve());
             }
         }
         else
@@ -685,6 +715,60 @@ template<unsigned DIM>
 void CellBasedPdeHandler<DIM>::SetImposeBcsOnCoarseBoundary(bool setBcsOnCoarseBoundary)
 {
     mSetBcsOnCoarseBoundary = setBcsOnCoarseBoundary;
+
+    // The boundary conditions held by any persistent solvers may no longer be correct
+    ClearCoarsePdeSolvers();
+}
+
+template<unsigned DIM>
+void CellBasedPdeHandler<DIM>::SetReuseCoarsePdeSolvers(bool reuseCoarsePdeSolvers)
+{
+    mReuseCoarsePdeSolvers = reuseCoarsePdeSolvers;
+    if (!mReuseCoarsePdeSolvers)
+    {
+        ClearCoarsePdeSolvers();
+    }
+}
+
+template<unsigned DIM>
+bool CellBasedPdeHandler<DIM>::GetReuseCoarsePdeSolvers()
+{
+    return mReuseCoarsePdeSolvers;
+}
+
+template<unsigned DIM>
+bool CellBasedPdeHandler<DIM>::CanReuseCoarsePdeSolver(unsigned pdeIndex)
+{
+    PdeAndBoundaryConditions<DIM>* p_pde_and_bc = mPdeAndBcCollection[pdeIndex];
+
+    /*
+     * Dirichlet conditions imposed on the edge of the cell population, rather than
+     * on the boundary of the coarse mesh, move with the cells and so must be
+     * reconstructed at every timestep.
+     */
+    bool bcs_are_fixed = mSetBcsOnCoarseBoundary || p_pde_and_bc->IsNeumannBoundaryCondition();
+
+    return mReuseCoarsePdeSolvers && (mpCoarsePdeMesh != NULL) && p_pde_and_bc->HasAveragedSourcePde() && bcs_are_fixed;
+}
+
+template<unsigned DIM>
+void CellBasedPdeHandler<DIM>::ClearCoarsePdeSolvers()
+{
+    for (typename std::map<unsigned, CachedDiffusionEllipticSolver<DIM>*>::iterator iter = mCoarsePdeSolvers.begin();
+         iter != mCoarsePdeSolvers.end();
+         ++iter)
+    {
+        delete iter->second;
+    }
+    mCoarsePdeSolvers.clear();
+
+    for (typename std::map<unsigned, BoundaryConditionsContainer<DIM,DIM,1>*>::iterator iter = mCoarsePdeBoundaryConditions.begin();
+         iter != mCoarsePdeBoundaryConditions.end();
+         ++iter)
+    {
+        delete iter->second;
+    }
+    mCoarsePdeBoundaryConditions.clear();
 }
 
 template<unsigned DIM>
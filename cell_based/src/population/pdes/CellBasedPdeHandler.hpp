@@ -40,6 +40,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <memory>
 
 #include "ChasteSerialization.hpp"
+#include "ChasteSerializationVersion.hpp"
 #include <boost/serialization/vector.hpp>
 
 #include "AbstractCellPopulation.hpp"
@@ -47,6 +48,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "BoundaryConditionsContainer.hpp"
 #include "TetrahedralMesh.hpp"
 #include "ChasteCuboid.hpp"
+#include "CachedDiffusionEllipticSolver.hpp"
 
 /**
  * A helper class, containing code for handling the numerical solution of one or more PDEs
@@ -83,6 +85,10 @@ private:
         archive & mSetBcsOnCoarseBoundary;
         archive & mNumRadialIntervals;
         archive & mAverageRadialSolutionVariableName;
+        if (version > 0)
+        {
+            archive & mReuseCoarsePdeSolvers;
+        }
     }
 
 protected:
@@ -123,6 +129,23 @@ protected:
     /** Map between cells and the elements of the coarse PDE mesh containing them. */
     std::map<CellPtr, unsigned> mCellPdeElementMap;
 
+    /**
+     * Whether to keep a solver (with its assembled diffusion operator, boundary
+     * conditions and linear system) alive between timesteps for each PDE solved
+     * on the coarse mesh. Defaults to false. The solvers themselves are not
+     * archived, but are rebuilt on the first solve after loading.
+     */
+    bool mReuseCoarsePdeSolvers;
+
+    /**
+     * Persistent solvers for PDEs solved on the coarse mesh, keyed by the index of
+     * the PDE in mPdeAndBcCollection. Only used if mReuseCoarsePdeSolvers is true.
+     */
+    std::map<unsigned, CachedDiffusionEllipticSolver<DIM>*> mCoarsePdeSolvers;
+
+    /** Boundary conditions containers used by the solvers in mCoarsePdeSolvers, keyed in the same way. */
+    std::map<unsigned, BoundaryConditionsContainer<DIM,DIM,1>*> mCoarsePdeBoundaryConditions;
+
     /**
      * Whether to delete member pointers in the destructor.
      * Used in archiving.
@@ -167,6 +190,22 @@ protected:
      */
     bool PdeSolveNeedsCoarseMesh();
 
+    /**
+     * @return whether the PDE with the given index in mPdeAndBcCollection can be solved
+     * using a persistent solver stored in mCoarsePdeSolvers. This is the case when the PDE
+     * has an averaged source term and is solved on the coarse mesh, and its boundary
+     * conditions do not depend on the positions of the cells.
+     *
+     * @param pdeIndex the index of the PDE in mPdeAndBcCollection
+     */
+    bool CanReuseCoarsePdeSolver(unsigned pdeIndex);
+
+    /**
+     * Delete the persistent solvers and boundary conditions containers stored in
+     * mCoarsePdeSolvers and mCoarsePdeBoundaryConditions.
+     */
+    void ClearCoarsePdeSolvers();
+
 public:
 
     /**
@@ -306,6 +345,22 @@ public:
      */
     void SetImposeBcsOnCoarseBoundary(bool setBcsOnCoarseBoundary);
 
+    /**
+     * Set whether to keep a solver alive between timesteps for each PDE solved on the
+     * coarse mesh. The diffusion operator, boundary conditions and KSP are then set up
+     * only once, and only the source terms are reassembled at each timestep. This
+     * assumes that the diffusion term of each PDE is constant in time, so is off
+     * unless requested.
+     *
+     * @param reuseCoarsePdeSolvers whether to reuse solvers (defaults to true)
+     */
+    void SetReuseCoarsePdeSolvers(bool reuseCoarsePdeSolvers=true);
+
+    /**
+     * @return mReuseCoarsePdeSolvers
+     */
+    bool GetReuseCoarsePdeSolvers();
+
     /**
      * Solve the PDE problem on a coarse mesh.
      *
@@ -337,6 +392,19 @@ namespace boost
 {
 namespace serialization
 {
+/**
+ * Specify a version number for archive backwards compatibility.
+ *
+ * This is how to do BOOST_CLASS_VERSION(CellBasedPdeHandler, 1)
+ * with a templated class.
+ */
+template <unsigned DIM>
+struct version<CellBasedPdeHandler<DIM> >
+{
+    ///Macro to set the version number of templated archive in known versions of Boost
+    CHASTE_VERSION_CONTENT(1);
+};
+
 /**
  * Serialize information required to construct a CellBasedPdeHandler.
  *
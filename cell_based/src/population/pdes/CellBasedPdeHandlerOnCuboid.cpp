@@ -79,17 +79,17 @@ std::auto_ptr<BoundaryConditionsContainer<DIM,DIM,1> > CellBasedPdeHandlerOnCubo
     boundary_condition_values[2] = 1.0; // Bottom
     boundary_condition_values[3] = 1.0; // Left
 
-    // Delete all previous boundary conditions
-    for (unsigned i=0; i<mConstBoundaryConditions.size(); i++)
+    /*
+     * Create the boundary conditions on the first call only, since containers
+     * constructed by earlier calls may still be held by persistent solvers.
+     */
+    if (mConstBoundaryConditions.empty())
     {
-        delete mConstBoundaryConditions[i];
+        mConstBoundaryConditions.push_back(new ConstBoundaryCondition<DIM>(boundary_condition_values[0]));
+        mConstBoundaryConditions.push_back(new ConstBoundaryCondition<DIM>(boundary_condition_values[1]));
+        mConstBoundaryConditions.push_back(new ConstBoundaryCondition<DIM>(boundary_condition_values[2]));
+        mConstBoundaryConditions.push_back(new ConstBoundaryCondition<DIM>(boundary_condition_values[3]));
     }
-    mConstBoundaryConditions.clear();
-
-    mConstBoundaryConditions.push_back(new ConstBoundaryCondition<DIM>(boundary_condition_values[0]));
-    mConstBoundaryConditions.push_back(new ConstBoundaryCondition<DIM>(boundary_condition_values[1]));
-    mConstBoundaryConditions.push_back(new ConstBoundaryCondition<DIM>(boundary_condition_values[2]));
-    mConstBoundaryConditions.push_back(new ConstBoundaryCondition<DIM>(boundary_condition_values[3]));
 
     ChasteCuboid<DIM> cuboid = pMesh->CalculateBoundingBox();
 
@@ -193,6 +193,7 @@ void OffLatticeSimulation<ELEMENT_DIM,SPACE_DIM>::RevertToOldLocations(std::map<
     {
         (node_iter)->rGetModifiableLocation() = oldNodeLoctions[&(*node_iter)];
     }
+    InvalidateVertexGeometryCache();
 }
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
@@ -205,6 +206,11 @@ void OffLatticeSimulation<ELEMENT_DIM,SPACE_DIM>::ApplyBoundaries(std::map<Node<
     {
         (*bcs_iter)->ImposeBoundaryCondition(oldNodeLoctions);
     }
+    if (!mBoundaryConditions.empty())
+    {
+        // Boundary conditions move nodes directly rather than through the cell population
+        InvalidateVertexGeometryCache();
+    }
 
     // Verify that each boundary condition is now satisfied
     for (typename std::vector<boost::shared_ptr<AbstractCellPopulationBoundaryCondition<ELEMENT_DIM,SPACE_DIM> > >::iterator bcs_iter = mBoundaryConditions.begin();
@@ -218,6 +224,16 @@ void OffLatticeSimulation<ELEMENT_DIM,SPACE_DIM>::ApplyBoundaries(std::map<Node<
     }
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void OffLatticeSimulation<ELEMENT_DIM,SPACE_DIM>::InvalidateVertexGeometryCache()
+{
+    VertexBasedCellPopulation<SPACE_DIM>* p_vertex_based_cell_population = dynamic_cast<VertexBasedCellPopulation<SPACE_DIM>*>(&(this->mrCellPopulation));
+    if (p_vertex_based_cell_population != NULL)
+    {
+        p_vertex_based_cell_population->rGetMesh().InvalidateGeometryCache();
+    }
+}
+
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 c_vector<double, SPACE_DIM> OffLatticeSimulation<ELEMENT_DIM,SPACE_DIM>::CalculateCellDivisionVector(CellPtr pParentCell)
 {
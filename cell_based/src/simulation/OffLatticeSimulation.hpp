@@ -124,6 +124,12 @@ protected:
      */
     void ApplyBoundaries(std::map<Node<SPACE_DIM>*, c_vector<double, SPACE_DIM> > oldNodeLoctions);
 
+    /**
+     * For a VertexBasedCellPopulation, mark any cached element geometry in the mesh as
+     * out of date. Called after nodes have been moved other than through the cell population.
+     */
+    void InvalidateVertexGeometryCache();
+
     /**
      * Overridden SetupSolve() method to clear the forces applied to the nodes.
      */
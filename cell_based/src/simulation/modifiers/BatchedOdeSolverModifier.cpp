@@ -0,0 +1,115 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "BatchedOdeSolverModifier.hpp"
+#include "ApoptoticCellProperty.hpp"
+
+template<unsigned DIM>
+BatchedOdeSolverModifier<DIM>::BatchedOdeSolverModifier()
+    : AbstractCellBasedSimulationModifier<DIM>()
+{
+}
+
+template<unsigned DIM>
+BatchedOdeSolverModifier<DIM>::~BatchedOdeSolverModifier()
+{
+}
+
+template<unsigned DIM>
+void BatchedOdeSolverModifier<DIM>::UpdateAtEndOfTimeStep(AbstractCellPopulation<DIM,DIM>& rCellPopulation)
+{
+    SolveCellOdes(rCellPopulation);
+}
+
+template<unsigned DIM>
+void BatchedOdeSolverModifier<DIM>::SetupSolve(AbstractCellPopulation<DIM,DIM>& rCellPopulation, std::string outputDirectory)
+{
+    // Cells are aged to the start time just after this, so do the bulk of that work in batches too
+    SolveCellOdes(rCellPopulation);
+}
+
+template<unsigned DIM>
+void BatchedOdeSolverModifier<DIM>::SolveCellOdes(AbstractCellPopulation<DIM,DIM>& rCellPopulation)
+{
+    std::vector<CellCycleModelOdeHandler*> handlers;
+    handlers.reserve(2*rCellPopulation.GetNumRealCells());
+
+    for (typename AbstractCellPopulation<DIM>::Iterator cell_iter = rCellPopulation.Begin();
+         cell_iter != rCellPopulation.End();
+         ++cell_iter)
+    {
+        // Cell::ReadyToDivide() does not run the models of apoptotic cells
+        if (cell_iter->IsDead() || cell_iter->HasApoptosisBegun() || cell_iter->template HasCellProperty<ApoptoticCellProperty>())
+        {
+            continue;
+        }
+
+        // As in Cell::ReadyToDivide(), the SRN model comes before the cell-cycle model
+        CellCycleModelOdeHandler* p_srn_handler = dynamic_cast<CellCycleModelOdeHandler*>(cell_iter->GetSrnModel());
+        if (p_srn_handler)
+        {
+            handlers.push_back(p_srn_handler);
+        }
+        CellCycleModelOdeHandler* p_cycle_handler = dynamic_cast<CellCycleModelOdeHandler*>(cell_iter->GetCellCycleModel());
+        if (p_cycle_handler)
+        {
+            handlers.push_back(p_cycle_handler);
+        }
+    }
+
+    mBatchSolver.SolveToTime(handlers, SimulationTime::Instance()->GetTime());
+}
+
+template<unsigned DIM>
+unsigned BatchedOdeSolverModifier<DIM>::GetNumSystemsSolved() const
+{
+    return mBatchSolver.GetNumSystemsSolved();
+}
+
+template<unsigned DIM>
+void BatchedOdeSolverModifier<DIM>::OutputSimulationModifierParameters(out_stream& rParamsFile)
+{
+    // No parameters to output, so just call method on direct parent class
+    AbstractCellBasedSimulationModifier<DIM>::OutputSimulationModifierParameters(rParamsFile);
+}
+
+// Explicit instantiation
+template class BatchedOdeSolverModifier<1>;
+template class BatchedOdeSolverModifier<2>;
+template class BatchedOdeSolverModifier<3>;
+
+// Serialization for Boost >= 1.36
+#include "SerializationExportWrapperForCpp.hpp"
+EXPORT_TEMPLATE_CLASS_SAME_DIMS(BatchedOdeSolverModifier)
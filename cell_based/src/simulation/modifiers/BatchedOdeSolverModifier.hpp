@@ -0,0 +1,133 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef BATCHEDODESOLVERMODIFIER_HPP_
+#define BATCHEDODESOLVERMODIFIER_HPP_
+
+#include "ChasteSerialization.hpp"
+#include <boost/serialization/base_object.hpp>
+
+#include "AbstractCellBasedSimulationModifier.hpp"
+#include "CellCycleModelOdeBatchSolver.hpp"
+
+/**
+ * A modifier class which, at each simulation time step, advances the ODE
+ * systems of all the cells' ODE-based cell-cycle and SRN models together
+ * using a CellCycleModelOdeBatchSolver, rather than leaving each cell to
+ * solve its own ODEs when it is next asked whether it is ready to divide.
+ *
+ * The results are identical to the unbatched solve, provided that any modifiers
+ * that read the ODE state or update CellData used by the ODEs (such as
+ * DeltaNotchTrackingModifier) are added to the simulation before this one. Without
+ * batching the ODEs are only advanced to the new time at the start of the next
+ * time step, so such modifiers would otherwise see the state one time step ahead of the unbatched solve.
+ */
+template<unsigned DIM>
+class BatchedOdeSolverModifier : public AbstractCellBasedSimulationModifier<DIM,DIM>
+{
+    /** Needed for serialization. */
+    friend class boost::serialization::access;
+    /**
+     * Boost Serialization method for archiving/checkpointing.
+     * Archives the object and its member variables.
+     *
+     * @param archive  The boost archive.
+     * @param version  The current version of this class.
+     */
+    template<class Archive>
+    void serialize(Archive & archive, const unsigned int version)
+    {
+        archive & boost::serialization::base_object<AbstractCellBasedSimulationModifier<DIM,DIM> >(*this);
+    }
+
+    /** The batch solver, which holds only working memory and so is not archived. */
+    CellCycleModelOdeBatchSolver mBatchSolver;
+
+public:
+
+    /**
+     * Default constructor.
+     */
+    BatchedOdeSolverModifier();
+
+    /**
+     * Destructor.
+     */
+    virtual ~BatchedOdeSolverModifier();
+
+    /**
+     * Overridden UpdateAtEndOfTimeStep() method.
+     *
+     * Specify what to do in the simulation at the end of each time step.
+     *
+     * @param rCellPopulation reference to the cell population
+     */
+    virtual void UpdateAtEndOfTimeStep(AbstractCellPopulation<DIM,DIM>& rCellPopulation);
+
+    /**
+     * Overridden SetupSolve() method.
+     *
+     * Specify what to do in the simulation before the start of the time loop.
+     *
+     * @param rCellPopulation reference to the cell population
+     * @param outputDirectory the output directory, relative to where Chaste output is stored
+     */
+    virtual void SetupSolve(AbstractCellPopulation<DIM,DIM>& rCellPopulation, std::string outputDirectory);
+
+    /**
+     * Helper method to advance the ODEs of every cell in the population to the current time.
+     *
+     * @param rCellPopulation reference to the cell population
+     */
+    void SolveCellOdes(AbstractCellPopulation<DIM,DIM>& rCellPopulation);
+
+    /**
+     * @return the number of ODE systems advanced by the most recent call to SolveCellOdes()
+     */
+    unsigned GetNumSystemsSolved() const;
+
+    /**
+     * Overridden OutputSimulationModifierParameters() method.
+     * Output any simulation modifier parameters to file.
+     *
+     * @param rParamsFile the file stream to which the parameters are output
+     */
+    void OutputSimulationModifierParameters(out_stream& rParamsFile);
+};
+
+#include "SerializationExportWrapper.hpp"
+EXPORT_TEMPLATE_CLASS_SAME_DIMS(BatchedOdeSolverModifier)
+
+#endif /*BATCHEDODESOLVERMODIFIER_HPP_*/
@@ -0,0 +1,203 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <algorithm>
+#include <cstdlib>
+
+#include "CellWritersHdf5ToTxtConverter.hpp"
+#include "AbstractHdf5Access.hpp"
+#include "Exception.hpp"
+#include "PetscTools.hpp"
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+CellWritersHdf5ToTxtConverter<ELEMENT_DIM, SPACE_DIM>::CellWritersHdf5ToTxtConverter(const FileFinder& rInputDirectory,
+                                                                                     const std::string& rFileName,
+                                                                                     const std::vector<boost::shared_ptr<AbstractCellWriter<ELEMENT_DIM, SPACE_DIM> > >& rCellWriters)
+{
+    FileFinder h5_file(rFileName, rInputDirectory);
+    if (!h5_file.Exists())
+    {
+        EXCEPTION("Cell writer HDF5 file " + h5_file.GetAbsolutePath() + " does not exist.");
+    }
+
+    // Creating the handler is collective, but only the master reads the data and writes the text files
+    OutputFileHandler handler(rInputDirectory, false);
+
+    /*
+     * Every process reads the column names and checks them against the cell writers,
+     * so that a mismatch is reported everywhere rather than only on the master.
+     */
+    hid_t file_id = H5Fopen(h5_file.GetAbsolutePath().c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+    hid_t data_dataset_id = H5Dopen(file_id, "CellData", H5P_DEFAULT);
+
+    // Read the spatial dimension and the column names
+    unsigned space_dim;
+    hid_t attribute_id = H5Aopen_name(data_dataset_id, "SpaceDimension");
+    H5Aread(attribute_id, H5T_NATIVE_UINT, &space_dim);
+    H5Aclose(attribute_id);
+    assert(space_dim == SPACE_DIM);
+    UNUSED_OPT(space_dim);
+
+    attribute_id = H5Aopen_name(data_dataset_id, "Variable Details");
+    hid_t attribute_type = H5Aget_type(attribute_id);
+    hid_t attribute_space = H5Aget_space(attribute_id);
+    unsigned num_columns = H5Sget_simple_extent_npoints(attribute_space);
+    char* string_array = (char*) malloc(sizeof(char)*MAX_STRING_SIZE*num_columns);
+    H5Aread(attribute_id, attribute_type, string_array);
+    std::vector<std::string> column_names;
+    for (unsigned index=0; index<num_columns; index++)
+    {
+        column_names.push_back(std::string(&string_array[sizeof(char)*MAX_STRING_SIZE*index]));
+    }
+    free(string_array);
+    H5Tclose(attribute_type);
+    H5Sclose(attribute_space);
+    H5Aclose(attribute_id);
+
+    // Find the first column holding each cell writer's values
+    std::vector<unsigned> first_columns;
+    for (unsigned i=0; i<rCellWriters.size(); i++)
+    {
+        std::string file_name = rCellWriters[i]->GetFileName();
+        std::vector<std::string>::iterator it = std::find(column_names.begin() + SPACE_DIM, column_names.end(), file_name);
+        unsigned num_values = rCellWriters[i]->GetNumHdf5Values();
+        if (it == column_names.end()
+            || num_values == 0
+            || (unsigned)(std::count(column_names.begin(), column_names.end(), file_name)) != num_values)
+        {
+            H5Dclose(data_dataset_id);
+            H5Fclose(file_id);
+            EXCEPTION("The cell writer for " + file_name + " does not match the data in " + h5_file.GetAbsolutePath() + ".");
+        }
+        first_columns.push_back(it - column_names.begin());
+    }
+
+    if (PetscTools::AmMaster())
+    {
+        hid_t time_dataset_id = H5Dopen(file_id, "Time", H5P_DEFAULT);
+        hid_t rows_dataset_id = H5Dopen(file_id, "Rows", H5P_DEFAULT);
+        hid_t indices_dataset_id = H5Dopen(file_id, "CellIndices", H5P_DEFAULT);
+
+        // Read the output times and the rows written at each
+        hid_t time_space = H5Dget_space(time_dataset_id);
+        hsize_t num_steps;
+        H5Sget_simple_extent_dims(time_space, &num_steps, NULL);
+        H5Sclose(time_space);
+
+        std::vector<double> times(num_steps);
+        std::vector<hsize_t> row_ranges(2*num_steps);
+        if (num_steps > 0)
+        {
+            H5Dread(time_dataset_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, &times[0]);
+            H5Dread(rows_dataset_id, H5T_NATIVE_HSIZE, H5S_ALL, H5S_ALL, H5P_DEFAULT, &row_ranges[0]);
+        }
+
+        // One text file per cell writer (out_stream cannot be stored in a vector)
+        std::vector<boost::shared_ptr<std::ofstream> > files;
+        for (unsigned i=0; i<rCellWriters.size(); i++)
+        {
+            files.push_back(boost::shared_ptr<std::ofstream>(handler.OpenOutputFile(rCellWriters[i]->GetFileName()).release()));
+        }
+
+        // Convert one output time at a time, so that only one step's rows are held in memory
+        std::vector<unsigned> indices;
+        std::vector<double> data;
+        c_vector<double, SPACE_DIM> centre;
+        std::vector<double> values;
+        for (unsigned step=0; step<num_steps; step++)
+        {
+            hsize_t first_row = row_ranges[2*step];
+            hsize_t num_rows = row_ranges[2*step + 1];
+
+            if (num_rows > 0)
+            {
+                indices.resize(2*num_rows);
+                data.resize(num_rows*num_columns);
+
+                hsize_t offset[2] = {first_row, 0};
+                hsize_t indices_count[2] = {num_rows, 2};
+                hid_t memspace = H5Screate_simple(2, indices_count, NULL);
+                hid_t hyperslab_space = H5Dget_space(indices_dataset_id);
+                H5Sselect_hyperslab(hyperslab_space, H5S_SELECT_SET, offset, NULL, indices_count, NULL);
+                H5Dread(indices_dataset_id, H5T_NATIVE_UINT, memspace, hyperslab_space, H5P_DEFAULT, &indices[0]);
+                H5Sclose(hyperslab_space);
+                H5Sclose(memspace);
+
+                hsize_t data_count[2] = {num_rows, num_columns};
+                memspace = H5Screate_simple(2, data_count, NULL);
+                hyperslab_space = H5Dget_space(data_dataset_id);
+                H5Sselect_hyperslab(hyperslab_space, H5S_SELECT_SET, offset, NULL, data_count, NULL);
+                H5Dread(data_dataset_id, H5T_NATIVE_DOUBLE, memspace, hyperslab_space, H5P_DEFAULT, &data[0]);
+                H5Sclose(hyperslab_space);
+                H5Sclose(memspace);
+            }
+
+            for (unsigned i=0; i<files.size(); i++)
+            {
+                *files[i] << times[step] << "\t";
+                for (hsize_t row=0; row<num_rows; row++)
+                {
+                    const double* p_row = &data[row*num_columns];
+                    std::copy(p_row, p_row + SPACE_DIM, centre.begin());
+                    values.assign(p_row + first_columns[i], p_row + first_columns[i] + rCellWriters[i]->GetNumHdf5Values());
+                    rCellWriters[i]->WriteCellRecordFromHdf5(*files[i], indices[2*row], indices[2*row + 1], centre, values);
+                }
+                *files[i] << "\n";
+            }
+        }
+
+        for (unsigned i=0; i<files.size(); i++)
+        {
+            files[i]->close();
+        }
+
+        H5Dclose(time_dataset_id);
+        H5Dclose(rows_dataset_id);
+        H5Dclose(indices_dataset_id);
+    }
+
+    H5Dclose(data_dataset_id);
+    H5Fclose(file_id);
+
+    PetscTools::Barrier("CellWritersHdf5ToTxtConverter");
+}
+
+// Explicit instantiation
+template class CellWritersHdf5ToTxtConverter<1,1>;
+template class CellWritersHdf5ToTxtConverter<1,2>;
+template class CellWritersHdf5ToTxtConverter<2,2>;
+template class CellWritersHdf5ToTxtConverter<1,3>;
+template class CellWritersHdf5ToTxtConverter<2,3>;
+template class CellWritersHdf5ToTxtConverter<3,3>;
@@ -0,0 +1,73 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef CELLWRITERSHDF5TOTXTCONVERTER_HPP_
+#define CELLWRITERSHDF5TOTXTCONVERTER_HPP_
+
+#include <string>
+#include <vector>
+#include <boost/shared_ptr.hpp>
+#include "AbstractCellWriter.hpp"
+#include "FileFinder.hpp"
+#include "OutputFileHandler.hpp"
+
+/**
+ * Converts a file written by CellWritersHdf5Writer back into one text file per
+ * cell writer, in the directory containing the HDF5 file, so that the results can
+ * be viewed with the Chaste visualizer or processed by existing scripts.
+ *
+ * Each line holds an output time, a tab, and a record for each cell. The records
+ * are written by AbstractCellWriter::WriteCellRecordFromHdf5(), so each cell writer
+ * gives its own layout. The cell writers passed in are matched to the columns of
+ * the file by their output file names; any other columns are ignored.
+ */
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+class CellWritersHdf5ToTxtConverter
+{
+public:
+
+    /**
+     * Constructor, which does the conversion and writes the text files.
+     *
+     * @param rInputDirectory  the directory containing the HDF5 file, in which the text files are written
+     * @param rFileName  the name of the HDF5 file
+     * @param rCellWriters  the cell writers whose text files are to be written
+     */
+    CellWritersHdf5ToTxtConverter(const FileFinder& rInputDirectory,
+                                  const std::string& rFileName,
+                                  const std::vector<boost::shared_ptr<AbstractCellWriter<ELEMENT_DIM, SPACE_DIM> > >& rCellWriters);
+};
+
+#endif /*CELLWRITERSHDF5TOTXTCONVERTER_HPP_*/
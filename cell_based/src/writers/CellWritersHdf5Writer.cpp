@@ -0,0 +1,292 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <cstdlib>
+#include <cstring>
+
+#include "CellWritersHdf5Writer.hpp"
+#include "AbstractCellPopulation.hpp"
+#include "Exception.hpp"
+#include "PetscTools.hpp"
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+CellWritersHdf5Writer<ELEMENT_DIM, SPACE_DIM>::CellWritersHdf5Writer(OutputFileHandler& rOutputFileHandler,
+                                                                     const std::string& rFileName,
+                                                                     const std::vector<boost::shared_ptr<AbstractCellWriter<ELEMENT_DIM, SPACE_DIM> > >& rCellWriters)
+    : mCellWriters(rCellWriters),
+      mIsOpen(false),
+      mNumSteps(0),
+      mNumRows(0)
+{
+    // Column names: the components of the cell centre, then the cell writer's file name for each of its values
+    std::vector<std::string> column_names;
+    const char* coordinate_names[3] = {"x", "y", "z"};
+    for (unsigned i=0; i<SPACE_DIM; i++)
+    {
+        column_names.push_back(coordinate_names[i]);
+    }
+    for (unsigned i=0; i<mCellWriters.size(); i++)
+    {
+        std::string name = mCellWriters[i]->GetFileName();
+        unsigned num_values = mCellWriters[i]->GetNumHdf5Values();
+        if (num_values == 0)
+        {
+            EXCEPTION("The cell writer for " + name + " does not support HDF5 output, so cannot be used with SetUseHdf5Output().");
+        }
+        if (name.length() >= MAX_STRING_SIZE)
+        {
+            EXCEPTION("The cell writer file name " + name + " is too long to be stored in HDF5 output.");
+        }
+        column_names.insert(column_names.end(), num_values, name);
+    }
+    mNumDataColumns = column_names.size();
+
+    std::string file_name = rOutputFileHandler.GetOutputDirectoryFullPath() + rFileName;
+
+    // Set up a property list saying how we'll open the file
+    hid_t fapl = H5Pcreate(H5P_FILE_ACCESS);
+    H5Pset_fapl_mpio(fapl, PETSC_COMM_WORLD, MPI_INFO_NULL);
+    mFileId = H5Fcreate(file_name.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+    H5Pclose(fapl);
+
+    if (mFileId < 0)
+    {
+        EXCEPTION("Could not create HDF5 file " + file_name + " for cell writer output.");
+    }
+    mIsOpen = true;
+
+    mTimeDatasetId = CreateExtendibleDataset("Time", H5T_NATIVE_DOUBLE, 0, 128);
+    mRowsDatasetId = CreateExtendibleDataset("Rows", H5T_NATIVE_HSIZE, 2, 128);
+    mCellIndicesDatasetId = CreateExtendibleDataset("CellIndices", H5T_NATIVE_UINT, 2, 1024);
+    mCellDataDatasetId = CreateExtendibleDataset("CellData", H5T_NATIVE_DOUBLE, mNumDataColumns, 1024);
+
+    // Store the column names
+    hsize_t columns[1] = {column_names.size()};
+    hid_t colspace = H5Screate_simple(1, columns, NULL);
+    char* col_data = (char*) malloc(column_names.size() * sizeof(char) * MAX_STRING_SIZE);
+    char* col_data_offset = col_data;
+    for (unsigned i=0; i<column_names.size(); i++)
+    {
+        memset(col_data_offset, 0, MAX_STRING_SIZE * sizeof(char));
+        strcpy(col_data_offset, column_names[i].c_str());
+        col_data_offset += sizeof(char) * MAX_STRING_SIZE;
+    }
+
+    hid_t string_type = H5Tcopy(H5T_C_S1);
+    H5Tset_size(string_type, MAX_STRING_SIZE);
+    hid_t attr = H5Acreate(mCellDataDatasetId, "Variable Details", string_type, colspace, H5P_DEFAULT, H5P_DEFAULT);
+    H5Awrite(attr, string_type, col_data);
+
+    free(col_data);
+    H5Tclose(string_type);
+    H5Sclose(colspace);
+    H5Aclose(attr);
+
+    // Store the spatial dimension, so that the converter knows how many columns are coordinates
+    hsize_t one[1] = {1};
+    colspace = H5Screate_simple(1, one, NULL);
+    attr = H5Acreate(mCellDataDatasetId, "SpaceDimension", H5T_NATIVE_UINT, colspace, H5P_DEFAULT, H5P_DEFAULT);
+    unsigned space_dim = SPACE_DIM;
+    H5Awrite(attr, H5T_NATIVE_UINT, &space_dim);
+    H5Sclose(colspace);
+    H5Aclose(attr);
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+CellWritersHdf5Writer<ELEMENT_DIM, SPACE_DIM>::~CellWritersHdf5Writer()
+{
+    Close();
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+hid_t CellWritersHdf5Writer<ELEMENT_DIM, SPACE_DIM>::CreateExtendibleDataset(const std::string& rName, hid_t type, hsize_t numColumns, hsize_t chunkRows)
+{
+    unsigned rank = (numColumns == 0) ? 1 : 2;
+    hsize_t dims[2] = {0, numColumns};
+    hsize_t max_dims[2] = {H5S_UNLIMITED, numColumns};
+    hsize_t chunk_dims[2] = {chunkRows, numColumns};
+
+    hid_t cparms = H5Pcreate(H5P_DATASET_CREATE);
+    H5Pset_chunk(cparms, rank, chunk_dims);
+    hid_t filespace = H5Screate_simple(rank, dims, max_dims);
+    hid_t dataset_id = H5Dcreate(mFileId, rName.c_str(), type, filespace, H5P_DEFAULT, cparms, H5P_DEFAULT);
+    H5Sclose(filespace);
+    H5Pclose(cparms);
+
+    return dataset_id;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void CellWritersHdf5Writer<ELEMENT_DIM, SPACE_DIM>::AddCell(CellPtr pCell, AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>* pCellPopulation)
+{
+    mLocalCellIndices.push_back(pCellPopulation->GetLocationIndexUsingCell(pCell));
+    mLocalCellIndices.push_back(pCell->GetCellId());
+
+    c_vector<double, SPACE_DIM> cell_location = pCellPopulation->GetLocationOfCellCentre(pCell);
+    for (unsigned i=0; i<SPACE_DIM; i++)
+    {
+        mLocalCellData.push_back(cell_location[i]);
+    }
+    for (unsigned i=0; i<mCellWriters.size(); i++)
+    {
+        mCellWriters[i]->GetCellDataForHdf5Output(pCell, pCellPopulation, mWriterValues);
+        assert(mWriterValues.size() == mCellWriters[i]->GetNumHdf5Values());
+        mLocalCellData.insert(mLocalCellData.end(), mWriterValues.begin(), mWriterValues.end());
+    }
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void CellWritersHdf5Writer<ELEMENT_DIM, SPACE_DIM>::WriteRows(double time)
+{
+    assert(mIsOpen);
+
+    // Work out where this process's rows go, keeping process order as the round robin text output does
+    unsigned num_local_rows = mLocalCellIndices.size()/2;
+    std::vector<unsigned> num_rows_on_process(PetscTools::GetNumProcs(), num_local_rows);
+    if (PetscTools::IsParallel())
+    {
+        MPI_Allgather(&num_local_rows, 1, MPI_UNSIGNED, &num_rows_on_process[0], 1, MPI_UNSIGNED, PetscTools::GetWorld());
+    }
+    hsize_t first_local_row = mNumRows;
+    hsize_t num_new_rows = 0;
+    for (unsigned proc=0; proc<num_rows_on_process.size(); proc++)
+    {
+        if (proc < PetscTools::GetMyRank())
+        {
+            first_local_row += num_rows_on_process[proc];
+        }
+        num_new_rows += num_rows_on_process[proc];
+    }
+
+    // Extend along the time dimension (collective)
+    hsize_t step_dims[2] = {mNumSteps + 1, 2};
+    H5Dset_extent(mTimeDatasetId, step_dims);
+    H5Dset_extent(mRowsDatasetId, step_dims);
+
+    // The time and the row range for this step are written by the master
+    if (PetscTools::AmMaster())
+    {
+        hsize_t offset[2] = {mNumSteps, 0};
+        hsize_t count[2] = {1, 2};
+
+        hid_t memspace = H5Screate_simple(1, count, NULL);
+        hid_t hyperslab_space = H5Dget_space(mTimeDatasetId);
+        H5Sselect_hyperslab(hyperslab_space, H5S_SELECT_SET, offset, NULL, count, NULL);
+        H5Dwrite(mTimeDatasetId, H5T_NATIVE_DOUBLE, memspace, hyperslab_space, H5P_DEFAULT, &time);
+        H5Sclose(hyperslab_space);
+        H5Sclose(memspace);
+
+        hsize_t row_range[2] = {mNumRows, num_new_rows};
+        memspace = H5Screate_simple(2, count, NULL);
+        hyperslab_space = H5Dget_space(mRowsDatasetId);
+        H5Sselect_hyperslab(hyperslab_space, H5S_SELECT_SET, offset, NULL, count, NULL);
+        H5Dwrite(mRowsDatasetId, H5T_NATIVE_HSIZE, memspace, hyperslab_space, H5P_DEFAULT, row_range);
+        H5Sclose(hyperslab_space);
+        H5Sclose(memspace);
+    }
+
+    if (num_new_rows > 0)
+    {
+        hsize_t indices_dims[2] = {mNumRows + num_new_rows, 2};
+        hsize_t data_dims[2] = {mNumRows + num_new_rows, mNumDataColumns};
+        H5Dset_extent(mCellIndicesDatasetId, indices_dims);
+        H5Dset_extent(mCellDataDatasetId, data_dims);
+
+        hid_t property_list_id = H5Pcreate(H5P_DATASET_XFER);
+        H5Pset_dxpl_mpio(property_list_id, H5FD_MPIO_COLLECTIVE);
+
+        hid_t indices_memspace, indices_hyperslab_space, data_memspace, data_hyperslab_space;
+        if (num_local_rows > 0)
+        {
+            hsize_t offset[2] = {first_local_row, 0};
+
+            hsize_t indices_count[2] = {num_local_rows, 2};
+            indices_memspace = H5Screate_simple(2, indices_count, NULL);
+            indices_hyperslab_space = H5Dget_space(mCellIndicesDatasetId);
+            H5Sselect_hyperslab(indices_hyperslab_space, H5S_SELECT_SET, offset, NULL, indices_count, NULL);
+
+            hsize_t data_count[2] = {num_local_rows, mNumDataColumns};
+            data_memspace = H5Screate_simple(2, data_count, NULL);
+            data_hyperslab_space = H5Dget_space(mCellDataDatasetId);
+            H5Sselect_hyperslab(data_hyperslab_space, H5S_SELECT_SET, offset, NULL, data_count, NULL);
+        }
+        else
+        {
+            // This process has nothing to write but must still join in the collective writes
+            indices_memspace = H5Screate(H5S_NULL);
+            indices_hyperslab_space = H5Screate(H5S_NULL);
+            data_memspace = H5Screate(H5S_NULL);
+            data_hyperslab_space = H5Screate(H5S_NULL);
+        }
+
+        const unsigned* p_indices = mLocalCellIndices.empty() ? NULL : &mLocalCellIndices[0];
+        const double* p_data = mLocalCellData.empty() ? NULL : &mLocalCellData[0];
+        H5Dwrite(mCellIndicesDatasetId, H5T_NATIVE_UINT, indices_memspace, indices_hyperslab_space, property_list_id, p_indices);
+        H5Dwrite(mCellDataDatasetId, H5T_NATIVE_DOUBLE, data_memspace, data_hyperslab_space, property_list_id, p_data);
+
+        H5Sclose(indices_memspace);
+        H5Sclose(indices_hyperslab_space);
+        H5Sclose(data_memspace);
+        H5Sclose(data_hyperslab_space);
+        H5Pclose(property_list_id);
+    }
+
+    mNumSteps++;
+    mNumRows += num_new_rows;
+    mLocalCellIndices.clear();
+    mLocalCellData.clear();
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void CellWritersHdf5Writer<ELEMENT_DIM, SPACE_DIM>::Close()
+{
+    if (mIsOpen)
+    {
+        H5Dclose(mTimeDatasetId);
+        H5Dclose(mRowsDatasetId);
+        H5Dclose(mCellIndicesDatasetId);
+        H5Dclose(mCellDataDatasetId);
+        H5Fclose(mFileId);
+        mIsOpen = false;
+    }
+}
+
+// Explicit instantiation
+template class CellWritersHdf5Writer<1,1>;
+template class CellWritersHdf5Writer<1,2>;
+template class CellWritersHdf5Writer<2,2>;
+template class CellWritersHdf5Writer<1,3>;
+template class CellWritersHdf5Writer<2,3>;
+template class CellWritersHdf5Writer<3,3>;
@@ -0,0 +1,167 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef CELLWRITERSHDF5WRITER_HPP_
+#define CELLWRITERSHDF5WRITER_HPP_
+
+#include <string>
+#include <vector>
+#include <boost/shared_ptr.hpp>
+
+#include "AbstractHdf5Access.hpp"
+#include "AbstractCellWriter.hpp"
+#include "OutputFileHandler.hpp"
+
+/**
+ * Writes the output of a set of cell writers to a single HDF5 file, as an
+ * alternative to each cell writer appending formatted text to its own file in
+ * turn on each process.
+ *
+ * At each output time every process collects one row per local cell, holding the
+ * cell's location index, cell ID, centre and the values given by
+ * AbstractCellWriter::GetCellDataForHdf5Output() for each cell writer. The rows of all
+ * processes are then written, in process order, with one collective write per dataset.
+ * Only cell writers declaring a non-zero AbstractCellWriter::GetNumHdf5Values() can be
+ * stored in this way.
+ * The file contains the extendible datasets
+ *
+ *  - "Time": the output times;
+ *  - "Rows": for each output time, the first row and number of rows written;
+ *  - "CellIndices": the location index and cell ID of each row;
+ *  - "CellData": the centre and cell writer values of each row, with the column
+ *    names (the cell writers' output file names, repeated for writers with more than
+ *    one value) stored in the "Variable Details" attribute.
+ *
+ * CellWritersHdf5ToTxtConverter turns this file back into the text files that the
+ * cell writers would have written.
+ */
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+class CellWritersHdf5Writer
+{
+private:
+
+    /** The cell writers whose output is stored in the file. */
+    std::vector<boost::shared_ptr<AbstractCellWriter<ELEMENT_DIM, SPACE_DIM> > > mCellWriters;
+
+    /** HDF5 file identifier. */
+    hid_t mFileId;
+
+    /** Identifier of the "Time" dataset. */
+    hid_t mTimeDatasetId;
+
+    /** Identifier of the "Rows" dataset. */
+    hid_t mRowsDatasetId;
+
+    /** Identifier of the "CellIndices" dataset. */
+    hid_t mCellIndicesDatasetId;
+
+    /** Identifier of the "CellData" dataset. */
+    hid_t mCellDataDatasetId;
+
+    /** The number of columns of the "CellData" dataset. */
+    hsize_t mNumDataColumns;
+
+    /** Work space for the values of a single cell writer. */
+    std::vector<double> mWriterValues;
+
+    /** Whether the file is currently open. */
+    bool mIsOpen;
+
+    /** The number of output times written so far. */
+    hsize_t mNumSteps;
+
+    /** The total number of rows written so far, over all processes. */
+    hsize_t mNumRows;
+
+    /** Location indices and cell IDs of the rows collected on this process since the last write. */
+    std::vector<unsigned> mLocalCellIndices;
+
+    /** Centres and cell writer values of the rows collected on this process since the last write. */
+    std::vector<double> mLocalCellData;
+
+    /**
+     * Create an extendible dataset whose first dimension is unlimited.
+     *
+     * @param rName  the name of the dataset
+     * @param type  the HDF5 type of the entries
+     * @param numColumns  the size of the second dimension (0 for a one-dimensional dataset)
+     * @param chunkRows  the number of rows in each chunk
+     * @return the dataset identifier
+     */
+    hid_t CreateExtendibleDataset(const std::string& rName, hid_t type, hsize_t numColumns, hsize_t chunkRows);
+
+public:
+
+    /**
+     * Constructor. Collectively creates the file and its datasets.
+     * Throws if any of the cell writers does not support HDF5 output.
+     *
+     * @param rOutputFileHandler  handler for the directory in which to create the file
+     * @param rFileName  the name of the file
+     * @param rCellWriters  the cell writers whose output is to be stored
+     */
+    CellWritersHdf5Writer(OutputFileHandler& rOutputFileHandler,
+                          const std::string& rFileName,
+                          const std::vector<boost::shared_ptr<AbstractCellWriter<ELEMENT_DIM, SPACE_DIM> > >& rCellWriters);
+
+    /**
+     * Destructor. Closes the file if this has not been done already.
+     */
+    ~CellWritersHdf5Writer();
+
+    /**
+     * Collect the row for a cell owned by this process. Rows are written in the
+     * order in which they are added.
+     *
+     * @param pCell  the cell
+     * @param pCellPopulation  the cell population owning the cell
+     */
+    void AddCell(CellPtr pCell, AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>* pCellPopulation);
+
+    /**
+     * Collectively write the rows added on every process since the last call,
+     * extending the datasets by one output time.
+     *
+     * @param time  the current time
+     */
+    void WriteRows(double time);
+
+    /**
+     * Collectively close the file.
+     */
+    void Close();
+};
+
+#endif /*CELLWRITERSHDF5WRITER_HPP_*/
@@ -41,6 +41,33 @@ AbstractCellWriter<ELEMENT_DIM, SPACE_DIM>::AbstractCellWriter(const std::string
 {
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+unsigned AbstractCellWriter<ELEMENT_DIM, SPACE_DIM>::GetNumHdf5Values()
+{
+    return 0;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void AbstractCellWriter<ELEMENT_DIM, SPACE_DIM>::GetCellDataForHdf5Output(CellPtr pCell,
+                                                                          AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>* pCellPopulation,
+                                                                          std::vector<double>& rValues)
+{
+    rValues.assign(1, GetCellDataForVtkOutput(pCell, pCellPopulation));
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void AbstractCellWriter<ELEMENT_DIM, SPACE_DIM>::WriteCellRecordFromHdf5(std::ostream& rFile,
+                                                                         unsigned locationIndex,
+                                                                         unsigned cellId,
+                                                                         const c_vector<double, SPACE_DIM>& rCentre,
+                                                                         const std::vector<double>& rValues)
+{
+    for (unsigned i=0; i<rValues.size(); i++)
+    {
+        rFile << rValues[i] << " ";
+    }
+}
+
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void AbstractCellWriter<ELEMENT_DIM, SPACE_DIM>::SetVtkCellDataName(std::string vtkCellDataName)
 {
@@ -38,8 +38,11 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "ChasteSerialization.hpp"
 #include <boost/serialization/base_object.hpp>
+#include <ostream>
+#include <vector>
 #include "AbstractCellBasedWriter.hpp"
 #include "Cell.hpp"
+#include "UblasVectorInclude.hpp"
 
 // Forward declaration prevents circular include chain
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM> class AbstractCellPopulation;
@@ -100,6 +103,50 @@ public:
      */
     virtual void VisitCell(CellPtr pCell, AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>* pCellPopulation)=0;
 
+    /**
+     * Get the number of values stored for each cell when the cell writers' output
+     * goes to HDF5 (see CellWritersHdf5Writer). The location index, cell ID and
+     * centre of each cell are always stored, so this is the number of values
+     * needed besides these to reproduce what VisitCell() writes.
+     *
+     * By default this is zero, meaning the writer's output cannot be stored in
+     * HDF5 form; writers that support HDF5 output override this method, and
+     * WriteCellRecordFromHdf5() if their layout differs from the default.
+     *
+     * @return the number of values per cell, or zero if HDF5 output is not supported
+     */
+    virtual unsigned GetNumHdf5Values();
+
+    /**
+     * Get the values stored for a cell in HDF5 output. By default this is the
+     * single value given by GetCellDataForVtkOutput().
+     *
+     * @param pCell a cell
+     * @param pCellPopulation a pointer to the cell population owning the cell
+     * @param rValues filled in with GetNumHdf5Values() values
+     */
+    virtual void GetCellDataForHdf5Output(CellPtr pCell,
+                                          AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>* pCellPopulation,
+                                          std::vector<double>& rValues);
+
+    /**
+     * Write the record for one cell, in the layout used by VisitCell(), from the
+     * data stored in HDF5 output. This is used by CellWritersHdf5ToTxtConverter.
+     * By default each value is written followed by a space, as in the files read
+     * by the Chaste visualizer.
+     *
+     * @param rFile the stream to write to
+     * @param locationIndex the location index of the cell
+     * @param cellId the ID of the cell
+     * @param rCentre the centre of the cell
+     * @param rValues the values given by GetCellDataForHdf5Output()
+     */
+    virtual void WriteCellRecordFromHdf5(std::ostream& rFile,
+                                         unsigned locationIndex,
+                                         unsigned cellId,
+                                         const c_vector<double, SPACE_DIM>& rCentre,
+                                         const std::vector<double>& rValues);
+
     /**
      * Set the name of the cell data used in VTK output.
      * This method allows the user to change mVtkCellDataName from
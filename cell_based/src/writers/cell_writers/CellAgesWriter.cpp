@@ -66,6 +66,27 @@ void CellAgesWriter<ELEMENT_DIM, SPACE_DIM>::VisitCell(CellPtr pCell, AbstractCe
     *this->mpOutStream << pCell->GetAge() << " ";
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+unsigned CellAgesWriter<ELEMENT_DIM, SPACE_DIM>::GetNumHdf5Values()
+{
+    return 1;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void CellAgesWriter<ELEMENT_DIM, SPACE_DIM>::WriteCellRecordFromHdf5(std::ostream& rFile,
+                                                                     unsigned locationIndex,
+                                                                     unsigned cellId,
+                                                                     const c_vector<double, SPACE_DIM>& rCentre,
+                                                                     const std::vector<double>& rValues)
+{
+    rFile << locationIndex << " ";
+    for (unsigned i=0; i<SPACE_DIM; i++)
+    {
+        rFile << rCentre[i] << " ";
+    }
+    rFile << rValues[0] << " ";
+}
+
 // Explicit instantiation
 template class CellAgesWriter<1,1>;
 template class CellAgesWriter<1,2>;
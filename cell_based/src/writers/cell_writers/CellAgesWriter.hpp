@@ -101,6 +101,30 @@ public:
      * @param pCellPopulation a pointer to the cell population owning the cell
      */
     virtual void VisitCell(CellPtr pCell, AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>* pCellPopulation);
+
+    /**
+     * Overridden GetNumHdf5Values() method.
+     *
+     * @return 1, the age of the cell
+     */
+    virtual unsigned GetNumHdf5Values();
+
+    /**
+     * Overridden WriteCellRecordFromHdf5() method.
+     *
+     * Writes the location index, centre and age of the cell, in the layout used by VisitCell().
+     *
+     * @param rFile the stream to write to
+     * @param locationIndex the location index of the cell
+     * @param cellId the ID of the cell
+     * @param rCentre the centre of the cell
+     * @param rValues the values given by GetCellDataForHdf5Output()
+     */
+    virtual void WriteCellRecordFromHdf5(std::ostream& rFile,
+                                         unsigned locationIndex,
+                                         unsigned cellId,
+                                         const c_vector<double, SPACE_DIM>& rCentre,
+                                         const std::vector<double>& rValues);
 };
 
 #include "SerializationExportWrapper.hpp"
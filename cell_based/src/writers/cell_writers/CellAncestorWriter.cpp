@@ -57,6 +57,12 @@ void CellAncestorWriter<ELEMENT_DIM, SPACE_DIM>::VisitCell(CellPtr pCell, Abstra
     *this->mpOutStream << ancestor_index << " ";
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+unsigned CellAncestorWriter<ELEMENT_DIM, SPACE_DIM>::GetNumHdf5Values()
+{
+    return 1;
+}
+
 // Explicit instantiation
 template class CellAncestorWriter<1,1>;
 template class CellAncestorWriter<1,2>;
@@ -81,6 +81,27 @@ std::string CellDataItemWriter<ELEMENT_DIM, SPACE_DIM>::GetCellDataVariableName(
    return mCellDataVariableName;
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+unsigned CellDataItemWriter<ELEMENT_DIM, SPACE_DIM>::GetNumHdf5Values()
+{
+    return 1;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void CellDataItemWriter<ELEMENT_DIM, SPACE_DIM>::WriteCellRecordFromHdf5(std::ostream& rFile,
+                                                                         unsigned locationIndex,
+                                                                         unsigned cellId,
+                                                                         const c_vector<double, SPACE_DIM>& rCentre,
+                                                                         const std::vector<double>& rValues)
+{
+    rFile << locationIndex << " " << cellId << " ";
+    for (unsigned i=0; i<SPACE_DIM; i++)
+    {
+        rFile << rCentre[i] << " ";
+    }
+    rFile << rValues[0] << " ";
+}
+
 // Explicit instantiation
 template class CellDataItemWriter<1,1>;
 template class CellDataItemWriter<1,2>;
@@ -118,6 +118,30 @@ public:
      * @return mCellDataVariableName used in archiving.
      */
     std::string GetCellDataVariableName() const;
+
+    /**
+     * Overridden GetNumHdf5Values() method.
+     *
+     * @return 1, the level of the cell data item
+     */
+    virtual unsigned GetNumHdf5Values();
+
+    /**
+     * Overridden WriteCellRecordFromHdf5() method.
+     *
+     * Writes the location index, ID, centre and level of the cell data item of the cell, in the layout used by VisitCell().
+     *
+     * @param rFile the stream to write to
+     * @param locationIndex the location index of the cell
+     * @param cellId the ID of the cell
+     * @param rCentre the centre of the cell
+     * @param rValues the values given by GetCellDataForHdf5Output()
+     */
+    virtual void WriteCellRecordFromHdf5(std::ostream& rFile,
+                                         unsigned locationIndex,
+                                         unsigned cellId,
+                                         const c_vector<double, SPACE_DIM>& rCentre,
+                                         const std::vector<double>& rValues);
 };
 
 #include "SerializationExportWrapper.hpp"
@@ -81,6 +81,41 @@ void CellDeltaNotchWriter<ELEMENT_DIM, SPACE_DIM>::VisitCell(CellPtr pCell, Abst
     *this->mpOutStream << mean_delta << " ";
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+unsigned CellDeltaNotchWriter<ELEMENT_DIM, SPACE_DIM>::GetNumHdf5Values()
+{
+    return 3;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void CellDeltaNotchWriter<ELEMENT_DIM, SPACE_DIM>::GetCellDataForHdf5Output(CellPtr pCell,
+                                                                            AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>* pCellPopulation,
+                                                                            std::vector<double>& rValues)
+{
+    rValues.resize(3);
+    rValues[0] = pCell->GetCellData()->GetItem("delta");
+    rValues[1] = pCell->GetCellData()->GetItem("notch");
+    rValues[2] = pCell->GetCellData()->GetItem("mean delta");
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void CellDeltaNotchWriter<ELEMENT_DIM, SPACE_DIM>::WriteCellRecordFromHdf5(std::ostream& rFile,
+                                                                           unsigned locationIndex,
+                                                                           unsigned cellId,
+                                                                           const c_vector<double, SPACE_DIM>& rCentre,
+                                                                           const std::vector<double>& rValues)
+{
+    rFile << locationIndex << " " << cellId << " ";
+    for (unsigned i=0; i<SPACE_DIM; i++)
+    {
+        rFile << rCentre[i] << " ";
+    }
+    for (unsigned i=0; i<rValues.size(); i++)
+    {
+        rFile << rValues[i] << " ";
+    }
+}
+
 // Explicit instantiation
 template class CellDeltaNotchWriter<1,1>;
 template class CellDeltaNotchWriter<1,2>;
@@ -64,6 +64,26 @@ void CellIdWriter<ELEMENT_DIM, SPACE_DIM>::VisitCell(CellPtr pCell, AbstractCell
     }
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+unsigned CellIdWriter<ELEMENT_DIM, SPACE_DIM>::GetNumHdf5Values()
+{
+    return 1;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void CellIdWriter<ELEMENT_DIM, SPACE_DIM>::WriteCellRecordFromHdf5(std::ostream& rFile,
+                                                                   unsigned locationIndex,
+                                                                   unsigned cellId,
+                                                                   const c_vector<double, SPACE_DIM>& rCentre,
+                                                                   const std::vector<double>& rValues)
+{
+    rFile << " " << cellId << " " << locationIndex;
+    for (unsigned i=0; i<SPACE_DIM; i++)
+    {
+        rFile << " " << rCentre[i];
+    }
+}
+
 // Explicit instantiation
 template class CellIdWriter<1,1>;
 template class CellIdWriter<1,2>;
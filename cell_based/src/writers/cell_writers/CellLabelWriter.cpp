@@ -80,6 +80,26 @@ void CellLabelWriter<ELEMENT_DIM, SPACE_DIM>::VisitCell(CellPtr pCell, AbstractC
     }
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+unsigned CellLabelWriter<ELEMENT_DIM, SPACE_DIM>::GetNumHdf5Values()
+{
+    return 1;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void CellLabelWriter<ELEMENT_DIM, SPACE_DIM>::WriteCellRecordFromHdf5(std::ostream& rFile,
+                                                                      unsigned locationIndex,
+                                                                      unsigned cellId,
+                                                                      const c_vector<double, SPACE_DIM>& rCentre,
+                                                                      const std::vector<double>& rValues)
+{
+    rFile << " " << static_cast<unsigned>(rValues[0]) << " " << locationIndex;
+    for (unsigned i=0; i<SPACE_DIM; i++)
+    {
+        rFile << " " << rCentre[i];
+    }
+}
+
 // Explicit instantiation
 template class CellLabelWriter<1,1>;
 template class CellLabelWriter<1,2>;
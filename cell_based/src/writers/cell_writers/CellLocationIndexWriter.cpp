@@ -57,6 +57,22 @@ void CellLocationIndexWriter<ELEMENT_DIM, SPACE_DIM>::VisitCell(CellPtr pCell, A
     *this->mpOutStream << location_index << " ";
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+unsigned CellLocationIndexWriter<ELEMENT_DIM, SPACE_DIM>::GetNumHdf5Values()
+{
+    return 1;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void CellLocationIndexWriter<ELEMENT_DIM, SPACE_DIM>::WriteCellRecordFromHdf5(std::ostream& rFile,
+                                                                              unsigned locationIndex,
+                                                                              unsigned cellId,
+                                                                              const c_vector<double, SPACE_DIM>& rCentre,
+                                                                              const std::vector<double>& rValues)
+{
+    rFile << locationIndex << " ";
+}
+
 // Explicit instantiation
 template class CellLocationIndexWriter<1,1>;
 template class CellLocationIndexWriter<1,2>;
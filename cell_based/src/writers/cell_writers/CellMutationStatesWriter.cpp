@@ -80,6 +80,12 @@ void CellMutationStatesWriter<ELEMENT_DIM, SPACE_DIM>::VisitCell(CellPtr pCell,
     *this->mpOutStream << mutation_state << " ";
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+unsigned CellMutationStatesWriter<ELEMENT_DIM, SPACE_DIM>::GetNumHdf5Values()
+{
+    return 1;
+}
+
 // Explicit instantiation
 template class CellMutationStatesWriter<1,1>;
 template class CellMutationStatesWriter<1,2>;
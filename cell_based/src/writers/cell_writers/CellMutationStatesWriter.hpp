@@ -99,6 +99,13 @@ public:
      * @param pCellPopulation a pointer to the cell population owning the cell
      */
     virtual void VisitCell(CellPtr pCell, AbstractCellPopulation<ELEMENT_DIM, SPACE_DIM>* pCellPopulation);
+
+    /**
+     * Overridden GetNumHdf5Values() method.
+     *
+     * @return 1, the mutation state (or label) colour of the cell
+     */
+    virtual unsigned GetNumHdf5Values();
 };
 
 #include "SerializationExportWrapper.hpp"
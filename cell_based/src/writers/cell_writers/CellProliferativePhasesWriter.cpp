@@ -58,6 +58,12 @@ void CellProliferativePhasesWriter<ELEMENT_DIM, SPACE_DIM>::VisitCell(CellPtr pC
     *this->mpOutStream << phase << " ";
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+unsigned CellProliferativePhasesWriter<ELEMENT_DIM, SPACE_DIM>::GetNumHdf5Values()
+{
+    return 1;
+}
+
 // Explicit instantiation
 template class CellProliferativePhasesWriter<1,1>;
 template class CellProliferativePhasesWriter<1,2>;
@@ -97,6 +97,12 @@ void CellProliferativeTypesWriter<ELEMENT_DIM, SPACE_DIM>::VisitCell(CellPtr pCe
     *this->mpOutStream << colour << " ";
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+unsigned CellProliferativeTypesWriter<ELEMENT_DIM, SPACE_DIM>::GetNumHdf5Values()
+{
+    return 1;
+}
+
 // Explicit instantiation
 template class CellProliferativeTypesWriter<1,1>;
 template class CellProliferativeTypesWriter<1,2>;
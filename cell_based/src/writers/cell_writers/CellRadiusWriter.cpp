@@ -78,6 +78,27 @@ void CellRadiusWriter<ELEMENT_DIM, SPACE_DIM>::VisitCell(CellPtr pCell, Abstract
     *this->mpOutStream << cell_radius << " ";
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+unsigned CellRadiusWriter<ELEMENT_DIM, SPACE_DIM>::GetNumHdf5Values()
+{
+    return 1;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void CellRadiusWriter<ELEMENT_DIM, SPACE_DIM>::WriteCellRecordFromHdf5(std::ostream& rFile,
+                                                                       unsigned locationIndex,
+                                                                       unsigned cellId,
+                                                                       const c_vector<double, SPACE_DIM>& rCentre,
+                                                                       const std::vector<double>& rValues)
+{
+    rFile << locationIndex << " " << cellId << " ";
+    for (unsigned i=0; i<SPACE_DIM; i++)
+    {
+        rFile << rCentre[i] << " ";
+    }
+    rFile << rValues[0] << " ";
+}
+
 // Explicit instantiation
 template class CellRadiusWriter<1,1>;
 template class CellRadiusWriter<1,2>;
@@ -80,6 +80,27 @@ void CellRosetteRankWriter<ELEMENT_DIM, SPACE_DIM>::VisitCell(CellPtr pCell, Abs
     *this->mpOutStream << rosette_rank << " ";
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+unsigned CellRosetteRankWriter<ELEMENT_DIM, SPACE_DIM>::GetNumHdf5Values()
+{
+    return 1;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void CellRosetteRankWriter<ELEMENT_DIM, SPACE_DIM>::WriteCellRecordFromHdf5(std::ostream& rFile,
+                                                                            unsigned locationIndex,
+                                                                            unsigned cellId,
+                                                                            const c_vector<double, SPACE_DIM>& rCentre,
+                                                                            const std::vector<double>& rValues)
+{
+    rFile << locationIndex << " " << cellId << " ";
+    for (unsigned i=0; i<SPACE_DIM; i++)
+    {
+        rFile << rCentre[i] << " ";
+    }
+    rFile << rValues[0] << " ";
+}
+
 // Explicit instantiation
 template class CellRosetteRankWriter<1,1>;
 template class CellRosetteRankWriter<1,2>;
@@ -70,6 +70,31 @@ void CellVolumesWriter<ELEMENT_DIM, SPACE_DIM>::VisitCell(CellPtr pCell, Abstrac
     }
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+unsigned CellVolumesWriter<ELEMENT_DIM, SPACE_DIM>::GetNumHdf5Values()
+{
+    return 1;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void CellVolumesWriter<ELEMENT_DIM, SPACE_DIM>::WriteCellRecordFromHdf5(std::ostream& rFile,
+                                                                        unsigned locationIndex,
+                                                                        unsigned cellId,
+                                                                        const c_vector<double, SPACE_DIM>& rCentre,
+                                                                        const std::vector<double>& rValues)
+{
+    // Cells with infinite volume (boundary cells in MeshBasedCellPopulation) are not written
+    if (rValues[0] < DBL_MAX)
+    {
+        rFile << locationIndex << " " << cellId << " ";
+        for (unsigned i=0; i<SPACE_DIM; i++)
+        {
+            rFile << rCentre[i] << " ";
+        }
+        rFile << rValues[0] << " ";
+    }
+}
+
 // Explicit instantiation
 template class CellVolumesWriter<1,1>;
 template class CellVolumesWriter<1,2>;
@@ -0,0 +1,303 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef TESTCELLCYCLEMODELODEBATCHSOLVER_HPP_
+#define TESTCELLCYCLEMODELODEBATCHSOLVER_HPP_
+
+#include <cxxtest/TestSuite.h>
+
+#include <boost/archive/text_oarchive.hpp>
+#include <boost/archive/text_iarchive.hpp>
+
+#include <fstream>
+#include <vector>
+
+#include "CellCycleModelOdeBatchSolver.hpp"
+#include "OutputFileHandler.hpp"
+#include "Goldbeter1991SrnModel.hpp"
+#include "Alarcon2004OxygenBasedCellCycleModel.hpp"
+#include "UniformlyDistributedGenerationBasedCellCycleModel.hpp"
+#include "AbstractCellBasedTestSuite.hpp"
+#include "WildTypeCellMutationState.hpp"
+#include "StemCellProliferativeType.hpp"
+#include "DifferentiatedCellProliferativeType.hpp"
+#include "SmartPointers.hpp"
+
+// This test is always run sequentially (never in parallel)
+#include "FakePetscSetup.hpp"
+
+class TestCellCycleModelOdeBatchSolver : public AbstractCellBasedTestSuite
+{
+public:
+
+    void TestBatchedSrnModelsMatchUnbatched() throw(Exception)
+    {
+        SimulationTime* p_simulation_time = SimulationTime::Instance();
+        double end_time = 10.0;
+        p_simulation_time->SetEndTimeAndNumberOfTimeSteps(end_time, 100);
+
+        MAKE_PTR(WildTypeCellMutationState, p_healthy_state);
+        MAKE_PTR(DifferentiatedCellProliferativeType, p_diff_type);
+
+        // Create two identical sets of cells, with a spread of initial conditions
+        unsigned num_cells = 5;
+        std::vector<Goldbeter1991SrnModel*> batched_models;
+        std::vector<Goldbeter1991SrnModel*> serial_models;
+        std::vector<CellPtr> cells;
+        for (unsigned i=0; i<2*num_cells; i++)
+        {
+            std::vector<double> initial_conditions;
+            initial_conditions.push_back(0.1 + 0.1*(i%num_cells));
+            initial_conditions.push_back(0.6);
+            initial_conditions.push_back(0.7);
+
+            Goldbeter1991SrnModel* p_srn_model = new Goldbeter1991SrnModel();
+            p_srn_model->SetInitialConditions(initial_conditions);
+
+            UniformlyDistributedGenerationBasedCellCycleModel* p_cc_model = new UniformlyDistributedGenerationBasedCellCycleModel();
+            CellPtr p_cell(new Cell(p_healthy_state, p_cc_model, p_srn_model, false, CellPropertyCollection()));
+            p_cell->SetCellProliferativeType(p_diff_type);
+            p_cell->InitialiseCellCycleModel();
+            p_cell->InitialiseSrnModel();
+            cells.push_back(p_cell);
+
+            if (i < num_cells)
+            {
+                batched_models.push_back(p_srn_model);
+            }
+            else
+            {
+                serial_models.push_back(p_srn_model);
+            }
+        }
+
+        std::vector<CellCycleModelOdeHandler*> handlers(batched_models.begin(), batched_models.end());
+        CellCycleModelOdeBatchSolver batch_solver;
+        TS_ASSERT_EQUALS(batch_solver.GetNumSystemsSolved(), 0u);
+
+        while (p_simulation_time->GetTime() < end_time)
+        {
+            p_simulation_time->IncrementTimeOneStep();
+
+            batch_solver.SolveToTime(handlers, p_simulation_time->GetTime());
+            TS_ASSERT_EQUALS(batch_solver.GetNumSystemsSolved(), num_cells);
+
+            for (unsigned i=0; i<num_cells; i++)
+            {
+                batched_models[i]->SimulateToCurrentTime();
+                serial_models[i]->SimulateToCurrentTime();
+
+                std::vector<double> batched_state = batched_models[i]->GetProteinConcentrations();
+                std::vector<double> serial_state = serial_models[i]->GetProteinConcentrations();
+                TS_ASSERT_EQUALS(batched_state.size(), serial_state.size());
+                for (unsigned j=0; j<batched_state.size(); j++)
+                {
+                    TS_ASSERT_DELTA(batched_state[j], serial_state[j], 1e-12);
+                }
+            }
+        }
+
+        // Systems that are already up to date are not solved again
+        batch_solver.SolveToTime(handlers, p_simulation_time->GetTime());
+        TS_ASSERT_EQUALS(batch_solver.GetNumSystemsSolved(), 0u);
+
+        // Test converged to the same steady state as the unbatched solve
+        TS_ASSERT_DELTA(batched_models[4]->GetC(), 5.5642, 1e-4);
+        TS_ASSERT_DELTA(batched_models[4]->GetM(), 4.7817, 1e-4);
+        TS_ASSERT_DELTA(batched_models[4]->GetX(), 2.1160, 1e-4);
+    }
+
+    void TestBatchedCellCycleModelsWithStoppingEvent() throw(Exception)
+    {
+        SimulationTime* p_simulation_time = SimulationTime::Instance();
+        double end_time = 30.0;
+        p_simulation_time->SetEndTimeAndNumberOfTimeSteps(end_time, 300);
+
+        MAKE_PTR(WildTypeCellMutationState, p_state);
+        MAKE_PTR(StemCellProliferativeType, p_stem_type);
+
+        // Create two identical sets of cells, with a spread of oxygen concentrations
+        unsigned num_cells = 4;
+        std::vector<Alarcon2004OxygenBasedCellCycleModel*> batched_models;
+        std::vector<Alarcon2004OxygenBasedCellCycleModel*> serial_models;
+        std::vector<CellPtr> cells;
+        for (unsigned i=0; i<2*num_cells; i++)
+        {
+            Alarcon2004OxygenBasedCellCycleModel* p_model = new Alarcon2004OxygenBasedCellCycleModel();
+            p_model->SetDimension(2);
+
+            CellPtr p_cell(new Cell(p_state, p_model));
+            p_cell->SetCellProliferativeType(p_stem_type);
+            p_cell->GetCellData()->SetItem("oxygen", 1.0 - 0.05*(i%num_cells));
+            p_cell->InitialiseCellCycleModel();
+            cells.push_back(p_cell);
+
+            if (i < num_cells)
+            {
+                batched_models.push_back(p_model);
+            }
+            else
+            {
+                serial_models.push_back(p_model);
+            }
+        }
+
+        std::vector<CellCycleModelOdeHandler*> handlers(batched_models.begin(), batched_models.end());
+        CellCycleModelOdeBatchSolver batch_solver;
+
+        std::vector<bool> batched_ready(num_cells, false);
+        std::vector<bool> serial_ready(num_cells, false);
+        while (p_simulation_time->GetTime() < end_time)
+        {
+            p_simulation_time->IncrementTimeOneStep();
+
+            batch_solver.SolveToTime(handlers, p_simulation_time->GetTime());
+
+            for (unsigned i=0; i<num_cells; i++)
+            {
+                // Once a model has passed its stopping event we stop querying it, as a simulation would divide the cell
+                if (!batched_ready[i])
+                {
+                    batched_ready[i] = batched_models[i]->ReadyToDivide();
+                    serial_ready[i] = serial_models[i]->ReadyToDivide();
+                    TS_ASSERT_EQUALS(batched_ready[i], serial_ready[i]);
+
+                    std::vector<double> batched_state = batched_models[i]->GetProteinConcentrations();
+                    std::vector<double> serial_state = serial_models[i]->GetProteinConcentrations();
+                    for (unsigned j=0; j<batched_state.size(); j++)
+                    {
+                        TS_ASSERT_DELTA(batched_state[j], serial_state[j], 1e-12);
+                    }
+                }
+            }
+        }
+
+        // The well-oxygenated cell should have divided; in each case the stopping event is located at the same time
+        TS_ASSERT_EQUALS(batched_ready[0], true);
+        for (unsigned i=0; i<num_cells; i++)
+        {
+            if (batched_ready[i])
+            {
+                TS_ASSERT_DELTA(batched_models[i]->GetOdeStopTime(), serial_models[i]->GetOdeStopTime(), 1e-12);
+            }
+        }
+
+        // Models that have finished running their ODEs are skipped
+        batch_solver.SolveToTime(handlers, p_simulation_time->GetTime());
+        TS_ASSERT_EQUALS(batch_solver.GetNumSystemsSolved(), 0u);
+    }
+
+    void TestArchivingWithPendingStoppingEvent() throw(Exception)
+    {
+        OutputFileHandler handler("archive", false);
+        handler.SetArchiveDirectory();
+        std::string archive_filename = handler.GetOutputDirectoryFullPath() + "pending_stopping_event.arch";
+
+        double serial_stop_time;
+        {
+            SimulationTime* p_simulation_time = SimulationTime::Instance();
+            double end_time = 30.0;
+            p_simulation_time->SetEndTimeAndNumberOfTimeSteps(end_time, 300);
+
+            MAKE_PTR(WildTypeCellMutationState, p_state);
+            MAKE_PTR(StemCellProliferativeType, p_stem_type);
+
+            // Two identical cells, one solved in a batch and one on its own
+            std::vector<Alarcon2004OxygenBasedCellCycleModel*> models;
+            std::vector<CellPtr> cells;
+            for (unsigned i=0; i<2; i++)
+            {
+                Alarcon2004OxygenBasedCellCycleModel* p_model = new Alarcon2004OxygenBasedCellCycleModel();
+                p_model->SetDimension(2);
+
+                CellPtr p_cell(new Cell(p_state, p_model));
+                p_cell->SetCellProliferativeType(p_stem_type);
+                p_cell->GetCellData()->SetItem("oxygen", 1.0);
+                p_cell->InitialiseCellCycleModel();
+                cells.push_back(p_cell);
+                models.push_back(p_model);
+            }
+
+            std::vector<CellCycleModelOdeHandler*> handlers(1, models[0]);
+            CellCycleModelOdeBatchSolver batch_solver;
+
+            // Stop as soon as the batched solve has found the stopping event, before it is reported
+            bool serial_ready = false;
+            while (!serial_ready && p_simulation_time->GetTime() < end_time)
+            {
+                p_simulation_time->IncrementTimeOneStep();
+                batch_solver.SolveToTime(handlers, p_simulation_time->GetTime());
+
+                serial_ready = models[1]->ReadyToDivide();
+                if (!serial_ready)
+                {
+                    TS_ASSERT_EQUALS(models[0]->ReadyToDivide(), false);
+                }
+            }
+            TS_ASSERT_EQUALS(serial_ready, true);
+            TS_ASSERT_EQUALS(batch_solver.GetNumSystemsSolved(), 1u);
+            serial_stop_time = models[1]->GetOdeStopTime();
+
+            std::ofstream ofs(archive_filename.c_str());
+            boost::archive::text_oarchive output_arch(ofs);
+
+            CellPtr const p_const_cell = cells[0];
+            output_arch << static_cast<const SimulationTime&>(*p_simulation_time);
+            output_arch << p_const_cell;
+
+            SimulationTime::Destroy();
+        }
+
+        {
+            SimulationTime* p_simulation_time = SimulationTime::Instance();
+            p_simulation_time->SetStartTime(0.0);
+
+            CellPtr p_cell;
+
+            std::ifstream ifs(archive_filename.c_str(), std::ios::binary);
+            boost::archive::text_iarchive input_arch(ifs);
+
+            input_arch >> *p_simulation_time;
+            input_arch >> p_cell;
+
+            // The stopping event found before saving is reported after loading, at the same time as in the serial solve
+            Alarcon2004OxygenBasedCellCycleModel* p_model = static_cast<Alarcon2004OxygenBasedCellCycleModel*>(p_cell->GetCellCycleModel());
+            TS_ASSERT_EQUALS(p_model->ReadyToDivide(), true);
+            TS_ASSERT_DELTA(p_model->GetOdeStopTime(), serial_stop_time, 1e-12);
+        }
+    }
+};
+
+#endif /*TESTCELLCYCLEMODELODEBATCHSOLVER_HPP_*/
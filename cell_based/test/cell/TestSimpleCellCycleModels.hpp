@@ -367,6 +367,64 @@ public:
         }
     }
 
+    void TestUniformlyDistributedCellCycleModelWithCounterBasedRandomStream() throw(Exception)
+    {
+        SimulationTime* p_simulation_time = SimulationTime::Instance();
+        p_simulation_time->SetEndTimeAndNumberOfTimeSteps(10.0, 10);
+        p_simulation_time->IncrementTimeOneStep();
+
+        MAKE_PTR(WildTypeCellMutationState, p_healthy_state);
+        MAKE_PTR(TransitCellProliferativeType, p_transit_type);
+
+        unsigned num_cells = 10;
+        std::vector<CellPtr> cells;
+        for (unsigned i=0; i<num_cells; i++)
+        {
+            UniformlyDistributedCellCycleModel* p_model = new UniformlyDistributedCellCycleModel;
+            TS_ASSERT_EQUALS(p_model->GetUseCounterBasedRandomStream(), false);
+            p_model->SetUseCounterBasedRandomStream();
+            TS_ASSERT_EQUALS(p_model->GetUseCounterBasedRandomStream(), true);
+
+            CellPtr p_cell(new Cell(p_healthy_state, p_model));
+            p_cell->SetCellProliferativeType(p_transit_type);
+            cells.push_back(p_cell);
+        }
+
+        // Initialise the cells in index order
+        std::vector<double> forward_durations(num_cells);
+        for (unsigned i=0; i<num_cells; i++)
+        {
+            cells[i]->InitialiseCellCycleModel();
+            forward_durations[i] = static_cast<UniformlyDistributedCellCycleModel*>(cells[i]->GetCellCycleModel())->GetCellCycleDuration();
+            TS_ASSERT_LESS_THAN_EQUALS(12.0, forward_durations[i]);
+            TS_ASSERT_LESS_THAN_EQUALS(forward_durations[i], 14.0);
+        }
+
+        // The durations differ between cells
+        TS_ASSERT_DIFFERS(forward_durations[0], forward_durations[1]);
+
+        // Initialising in reverse order, with other draws from the shared generator in between, gives the same durations
+        for (unsigned i=num_cells; i-- > 0; )
+        {
+            RandomNumberGenerator::Instance()->ranf();
+            cells[i]->InitialiseCellCycleModel();
+            TS_ASSERT_DELTA(static_cast<UniformlyDistributedCellCycleModel*>(cells[i]->GetCellCycleModel())->GetCellCycleDuration(),
+                            forward_durations[i], 1e-12);
+        }
+
+        // A daughter inherits the setting, and its duration is keyed by its own cell ID
+        p_simulation_time->IncrementTimeOneStep();
+        cells[0]->GetCellCycleModel()->SetBirthTime(-20.0);
+        TS_ASSERT_EQUALS(cells[0]->ReadyToDivide(), true);
+        CellPtr p_daughter = cells[0]->Divide();
+        UniformlyDistributedCellCycleModel* p_daughter_model = static_cast<UniformlyDistributedCellCycleModel*>(p_daughter->GetCellCycleModel());
+        TS_ASSERT_EQUALS(p_daughter_model->GetUseCounterBasedRandomStream(), true);
+
+        unsigned time_step = p_simulation_time->GetTimeStepsElapsed();
+        double expected_duration = 12.0 + 2.0*RandomNumberGenerator::Instance()->GetStream(p_daughter->GetCellId(), time_step).ranf();
+        TS_ASSERT_DELTA(p_daughter_model->GetCellCycleDuration(), expected_duration, 1e-12);
+    }
+
     void TestGammaDistributedCellCycleModel() throw(Exception)
     {
         TS_ASSERT_THROWS_NOTHING(GammaDistributedCellCycleModel cell_model);
@@ -1098,6 +1156,7 @@ public:
             p_model->SetDimension(2);
             dynamic_cast<UniformlyDistributedCellCycleModel*>(p_model)->SetMinCellCycleDuration(1.0);
             dynamic_cast<UniformlyDistributedCellCycleModel*>(p_model)->SetMaxCellCycleDuration(2.0);
+            dynamic_cast<UniformlyDistributedCellCycleModel*>(p_model)->SetUseCounterBasedRandomStream();
 
             std::ofstream ofs(archive_filename.c_str());
             boost::archive::text_oarchive output_arch(ofs);
@@ -1125,6 +1184,7 @@ public:
             TS_ASSERT_EQUALS(p_model2->GetDimension(),2u);
             TS_ASSERT_DELTA(dynamic_cast<UniformlyDistributedCellCycleModel*>(p_model2)->GetMinCellCycleDuration(),1.0,1e-5);
             TS_ASSERT_DELTA(dynamic_cast<UniformlyDistributedCellCycleModel*>(p_model2)->GetMaxCellCycleDuration(),2.0,1e-5);
+            TS_ASSERT_EQUALS(dynamic_cast<UniformlyDistributedCellCycleModel*>(p_model2)->GetUseCounterBasedRandomStream(), true);
 
 
             TS_ASSERT_DELTA(RandomNumberGenerator::Instance()->ranf(), random_number_test, 1e-6);
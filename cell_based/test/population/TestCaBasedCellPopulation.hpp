@@ -50,12 +50,14 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "FixedDurationGenerationBasedCellCycleModel.hpp"
 #include "DifferentiatedCellProliferativeType.hpp"
 #include "DiffusionCaUpdateRule.hpp"
+#include "RandomCaSwitchingUpdateRule.hpp"
 #include "AbstractCellBasedTestSuite.hpp"
 #include "ArchiveOpener.hpp"
 #include "WildTypeCellMutationState.hpp"
 #include "SmartPointers.hpp"
 #include "CellLabel.hpp"
 #include "FileComparison.hpp"
+#include "RandomNumberGenerator.hpp"
 
 // Cell writers
 #include "CellAgesWriter.hpp"
@@ -732,6 +734,163 @@ public:
         TS_ASSERT_EQUALS(cell_population.rGetCells().size(), 1u);
     }
 
+    void TestUpdateCellLocationsKineticMonteCarlo() throw(Exception)
+    {
+        // Create a simple 2D PottsMesh with a single cell
+        PottsMeshGenerator<2> generator(5, 0, 0, 5, 0, 0);
+        PottsMesh<2>* p_mesh = generator.GetMesh();
+
+        std::vector<CellPtr> cells;
+        CellsGenerator<FixedDurationGenerationBasedCellCycleModel, 2> cells_generator;
+        cells_generator.GenerateBasic(cells, 1);
+
+        std::vector<unsigned> location_indices;
+        location_indices.push_back(12);
+
+        CaBasedCellPopulation<2u> cell_population(*p_mesh, cells, location_indices);
+        TS_ASSERT_EQUALS(cell_population.GetUseKineticMonteCarlo(), false);
+        cell_population.SetUseKineticMonteCarlo();
+        TS_ASSERT_EQUALS(cell_population.GetUseKineticMonteCarlo(), true);
+
+        // With no update rules there are no events
+        cell_population.UpdateCellLocations(1.0);
+        TS_ASSERT_EQUALS(cell_population.GetNumKineticMonteCarloEvents(), 0u);
+        TS_ASSERT_EQUALS(cell_population.GetLocationIndexUsingCell(*(cell_population.Begin())), 12u);
+
+        // The rates need not satisfy the time step restrictions of the sweeping scheme
+        MAKE_PTR(DiffusionCaUpdateRule<2u>, p_diffusion_update_rule);
+        p_diffusion_update_rule->SetDiffusionParameter(1.0);
+        cell_population.AddUpdateRule(p_diffusion_update_rule);
+
+        for (unsigned i=0; i<10; i++)
+        {
+            TS_ASSERT_THROWS_NOTHING(cell_population.UpdateCellLocations(1.0));
+        }
+        TS_ASSERT_LESS_THAN(0u, cell_population.GetNumKineticMonteCarloEvents());
+
+        // The cell is still on the lattice and the available spaces are consistent
+        TS_ASSERT_EQUALS(cell_population.rGetCells().size(), 1u);
+        unsigned location = cell_population.GetLocationIndexUsingCell(*(cell_population.Begin()));
+        for (unsigned i=0; i<p_mesh->GetNumNodes(); i++)
+        {
+            TS_ASSERT_EQUALS(cell_population.rGetAvailableSpaces()[i], (i == location ? 0u : 1u));
+        }
+
+        // A negative rate is reported
+        p_diffusion_update_rule->SetDiffusionParameter(-1.0);
+        TS_ASSERT_THROWS_THIS(cell_population.UpdateCellLocations(1.0),
+            "The rate of cellular movement is smaller than zero. Check the parameters of your update rules.");
+    }
+
+    void TestSwitchingKineticMonteCarlo() throw(Exception)
+    {
+        // Create a fully populated 2D PottsMesh
+        PottsMeshGenerator<2> generator(3, 0, 0, 3, 0, 0);
+        PottsMesh<2>* p_mesh = generator.GetMesh();
+
+        std::vector<CellPtr> cells;
+        CellsGenerator<FixedDurationGenerationBasedCellCycleModel, 2> cells_generator;
+        cells_generator.GenerateBasic(cells, 9);
+
+        std::vector<unsigned> location_indices;
+        for (unsigned i=0; i<9; i++)
+        {
+            location_indices.push_back(i);
+        }
+
+        CaBasedCellPopulation<2u> cell_population(*p_mesh, cells, location_indices);
+        cell_population.SetUseKineticMonteCarlo();
+
+        MAKE_PTR(RandomCaSwitchingUpdateRule<2u>, p_switching_update_rule);
+        p_switching_update_rule->SetSwitchingParameter(1.0);
+        cell_population.AddSwitchingUpdateRule(p_switching_update_rule);
+
+        for (unsigned i=0; i<5; i++)
+        {
+            cell_population.UpdateCellLocations(1.0);
+        }
+        TS_ASSERT_LESS_THAN(0u, cell_population.GetNumKineticMonteCarloEvents());
+
+        // Switching preserves full occupancy and each site holds exactly one cell
+        std::set<unsigned> occupied_sites;
+        for (AbstractCellPopulation<2>::Iterator cell_iter = cell_population.Begin();
+             cell_iter != cell_population.End();
+             ++cell_iter)
+        {
+            occupied_sites.insert(cell_population.GetLocationIndexUsingCell(*cell_iter));
+        }
+        TS_ASSERT_EQUALS(occupied_sites.size(), 9u);
+        for (unsigned i=0; i<9; i++)
+        {
+            TS_ASSERT_EQUALS(cell_population.rGetAvailableSpaces()[i], 0u);
+        }
+    }
+
+    void TestKineticMonteCarloMatchesSweepStatistics() throw(Exception)
+    {
+        /*
+         * A single cell diffusing on a 2D lattice. With DiffusionCaUpdateRule each
+         * update moves the cell to an orthogonal neighbour with probability D*dt/2
+         * and to a diagonal neighbour with probability D*dt/4, so the mean squared
+         * displacement after time T is 4*D*T under either scheme.
+         */
+        PottsMeshGenerator<2> generator(31, 0, 0, 31, 0, 0);
+        PottsMesh<2>* p_mesh = generator.GetMesh();
+        unsigned start_index = 15*31 + 15;
+        c_vector<double, 2> start_location = p_mesh->GetNode(start_index)->rGetLocation();
+
+        double diffusion_parameter = 1.0;
+        double dt = 0.1;
+        unsigned num_timesteps = 40;
+        unsigned num_realisations = 400;
+
+        double expected_msd = 4.0*diffusion_parameter*dt*num_timesteps;
+        std::vector<double> mean_squared_displacement(2, 0.0);
+
+        for (unsigned use_kmc=0; use_kmc<2; use_kmc++)
+        {
+            RandomNumberGenerator::Instance()->Reseed(use_kmc);
+
+            for (unsigned realisation=0; realisation<num_realisations; realisation++)
+            {
+                std::vector<CellPtr> cells;
+                CellsGenerator<FixedDurationGenerationBasedCellCycleModel, 2> cells_generator;
+                cells_generator.GenerateBasic(cells, 1);
+
+                std::vector<unsigned> location_indices;
+                location_indices.push_back(start_index);
+
+                CaBasedCellPopulation<2u> cell_population(*p_mesh, cells, location_indices);
+                if (use_kmc)
+                {
+                    cell_population.SetUseKineticMonteCarlo();
+                }
+
+                MAKE_PTR(DiffusionCaUpdateRule<2u>, p_diffusion_update_rule);
+                p_diffusion_update_rule->SetDiffusionParameter(diffusion_parameter);
+                cell_population.AddUpdateRule(p_diffusion_update_rule);
+
+                for (unsigned i=0; i<num_timesteps; i++)
+                {
+                    cell_population.UpdateCellLocations(dt);
+                }
+
+                unsigned location_index = cell_population.GetLocationIndexUsingCell(*(cell_population.Begin()));
+                c_vector<double, 2> displacement = p_mesh->GetNode(location_index)->rGetLocation() - start_location;
+                mean_squared_displacement[use_kmc] += inner_prod(displacement, displacement)/num_realisations;
+            }
+        }
+
+        /*
+         * The squared displacement has a standard deviation comparable to its mean,
+         * so with 400 realisations each estimate should be within about 5% of the
+         * expected value; allow three standard errors.
+         */
+        TS_ASSERT_DELTA(mean_squared_displacement[0], expected_msd, 0.15*expected_msd);
+        TS_ASSERT_DELTA(mean_squared_displacement[1], expected_msd, 0.15*expected_msd);
+        TS_ASSERT_DELTA(mean_squared_displacement[1], mean_squared_displacement[0], 0.2*expected_msd);
+    }
+
     void TestArchiving() throw(Exception)
     {
         FileFinder archive_dir("archive", RelativeTo::ChasteTestOutput);
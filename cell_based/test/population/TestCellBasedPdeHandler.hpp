@@ -246,6 +246,7 @@ public:
             // Set member variables for testing
             p_pde_handler->SetWriteAverageRadialPdeSolution("averaged quantity", 5, true);
             p_pde_handler->SetImposeBcsOnCoarseBoundary(false);
+            p_pde_handler->SetReuseCoarsePdeSolvers();
 
             // Set up PDE and pass to handler
             AveragedSourcePde<2> pde(cell_population, -0.1);
@@ -294,6 +295,8 @@ public:
             TS_ASSERT_EQUALS(p_pde_handler->GetImposeBcsOnCoarseBoundary(), false);
             TS_ASSERT_EQUALS(p_pde_handler->GetNumRadialIntervals(), 5u);
             TS_ASSERT_EQUALS(p_pde_handler->mAverageRadialSolutionVariableName, "averaged quantity");
+            TS_ASSERT_EQUALS(p_pde_handler->GetReuseCoarsePdeSolvers(), true);
+            TS_ASSERT(p_pde_handler->mCoarsePdeSolvers.empty());
 
             ///\todo we currently do not archive mpCoarsePdeMesh - consider doing this (#1891)
             TS_ASSERT(p_pde_handler->GetCoarsePdeMesh() == NULL);
@@ -1185,6 +1188,96 @@ public:
             TS_ASSERT_DELTA(pde_handler.GetPdeSolutionAtPoint(cell_location, "quantity 2"), value1_at_cell, 1e-6);
         }
     }
+
+    void TestReuseCoarsePdeSolvers() throw(Exception)
+    {
+        EXIT_IF_PARALLEL;
+
+        // Set up SimulationTime
+        SimulationTime::Instance()->SetEndTimeAndNumberOfTimeSteps(0.05, 6);
+
+        // Create a cell population
+        HoneycombMeshGenerator generator(5, 5, 0);
+        MutableMesh<2,2>* p_mesh = generator.GetMesh();
+
+        std::vector<CellPtr> cells;
+        CellsGenerator<FixedDurationGenerationBasedCellCycleModel, 2> cells_generator;
+        cells_generator.GenerateBasic(cells, p_mesh->GetNumNodes());
+
+        MeshBasedCellPopulation<2> cell_population(*p_mesh, cells);
+
+        ChastePoint<2> lower(0.0, 0.0);
+        ChastePoint<2> upper(50.0, 50.0);
+        ChasteCuboid<2> cuboid(lower, upper);
+        ConstBoundaryCondition<2> bc(1.0);
+
+        // Create a PDE handler that keeps its coarse PDE solver between timesteps (not the default)
+        CellBasedPdeHandler<2> pde_handler(&cell_population);
+        TS_ASSERT_EQUALS(pde_handler.GetReuseCoarsePdeSolvers(), false);
+        pde_handler.SetReuseCoarsePdeSolvers();
+        TS_ASSERT_EQUALS(pde_handler.GetReuseCoarsePdeSolvers(), true);
+
+        AveragedSourcePde<2> pde(cell_population, -0.1);
+        PdeAndBoundaryConditions<2> pde_and_bc(&pde, &bc, false);
+        pde_and_bc.SetDependentVariableName("reused");
+        pde_handler.AddPdeAndBc(&pde_and_bc);
+        pde_handler.UseCoarsePdeMesh(10.0, cuboid, true);
+
+        // Create a PDE handler that sets up a new solver at each timestep
+        CellBasedPdeHandler<2> pde_handler_no_reuse(&cell_population);
+        pde_handler_no_reuse.SetReuseCoarsePdeSolvers(false);
+        TS_ASSERT_EQUALS(pde_handler_no_reuse.GetReuseCoarsePdeSolvers(), false);
+
+        AveragedSourcePde<2> pde_no_reuse(cell_population, -0.1);
+        PdeAndBoundaryConditions<2> pde_and_bc_no_reuse(&pde_no_reuse, &bc, false);
+        pde_and_bc_no_reuse.SetDependentVariableName("not reused");
+        pde_handler_no_reuse.AddPdeAndBc(&pde_and_bc_no_reuse);
+        pde_handler_no_reuse.UseCoarsePdeMesh(10.0, cuboid, true);
+
+        // Open result files ourselves
+        OutputFileHandler output_file_handler("TestReuseCoarsePdeSolvers", false);
+        pde_handler.mpVizPdeSolutionResultsFile = output_file_handler.OpenOutputFile("results.vizpdesolution");
+        pde_handler_no_reuse.mpVizPdeSolutionResultsFile = output_file_handler.OpenOutputFile("results_no_reuse.vizpdesolution");
+
+        // Solve the PDEs over several timesteps
+        for (unsigned i=0; i<3; i++)
+        {
+            pde_handler.SolvePdeAndWriteResultsToFile(1);
+            pde_handler_no_reuse.SolvePdeAndWriteResultsToFile(1);
+            SimulationTime::Instance()->IncrementTimeOneStep();
+
+            ReplicatableVector solution(pde_handler.GetPdeSolution());
+            ReplicatableVector solution_no_reuse(pde_handler_no_reuse.GetPdeSolution());
+
+            TS_ASSERT_EQUALS(solution.GetSize(), solution_no_reuse.GetSize());
+            for (unsigned j=0; j<solution.GetSize(); j++)
+            {
+                TS_ASSERT_DELTA(solution[j], solution_no_reuse[j], 1e-5);
+            }
+        }
+
+        // Close result files ourselves
+        pde_handler.mpVizPdeSolutionResultsFile->close();
+        pde_handler_no_reuse.mpVizPdeSolutionResultsFile->close();
+
+        // The diffusion operator should only have been assembled once
+        TS_ASSERT_EQUALS(pde_handler.mCoarsePdeSolvers.size(), 1u);
+        TS_ASSERT_EQUALS(pde_handler.mCoarsePdeSolvers[0]->GetNumDiffusionMatrixAssemblies(), 1u);
+        TS_ASSERT_EQUALS(pde_handler_no_reuse.mCoarsePdeSolvers.size(), 0u);
+
+        // Check the solution is the same at each cell
+        for (AbstractCellPopulation<2>::Iterator cell_iter = cell_population.Begin();
+             cell_iter != cell_population.End();
+             ++cell_iter)
+        {
+            TS_ASSERT_DELTA(cell_iter->GetCellData()->GetItem("reused"),
+                            cell_iter->GetCellData()->GetItem("not reused"), 1e-5);
+        }
+
+        // Changing where the boundary conditions are imposed discards the persistent solver
+        pde_handler.SetImposeBcsOnCoarseBoundary(false);
+        TS_ASSERT_EQUALS(pde_handler.mCoarsePdeSolvers.size(), 0u);
+    }
 };
 
 #endif /*TESTCELLBASEDPDEHANDLER_HPP_*/
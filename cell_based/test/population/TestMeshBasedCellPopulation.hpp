@@ -361,6 +361,67 @@ public:
         TS_ASSERT_DELTA(area_based_damping_const, cell_population.GetDampingConstantNormal(), 1e-6);
     }
 
+    void TestIncrementalVoronoiGeometry()
+    {
+        EXIT_IF_PARALLEL;    // HoneycombMeshGenerator doesn't work in parallel
+
+        // Create a cell population on a honeycomb mesh
+        HoneycombMeshGenerator generator(6, 6, 0);
+        MutableMesh<2,2>* p_mesh = generator.GetMesh();
+
+        std::vector<CellPtr> cells;
+        CellsGenerator<FixedDurationGenerationBasedCellCycleModel, 2> cells_generator;
+        cells_generator.GenerateBasic(cells, p_mesh->GetNumNodes());
+
+        MeshBasedCellPopulation<2> cell_population(*p_mesh, cells);
+        cell_population.SetAreaBasedDampingConstant(true);
+
+        // The first update computes the geometry of every Voronoi element
+        cell_population.TessellateIfNeeded();
+        unsigned num_nodes = p_mesh->GetNumNodes();
+        TS_ASSERT_EQUALS(cell_population.GetNumVoronoiCellsUpdated(), num_nodes);
+        TS_ASSERT_EQUALS(cell_population.rGetVoronoiCellVolumes().size(), num_nodes);
+        TS_ASSERT_EQUALS(cell_population.rGetVoronoiCellSurfaceAreas().size(), num_nodes);
+
+        // A further update with nothing changed recomputes nothing
+        cell_population.TessellateIfNeeded();
+        TS_ASSERT_EQUALS(cell_population.GetNumVoronoiCellsUpdated(), 0u);
+
+        // Move an interior node slightly, so that the connectivity of the mesh is unchanged
+        unsigned moved_node_index = 14;
+        TS_ASSERT_EQUALS(p_mesh->GetNode(moved_node_index)->IsBoundaryNode(), false);
+        c_vector<double,2> new_location = p_mesh->GetNode(moved_node_index)->rGetLocation();
+        new_location[0] += 0.05;
+        new_location[1] -= 0.02;
+        ChastePoint<2> new_point(new_location);
+        p_mesh->SetNode(moved_node_index, new_point, true);
+
+        // Only the moved node and its neighbours should have been recomputed
+        cell_population.TessellateIfNeeded();
+        std::set<unsigned> neighbours = cell_population.GetNeighbouringNodeIndices(moved_node_index);
+        TS_ASSERT_EQUALS(cell_population.GetNumVoronoiCellsUpdated(), neighbours.size() + 1);
+
+        // The flat arrays should agree with a freshly constructed tessellation
+        VertexMesh<2,2>* p_tessellation = cell_population.GetVoronoiTessellation();
+        for (unsigned node_index=0; node_index<num_nodes; node_index++)
+        {
+            unsigned elem_index = p_tessellation->GetVoronoiElementIndexCorrespondingToDelaunayNodeIndex(node_index);
+            TS_ASSERT_DELTA(cell_population.GetVolumeOfVoronoiElement(node_index), p_tessellation->GetVolumeOfElement(elem_index), 1e-12);
+            TS_ASSERT_DELTA(cell_population.GetSurfaceAreaOfVoronoiElement(node_index), p_tessellation->GetSurfaceAreaOfElement(elem_index), 1e-12);
+        }
+
+        for (std::set<unsigned>::iterator iter = neighbours.begin(); iter != neighbours.end(); ++iter)
+        {
+            unsigned elem_index_a = p_tessellation->GetVoronoiElementIndexCorrespondingToDelaunayNodeIndex(moved_node_index);
+            unsigned elem_index_b = p_tessellation->GetVoronoiElementIndexCorrespondingToDelaunayNodeIndex(*iter);
+            TS_ASSERT_DELTA(cell_population.GetVoronoiEdgeLength(moved_node_index, *iter), p_tessellation->GetEdgeLength(elem_index_a, elem_index_b), 1e-12);
+        }
+
+        // Edges on the boundary of the mesh are unbounded
+        TS_ASSERT_THROWS_THIS(cell_population.GetVoronoiEdgeLength(0, 1),
+            "Spring iterator tried to calculate interaction between degenerate cells on the boundary of the mesh.  Have you set ghost layers correctly?");
+    }
+
     void TestSetNodeAndAddCell()
     {
         // Create a simple mesh
@@ -67,10 +67,18 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 // Cell writers
 #include "CellAgesWriter.hpp"
 #include "CellAncestorWriter.hpp"
+#include "CellCycleModelProteinConcentrationsWriter.hpp"
+#include "CellDataItemWriter.hpp"
+#include "CellDeltaNotchWriter.hpp"
 #include "CellIdWriter.hpp"
+#include "CellLabelWriter.hpp"
+#include "CellLocationIndexWriter.hpp"
+#include "CellProliferativeTypesWriter.hpp"
+#include "CellRadiusWriter.hpp"
 #include "CellProliferativePhasesWriter.hpp"
 #include "CellVolumesWriter.hpp"
 #include "CellMutationStatesWriter.hpp"
+#include "CellWritersHdf5ToTxtConverter.hpp"
 
 // Cell population writers
 #include "CellPopulationAreaWriter.hpp"
@@ -132,6 +140,34 @@ private:
         TS_ASSERT_EQUALS(counter, node_based_cell_population.GetNumRealCells());
     }
 
+    /**
+     * Check that every pair of nodes closer than the given distance is in the population's node pairs.
+     */
+    void CheckNodePairsContainPairsWithin(NodeBasedCellPopulation<2>& rCellPopulation, double distance)
+    {
+        std::set<std::pair<unsigned, unsigned> > pairs;
+        std::vector<std::pair<Node<2>*, Node<2>*> >& r_node_pairs = rCellPopulation.rGetNodePairs();
+        for (unsigned i=0; i<r_node_pairs.size(); i++)
+        {
+            unsigned index_a = r_node_pairs[i].first->GetIndex();
+            unsigned index_b = r_node_pairs[i].second->GetIndex();
+            pairs.insert(std::make_pair(std::min(index_a, index_b), std::max(index_a, index_b)));
+        }
+
+        NodesOnlyMesh<2>& r_mesh = rCellPopulation.rGetMesh();
+        for (AbstractMesh<2,2>::NodeIterator iter_a = r_mesh.GetNodeIteratorBegin(); iter_a != r_mesh.GetNodeIteratorEnd(); ++iter_a)
+        {
+            for (AbstractMesh<2,2>::NodeIterator iter_b = r_mesh.GetNodeIteratorBegin(); iter_b != r_mesh.GetNodeIteratorEnd(); ++iter_b)
+            {
+                if (iter_a->GetIndex() < iter_b->GetIndex()
+                    && norm_2(iter_a->rGetLocation() - iter_b->rGetLocation()) < distance)
+                {
+                    TS_ASSERT_EQUALS(pairs.count(std::make_pair(iter_a->GetIndex(), iter_b->GetIndex())), 1u);
+                }
+            }
+        }
+    }
+
 public:
 
     // Test construction, accessors and Iterator
@@ -515,6 +551,115 @@ public:
         }
     }
 
+    void TestVerletLists() throw (Exception)
+    {
+        EXIT_IF_PARALLEL;    // Verlet lists are only reused sequentially
+
+        SimulationTime::Instance()->SetEndTimeAndNumberOfTimeSteps(10.0, 10);
+
+        // Create a 9 by 9 grid of nodes with spacing 0.125
+        TrianglesMeshReader<2,2> mesh_reader("mesh/test/data/square_128_elements");
+        TetrahedralMesh<2,2> generating_mesh;
+        generating_mesh.ConstructFromMeshReader(mesh_reader);
+
+        NodesOnlyMesh<2> mesh;
+        mesh.ConstructNodesWithoutMesh(generating_mesh, 0.3);
+
+        std::vector<CellPtr> cells;
+        CellsGenerator<FixedDurationGenerationBasedCellCycleModel, 2> cells_generator;
+        cells_generator.GenerateBasic(cells, mesh.GetNumNodes());
+
+        NodeBasedCellPopulation<2> cell_population(mesh, cells);
+
+        TS_ASSERT_EQUALS(cell_population.GetUseVerletLists(), false);
+        TS_ASSERT_DELTA(cell_population.GetVerletSkin(), 0.06, 1e-12);
+        TS_ASSERT_EQUALS(cell_population.GetTuneVerletSkin(), false);
+
+        cell_population.SetUseVerletLists();
+        cell_population.SetVerletSkin(0.1);
+        TS_ASSERT_EQUALS(cell_population.GetUseVerletLists(), true);
+        TS_ASSERT_DELTA(cell_population.GetVerletSkin(), 0.1, 1e-12);
+
+        // The first update builds the list, with pairs out to the interaction distance plus skin
+        cell_population.Update();
+        TS_ASSERT_EQUALS(cell_population.mVerletListIsValid, true);
+        TS_ASSERT_EQUALS(cell_population.mUpdatesSinceVerletRebuild, 0u);
+        TS_ASSERT_DELTA(mesh.GetVerletSkin(), 0.1, 1e-12);
+        CheckNodePairsContainPairsWithin(cell_population, 0.4);
+
+        std::vector<std::pair<Node<2>*, Node<2>*> >& r_node_pairs = cell_population.rGetNodePairs();
+        for (unsigned i=0; i<r_node_pairs.size(); i++)
+        {
+            TS_ASSERT_LESS_THAN(norm_2(r_node_pairs[i].first->rGetLocation() - r_node_pairs[i].second->rGetLocation()), 0.4);
+        }
+        unsigned num_pairs = r_node_pairs.size();
+
+        // Small movements keep the list
+        for (AbstractMesh<2,2>::NodeIterator node_iter = mesh.GetNodeIteratorBegin(); node_iter != mesh.GetNodeIteratorEnd(); ++node_iter)
+        {
+            node_iter->rGetModifiableLocation()[0] += 0.01*(node_iter->GetIndex() % 3);
+        }
+        cell_population.Update();
+        TS_ASSERT_EQUALS(cell_population.mVerletListIsValid, true);
+        TS_ASSERT_EQUALS(cell_population.mUpdatesSinceVerletRebuild, 1u);
+        TS_ASSERT_EQUALS(cell_population.rGetNodePairs().size(), num_pairs);
+        CheckNodePairsContainPairsWithin(cell_population, 0.3);
+
+        // Deaths are removed from the list without rebuilding it
+        CellPtr p_dead_cell = cell_population.GetCellUsingLocationIndex(40);
+        p_dead_cell->Kill();
+        TS_ASSERT_EQUALS(cell_population.RemoveDeadCells(), 1u);
+        for (unsigned i=0; i<cell_population.rGetNodePairs().size(); i++)
+        {
+            TS_ASSERT_DIFFERS(cell_population.rGetNodePairs()[i].first->GetIndex(), 40u);
+            TS_ASSERT_DIFFERS(cell_population.rGetNodePairs()[i].second->GetIndex(), 40u);
+        }
+
+        // Births are added to the list, taking their parent's partners
+        CellPtr p_parent_cell = cell_population.GetCellUsingLocationIndex(30);
+        MAKE_PTR(WildTypeCellMutationState, p_state);
+        CellPtr p_new_cell(new Cell(p_state, new FixedDurationGenerationBasedCellCycleModel()));
+        c_vector<double, 2> new_location = mesh.GetNode(30)->rGetLocation();
+        new_location[1] += 0.04;
+        cell_population.AddCell(p_new_cell, new_location, p_parent_cell);
+
+        cell_population.Update();
+        TS_ASSERT_EQUALS(cell_population.mVerletListIsValid, true);
+        TS_ASSERT_EQUALS(cell_population.mUpdatesSinceVerletRebuild, 2u);
+        TS_ASSERT_EQUALS(cell_population.GetNumNodes(), 81u);
+        CheckNodePairsContainPairsWithin(cell_population, 0.3);
+
+        // Neighbours are kept up to date too
+        unsigned new_index = cell_population.GetLocationIndexUsingCell(p_new_cell);
+        std::set<unsigned> neighbours = cell_population.GetNodesWithinNeighbourhoodRadius(new_index, 0.3);
+        TS_ASSERT_EQUALS(neighbours.count(30), 1u);
+        TS_ASSERT_EQUALS(neighbours.count(40), 0u);
+
+        // Moving a node more than half the skin rebuilds the list
+        mesh.GetNode(0)->rGetModifiableLocation()[1] += 0.06;
+        cell_population.Update();
+        TS_ASSERT_EQUALS(cell_population.mVerletListIsValid, true);
+        TS_ASSERT_EQUALS(cell_population.mUpdatesSinceVerletRebuild, 0u);
+        CheckNodePairsContainPairsWithin(cell_population, 0.4);
+
+        // With tuning, a fast-moving node increases the skin (up to half the interaction distance)
+        cell_population.SetTuneVerletSkin();
+        TS_ASSERT_EQUALS(cell_population.GetTuneVerletSkin(), true);
+        mesh.GetNode(0)->rGetModifiableLocation()[1] += 0.06;
+        cell_population.Update();
+        TS_ASSERT_DELTA(cell_population.GetVerletSkin(), 0.15, 1e-12);
+        TS_ASSERT_DELTA(mesh.GetVerletSkin(), 0.15, 1e-12);
+        TS_ASSERT_EQUALS(cell_population.mUpdatesSinceVerletRebuild, 0u);
+        CheckNodePairsContainPairsWithin(cell_population, 0.45);
+
+        // Switching the lists off restores the original box size
+        cell_population.SetUseVerletLists(false);
+        cell_population.Update();
+        TS_ASSERT_EQUALS(cell_population.mVerletListIsValid, false);
+        TS_ASSERT_DELTA(mesh.GetVerletSkin(), 0.0, 1e-12);
+        CheckNodePairsContainPairsWithin(cell_population, 0.3);
+    }
+
     void TestAddAndRemoveAndAddWithOutRemovingDeletedNodesSmallCutOff()
     {
         SimulationTime* p_simulation_time = SimulationTime::Instance();
@@ -1213,6 +1358,174 @@ public:
 #endif
     }
 
+    void TestNodeBasedCellPopulationHdf5CellWriterOutput() throw (Exception)
+    {
+        EXIT_IF_PARALLEL;    // Population writers don't work in parallel yet
+
+        SimulationTime::Instance()->SetEndTimeAndNumberOfTimeSteps(1.0, 1);
+
+        // Set up the same population as in TestNodeBasedCellPopulationOutputWriters2d()
+        TrianglesMeshReader<2,2> mesh_reader("mesh/test/data/square_2_elements");
+        TetrahedralMesh<2,2> generating_mesh;
+        generating_mesh.ConstructFromMeshReader(mesh_reader);
+
+        NodesOnlyMesh<2> mesh;
+        mesh.ConstructNodesWithoutMesh(generating_mesh, 1.5);
+
+        std::vector<CellPtr> cells;
+        CellsGenerator<FixedDurationGenerationBasedCellCycleModel, 2> cells_generator;
+        cells_generator.GenerateBasic(cells, mesh.GetNumNodes());
+
+        NodeBasedCellPopulation<2> node_based_cell_population(mesh, cells);
+        node_based_cell_population.Update();
+
+        node_based_cell_population.GetCellPropertyRegistry()->Get<WildTypeCellMutationState>();
+        boost::shared_ptr<AbstractCellProperty> p_apc1(node_based_cell_population.GetCellPropertyRegistry()->Get<ApcOneHitCellMutationState>());
+        boost::shared_ptr<AbstractCellProperty> p_apc2(node_based_cell_population.GetCellPropertyRegistry()->Get<ApcTwoHitCellMutationState>());
+        boost::shared_ptr<AbstractCellProperty> p_bcat1(node_based_cell_population.GetCellPropertyRegistry()->Get<BetaCateninOneHitCellMutationState>());
+        boost::shared_ptr<AbstractCellProperty> p_apoptotic_state(node_based_cell_population.GetCellPropertyRegistry()->Get<ApoptoticCellProperty>());
+        boost::shared_ptr<AbstractCellProperty> p_label(node_based_cell_population.GetCellPropertyRegistry()->Get<CellLabel>());
+        boost::shared_ptr<AbstractCellProperty> p_transit_type(node_based_cell_population.GetCellPropertyRegistry()->Get<TransitCellProliferativeType>());
+        boost::shared_ptr<AbstractCellProperty> p_diff_type(node_based_cell_population.GetCellPropertyRegistry()->Get<DifferentiatedCellProliferativeType>());
+
+        node_based_cell_population.GetCellUsingLocationIndex(0)->SetCellProliferativeType(p_transit_type);
+        node_based_cell_population.GetCellUsingLocationIndex(0)->AddCellProperty(p_label);
+        node_based_cell_population.GetCellUsingLocationIndex(1)->SetCellProliferativeType(p_diff_type);
+        node_based_cell_population.GetCellUsingLocationIndex(1)->SetMutationState(p_apc1);
+        node_based_cell_population.GetCellUsingLocationIndex(2)->SetMutationState(p_apc2);
+        node_based_cell_population.GetCellUsingLocationIndex(3)->SetMutationState(p_bcat1);
+        node_based_cell_population.GetCellUsingLocationIndex(3)->AddCellProperty(p_apoptotic_state);
+
+        node_based_cell_population.rGetMesh().GetNode(0)->SetRadius(0.6);
+        node_based_cell_population.Update();
+
+        node_based_cell_population.AddCellWriter<CellAgesWriter>();
+        node_based_cell_population.AddCellWriter<CellVolumesWriter>();
+        node_based_cell_population.AddCellWriter<CellAncestorWriter>();
+        node_based_cell_population.AddCellWriter<CellMutationStatesWriter>();
+        node_based_cell_population.SetCellAncestorsToLocationIndices();
+
+        TS_ASSERT_EQUALS(node_based_cell_population.GetUseHdf5Output(), false);
+        node_based_cell_population.SetUseHdf5Output(true);
+        TS_ASSERT_EQUALS(node_based_cell_population.GetUseHdf5Output(), true);
+
+        std::string output_directory = "TestNodeBasedCellPopulationHdf5CellWriterOutput";
+        OutputFileHandler output_file_handler(output_directory);
+
+        node_based_cell_population.OpenWritersFiles(output_file_handler);
+        node_based_cell_population.WriteResultsToFiles(output_directory);
+        node_based_cell_population.CloseWritersFiles();
+
+        // The cell writers' data have gone to a single HDF5 file, while population writers still write text
+        std::string results_dir = output_file_handler.GetOutputDirectoryFullPath();
+        TS_ASSERT(FileFinder(results_dir + "cell_writers.h5", RelativeTo::Absolute).Exists());
+        TS_ASSERT(!FileFinder(results_dir + "results.vizcelltypes", RelativeTo::Absolute).Exists());
+        TS_ASSERT(!FileFinder(results_dir + "cellages.dat", RelativeTo::Absolute).Exists());
+        FileComparison(results_dir + "results.viznodes", "cell_based/test/data/TestNodeBasedCellPopulationWriters2d/results.viznodes").CompareFiles();
+
+        // Converting back gives the same text files as the cell writers themselves
+        std::vector<boost::shared_ptr<AbstractCellWriter<2,2> > > cell_writers;
+        cell_writers.push_back(boost::shared_ptr<AbstractCellWriter<2,2> >(new CellProliferativeTypesWriter<2,2>));
+        cell_writers.push_back(boost::shared_ptr<AbstractCellWriter<2,2> >(new CellAncestorWriter<2,2>));
+        cell_writers.push_back(boost::shared_ptr<AbstractCellWriter<2,2> >(new CellMutationStatesWriter<2,2>));
+        cell_writers.push_back(boost::shared_ptr<AbstractCellWriter<2,2> >(new CellAgesWriter<2,2>));
+        cell_writers.push_back(boost::shared_ptr<AbstractCellWriter<2,2> >(new CellVolumesWriter<2,2>));
+        CellWritersHdf5ToTxtConverter<2,2> converter(FileFinder(results_dir, RelativeTo::Absolute), "cell_writers.h5", cell_writers);
+
+        FileComparison(results_dir + "results.vizcelltypes", "cell_based/test/data/TestNodeBasedCellPopulationWriters2d/results.vizcelltypes").CompareFiles();
+        FileComparison(results_dir + "results.vizancestors", "cell_based/test/data/TestNodeBasedCellPopulationWriters2d/results.vizancestors").CompareFiles();
+        FileComparison(results_dir + "results.vizmutationstates", "cell_based/test/data/TestNodeBasedCellPopulationWriters2d/results.vizmutationstates").CompareFiles();
+        FileComparison(results_dir + "cellages.dat", "cell_based/test/data/TestNodeBasedCellPopulationWriters2d/cellages.dat").CompareFiles();
+        FileComparison(results_dir + "cellareas.dat", "cell_based/test/data/TestNodeBasedCellPopulationWriters2d/cellareas.dat").CompareFiles();
+    }
+
+    void TestHdf5CellWriterOutputMatchesTextOutput() throw(Exception)
+    {
+        EXIT_IF_PARALLEL;    // Population writers don't work in parallel yet
+
+        SimulationTime::Instance()->SetEndTimeAndNumberOfTimeSteps(1.0, 1);
+
+        TrianglesMeshReader<2,2> mesh_reader("mesh/test/data/square_2_elements");
+        TetrahedralMesh<2,2> generating_mesh;
+        generating_mesh.ConstructFromMeshReader(mesh_reader);
+
+        NodesOnlyMesh<2> mesh;
+        mesh.ConstructNodesWithoutMesh(generating_mesh, 1.5);
+
+        std::vector<CellPtr> cells;
+        CellsGenerator<FixedDurationGenerationBasedCellCycleModel, 2> cells_generator;
+        cells_generator.GenerateBasic(cells, mesh.GetNumNodes());
+
+        NodeBasedCellPopulation<2> node_based_cell_population(mesh, cells);
+        node_based_cell_population.Update();
+
+        boost::shared_ptr<AbstractCellProperty> p_label(node_based_cell_population.GetCellPropertyRegistry()->Get<CellLabel>());
+        node_based_cell_population.GetCellUsingLocationIndex(1)->AddCellProperty(p_label);
+        node_based_cell_population.rGetMesh().GetNode(0)->SetRadius(0.6);
+
+        unsigned index = 0;
+        for (AbstractCellPopulation<2>::Iterator cell_iter = node_based_cell_population.Begin();
+             cell_iter != node_based_cell_population.End();
+             ++cell_iter, ++index)
+        {
+            cell_iter->GetCellData()->SetItem("delta", 0.1*index);
+            cell_iter->GetCellData()->SetItem("notch", 1.0 + 0.2*index);
+            cell_iter->GetCellData()->SetItem("mean delta", 2.0 + 0.3*index);
+            cell_iter->GetCellData()->SetItem("oxygen", 3.0 + 0.4*index);
+        }
+
+        // These cell writers have a variety of layouts, and one stores more than one value per cell
+        std::vector<boost::shared_ptr<AbstractCellWriter<2,2> > > cell_writers;
+        cell_writers.push_back(boost::shared_ptr<AbstractCellWriter<2,2> >(new CellDeltaNotchWriter<2,2>));
+        cell_writers.push_back(boost::shared_ptr<AbstractCellWriter<2,2> >(new CellDataItemWriter<2,2>("oxygen")));
+        cell_writers.push_back(boost::shared_ptr<AbstractCellWriter<2,2> >(new CellIdWriter<2,2>));
+        cell_writers.push_back(boost::shared_ptr<AbstractCellWriter<2,2> >(new CellLabelWriter<2,2>));
+        cell_writers.push_back(boost::shared_ptr<AbstractCellWriter<2,2> >(new CellLocationIndexWriter<2,2>));
+        cell_writers.push_back(boost::shared_ptr<AbstractCellWriter<2,2> >(new CellRadiusWriter<2,2>));
+        for (unsigned i=0; i<cell_writers.size(); i++)
+        {
+            node_based_cell_population.AddCellWriter(cell_writers[i]);
+        }
+
+        // Write the text files directly
+        std::string text_directory = "TestHdf5CellWriterOutputMatchesTextOutput/text";
+        OutputFileHandler text_handler(text_directory);
+        node_based_cell_population.OpenWritersFiles(text_handler);
+        node_based_cell_population.WriteResultsToFiles(text_directory);
+        node_based_cell_population.CloseWritersFiles();
+
+        // Write the same data to HDF5 and convert them back
+        std::string hdf5_directory = "TestHdf5CellWriterOutputMatchesTextOutput/hdf5";
+        OutputFileHandler hdf5_handler(hdf5_directory);
+        node_based_cell_population.SetUseHdf5Output(true);
+        node_based_cell_population.OpenWritersFiles(hdf5_handler);
+        node_based_cell_population.WriteResultsToFiles(hdf5_directory);
+        node_based_cell_population.CloseWritersFiles();
+
+        std::string text_dir = text_handler.GetOutputDirectoryFullPath();
+        std::string hdf5_dir = hdf5_handler.GetOutputDirectoryFullPath();
+        TS_ASSERT(!FileFinder(hdf5_dir + "celldeltanotch.dat", RelativeTo::Absolute).Exists());
+        CellWritersHdf5ToTxtConverter<2,2> converter(FileFinder(hdf5_dir, RelativeTo::Absolute), "cell_writers.h5", cell_writers);
+
+        for (unsigned i=0; i<cell_writers.size(); i++)
+        {
+            std::string file_name = cell_writers[i]->GetFileName();
+            FileComparison(hdf5_dir + file_name, text_dir + file_name).CompareFiles();
+        }
+
+        // A cell writer that was not stored cannot be converted
+        std::vector<boost::shared_ptr<AbstractCellWriter<2,2> > > other_writers;
+        other_writers.push_back(boost::shared_ptr<AbstractCellWriter<2,2> >(new CellAgesWriter<2,2>));
+        typedef CellWritersHdf5ToTxtConverter<2,2> converter_2d_t;
+        TS_ASSERT_THROWS_CONTAINS(converter_2d_t(FileFinder(hdf5_dir, RelativeTo::Absolute), "cell_writers.h5", other_writers),
+                                  "The cell writer for cellages.dat does not match the data in ");
+
+        // A cell writer with a varying number of values per cell cannot be stored in HDF5 output
+        node_based_cell_population.AddCellWriter<CellCycleModelProteinConcentrationsWriter>();
+        TS_ASSERT_THROWS_THIS(node_based_cell_population.OpenWritersFiles(hdf5_handler),
+                              "The cell writer for proteinconcentrations.dat does not support HDF5 output, so cannot be used with SetUseHdf5Output().");
+    }
+
     void TestNodeBasedCellPopulationOutputWriters3d()
     {
         EXIT_IF_PARALLEL;    // Population writers don't work in parallel yet
@@ -1430,6 +1743,7 @@ public:
             }
 
             p_cell_population->SetUseVariableRadii(true);
+            p_cell_population->SetUseHdf5Output(true);
 
             // Create an output archive
             ArchiveOpener<boost::archive::text_oarchive, std::ofstream> arch_opener(archive_dir, archive_file);
@@ -1495,6 +1809,7 @@ public:
             // Check the member variables have been restored
             TS_ASSERT_DELTA(p_cell_population->GetMechanicsCutOffLength(), 1.5, 1e-9);
             TS_ASSERT(p_cell_population->GetUseVariableRadii());
+            TS_ASSERT(p_cell_population->GetUseHdf5Output());
 
             // Tidy up
             delete p_cell_population;
@@ -257,6 +257,80 @@ public:
         }
     }
 
+    void TestHaloRecordsOnlySendChangedCellsInFull() throw (Exception)
+    {
+        std::vector<std::string> items;
+        items.push_back("Concentration");
+        mpNodeBasedCellPopulation->SetHaloCellDataItems(items);
+        TS_ASSERT_EQUALS(mpNodeBasedCellPopulation->rGetHaloCellDataItems().size(), 1u);
+        TS_ASSERT_EQUALS(mpNodeBasedCellPopulation->GetHaloRecordSize(), 8u);
+
+        for (AbstractCellPopulation<3>::Iterator cell_iter = mpNodeBasedCellPopulation->Begin();
+             cell_iter != mpNodeBasedCellPopulation->End();
+             ++cell_iter)
+        {
+            cell_iter->GetCellData()->SetItem("Concentration", PetscTools::GetMyRank());
+        }
+
+        // Update() exchanges halos; every halo cell is new to the neighbours so is sent in full
+        mpNodeBasedCellPopulation->Update();
+
+        unsigned num_neighbours = (PetscTools::AmMaster() ? 0u : 1u) + (PetscTools::AmTopMost() ? 0u : 1u);
+        TS_ASSERT_EQUALS(mpNodeBasedCellPopulation->mFullHaloCellsToSendRight.size() + mpNodeBasedCellPopulation->mFullHaloCellsToSendLeft.size(),
+                         num_neighbours);
+
+        TS_ASSERT_EQUALS(mpNodeBasedCellPopulation->mHaloCells.size(), num_neighbours);
+        for (unsigned i=0; i<mpNodeBasedCellPopulation->mHaloCells.size(); i++)
+        {
+            CellPtr p_halo_cell = mpNodeBasedCellPopulation->mHaloCells[i];
+            unsigned owner = p_halo_cell->GetCellId() % PetscTools::GetNumProcs();
+            TS_ASSERT_DELTA(p_halo_cell->GetCellData()->GetItem("Concentration"), owner, 1e-12);
+
+            Node<3>* p_halo_node = mpNodeBasedCellPopulation->GetNode(mpNodeBasedCellPopulation->mHaloCellLocationMap[p_halo_cell]);
+            TS_ASSERT_DELTA(p_halo_node->rGetLocation()[2], 0.5 + owner, 1e-12);
+        }
+
+        // Change the data and exchange again; this time only the records are needed
+        for (AbstractCellPopulation<3>::Iterator cell_iter = mpNodeBasedCellPopulation->Begin();
+             cell_iter != mpNodeBasedCellPopulation->End();
+             ++cell_iter)
+        {
+            cell_iter->GetCellData()->SetItem("Concentration", 10.0 + PetscTools::GetMyRank());
+        }
+
+        mpNodeBasedCellPopulation->RefreshHaloCells();
+        TS_ASSERT(mpNodeBasedCellPopulation->mFullHaloCellsToSendRight.empty());
+        TS_ASSERT(mpNodeBasedCellPopulation->mFullHaloCellsToSendLeft.empty());
+        mpNodeBasedCellPopulation->AddReceivedHaloCells();
+
+        TS_ASSERT_EQUALS(mpNodeBasedCellPopulation->mHaloCells.size(), num_neighbours);
+        for (unsigned i=0; i<mpNodeBasedCellPopulation->mHaloCells.size(); i++)
+        {
+            CellPtr p_halo_cell = mpNodeBasedCellPopulation->mHaloCells[i];
+            unsigned owner = p_halo_cell->GetCellId() % PetscTools::GetNumProcs();
+            TS_ASSERT_DELTA(p_halo_cell->GetCellData()->GetItem("Concentration"), 10.0 + owner, 1e-12);
+        }
+
+        // Labelling a cell means its neighbours need a new copy
+        MAKE_PTR(CellLabel, p_label);
+        for (AbstractCellPopulation<3>::Iterator cell_iter = mpNodeBasedCellPopulation->Begin();
+             cell_iter != mpNodeBasedCellPopulation->End();
+             ++cell_iter)
+        {
+            cell_iter->AddCellProperty(p_label);
+        }
+
+        mpNodeBasedCellPopulation->RefreshHaloCells();
+        TS_ASSERT_EQUALS(mpNodeBasedCellPopulation->mFullHaloCellsToSendRight.size() + mpNodeBasedCellPopulation->mFullHaloCellsToSendLeft.size(),
+                         num_neighbours);
+        mpNodeBasedCellPopulation->AddReceivedHaloCells();
+
+        for (unsigned i=0; i<mpNodeBasedCellPopulation->mHaloCells.size(); i++)
+        {
+            TS_ASSERT(mpNodeBasedCellPopulation->mHaloCells[i]->HasCellProperty<CellLabel>());
+        }
+    }
+
     void TestUpdateWithLoadBalanceDoesntThrow() throw (Exception)
     {
         SimulationTime* p_simulation_time = SimulationTime::Instance();
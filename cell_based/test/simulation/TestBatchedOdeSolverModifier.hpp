@@ -0,0 +1,178 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef TESTBATCHEDODESOLVERMODIFIER_HPP_
+#define TESTBATCHEDODESOLVERMODIFIER_HPP_
+
+#include <cxxtest/TestSuite.h>
+
+// Must be included before other cell_based headers
+#include "CellBasedSimulationArchiver.hpp"
+
+#include "BatchedOdeSolverModifier.hpp"
+#include "DeltaNotchTrackingModifier.hpp"
+#include "DeltaNotchSrnModel.hpp"
+#include "CellCycleModelOdeSolver.hpp"
+#include "RungeKutta4IvpOdeSolver.hpp"
+#include "UniformlyDistributedCellCycleModel.hpp"
+#include "HoneycombVertexMeshGenerator.hpp"
+#include "VertexBasedCellPopulation.hpp"
+#include "OffLatticeSimulation.hpp"
+#include "AbstractCellBasedTestSuite.hpp"
+#include "WildTypeCellMutationState.hpp"
+#include "DifferentiatedCellProliferativeType.hpp"
+#include "SmartPointers.hpp"
+
+// This test is always run sequentially (never in parallel)
+#include "FakePetscSetup.hpp"
+
+class TestBatchedOdeSolverModifier : public AbstractCellBasedTestSuite
+{
+private:
+
+    /**
+     * Run a small vertex-based Delta-Notch simulation and return the notch,
+     * delta and mean neighbouring delta levels of each cell at the end.
+     *
+     * @param useBatchedSolver whether to add a BatchedOdeSolverModifier
+     * @return the levels, three per cell
+     */
+    std::vector<double> RunDeltaNotchSimulation(bool useBatchedSolver)
+    {
+        SimulationTime::Destroy();
+        SimulationTime::Instance()->SetStartTime(0.0);
+
+        HoneycombVertexMeshGenerator generator(3, 3);
+        MutableVertexMesh<2,2>* p_mesh = generator.GetMesh();
+
+        // Use an explicit solver, which can be batched, whether or not CVODE is available
+        boost::shared_ptr<AbstractCellCycleModelOdeSolver> p_ode_solver = CellCycleModelOdeSolver<DeltaNotchSrnModel, RungeKutta4IvpOdeSolver>::Instance();
+        p_ode_solver->Initialise();
+
+        MAKE_PTR(WildTypeCellMutationState, p_state);
+        MAKE_PTR(DifferentiatedCellProliferativeType, p_diff_type);
+        std::vector<CellPtr> cells;
+        for (unsigned i=0; i<p_mesh->GetNumElements(); i++)
+        {
+            // Give each cell different initial levels, so that the mean neighbouring Delta matters
+            std::vector<double> initial_conditions;
+            initial_conditions.push_back(0.5 + 0.05*i);
+            initial_conditions.push_back(1.0 - 0.08*i);
+
+            UniformlyDistributedCellCycleModel* p_cc_model = new UniformlyDistributedCellCycleModel();
+            DeltaNotchSrnModel* p_srn_model = new DeltaNotchSrnModel(p_ode_solver);
+            p_srn_model->SetDt(0.001);
+            p_srn_model->SetInitialConditions(initial_conditions);
+
+            CellPtr p_cell(new Cell(p_state, p_cc_model, p_srn_model));
+            p_cell->SetCellProliferativeType(p_diff_type);
+            p_cell->SetBirthTime(0.0);
+            cells.push_back(p_cell);
+        }
+
+        VertexBasedCellPopulation<2> cell_population(*p_mesh, cells);
+
+        OffLatticeSimulation<2> simulator(cell_population);
+        simulator.SetOutputDirectory("TestBatchedOdeSolverModifier");
+        simulator.SetEndTime(0.1);
+
+        // The tracking modifier must come first, as it reads the ODE state and sets the mean Delta
+        MAKE_PTR(DeltaNotchTrackingModifier<2>, p_tracking_modifier);
+        simulator.AddSimulationModifier(p_tracking_modifier);
+
+        MAKE_PTR(BatchedOdeSolverModifier<2>, p_batched_modifier);
+        if (useBatchedSolver)
+        {
+            simulator.AddSimulationModifier(p_batched_modifier);
+        }
+
+        simulator.Solve();
+
+        if (useBatchedSolver)
+        {
+            // Every cell's ODEs were advanced in the batch at the last time step
+            TS_ASSERT_EQUALS(p_batched_modifier->GetNumSystemsSolved(), cell_population.GetNumRealCells());
+        }
+
+        std::vector<double> levels;
+        for (AbstractCellPopulation<2>::Iterator cell_iter = cell_population.Begin();
+             cell_iter != cell_population.End();
+             ++cell_iter)
+        {
+            DeltaNotchSrnModel* p_srn_model = static_cast<DeltaNotchSrnModel*>(cell_iter->GetSrnModel());
+            levels.push_back(p_srn_model->GetNotch());
+            levels.push_back(p_srn_model->GetDelta());
+            levels.push_back(p_srn_model->GetMeanNeighbouringDelta());
+        }
+        return levels;
+    }
+
+public:
+
+    void TestBatchedDeltaNotchMatchesUnbatched() throw(Exception)
+    {
+        std::vector<double> serial_levels = RunDeltaNotchSimulation(false);
+        std::vector<double> batched_levels = RunDeltaNotchSimulation(true);
+
+        TS_ASSERT_EQUALS(batched_levels.size(), 27u);
+        TS_ASSERT_EQUALS(batched_levels.size(), serial_levels.size());
+        for (unsigned i=0; i<serial_levels.size(); i++)
+        {
+            TS_ASSERT_DELTA(batched_levels[i], serial_levels[i], 1e-12);
+        }
+
+        // The levels have changed from their initial values
+        TS_ASSERT_DIFFERS(serial_levels[0], 0.5);
+    }
+
+    void TestOutputParameters() throw(Exception)
+    {
+        std::string output_directory = "TestBatchedOdeSolverModifierOutputParameters";
+        OutputFileHandler output_file_handler(output_directory, false);
+
+        MAKE_PTR(BatchedOdeSolverModifier<2>, p_modifier);
+        TS_ASSERT_EQUALS(p_modifier->GetIdentifier(), "BatchedOdeSolverModifier-2");
+        TS_ASSERT_EQUALS(p_modifier->GetNumSystemsSolved(), 0u);
+
+        out_stream modifier_parameter_file = output_file_handler.OpenOutputFile("BatchedOdeSolverModifier.parameters");
+        p_modifier->OutputSimulationModifierParameters(modifier_parameter_file);
+        modifier_parameter_file->close();
+
+        FileFinder generated = output_file_handler.FindFile("BatchedOdeSolverModifier.parameters");
+        TS_ASSERT(generated.IsFile());
+    }
+};
+
+#endif /*TESTBATCHEDODESOLVERMODIFIER_HPP_*/
@@ -0,0 +1,164 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef TESTNODEBASEDFORCELOOPPERFORMANCE_HPP_
+#define TESTNODEBASEDFORCELOOPPERFORMANCE_HPP_
+
+#include <cxxtest/TestSuite.h>
+
+// Must be included before other cell_based headers
+#include "CellBasedSimulationArchiver.hpp"
+
+#include "RepulsionForce.hpp"
+#include "UniformlyDistributedCellCycleModel.hpp"
+#include "CellsGenerator.hpp"
+#include "NodeBasedCellPopulation.hpp"
+#include "AbstractCellBasedWithTimingsTestSuite.hpp"
+#include "TransitCellProliferativeType.hpp"
+#include "RandomNumberGenerator.hpp"
+#include "SmartPointers.hpp"
+#include "Timer.hpp"
+#include "FakePetscSetup.hpp"
+
+/**
+ * This class times the force calculation loop of a 3D node-based cell population
+ * whose nodes are stored in an order unrelated to their positions, before and
+ * after the nodes are reordered along a Morton curve.
+ *
+ * This test is used for profiling, to establish the run time
+ * variation as the code is developed.
+ */
+class TestNodeBasedForceLoopPerformance : public AbstractCellBasedWithTimingsTestSuite
+{
+private:
+
+    /**
+     * Compute the forces on all nodes a number of times and return the elapsed time.
+     *
+     * @param rCellPopulation the cell population
+     * @param rForce the force law
+     * @param numRepeats how many times to compute the forces
+     * @return the wall time taken
+     */
+    double TimeForceLoop(NodeBasedCellPopulation<3>& rCellPopulation, RepulsionForce<3>& rForce, unsigned numRepeats)
+    {
+        Timer::Reset();
+        for (unsigned repeat=0; repeat<numRepeats; repeat++)
+        {
+            for (AbstractMesh<3,3>::NodeIterator node_iter = rCellPopulation.rGetMesh().GetNodeIteratorBegin();
+                 node_iter != rCellPopulation.rGetMesh().GetNodeIteratorEnd();
+                 ++node_iter)
+            {
+                node_iter->ClearAppliedForce();
+            }
+            rForce.AddForceContribution(rCellPopulation);
+        }
+        return Timer::GetElapsedTime();
+    }
+
+public:
+
+    void TestForceLoopBeforeAndAfterReordering() throw (Exception)
+    {
+        unsigned cells_across = 30;
+        double spacing = 0.8;
+        unsigned num_nodes = cells_across*cells_across*cells_across;
+
+        // Lay the nodes out on a regular grid, but number them in a random order
+        std::vector<unsigned> permutation;
+        RandomNumberGenerator::Instance()->Shuffle(num_nodes, permutation);
+
+        std::vector<Node<3>*> nodes;
+        for (unsigned index=0; index<num_nodes; index++)
+        {
+            unsigned position = permutation[index];
+            unsigned i = position % cells_across;
+            unsigned j = (position/cells_across) % cells_across;
+            unsigned k = position/(cells_across*cells_across);
+            nodes.push_back(new Node<3>(index, false, i*spacing, j*spacing, k*spacing));
+        }
+
+        NodesOnlyMesh<3> mesh;
+        mesh.ConstructNodesWithoutMesh(nodes, 1.5);
+
+        std::vector<CellPtr> cells;
+        MAKE_PTR(TransitCellProliferativeType, p_transit_type);
+        CellsGenerator<UniformlyDistributedCellCycleModel, 3> cells_generator;
+        cells_generator.GenerateBasicRandom(cells, mesh.GetNumNodes(), p_transit_type);
+
+        NodeBasedCellPopulation<3> cell_population(mesh, cells);
+        cell_population.Update();
+
+        RepulsionForce<3> force;
+        force.SetCutOffLength(1.5);
+
+        unsigned num_repeats = 10;
+        double time_unordered = TimeForceLoop(cell_population, force, num_repeats);
+
+        std::vector<c_vector<double,3> > unordered_forces(num_nodes);
+        for (unsigned index=0; index<num_nodes; index++)
+        {
+            unordered_forces[index] = cell_population.GetNode(index)->rGetAppliedForce();
+        }
+
+        // Reorder the nodes on the next update
+        cell_population.SetNodeReorderingFrequency(1);
+        cell_population.Update();
+
+        double time_ordered = TimeForceLoop(cell_population, force, num_repeats);
+
+        std::cout << "Force loop with shuffled nodes: " << time_unordered << "s" << std::endl;
+        std::cout << "Force loop with Morton-ordered nodes: " << time_ordered << "s" << std::endl;
+
+        // Reordering does not change the forces on each node
+        TS_ASSERT_EQUALS(cell_population.GetNumNodes(), num_nodes);
+        for (unsigned index=0; index<num_nodes; index++)
+        {
+            c_vector<double,3> force_on_node = cell_population.GetNode(index)->rGetAppliedForce();
+            for (unsigned d=0; d<3; d++)
+            {
+                TS_ASSERT_DELTA(force_on_node[d], unordered_forces[index][d], 1e-9);
+            }
+        }
+
+        // Avoid memory leak
+        for (unsigned i=0; i<nodes.size(); i++)
+        {
+            delete nodes[i];
+        }
+    }
+};
+
+#endif /*TESTNODEBASEDFORCELOOPPERFORMANCE_HPP_*/
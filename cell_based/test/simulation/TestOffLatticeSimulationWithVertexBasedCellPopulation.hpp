@@ -58,6 +58,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "DifferentiatedCellProliferativeType.hpp"
 #include "CellLabel.hpp"
 #include "SimpleTargetAreaModifier.hpp"
+#include "PlaneBoundaryCondition.hpp"
 #include "Warnings.hpp"
 #include "LogFile.hpp"
 #include "SmartPointers.hpp"
@@ -684,6 +685,63 @@ public:
         Warnings::QuietDestroy();
     }
 
+    void TestVertexMonolayerWithGeometryCacheAndBoundaryCondition() throw (Exception)
+    {
+        // Run the same simulation without and with the mesh's geometry cache
+        std::vector<std::vector<c_vector<double, 2> > > final_locations(2);
+        for (unsigned use_cache=0; use_cache<2; use_cache++)
+        {
+            SimulationTime::Destroy();
+            SimulationTime::Instance()->SetStartTime(0.0);
+
+            HoneycombVertexMeshGenerator generator(4, 4);
+            MutableVertexMesh<2,2>* p_mesh = generator.GetMesh();
+
+            std::vector<CellPtr> cells;
+            MAKE_PTR(DifferentiatedCellProliferativeType, p_diff_type);
+            CellsGenerator<FixedDurationGenerationBasedCellCycleModel, 2> cells_generator;
+            cells_generator.GenerateBasic(cells, p_mesh->GetNumElements(), std::vector<unsigned>(), p_diff_type);
+
+            VertexBasedCellPopulation<2> cell_population(*p_mesh, cells);
+            TS_ASSERT_EQUALS(cell_population.GetUseGeometryCache(), false);
+            cell_population.SetUseGeometryCache(use_cache == 1);
+            TS_ASSERT_EQUALS(cell_population.GetUseGeometryCache(), use_cache == 1);
+
+            OffLatticeSimulation<2> simulator(cell_population);
+            simulator.SetOutputDirectory("TestVertexMonolayerWithGeometryCacheAndBoundaryCondition");
+            simulator.SetEndTime(0.1);
+
+            MAKE_PTR(NagaiHondaForce<2>, p_force);
+            simulator.AddForce(p_force);
+            MAKE_PTR(SimpleTargetAreaModifier<2>, p_growth_modifier);
+            simulator.AddSimulationModifier(p_growth_modifier);
+
+            // The boundary condition moves nodes directly, which must invalidate the cache
+            c_vector<double, 2> point = zero_vector<double>(2);
+            point[1] = 0.3;
+            c_vector<double, 2> normal = zero_vector<double>(2);
+            normal[1] = -1.0;
+            MAKE_PTR_ARGS(PlaneBoundaryCondition<2>, p_boundary_condition, (&cell_population, point, normal));
+            simulator.AddCellPopulationBoundaryCondition(p_boundary_condition);
+
+            simulator.Solve();
+
+            for (unsigned node_index=0; node_index<cell_population.GetNumNodes(); node_index++)
+            {
+                final_locations[use_cache].push_back(cell_population.GetNode(node_index)->rGetLocation());
+            }
+        }
+
+        TS_ASSERT_EQUALS(final_locations[1].size(), final_locations[0].size());
+        for (unsigned node_index=0; node_index<final_locations[0].size(); node_index++)
+        {
+            TS_ASSERT_DELTA(final_locations[1][node_index][0], final_locations[0][node_index][0], 1e-10);
+            TS_ASSERT_DELTA(final_locations[1][node_index][1], final_locations[0][node_index][1], 1e-10);
+            TS_ASSERT_LESS_THAN_EQUALS(0.3 - 1e-10, final_locations[1][node_index][1]);
+        }
+        Warnings::QuietDestroy();
+    }
+
     // Test archiving of a OffLatticeSimulation that uses a VertexBasedCellPopulation.
     void TestArchiving() throw (Exception)
     {
@@ -50,6 +50,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "SolidMechanicsProblemDefinition.hpp"
 #include "Timer.hpp"
 #include "AbstractPerElementWriter.hpp"
+#include "PCLDUFactorisationMechanics.hpp"
 #include "petscsnes.h"
 
 
@@ -321,6 +322,71 @@ protected:
      */
     bool mPetscDirectSolve;
 
+    /**
+     *  Whether to use a modified Newton method (non-SNES solver only), in which an assembled
+     *  Jacobian, and the preconditioner built from it, are re-used for subsequent Newton steps
+     *  (and subsequent solves) until one of the refresh rules in TakeNewtonStep() applies.
+     *  See SetUseModifiedNewton().
+     */
+    bool mUseModifiedNewton;
+
+    /**
+     *  Maximum number of Newton steps an assembled Jacobian may be used for when using
+     *  modified Newton.
+     */
+    unsigned mMaxJacobianAge;
+
+    /**
+     *  When using modified Newton, if a step taken with a re-used Jacobian does not reduce
+     *  the residual norm by at least this factor, the Jacobian is re-assembled for the next step.
+     */
+    double mJacobianRefreshResidualRatio;
+
+    /**
+     *  Whether to choose the relative tolerance of each linear solve adaptively, using the
+     *  Eisenstat-Walker rule. See SetUseEisenstatWalkerLinearTolerances().
+     */
+    bool mUseEisenstatWalker;
+
+    /**
+     *  The linear solver (with its set-up preconditioner) kept between Newton steps when using
+     *  modified Newton. NULL if there is no stored Jacobian.
+     */
+    KSP mLaggedKspSolver;
+
+    /** Number of Newton steps the stored Jacobian has been used for (modified Newton only). */
+    unsigned mJacobianAge;
+
+    /** Whether the next Newton step has to re-assemble the Jacobian (modified Newton only). */
+    bool mJacobianRefreshRequired;
+
+    /** The forcing term (relative linear tolerance) used in the last Newton step, for Eisenstat-Walker. */
+    double mLastForcingTerm;
+
+    /**
+     *  The residual norm at the beginning of the last Newton step in the current solve, for
+     *  Eisenstat-Walker. Negative at the start of each solve.
+     */
+    double mLastNewtonStepResidualNorm;
+
+    /** The tolerance of the current nonlinear (non-SNES) solve. */
+    double mNewtonTolerance;
+
+    /** Number of Newton steps (since construction) for which the Jacobian was assembled. */
+    unsigned mNumJacobianAssemblies;
+
+    /** Number of Newton steps (since construction) which re-used a stored Jacobian instead of assembling one. */
+    unsigned mNumJacobianAssembliesSaved;
+
+    /**
+     *  Whether to use the block preconditioner PCLDUFactorisationMechanics for incompressible
+     *  problems. See SetUseBlockPreconditioner().
+     */
+    bool mUseBlockPreconditioner;
+
+    /** The block preconditioner, if in use. Created in SetKspSolverAndPcType(). */
+    PCLDUFactorisationMechanics* mpBlockPreconditioner;
+
     /**
      * Whether to call AddActiveStressAndStressDerivative() when computing stresses or not.
      *
@@ -356,7 +422,9 @@ protected:
 
     /**
      * Set the KSP type (CG, GMRES, etc) and the preconditioner type (ILU, ICC etc). Depends on
-     * incompressible or not, and other factors.
+     * incompressible or not, and other factors. The operators of the KSP must already have been
+     * set, and (unless the SNES solver is used) assembled, as the block preconditioner (see
+     * SetUseBlockPreconditioner()) is built from the preconditioner matrix here.
      *
      * ///\todo #2057 Make better choices here...
      *
@@ -568,6 +636,17 @@ protected:
      */
     double TakeNewtonStep();
 
+    /**
+     * Compute the Eisenstat-Walker forcing term (the relative tolerance of the linear solve) for the
+     * current Newton step, eta_k = gamma (|f_k|/|f_{k-1}|)^alpha, with gamma=0.9 and alpha=2, using the
+     * usual safeguards: eta_k is not allowed to decrease too fast, is not made smaller than is needed
+     * to reach the nonlinear tolerance, and lies between 1e-6 (the tolerance used otherwise) and 0.9.
+     *
+     * @param residualNorm norm of the residual at the start of this Newton step
+     * @return the forcing term
+     */
+    double ComputeEisenstatWalkerForcingTerm(double residualNorm);
+
     /**
      * Using the update vector (of Newton's method), choose s such that ||f(x+su)|| is most decreased,
      * where f is the residual vector, x the current solution (mCurrentSolution) and u the update vector.
@@ -735,6 +814,84 @@ public:
         mPetscDirectSolve = usePetscDirectSolve;
     }
 
+    /**
+     *  Use a modified Newton method (does nothing if the SNES solver is used). The Jacobian,
+     *  and the preconditioner built from it, are kept after being assembled and are re-used for
+     *  subsequent Newton steps, including those of later calls to Solve(), which only need a
+     *  residual assembly. This is beneficial when a sequence of similar problems is solved, for
+     *  example the mechanics solves in cardiac electromechanics. The Jacobian is re-assembled if
+     *    (i) it has been used for maxJacobianAge Newton steps;
+     *    (ii) a step taken with it didn't reduce the residual norm by the factor refreshResidualRatio;
+     *    (iii) the line search had to damp the last update;
+     *    (iv) the linear solve or the line search failed with it (the step is then repeated); or
+     *    (v) InvalidateStoredJacobian() was called.
+     *  Equivalent to the command line argument "-mech_modified_newton".
+     *
+     *  @param useModifiedNewton Whether to use modified Newton or not
+     *  @param maxJacobianAge Maximum number of Newton steps a Jacobian is used for (defaults to 5)
+     *  @param refreshResidualRatio Required reduction factor of the residual norm for steps taken
+     *    with a re-used Jacobian (defaults to 0.5)
+     */
+    void SetUseModifiedNewton(bool useModifiedNewton = true,
+                              unsigned maxJacobianAge = 5u,
+                              double refreshResidualRatio = 0.5);
+
+    /**
+     *  Choose the tolerance of the linear solve in each Newton step adaptively, using the
+     *  Eisenstat-Walker rule, instead of always solving to a relative tolerance of 1e-6.
+     *  Early Newton steps are then solved inexactly. Has no effect if SetKspAbsoluteTolerance()
+     *  has been called, or if the SNES solver is used. Equivalent to the command line argument
+     *  "-mech_eisenstat_walker".
+     *
+     *  @param useEisenstatWalker Whether to use Eisenstat-Walker linear tolerances or not
+     */
+    void SetUseEisenstatWalkerLinearTolerances(bool useEisenstatWalker = true)
+    {
+        mUseEisenstatWalker = useEisenstatWalker;
+    }
+
+    /**
+     *  Use a block preconditioner for the linear systems of incompressible problems, instead of
+     *  GMRES with (block Jacobi) ILU on the whole system, which is very poor on large problems.
+     *  The preconditioner (see PCLDUFactorisationMechanics) uses an AMG cycle for the displacement
+     *  block and the pressure mass matrix as Schur complement approximation, so scales with problem
+     *  size and number of processes. Has no effect for compressible problems, if
+     *  SetUsePetscDirectSolve() has been called, or if the SNES solver is used (as the preconditioner
+     *  matrix is not available when the SNES solver is set up). Equivalent to the command line
+     *  argument "-mech_block_preconditioner".
+     *
+     *  @param useBlockPreconditioner Whether to use the block preconditioner or not
+     */
+    void SetUseBlockPreconditioner(bool useBlockPreconditioner = true)
+    {
+        mUseBlockPreconditioner = useBlockPreconditioner;
+    }
+
+    /**
+     *  Discard any Jacobian stored by the modified Newton method, so that the next Newton step
+     *  re-assembles it. Should be called if the problem has changed substantially between solves.
+     */
+    void InvalidateStoredJacobian();
+
+    /**
+     * @return the number of Newton steps (non-SNES solver, since construction) for which the
+     * Jacobian was assembled.
+     */
+    unsigned GetNumJacobianAssemblies()
+    {
+        return mNumJacobianAssemblies;
+    }
+
+    /**
+     * @return the number of Newton steps (non-SNES solver, since construction) which re-used a
+     * stored Jacobian and preconditioner, ie the number of Jacobian assemblies saved by the
+     * modified Newton method.
+     */
+    unsigned GetNumJacobianAssembliesSaved()
+    {
+        return mNumJacobianAssembliesSaved;
+    }
+
 
     /**
      * This solver is for static problems, however the body force or surface tractions
@@ -833,6 +990,17 @@ AbstractNonlinearElasticitySolver<DIM>::AbstractNonlinearElasticitySolver(Abstra
       mCurrentTime(0.0),
       mCheckedOutwardNormals(false),
       mLastDampingValue(0.0),
+      mMaxJacobianAge(5u),
+      mJacobianRefreshResidualRatio(0.5),
+      mLaggedKspSolver(NULL),
+      mJacobianAge(0u),
+      mJacobianRefreshRequired(true),
+      mLastForcingTerm(1e-6),
+      mLastNewtonStepResidualNorm(-1.0),
+      mNewtonTolerance(0.0),
+      mNumJacobianAssemblies(0u),
+      mNumJacobianAssembliesSaved(0u),
+      mpBlockPreconditioner(NULL),
       mIncludeActiveTension(true),
       mSetComputeAverageStressPerElement(false)
 {
@@ -843,11 +1011,51 @@ AbstractNonlinearElasticitySolver<DIM>::AbstractNonlinearElasticitySolver(Abstra
 
     mTakeFullFirstNewtonStep = CommandLineArguments::Instance()->OptionExists("-mech_full_first_newton_step");
     mPetscDirectSolve = CommandLineArguments::Instance()->OptionExists("-mech_petsc_direct_solve");
+    mUseModifiedNewton = CommandLineArguments::Instance()->OptionExists("-mech_modified_newton");
+    mUseEisenstatWalker = CommandLineArguments::Instance()->OptionExists("-mech_eisenstat_walker");
+    mUseBlockPreconditioner = CommandLineArguments::Instance()->OptionExists("-mech_block_preconditioner");
 }
 
 template<unsigned DIM>
 AbstractNonlinearElasticitySolver<DIM>::~AbstractNonlinearElasticitySolver()
 {
+    InvalidateStoredJacobian();
+    delete mpBlockPreconditioner;
+}
+
+template<unsigned DIM>
+void AbstractNonlinearElasticitySolver<DIM>::SetUseModifiedNewton(bool useModifiedNewton,
+                                                                  unsigned maxJacobianAge,
+                                                                  double refreshResidualRatio)
+{
+    if (maxJacobianAge == 0u)
+    {
+        EXCEPTION("The maximum Jacobian age must be at least one Newton step");
+    }
+    if (refreshResidualRatio <= 0.0 || refreshResidualRatio > 1.0)
+    {
+        EXCEPTION("The residual ratio for refreshing the Jacobian must be in (0,1]");
+    }
+    mUseModifiedNewton = useModifiedNewton;
+    mMaxJacobianAge = maxJacobianAge;
+    mJacobianRefreshResidualRatio = refreshResidualRatio;
+
+    if (!mUseModifiedNewton)
+    {
+        InvalidateStoredJacobian();
+    }
+}
+
+template<unsigned DIM>
+void AbstractNonlinearElasticitySolver<DIM>::InvalidateStoredJacobian()
+{
+    if (mLaggedKspSolver != NULL)
+    {
+        KSPDestroy(PETSC_DESTROY_PARAM(mLaggedKspSolver));
+        mLaggedKspSolver = NULL;
+    }
+    mJacobianAge = 0u;
+    mJacobianRefreshRequired = true;
 }
 
 
@@ -1604,7 +1812,8 @@ void AbstractNonlinearElasticitySolver<DIM>::SetKspSolverAndPcType(KSP solver)
     //   Otherwise iterative solve with:
     //   (b) Incompressible: GMRES with ILU preconditioner (or bjacobi=ILU on each process) [default]. Very poor on large problems.
     //   (c) Incompressible: GMRES with AMG preconditioner. Uncomment #define MECH_USE_HYPRE above. Requires Petsc3 with HYPRE installed.
-    //   (d) Compressible: CG with ICC
+    //   (d) Incompressible: GMRES with the block preconditioner PCLDUFactorisationMechanics, see SetUseBlockPreconditioner().
+    //   (e) Compressible: CG with ICC
 
     PC pc;
     KSPGetPC(solver, &pc);
@@ -1650,6 +1859,41 @@ void AbstractNonlinearElasticitySolver<DIM>::SetKspSolverAndPcType(KSP solver)
             KSPSetType(solver,KSPGMRES);
             KSPGMRESSetRestart(solver,num_restarts);
 
+            if (mUseBlockPreconditioner && mUseSnesSolver)
+            {
+                WARN_ONCE_ONLY("The mechanics block preconditioner can't be used with the SNES solver, using the default preconditioner");
+            }
+
+            if (mUseBlockPreconditioner && !mUseSnesSolver)
+            {
+                // The locations of the locally owned nodes, for the rigid body modes of the displacement block
+                Vec node_coordinates = this->mrQuadMesh.GetDistributedVectorFactory()->CreateVec(DIM);
+                double* p_node_coordinates;
+                VecGetArray(node_coordinates, &p_node_coordinates);
+                unsigned lo = this->mrQuadMesh.GetDistributedVectorFactory()->GetLow();
+                unsigned hi = this->mrQuadMesh.GetDistributedVectorFactory()->GetHigh();
+                for (unsigned node_index=lo; node_index<hi; node_index++)
+                {
+                    for (unsigned j=0; j<DIM; j++)
+                    {
+                        p_node_coordinates[DIM*(node_index-lo) + j] = this->mrQuadMesh.GetNode(node_index)->rGetLocation()[j];
+                    }
+                }
+                VecRestoreArray(node_coordinates, &p_node_coordinates);
+
+                // Any previous block preconditioner belonged to a KSP which has since been destroyed
+                delete mpBlockPreconditioner;
+                mpBlockPreconditioner = new PCLDUFactorisationMechanics(solver, DIM+1, node_coordinates);
+                PetscTools::Destroy(node_coordinates);
+
+                #if (PETSC_VERSION_MAJOR == 3 && PETSC_VERSION_MINOR >=2) //PETSc 3.2 or later
+                    KSPSetPCSide(solver, PC_RIGHT);
+                #else
+                    KSPSetPreconditionerSide(solver, PC_RIGHT);
+                #endif
+                return;
+            }
+
             #ifndef MECH_USE_HYPRE
                 PCSetType(pc, PCBJACOBI); // BJACOBI = ILU on each block (block = part of matrix on each process)
             #else
@@ -1744,17 +1988,44 @@ double AbstractNonlinearElasticitySolver<DIM>::TakeNewtonStep()
         Timer::Reset();
     }
 
+    // With modified Newton, re-use the stored Jacobian (and the preconditioner already set
+    // up from it) unless one of the refresh rules (see SetUseModifiedNewton()) applied
+    bool reuse_jacobian = (    mUseModifiedNewton
+                           && (mLaggedKspSolver != NULL)
+                           && !mJacobianRefreshRequired
+                           && (mJacobianAge < mMaxJacobianAge) );
+
+    // Kept so that a step which is repeated (see below) sees the same Eisenstat-Walker history
+    double previous_step_resid_norm = mLastNewtonStepResidualNorm;
+
     /////////////////////////////////////////////////////////////
     // Assemble Jacobian (and preconditioner)
     /////////////////////////////////////////////////////////////
     MechanicsEventHandler::BeginEvent(MechanicsEventHandler::ASSEMBLE);
-    AssembleSystem(true, true);
+    if (reuse_jacobian)
+    {
+        // Only the residual is needed. The RHS of the linear system is the residual with the
+        // Dirichlet rows set (as done when applying the bcs to the residual only). Note that in
+        // the compressible case, where the bcs are applied symmetrically, the column correction is
+        // not added - this only matters if the current guess doesn't satisfy the Dirichlet bcs,
+        // and just makes the update inexact, which modified Newton already is.
+        AssembleSystem(true, false);
+        VecCopy(this->mResidualVector, this->mLinearSystemRhsVector);
+        mNumJacobianAssembliesSaved++;
+    }
+    else
+    {
+        AssembleSystem(true, true);
+        mNumJacobianAssemblies++;
+    }
     MechanicsEventHandler::EndEvent(MechanicsEventHandler::ASSEMBLE);
     if(this->mVerbose)
     {
-        Timer::PrintAndReset("AssembleSystem");
+        Timer::PrintAndReset(reuse_jacobian ? "AssembleSystem (residual only)" : "AssembleSystem");
     }
 
+    double initial_norm_resid = CalculateResidualNorm();
+
     ///////////////////////////////////////////////////////////////////
     // Solve the linear system.
     ///////////////////////////////////////////////////////////////////
@@ -1764,27 +2035,43 @@ double AbstractNonlinearElasticitySolver<DIM>::TakeNewtonStep()
     VecDuplicate(this->mResidualVector,&solution);
 
     KSP solver;
-    KSPCreate(PETSC_COMM_WORLD,&solver);
+    if (reuse_jacobian)
+    {
+        solver = mLaggedKspSolver;
+    }
+    else
+    {
+        // A new Jacobian has been assembled, so any stored solver and preconditioner is out of date
+        InvalidateStoredJacobian();
+
+        KSPCreate(PETSC_COMM_WORLD,&solver);
 
 #if ( PETSC_VERSION_MAJOR==3 && PETSC_VERSION_MINOR>=5 )
-    KSPSetOperators(solver, mrJacobianMatrix, this->mPreconditionMatrix);
+        KSPSetOperators(solver, mrJacobianMatrix, this->mPreconditionMatrix);
 #else
-    KSPSetOperators(solver, mrJacobianMatrix, this->mPreconditionMatrix, DIFFERENT_NONZERO_PATTERN /*in precond between successive solves*/);
+        KSPSetOperators(solver, mrJacobianMatrix, this->mPreconditionMatrix, DIFFERENT_NONZERO_PATTERN /*in precond between successive solves*/);
 #endif
 
-    // Set the type of KSP solver (CG, GMRES etc) and preconditioner (ILU, HYPRE, etc)
-    SetKspSolverAndPcType(solver);
+        // Set the type of KSP solver (CG, GMRES etc) and preconditioner (ILU, HYPRE, etc)
+        SetKspSolverAndPcType(solver);
 
-    //PetscTools::SetOption("-ksp_monitor","");
-    //PetscTools::SetOption("-ksp_norm_type","natural");
+        //PetscTools::SetOption("-ksp_monitor","");
+        //PetscTools::SetOption("-ksp_norm_type","natural");
 
-    KSPSetFromOptions(solver);
-    KSPSetUp(solver);
+        KSPSetFromOptions(solver);
+        KSPSetUp(solver);
 
+        if (mUseModifiedNewton)
+        {
+            mLaggedKspSolver = solver;
+            mJacobianRefreshRequired = false;
+        }
+    }
 
     // Set the linear system absolute tolerance.
     // This is either the user provided value, or set to
-    // max {1e-6 * initial_residual, 1e-12}
+    // max {eta * initial_residual, 1e-12}, where eta is 1e-6 or
+    // chosen using the Eisenstat-Walker rule
     if (mKspAbsoluteTol < 0)
     {
         Vec temp;
@@ -1803,6 +2090,14 @@ double AbstractNonlinearElasticitySolver<DIM>::TakeNewtonStep()
         PetscTools::Destroy(linsys_residual);
 
         double ksp_rel_tol = 1e-6;
+        if (mUseEisenstatWalker)
+        {
+            ksp_rel_tol = ComputeEisenstatWalkerForcingTerm(initial_norm_resid);
+            if(this->mVerbose)
+            {
+                std::cout << "\tEisenstat-Walker linear tolerance = " << ksp_rel_tol << "\n" << std::flush;
+            }
+        }
         double absolute_tol = ksp_rel_tol * initial_resid_norm;
         if(absolute_tol < 1e-12)
         {
@@ -1814,6 +2109,7 @@ double AbstractNonlinearElasticitySolver<DIM>::TakeNewtonStep()
     {
         KSPSetTolerances(solver, 1e-16, mKspAbsoluteTol, PETSC_DEFAULT, 1000 /* max iters */); // Note: some machines - max iters seems to be 1000 whatever we give here
     }
+    mLastNewtonStepResidualNorm = initial_norm_resid;
 
     if(this->mVerbose)
     {
@@ -1849,12 +2145,36 @@ double AbstractNonlinearElasticitySolver<DIM>::TakeNewtonStep()
     KSPConvergedReason reason;
     KSPGetConvergedReason(solver,&reason);
 
+    int num_iters;
+    KSPGetIterationNumber(solver, &num_iters);
+
+    if (reuse_jacobian && (reason<0 || num_iters==0))
+    {
+        // The linear solve failed with the re-used Jacobian: discard it and repeat this
+        // Newton step with a freshly assembled one
+        MechanicsEventHandler::EndEvent(MechanicsEventHandler::SOLVE);
+        PetscTools::Destroy(solution);
+        mNumJacobianAssembliesSaved--;
+        InvalidateStoredJacobian();
+        mLastNewtonStepResidualNorm = previous_step_resid_norm;
+        if(this->mVerbose)
+        {
+            std::cout << "\tLinear solve failed with re-used Jacobian, re-assembling\n" << std::flush;
+        }
+        return TakeNewtonStep();
+    }
+
     if(reason != KSP_DIVERGED_ITS)
     {
         // Throw an exception if the solver failed for any reason other than DIVERGED_ITS.
         // This is not covered as would be difficult to cover - requires a bad matrix to
         // assembled, for example.
         #define COVERAGE_IGNORE
+        if (reason < 0)
+        {
+            // Don't keep a Jacobian the linear solver can't cope with
+            InvalidateStoredJacobian();
+        }
         KSPEXCEPT(reason);
         #undef COVERAGE_IGNORE
     }
@@ -1872,12 +2192,14 @@ double AbstractNonlinearElasticitySolver<DIM>::TakeNewtonStep()
     }
 
     // quit if no ksp iterations were done
-    int num_iters;
-    KSPGetIterationNumber(solver, &num_iters);
     if (num_iters==0)
     {
         PetscTools::Destroy(solution);
-        KSPDestroy(PETSC_DESTROY_PARAM(solver));
+        if (solver != mLaggedKspSolver)
+        {
+            KSPDestroy(PETSC_DESTROY_PARAM(solver));
+        }
+        InvalidateStoredJacobian();
         EXCEPTION("KSP Absolute tolerance was too high, linear system wasn't solved - there will be no decrease in Newton residual. Decrease KspAbsoluteTolerance");
     }
 
@@ -1904,16 +2226,98 @@ double AbstractNonlinearElasticitySolver<DIM>::TakeNewtonStep()
     // s=1 is the best. Otherwise, check s=0.8 to see if s=0.9 is a local min.
     ///////////////////////////////////////////////////////////////////////////
     MechanicsEventHandler::BeginEvent(MechanicsEventHandler::UPDATE);
-    double new_norm_resid = UpdateSolutionUsingLineSearch(solution);
+    double new_norm_resid = DBL_MAX;
+    if (reuse_jacobian)
+    {
+        // If the update computed with the re-used Jacobian is not a descent direction,
+        // restore the current guess and repeat this Newton step with a fresh Jacobian
+        std::vector<double> old_solution = this->mCurrentSolution;
+        try
+        {
+            new_norm_resid = UpdateSolutionUsingLineSearch(solution);
+        }
+        catch (Exception&)
+        {
+            MechanicsEventHandler::EndEvent(MechanicsEventHandler::UPDATE);
+            PetscTools::Destroy(solution);
+            this->mCurrentSolution = old_solution;
+            mNumJacobianAssembliesSaved--;
+            InvalidateStoredJacobian();
+            mLastNewtonStepResidualNorm = previous_step_resid_norm;
+            if(this->mVerbose)
+            {
+                std::cout << "\tLine search failed with re-used Jacobian, re-assembling\n" << std::flush;
+            }
+            return TakeNewtonStep();
+        }
+    }
+    else
+    {
+        new_norm_resid = UpdateSolutionUsingLineSearch(solution);
+    }
     MechanicsEventHandler::EndEvent(MechanicsEventHandler::UPDATE);
 
     PetscTools::Destroy(solution);
-    KSPDestroy(PETSC_DESTROY_PARAM(solver));
+
+    if (mUseModifiedNewton)
+    {
+        // Decide whether the stored Jacobian can be used for the next step
+        mJacobianAge = reuse_jacobian ? mJacobianAge+1 : 1u;
+        if (    (mJacobianAge >= mMaxJacobianAge)
+             || (mLastDampingValue < 1.0)
+             || (reuse_jacobian && new_norm_resid > mJacobianRefreshResidualRatio*initial_norm_resid) )
+        {
+            mJacobianRefreshRequired = true;
+        }
+    }
+    else
+    {
+        KSPDestroy(PETSC_DESTROY_PARAM(solver));
+    }
 
     return new_norm_resid;
 }
 
 
+template<unsigned DIM>
+double AbstractNonlinearElasticitySolver<DIM>::ComputeEisenstatWalkerForcingTerm(double residualNorm)
+{
+    const double gamma = 0.9;
+    const double alpha = 2.0;
+    const double max_forcing_term = 0.9;
+    const double min_forcing_term = 1e-6;
+
+    double eta;
+    if (mLastNewtonStepResidualNorm <= 0.0)
+    {
+        // First Newton step of this solve
+        eta = 0.1;
+    }
+    else
+    {
+        eta = gamma*pow(residualNorm/mLastNewtonStepResidualNorm, alpha);
+
+        // Don't let the forcing term decrease too quickly
+        double safeguard = gamma*pow(mLastForcingTerm, alpha);
+        if (safeguard > 0.1)
+        {
+            eta = std::max(eta, safeguard);
+        }
+    }
+
+    // Don't over-solve the last linear system: a reduction in the residual to (half) the
+    // nonlinear tolerance is all that is needed
+    if (mNewtonTolerance > 0.0 && residualNorm > 0.0)
+    {
+        eta = std::max(eta, 0.5*mNewtonTolerance/residualNorm);
+    }
+
+    eta = std::min(std::max(eta, min_forcing_term), max_forcing_term);
+    mLastForcingTerm = eta;
+    return eta;
+}
+
+
 template<unsigned DIM>
 void AbstractNonlinearElasticitySolver<DIM>::PrintLineSearchResult(double s, double residNorm)
 {
@@ -2111,6 +2515,9 @@ void AbstractNonlinearElasticitySolver<DIM>::SolveNonSnes(double tol)
         std::cout << "Solving with tolerance " << tol << "\n";
     }
 
+    mNewtonTolerance = tol;
+    mLastNewtonStepResidualNorm = -1.0;
+
     while (norm_resid > tol)
     {
         if(this->mVerbose)
@@ -2153,6 +2560,12 @@ void AbstractNonlinearElasticitySolver<DIM>::SolveNonSnes(double tol)
         EXCEPTION("Failed to converge");
         #undef COVERAGE_IGNORE
     }
+
+    if(this->mVerbose && mUseModifiedNewton)
+    {
+        std::cout << "Jacobian assemblies: " << mNumJacobianAssemblies
+                  << ", saved by re-use: " << mNumJacobianAssembliesSaved << "\n";
+    }
 }
 
 
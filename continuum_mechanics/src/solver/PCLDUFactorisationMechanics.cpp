@@ -0,0 +1,317 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <iostream>
+
+#include "PetscVecTools.hpp" // Includes Ublas so must come first
+#include "PCLDUFactorisationMechanics.hpp"
+#include "Exception.hpp"
+#include "Warnings.hpp"
+
+PCLDUFactorisationMechanics::PCLDUFactorisationMechanics(KSP& rKspObject, unsigned problemDimension, Vec nodeCoordinates)
+{
+    assert(problemDimension==3 || problemDimension==4);
+    mPCContext.problemDimension = problemDimension;
+
+    PCLDUFactorisationMechanicsCreate(rKspObject);
+    PCLDUFactorisationMechanicsSetUp(nodeCoordinates);
+}
+
+PCLDUFactorisationMechanics::~PCLDUFactorisationMechanics()
+{
+    PetscTools::Destroy(mPCContext.A_matrix_subblock);
+    PetscTools::Destroy(mPCContext.B_matrix_subblock);
+    PetscTools::Destroy(mPCContext.M_matrix_subblock);
+
+    PCDestroy(PETSC_DESTROY_PARAM(mPCContext.PC_amg_A));
+    PCDestroy(PETSC_DESTROY_PARAM(mPCContext.PC_M));
+
+    PetscTools::Destroy(mPCContext.x1_subvector);
+    PetscTools::Destroy(mPCContext.y1_subvector);
+    PetscTools::Destroy(mPCContext.x2_subvector);
+    PetscTools::Destroy(mPCContext.y2_subvector);
+    PetscTools::Destroy(mPCContext.temp);
+}
+
+void PCLDUFactorisationMechanics::PCLDUFactorisationMechanicsCreate(KSP& rKspObject)
+{
+    KSPGetPC(rKspObject, &mPetscPCObject);
+
+    // The preconditioner matrix (not the Jacobian) is split into blocks
+    Mat system_matrix, precond_matrix;
+#if ( PETSC_VERSION_MAJOR==3 && PETSC_VERSION_MINOR>=5 )
+    KSPGetOperators(rKspObject, &system_matrix, &precond_matrix);
+#else
+    MatStructure flag;
+    KSPGetOperators(rKspObject, &system_matrix, &precond_matrix, &flag);
+#endif
+
+    const unsigned problem_dim = mPCContext.problemDimension;
+
+    PetscInt num_rows, num_columns;
+    MatGetSize(precond_matrix, &num_rows, &num_columns);
+
+    PetscInt num_local_rows, num_local_columns;
+    MatGetLocalSize(precond_matrix, &num_local_rows, &num_local_columns);
+
+    // All the unknowns of a node should be stored in the same processor
+    if ((num_rows%problem_dim != 0) || (num_local_rows%problem_dim != 0))
+    {
+        TERMINATE("Wrong matrix parallel layout detected in PCLDUFactorisationMechanics.");
+    }
+
+    PetscInt low, high;
+    MatGetOwnershipRange(precond_matrix, &low, &high);
+
+    // Allocate memory
+    unsigned num_nodes = num_rows/problem_dim;
+    unsigned num_local_nodes = num_local_rows/problem_dim;
+    mPCContext.x1_subvector = PetscTools::CreateVec((problem_dim-1)*num_nodes, (problem_dim-1)*num_local_nodes);
+    mPCContext.y1_subvector = PetscTools::CreateVec((problem_dim-1)*num_nodes, (problem_dim-1)*num_local_nodes);
+    mPCContext.temp = PetscTools::CreateVec((problem_dim-1)*num_nodes, (problem_dim-1)*num_local_nodes);
+    mPCContext.x2_subvector = PetscTools::CreateVec(num_nodes, num_local_nodes);
+    mPCContext.y2_subvector = PetscTools::CreateVec(num_nodes, num_local_nodes);
+
+    // Index sets of the locally owned displacement and pressure rows
+    PetscInt* displacement_rows = new PetscInt[(problem_dim-1)*num_local_nodes];
+    PetscInt* pressure_rows = new PetscInt[num_local_nodes];
+    for (unsigned local_node=0; local_node<num_local_nodes; local_node++)
+    {
+        PetscInt first_row = low + problem_dim*local_node;
+        for (unsigned j=0; j<problem_dim-1; j++)
+        {
+            displacement_rows[(problem_dim-1)*local_node + j] = first_row + j;
+        }
+        pressure_rows[local_node] = first_row + problem_dim - 1;
+    }
+
+    IS displacement_is;
+    IS pressure_is;
+#if (PETSC_VERSION_MAJOR == 3 && PETSC_VERSION_MINOR >= 2) //PETSc 3.2 or later
+    ISCreateGeneral(PETSC_COMM_WORLD, (problem_dim-1)*num_local_nodes, displacement_rows, PETSC_COPY_VALUES, &displacement_is);
+    ISCreateGeneral(PETSC_COMM_WORLD, num_local_nodes, pressure_rows, PETSC_COPY_VALUES, &pressure_is);
+#else
+    ISCreateGeneral(PETSC_COMM_WORLD, (problem_dim-1)*num_local_nodes, displacement_rows, &displacement_is);
+    ISCreateGeneral(PETSC_COMM_WORLD, num_local_nodes, pressure_rows, &pressure_is);
+#endif
+    delete[] displacement_rows;
+    delete[] pressure_rows;
+
+    // Get matrix sublocks A, B1' and M
+#if (PETSC_VERSION_MAJOR == 3 && PETSC_VERSION_MINOR >= 1) //PETSc 3.1 or later
+    MatGetSubMatrix(precond_matrix, displacement_is, displacement_is,
+        MAT_INITIAL_MATRIX, &mPCContext.A_matrix_subblock);
+    MatGetSubMatrix(precond_matrix, displacement_is, pressure_is,
+        MAT_INITIAL_MATRIX, &mPCContext.B_matrix_subblock);
+    MatGetSubMatrix(precond_matrix, pressure_is, pressure_is,
+        MAT_INITIAL_MATRIX, &mPCContext.M_matrix_subblock);
+#else
+    MatGetSubMatrix(precond_matrix, displacement_is, displacement_is, PETSC_DECIDE,
+        MAT_INITIAL_MATRIX, &mPCContext.A_matrix_subblock);
+    MatGetSubMatrix(precond_matrix, displacement_is, pressure_is, PETSC_DECIDE,
+        MAT_INITIAL_MATRIX, &mPCContext.B_matrix_subblock);
+    MatGetSubMatrix(precond_matrix, pressure_is, pressure_is, PETSC_DECIDE,
+        MAT_INITIAL_MATRIX, &mPCContext.M_matrix_subblock);
+#endif
+
+    ISDestroy(PETSC_DESTROY_PARAM(displacement_is));
+    ISDestroy(PETSC_DESTROY_PARAM(pressure_is));
+
+    PCSetType(mPetscPCObject, PCSHELL);
+#if (PETSC_VERSION_MAJOR == 2 && PETSC_VERSION_MINOR == 2) //PETSc 2.2
+    // Register PC context and call-back function
+    PCShellSetApply(mPetscPCObject, PCLDUFactorisationMechanicsApply, (void*) &mPCContext);
+#else
+    // Register PC context so it gets passed to PCLDUFactorisationMechanicsApply
+    PCShellSetContext(mPetscPCObject, &mPCContext);
+    // Register call-back function
+    PCShellSetApply(mPetscPCObject, PCLDUFactorisationMechanicsApply);
+#endif
+}
+
+void PCLDUFactorisationMechanics::PCLDUFactorisationMechanicsSetUp(Vec nodeCoordinates)
+{
+    /*
+     * Set up AMG preconditioner for the displacement block A
+     */
+    PCCreate(PETSC_COMM_WORLD, &(mPCContext.PC_amg_A));
+    PCSetOptionsPrefix(mPCContext.PC_amg_A, "mech_A_");
+#if ( PETSC_VERSION_MAJOR==3 && PETSC_VERSION_MINOR>=5 )
+    PCSetOperators(mPCContext.PC_amg_A, mPCContext.A_matrix_subblock, mPCContext.A_matrix_subblock);
+#else
+    PCSetOperators(mPCContext.PC_amg_A, mPCContext.A_matrix_subblock, mPCContext.A_matrix_subblock, SAME_PRECONDITIONER);
+#endif
+
+#if (PETSC_VERSION_MAJOR == 3 && PETSC_VERSION_MINOR >= 3) //PETSc 3.3 or later
+    PCSetType(mPCContext.PC_amg_A, PCGAMG);
+
+    if (nodeCoordinates != NULL)
+    {
+        // Smoothed aggregation needs the rigid body modes to work well for elasticity
+        MatNullSpace rigid_body_modes;
+        MatNullSpaceCreateRigidBody(nodeCoordinates, &rigid_body_modes);
+        MatSetNearNullSpace(mPCContext.A_matrix_subblock, rigid_body_modes);
+        MatNullSpaceDestroy(&rigid_body_modes);
+    }
+#else
+    // We are expecting an error from PETSC on systems that don't have the hypre library, so suppress it
+    // in case it aborts
+    PetscPushErrorHandler(PetscIgnoreErrorHandler, NULL);
+    PetscErrorCode pc_set_error = PCSetType(mPCContext.PC_amg_A, PCHYPRE);
+    // Stop supressing error
+    PetscPopErrorHandler();
+    if (pc_set_error != 0)
+    {
+        WARNING("PETSc hypre preconditioning library is not installed");
+        PCSetType(mPCContext.PC_amg_A, PCBJACOBI);
+    }
+    else
+    {
+        PetscTools::SetOption("-mech_A_pc_hypre_type", "boomeramg");
+        PetscTools::SetOption("-mech_A_pc_hypre_boomeramg_max_iter", "1");
+    }
+#endif
+
+    PCSetFromOptions(mPCContext.PC_amg_A);
+    PCSetUp(mPCContext.PC_amg_A);
+
+    /*
+     * Set up preconditioner for the pressure mass matrix block M
+     */
+    PCCreate(PETSC_COMM_WORLD, &(mPCContext.PC_M));
+    PCSetOptionsPrefix(mPCContext.PC_M, "mech_M_");
+#if ( PETSC_VERSION_MAJOR==3 && PETSC_VERSION_MINOR>=5 )
+    PCSetOperators(mPCContext.PC_M, mPCContext.M_matrix_subblock, mPCContext.M_matrix_subblock);
+#else
+    PCSetOperators(mPCContext.PC_M, mPCContext.M_matrix_subblock, mPCContext.M_matrix_subblock, SAME_PRECONDITIONER);
+#endif
+    PCSetType(mPCContext.PC_M, PCBJACOBI);
+    PCSetFromOptions(mPCContext.PC_M);
+    PCSetUp(mPCContext.PC_M);
+}
+
+#if (PETSC_VERSION_MAJOR == 3 && PETSC_VERSION_MINOR >= 1) //PETSc 3.1 or later
+PetscErrorCode PCLDUFactorisationMechanicsApply(PC pc_object, Vec x, Vec y)
+{
+  void* pc_context;
+
+  PCShellGetContext(pc_object, &pc_context);
+#else
+PetscErrorCode PCLDUFactorisationMechanicsApply(void* pc_context, Vec x, Vec y)
+{
+#endif
+    // Cast the pointer to a PC context to our defined type
+    PCLDUFactorisationMechanics::PCLDUFactorisationMechanicsContext* ldu_context = (PCLDUFactorisationMechanics::PCLDUFactorisationMechanicsContext*) pc_context;
+    assert(ldu_context!=NULL);
+
+    const unsigned problem_dim = ldu_context->problemDimension;
+
+    /*
+     * Split vector x into two. x = [x1 x2]'. All the unknowns of a node are local,
+     * so this doesn't need any communication.
+     */
+    PetscScalar *p_x;
+    PetscScalar *p_x1;
+    PetscScalar *p_x2;
+#if (PETSC_VERSION_MAJOR == 3 && PETSC_VERSION_MINOR >= 2) //PETSc 3.2 or later
+    VecGetArrayRead(x, (const PetscScalar**)&p_x);
+#else
+    VecGetArray(x, &p_x);
+#endif
+    VecGetArray(ldu_context->x1_subvector, &p_x1);
+    VecGetArray(ldu_context->x2_subvector, &p_x2);
+
+    PetscInt x2_local_size;
+    VecGetLocalSize(ldu_context->x2_subvector, &x2_local_size);
+    for (PetscInt local_node=0; local_node<x2_local_size; local_node++)
+    {
+        for (unsigned j=0; j<problem_dim-1; j++)
+        {
+            p_x1[(problem_dim-1)*local_node + j] = p_x[problem_dim*local_node + j];
+        }
+        p_x2[local_node] = p_x[problem_dim*local_node + problem_dim-1];
+    }
+
+#if (PETSC_VERSION_MAJOR == 3 && PETSC_VERSION_MINOR >= 2) //PETSc 3.2 or later
+    VecRestoreArrayRead(x, (const PetscScalar**)&p_x);
+#else
+    VecRestoreArray(x, &p_x);
+#endif
+    VecRestoreArray(ldu_context->x1_subvector, &p_x1);
+    VecRestoreArray(ldu_context->x2_subvector, &p_x2);
+
+    /*
+     * Apply preconditioner: [y1 y2]' = inv(P)[x1 x2]'
+     *
+     *    y2 = inv(M)*x2
+     *    y1 = inv(A)*(x1 - B1'*y2)
+     */
+    PCApply(ldu_context->PC_M, ldu_context->x2_subvector, ldu_context->y2_subvector);
+
+    MatMult(ldu_context->B_matrix_subblock, ldu_context->y2_subvector, ldu_context->temp); // temp = B1'*y2
+    double minus_one = -1.0;
+#if (PETSC_VERSION_MAJOR == 2 && PETSC_VERSION_MINOR == 2) //PETSc 2.2
+    VecAYPX(&minus_one, ldu_context->x1_subvector, ldu_context->temp); // temp <-- x1 - temp
+#else
+    VecAYPX(ldu_context->temp, minus_one, ldu_context->x1_subvector); // temp <-- x1 - temp
+#endif
+
+    PCApply(ldu_context->PC_amg_A, ldu_context->temp, ldu_context->y1_subvector); // y1 = inv(A)*temp
+
+    /*
+     * Gather vectors y1 and y2. y = [y1 y2]'
+     */
+    PetscScalar *p_y;
+    PetscScalar *p_y1;
+    PetscScalar *p_y2;
+    VecGetArray(y, &p_y);
+    VecGetArray(ldu_context->y1_subvector, &p_y1);
+    VecGetArray(ldu_context->y2_subvector, &p_y2);
+
+    for (PetscInt local_node=0; local_node<x2_local_size; local_node++)
+    {
+        for (unsigned j=0; j<problem_dim-1; j++)
+        {
+            p_y[problem_dim*local_node + j] = p_y1[(problem_dim-1)*local_node + j];
+        }
+        p_y[problem_dim*local_node + problem_dim-1] = p_y2[local_node];
+    }
+
+    VecRestoreArray(y, &p_y);
+    VecRestoreArray(ldu_context->y1_subvector, &p_y1);
+    VecRestoreArray(ldu_context->y2_subvector, &p_y2);
+
+    return 0;
+}
@@ -0,0 +1,149 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef PCLDUFACTORISATIONMECHANICS_HPP_
+#define PCLDUFACTORISATIONMECHANICS_HPP_
+
+#include <cassert>
+#include <petscvec.h>
+#include <petscmat.h>
+#include <petscksp.h>
+#include <petscpc.h>
+#include "PetscTools.hpp"
+
+/**
+ * PETSc will return the control to this function everytime it needs to precondition a vector (i.e. y = inv(M)*x)
+ *
+ * @param pc_context preconditioner context struct. Stores preconditioner state (i.e. PC, Mat, and Vec objects used)
+ * @param x unpreconditioned residual.
+ * @param y preconditioned residual. y = inv(M)*x
+ */
+#if (PETSC_VERSION_MAJOR == 3 && PETSC_VERSION_MINOR >= 1) //PETSc 3.1 or later
+PetscErrorCode PCLDUFactorisationMechanicsApply(PC pc_object, Vec x, Vec y);
+#else
+PetscErrorCode PCLDUFactorisationMechanicsApply(void* pc_context, Vec x, Vec y);
+#endif
+
+/**
+ * A PETSc-compliant purpose-built preconditioner for the displacement-pressure
+ * (saddle point) systems arising in incompressible nonlinear elasticity.
+ *
+ * Ordering the unknowns as displacement then pressure, the Jacobian has the block structure
+ *
+ *                 J = (A   B1')
+ *                     (B2  0  )
+ *
+ * and the incompressible solvers assemble a preconditioner matrix
+ *
+ *                 P = (A   B1')
+ *                     (0   M  )
+ *
+ * where M is the pressure mass matrix (with the identity for the dummy pressure unknowns
+ * at internal nodes). M is spectrally equivalent to the Schur complement B2*inv(A)*B1', so
+ * this is the LDU factorisation of the bidomain preconditioner PCLDUFactorisation with L=I
+ * and S approximated by M. In order to compute [y1 y2]' = inv(P)[x1 x2]' we do
+ *
+ *                 y2 = inv(M)*x2
+ *                 y1 = inv(A)*(x1 - B1'*y2)
+ *
+ * inv(A) is approximated with one AMG cycle: PETSc's built-in smoothed aggregation (GAMG,
+ * PETSc 3.3 or later), which is given the rigid body modes of the mesh as near null space if
+ * node coordinates are provided, or HYPRE BoomerAMG for older PETSc versions (block Jacobi
+ * with a warning if HYPRE is not installed). inv(M) is approximated with block Jacobi, as M
+ * is well conditioned. The sub-preconditioners can be tuned from the command line using the
+ * option prefixes "-mech_A_" and "-mech_M_" (eg "-mech_A_pc_gamg_threshold 0.05"). All the sub-preconditioners are parallel, so unlike the default (block Jacobi ILU
+ * on the whole of P) the number of Krylov iterations should stay roughly constant as the problem
+ * is refined and distributed over more processes.
+ *
+ * The matrix layout is assumed to be that of the continuum mechanics solvers: problemDimension
+ * unknowns per node, the last of which is the pressure, with the rows of each node owned by a
+ * single process.
+ */
+class PCLDUFactorisationMechanics
+{
+public:
+
+    /**
+     * This struct defines the state of the preconditioner (initialised data and objects to be reused).
+     */
+    typedef struct{
+        Mat A_matrix_subblock; /**< Mat object that stores the displacement-displacement block A.*/
+        Mat B_matrix_subblock; /**< Mat object that stores the displacement-pressure block B1'.*/
+        Mat M_matrix_subblock; /**< Mat object that stores the pressure-pressure (mass matrix) block M.*/
+        PC  PC_amg_A; /**< inv(A) is approximated by an AMG cycle.*/
+        PC  PC_M; /**< inv(M) is approximated by block Jacobi.*/
+        Vec x1_subvector;/**< Used to store the displacement part of the vector to be preconditioned*/
+        Vec x2_subvector;/**< Used to store the pressure part of the vector to be preconditioned*/
+        Vec y1_subvector;/**< Used to store the displacement part of the preconditioned vector*/
+        Vec y2_subvector;/**< Used to store the pressure part of the preconditioned vector*/
+        Vec temp;/**< Used to store intermediate results*/
+        unsigned problemDimension;/**< Number of unknowns per node (the last one being the pressure)*/
+    } PCLDUFactorisationMechanicsContext;
+
+    PCLDUFactorisationMechanicsContext mPCContext; /**< PC context, this will be passed to PCLDUFactorisationMechanicsApply when PETSc returns control to our preconditioner subroutine. See PCShellSetContext().*/
+    PC mPetscPCObject;/**< Generic PETSc preconditioner object */
+
+    /**
+     * Constructor. The operators of the KSP must have been set (and assembled). The preconditioner
+     * matrix of the KSP is the one split into blocks.
+     *
+     * @param rKspObject KSP object where we want to install the preconditioner.
+     * @param problemDimension number of unknowns per node, ie DIM+1
+     * @param nodeCoordinates (optional) the locations of the locally owned nodes, interleaved
+     *   (x0 y0 z0 x1 y1 z1 ...), with block size problemDimension-1. Used to give the AMG method
+     *   the rigid body modes. May be NULL.
+     */
+    PCLDUFactorisationMechanics(KSP& rKspObject, unsigned problemDimension, Vec nodeCoordinates=NULL);
+
+    ~PCLDUFactorisationMechanics();
+
+private:
+
+    /**
+     * Creates all the state data required by the preconditioner.
+     *
+     * @param rKspObject KSP object where we want to install the preconditioner.
+     */
+    void PCLDUFactorisationMechanicsCreate(KSP& rKspObject);
+
+    /**
+     * Setups preconditioner.
+     *
+     * @param nodeCoordinates see constructor
+     */
+    void PCLDUFactorisationMechanicsSetUp(Vec nodeCoordinates);
+};
+
+#endif /*PCLDUFACTORISATIONMECHANICS_HPP_*/
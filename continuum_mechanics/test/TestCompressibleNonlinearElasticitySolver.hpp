@@ -782,6 +782,75 @@ public:
         TS_ASSERT_DELTA(r_solution[5](1), 0.0021, 1e-4);
     }
 
+    /**
+     * Same problem as TestSolveForSimpleDeformationWithExponentialLaw, but using modified Newton
+     * (re-using the Jacobian) and Eisenstat-Walker linear tolerances. The problem is then solved
+     * again with a slightly different body force, which should re-use the Jacobian from the first solve.
+     */
+    void TestModifiedNewtonWithExponentialLaw() throw(Exception)
+    {
+        unsigned num_elem = 5;
+
+        QuadraticMesh<2> mesh(1.0/num_elem, 1.0, 1.0);
+        CompressibleExponentialLaw<2> law;
+
+        std::vector<unsigned> fixed_nodes = NonlinearElasticityTools<2>::GetNodesByComponentValue(mesh,0,0);
+
+        SolidMechanicsProblemDefinition<2> problem_defn(mesh);
+        problem_defn.SetMaterialLaw(COMPRESSIBLE,&law);
+        problem_defn.SetZeroDisplacementNodes(fixed_nodes);
+
+        c_vector<double,2> gravity;
+        gravity(0) = 2.0;
+        gravity(1) = 0.0;
+        problem_defn.SetBodyForce(gravity);
+
+        CompressibleNonlinearElasticitySolver<2> solver(mesh,
+                                                        problem_defn,
+                                                        "CompressibleExponentialLawModifiedNewton");
+
+        TS_ASSERT_THROWS_THIS(solver.SetUseModifiedNewton(true, 0u),
+                              "The maximum Jacobian age must be at least one Newton step");
+        TS_ASSERT_THROWS_THIS(solver.SetUseModifiedNewton(true, 5u, 1.5),
+                              "The residual ratio for refreshing the Jacobian must be in (0,1]");
+
+        solver.SetUseModifiedNewton(true, 5u, 0.5);
+        solver.SetUseEisenstatWalkerLinearTolerances();
+
+        PetscTools::SetOption("-pc_type","jacobi");
+
+        solver.Solve();
+
+        // Same answer as with full Newton (see TestSolveForSimpleDeformationWithExponentialLaw)
+        std::vector<c_vector<double,2> >& r_solution = solver.rGetDeformedPosition();
+        TS_ASSERT_DELTA(r_solution[5](0), 1.0360, 1e-4);
+        TS_ASSERT_DELTA(r_solution[5](1), 0.0021, 1e-4);
+
+        unsigned num_assemblies = solver.GetNumJacobianAssemblies();
+        TS_ASSERT_EQUALS(num_assemblies + solver.GetNumJacobianAssembliesSaved(), solver.GetNumNewtonIterations());
+        TS_ASSERT_LESS_THAN(0u, num_assemblies);
+
+        // A slightly different problem, starting from the previous solution: the stored
+        // Jacobian should be good enough to be re-used
+        gravity(0) = 2.01;
+        problem_defn.SetBodyForce(gravity);
+        solver.Solve();
+
+        TS_ASSERT_LESS_THAN(0u, solver.GetNumJacobianAssembliesSaved());
+        TS_ASSERT_DELTA(solver.rGetDeformedPosition()[5](0), 1.0360, 1e-3);
+
+        // Switching off modified Newton means every Newton step assembles the Jacobian
+        solver.SetUseModifiedNewton(false);
+        unsigned num_saved = solver.GetNumJacobianAssembliesSaved();
+        num_assemblies = solver.GetNumJacobianAssemblies();
+        gravity(0) = 2.0;
+        problem_defn.SetBodyForce(gravity);
+        solver.Solve();
+        TS_ASSERT_EQUALS(solver.GetNumJacobianAssembliesSaved(), num_saved);
+        TS_ASSERT_EQUALS(solver.GetNumJacobianAssemblies(), num_assemblies + solver.GetNumNewtonIterations());
+        TS_ASSERT_DELTA(solver.rGetDeformedPosition()[5](0), 1.0360, 1e-4);
+    }
+
     /**
      * Same as TestSolveForSimpleDeformationWithCompMooneyRivlin (see comments for this),
      * except the y position of the fixed nodes is left free, i.e. sliding boundary conditions
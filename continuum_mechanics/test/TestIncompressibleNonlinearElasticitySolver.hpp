@@ -532,6 +532,61 @@ public:
 
 
 
+    // Same as TestSolve but using the block (AMG + pressure mass matrix) preconditioner
+    void TestSolveWithBlockPreconditioner() throw(Exception)
+    {
+        QuadraticMesh<2> mesh;
+        TrianglesMeshReader<2,2> mesh_reader("mesh/test/data/square_128_elements_quadratic",2,1,false);
+        mesh.ConstructFromMeshReader(mesh_reader);
+
+        MooneyRivlinMaterialLaw<2> law(1.0);
+        c_vector<double,2> body_force;
+        body_force(0) = 3.0;
+        body_force(1) = 0.0;
+
+        std::vector<unsigned> fixed_nodes
+          = NonlinearElasticityTools<2>::GetNodesByComponentValue(mesh,0,0);
+
+        SolidMechanicsProblemDefinition<2> problem_defn(mesh);
+        problem_defn.SetMaterialLaw(INCOMPRESSIBLE,&law);
+        problem_defn.SetZeroDisplacementNodes(fixed_nodes);
+        problem_defn.SetBodyForce(body_force);
+
+        IncompressibleNonlinearElasticitySolver<2> solver(mesh,
+                                                          problem_defn,
+                                                          "simple_nonlin_elas_block_pc");
+        solver.SetUseBlockPreconditioner();
+
+        solver.Solve();
+        TS_ASSERT_LESS_THAN_EQUALS(solver.GetNumNewtonIterations(), 5u); // 4 with the default preconditioner
+
+        std::vector<c_vector<double,2> >& r_solution = solver.rGetDeformedPosition();
+
+        double xend = 1.17199;
+        double yend = 0.01001;
+
+        TS_ASSERT_DELTA( r_solution[0](0), 0.0, 1e-6 );
+        TS_ASSERT_DELTA( r_solution[0](1), 0.0, 1e-6 );
+        TS_ASSERT_DELTA( r_solution[3](0), 0.0, 1e-6 );
+        TS_ASSERT_DELTA( r_solution[3](1), 1.0, 1e-6 );
+        TS_ASSERT_DELTA( r_solution[1](0), xend, 1e-3 );
+        TS_ASSERT_DELTA( r_solution[1](1), yend, 1e-3 );
+        TS_ASSERT_DELTA( r_solution[2](0), xend,   1e-3 );
+        TS_ASSERT_DELTA( r_solution[2](1), 1-yend, 1e-3 );
+
+        // The block preconditioner works together with modified Newton (the preconditioner is
+        // kept with the Jacobian)
+        solver.SetUseModifiedNewton();
+        body_force(0) = 3.01;
+        problem_defn.SetBodyForce(body_force);
+        solver.Solve();
+        body_force(0) = 3.02;
+        problem_defn.SetBodyForce(body_force);
+        solver.Solve();
+        TS_ASSERT_LESS_THAN(0u, solver.GetNumJacobianAssembliesSaved());
+        TS_ASSERT_DELTA( solver.rGetDeformedPosition()[1](0), xend, 1e-2 );
+    }
+
     /**
      *  Solve a problem with non-zero dirichlet boundary conditions
      *  and non-zero tractions. THIS TEST COMPARES AGAINST AN EXACT SOLUTION.
@@ -0,0 +1,183 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "CounterBasedRandomStream.hpp"
+
+#include <cassert>
+#include <cmath>
+
+// Multipliers and Weyl sequence constants for Philox4x32, from Salmon et al. (2011)
+static const boost::uint32_t PHILOX_M0 = 0xD2511F53u; ///< Multiplier for the first word pair
+static const boost::uint32_t PHILOX_M1 = 0xCD9E8D57u; ///< Multiplier for the second word pair
+static const boost::uint32_t PHILOX_W0 = 0x9E3779B9u; ///< Key increment for the first key word
+static const boost::uint32_t PHILOX_W1 = 0xBB67AE85u; ///< Key increment for the second key word
+
+CounterBasedRandomStream::CounterBasedRandomStream(unsigned seed, unsigned streamId, unsigned timeStep, unsigned purpose)
+    : mBlockIndex(0u),
+      mNumWordsUsed(4u),
+      mCachedNormal(0.0),
+      mHasCachedNormal(false)
+{
+    mKey[0] = seed;
+    mKey[1] = streamId;
+    mCounterHigh[0] = timeStep;
+    mCounterHigh[1] = purpose;
+    for (unsigned i=0; i<4; i++)
+    {
+        mBlock[i] = 0u;
+    }
+}
+
+void CounterBasedRandomStream::Philox4x32(const boost::uint32_t counter[4], const boost::uint32_t key[2], boost::uint32_t output[4])
+{
+    boost::uint32_t c0 = counter[0];
+    boost::uint32_t c1 = counter[1];
+    boost::uint32_t c2 = counter[2];
+    boost::uint32_t c3 = counter[3];
+    boost::uint32_t k0 = key[0];
+    boost::uint32_t k1 = key[1];
+
+    for (unsigned round=0; round<10; round++)
+    {
+        boost::uint64_t product0 = static_cast<boost::uint64_t>(PHILOX_M0) * c0;
+        boost::uint64_t product1 = static_cast<boost::uint64_t>(PHILOX_M1) * c2;
+
+        c0 = static_cast<boost::uint32_t>(product1 >> 32) ^ c1 ^ k0;
+        c1 = static_cast<boost::uint32_t>(product1);
+        c2 = static_cast<boost::uint32_t>(product0 >> 32) ^ c3 ^ k1;
+        c3 = static_cast<boost::uint32_t>(product0);
+
+        k0 += PHILOX_W0;
+        k1 += PHILOX_W1;
+    }
+
+    output[0] = c0;
+    output[1] = c1;
+    output[2] = c2;
+    output[3] = c3;
+}
+
+boost::uint32_t CounterBasedRandomStream::NextWord()
+{
+    if (mNumWordsUsed == 4u)
+    {
+        const boost::uint32_t counter[4] = {mBlockIndex, 0u, mCounterHigh[0], mCounterHigh[1]};
+        Philox4x32(counter, mKey, mBlock);
+        mBlockIndex++;
+        mNumWordsUsed = 0u;
+    }
+    return mBlock[mNumWordsUsed++];
+}
+
+double CounterBasedRandomStream::WordsToUnitReal(boost::uint32_t high, boost::uint32_t low)
+{
+    // Take 27 bits from the first word and 26 from the second, giving 53 random bits
+    return ((high >> 5)*67108864.0 + (low >> 6))*(1.0/9007199254740992.0);
+}
+
+double CounterBasedRandomStream::ranf()
+{
+    boost::uint32_t high = NextWord();
+    boost::uint32_t low = NextWord();
+    return WordsToUnitReal(high, low);
+}
+
+double CounterBasedRandomStream::StandardNormalRandomDeviate()
+{
+    if (mHasCachedNormal)
+    {
+        mHasCachedNormal = false;
+        return mCachedNormal;
+    }
+
+    // Box-Muller transform; the first uniform is taken in (0,1] so the logarithm is finite
+    double u1 = 1.0 - ranf();
+    double u2 = ranf();
+    double radius = sqrt(-2.0*log(u1));
+    double angle = 2.0*M_PI*u2;
+
+    mCachedNormal = radius*sin(angle);
+    mHasCachedNormal = true;
+    return radius*cos(angle);
+}
+
+double CounterBasedRandomStream::NormalRandomDeviate(double mean, double stdDev)
+{
+    return stdDev*StandardNormalRandomDeviate() + mean;
+}
+
+double CounterBasedRandomStream::ExponentialRandomDeviate(double scale)
+{
+    assert(scale > 0.0);
+    return -log(1.0 - ranf())/scale;
+}
+
+unsigned CounterBasedRandomStream::randMod(unsigned base)
+{
+    assert(base > 0u);
+
+    // Reject the lowest (2^32 mod base) words, so that every residue is equally likely
+    boost::uint32_t threshold = static_cast<boost::uint32_t>(0u - base) % base;
+    boost::uint32_t word = NextWord();
+    while (word < threshold)
+    {
+        word = NextWord();
+    }
+    return word % base;
+}
+
+void CounterBasedRandomStream::FillUnitReals(std::vector<double>& rValues)
+{
+    mNumWordsUsed = 4u;
+    mHasCachedNormal = false;
+
+    const unsigned num_values = rValues.size();
+    boost::uint32_t counter[4] = {mBlockIndex, 0u, mCounterHigh[0], mCounterHigh[1]};
+    boost::uint32_t block[4];
+
+    // Each block of four words gives two values
+    unsigned i = 0;
+    for ( ; i+1 < num_values; i += 2)
+    {
+        counter[0] = mBlockIndex++;
+        Philox4x32(counter, mKey, block);
+        rValues[i] = WordsToUnitReal(block[0], block[1]);
+        rValues[i+1] = WordsToUnitReal(block[2], block[3]);
+    }
+    if (i < num_values)
+    {
+        rValues[i] = ranf();
+    }
+}
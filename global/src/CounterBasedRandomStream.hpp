@@ -0,0 +1,167 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef COUNTERBASEDRANDOMSTREAM_HPP_
+#define COUNTERBASEDRANDOMSTREAM_HPP_
+
+#include <vector>
+#include <boost/cstdint.hpp>
+
+/**
+ * A stream of random numbers generated by the counter-based Philox4x32-10
+ * generator (Salmon et al., "Parallel random numbers: as easy as 1, 2, 3",
+ * SC'11).
+ *
+ * Unlike the Mersenne Twister used by RandomNumberGenerator, each output of a
+ * counter-based generator is a pure function of a key and a counter, so there
+ * is no hidden sequential state. A stream is identified by a seed, a stream
+ * identifier (e.g. a cell ID or lattice site), a time step and a 'purpose'
+ * (distinguishing, for example, cell-cycle durations from division
+ * directions). The numbers drawn from a stream therefore depend only on these
+ * four values and on how many numbers have already been drawn from that
+ * stream, and not on the order in which streams are visited, nor on which
+ * thread or process visits them.
+ *
+ * Streams are cheap to construct and copy, and are intended to be created
+ * where they are needed, typically via RandomNumberGenerator::GetStream().
+ */
+class CounterBasedRandomStream
+{
+private:
+
+    /** The key (seed and stream identifier). */
+    boost::uint32_t mKey[2];
+
+    /** The time step and purpose, which form the upper words of the counter. */
+    boost::uint32_t mCounterHigh[2];
+
+    /** The index of the next block of four words to be generated. */
+    boost::uint32_t mBlockIndex;
+
+    /** The most recently generated block of four words. */
+    boost::uint32_t mBlock[4];
+
+    /** The number of words of mBlock already used. */
+    unsigned mNumWordsUsed;
+
+    /** The second normal deviate from the most recent Box-Muller transform. */
+    double mCachedNormal;
+
+    /** Whether mCachedNormal holds a value not yet returned. */
+    bool mHasCachedNormal;
+
+    /** @return the next 32 random bits from the stream. */
+    boost::uint32_t NextWord();
+
+    /**
+     * Convert two 32-bit words into a double in [0,1) with 53 random bits.
+     *
+     * @param high the word providing the high bits
+     * @param low the word providing the low bits
+     * @return the uniform deviate
+     */
+    static double WordsToUnitReal(boost::uint32_t high, boost::uint32_t low);
+
+public:
+
+    /**
+     * Constructor.
+     *
+     * @param seed the global seed
+     * @param streamId identifies the stream, e.g. a cell ID
+     * @param timeStep the time step at which the numbers are drawn
+     * @param purpose distinguishes different uses of random numbers for the same stream and time step
+     */
+    CounterBasedRandomStream(unsigned seed, unsigned streamId, unsigned timeStep, unsigned purpose);
+
+    /**
+     * Apply the Philox4x32-10 bijection to a counter under a given key.
+     * This is exposed so the generator can be checked against published
+     * known-answer tests.
+     *
+     * @param counter the four-word counter
+     * @param key the two-word key
+     * @param output filled in with the four-word result
+     */
+    static void Philox4x32(const boost::uint32_t counter[4], const boost::uint32_t key[2], boost::uint32_t output[4]);
+
+    /**
+     * @return a uniform random number in [0,1).
+     */
+    double ranf();
+
+    /**
+     * @return a random number from the normal distribution with mean 0 and
+     * standard deviation 1.
+     */
+    double StandardNormalRandomDeviate();
+
+    /**
+     * @return a random number from a normal distribution with given mean and
+     * standard deviation.
+     *
+     * @param mean the mean of the distribution
+     * @param stdDev the standard deviation of the distribution
+     */
+    double NormalRandomDeviate(double mean, double stdDev);
+
+    /**
+     * @return a random number from an exponential distribution.
+     *
+     * @param scale the rate parameter of the distribution, often named lambda
+     */
+    double ExponentialRandomDeviate(double scale);
+
+    /**
+     * @return a random integer in [0, base), without modulo bias.
+     *
+     * @param base the number of possible values; must be positive
+     */
+    unsigned randMod(unsigned base);
+
+    /**
+     * Fill a vector with uniform random numbers in [0,1). This draws whole
+     * blocks at a time, so is considerably cheaper than repeated calls to
+     * ranf() for the large numbers of draws needed by lattice sweeps.
+     * Any unused words of the current block are skipped first, so on a newly
+     * constructed stream the values are identical to those that successive
+     * calls to ranf() would give.
+     *
+     * @param rValues the vector to fill (its size determines the number of draws)
+     */
+    void FillUnitReals(std::vector<double>& rValues);
+};
+
+#endif /*COUNTERBASEDRANDOMSTREAM_HPP_*/
@@ -42,10 +42,11 @@ RandomNumberGenerator::RandomNumberGenerator()
     : mMersenneTwisterGenerator(0u),
       mGenerateUnitReal(mMersenneTwisterGenerator, boost::uniform_real<>()),
 #if BOOST_VERSION < 105600  //#2585
-      mGenerateStandardNormal(mMersenneTwisterGenerator, boost::random::normal_distribution_v156<>(mMersenneTwisterGenerator, 0.0, 1.0))
+      mGenerateStandardNormal(mMersenneTwisterGenerator, boost::random::normal_distribution_v156<>(mMersenneTwisterGenerator, 0.0, 1.0)),
 #else
-      mGenerateStandardNormal(mMersenneTwisterGenerator, boost::normal_distribution<>(0.0, 1.0))
+      mGenerateStandardNormal(mMersenneTwisterGenerator, boost::normal_distribution<>(0.0, 1.0)),
 #endif
+      mSeed(0u)
 {
     assert(mpInstance == NULL); // Ensure correct serialization
 }
@@ -145,6 +146,7 @@ double RandomNumberGenerator::ExponentialRandomDeviate(double scale)
 void RandomNumberGenerator::Reseed(unsigned seed)
 {
     mMersenneTwisterGenerator.seed(seed);
+    mSeed = seed;
 
     // Because this does some Box-Muller type thing it remembers if you don't reset it - see #2633
     mGenerateStandardNormal.distribution().reset();
@@ -153,6 +155,16 @@ void RandomNumberGenerator::Reseed(unsigned seed)
     mGenerateUnitReal.distribution().reset();
 }
 
+unsigned RandomNumberGenerator::GetSeed() const
+{
+    return mSeed;
+}
+
+CounterBasedRandomStream RandomNumberGenerator::GetStream(unsigned streamId, unsigned timeStep, unsigned purpose) const
+{
+    return CounterBasedRandomStream(mSeed, streamId, timeStep, purpose);
+}
+
 void RandomNumberGenerator::Shuffle(unsigned num, std::vector<unsigned>& rValues)
 {
     rValues.resize(num);
@@ -49,7 +49,9 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <boost/random.hpp>
 
 #include "ChasteSerialization.hpp"
+#include "ChasteSerializationVersion.hpp"
 #include "SerializableSingleton.hpp"
+#include "CounterBasedRandomStream.hpp"
 #include <boost/serialization/split_member.hpp>
 
 /**
@@ -73,6 +75,9 @@ private:
 #else
     boost::variate_generator<boost::mt19937& , boost::normal_distribution<> > mGenerateStandardNormal;
 #endif
+    /** The most recent seed, which also keys any counter-based streams. */
+    unsigned mSeed;
+
     /** Pointer to the single instance. */
     static RandomNumberGenerator* mpInstance;
 
@@ -103,6 +108,8 @@ private:
         normal_internals << r_normal_dist;
         std::string normal_internals_string = normal_internals.str();
         archive & normal_internals_string;
+
+        archive & mSeed;
     }
 
     /**
@@ -126,6 +133,11 @@ private:
         archive & normal_internals_string;
         std::stringstream normal_internals(normal_internals_string);
         normal_internals >> mGenerateStandardNormal.distribution();
+
+        if (version > 0)
+        {
+            archive & mSeed;
+        }
     }
     BOOST_SERIALIZATION_SPLIT_MEMBER()
 
@@ -235,10 +247,37 @@ public:
 
     /**
      * Reseed the random number generator.
+     * The seed is also used to key any counter-based streams subsequently
+     * obtained from GetStream().
      *
      * @param seed the new seed
      */
     void Reseed(unsigned seed);
+
+    /**
+     * @return the seed most recently passed to Reseed() (0 by default).
+     */
+    unsigned GetSeed() const;
+
+    /**
+     * Get a counter-based random number stream, keyed by the current seed
+     * and the given identifiers.
+     *
+     * The numbers drawn from the stream are independent of the state of the
+     * main (Mersenne Twister) generator, and of any other stream, so code
+     * using streams gives the same results whatever order cells or lattice
+     * sites are visited in, and however they are divided between threads or
+     * processes. Since the singleton is not modified, this method may be
+     * called concurrently.
+     *
+     * @param streamId identifies the stream, e.g. a cell ID or lattice site index
+     * @param timeStep the time step at which the numbers are drawn
+     * @param purpose distinguishes different uses of random numbers for the same stream and time step
+     * @return the stream
+     */
+    CounterBasedRandomStream GetStream(unsigned streamId, unsigned timeStep, unsigned purpose=0u) const;
 };
 
+BOOST_CLASS_VERSION(RandomNumberGenerator, 1)
+
 #endif /*RANDOMNUMBERGENERATORS_HPP_*/
@@ -0,0 +1,196 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "GhostedVector.hpp"
+#include "PetscTools.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+// Private methods
+
+void GhostedVector::RemovePetscContext()
+{
+    if (mToGhosts != NULL)
+    {
+        VecScatterDestroy(PETSC_DESTROY_PARAM(mToGhosts));
+        mToGhosts = NULL;
+    }
+
+    if (mDistributed != NULL)
+    {
+        PetscTools::Destroy(mDistributed);
+        mDistributed = NULL;
+    }
+
+    if (mGhosts != NULL)
+    {
+        PetscTools::Destroy(mGhosts);
+        mGhosts = NULL;
+    }
+}
+
+// Constructors & destructors
+
+GhostedVector::GhostedVector()
+    : mLo(0),
+      mHi(0),
+      mSize(0),
+      mToGhosts(NULL),
+      mDistributed(NULL),
+      mGhosts(NULL)
+{
+}
+
+GhostedVector::~GhostedVector()
+{
+    RemovePetscContext();
+}
+
+// Vector interface methods
+
+void GhostedVector::Resize(unsigned lo, unsigned hi, unsigned size, const std::vector<unsigned>& rGhostIndices)
+{
+    assert(lo <= hi && hi <= size);
+    RemovePetscContext();
+
+    mLo = lo;
+    mHi = hi;
+    mSize = size;
+
+    mGhostIndices.clear();
+    for (std::vector<unsigned>::const_iterator it = rGhostIndices.begin(); it != rGhostIndices.end(); ++it)
+    {
+        assert(*it < size);
+        if (*it < lo || *it >= hi)
+        {
+            mGhostIndices.push_back(*it);
+        }
+    }
+    std::sort(mGhostIndices.begin(), mGhostIndices.end());
+    mGhostIndices.erase(std::unique(mGhostIndices.begin(), mGhostIndices.end()), mGhostIndices.end());
+
+    const unsigned num_owned = hi - lo;
+    const unsigned num_ghosts = mGhostIndices.size();
+    mData.assign(num_owned + num_ghosts, 0.0);
+
+    // PETSc vectors sharing our storage, so no copying is needed when updating
+    double* p_owned = (num_owned > 0) ? &mData[0] : NULL;
+    double* p_ghosts = (num_ghosts > 0) ? &mData[num_owned] : NULL;
+#if (PETSC_VERSION_MAJOR == 3 && PETSC_VERSION_MINOR >= 3) //PETSc 3.3 or later
+    //Extra argument is block size
+    VecCreateMPIWithArray(PETSC_COMM_WORLD, 1, num_owned, size, p_owned, &mDistributed);
+    VecCreateSeqWithArray(PETSC_COMM_SELF, 1, num_ghosts, p_ghosts, &mGhosts);
+#else
+    VecCreateMPIWithArray(PETSC_COMM_WORLD, num_owned, size, p_owned, &mDistributed);
+    VecCreateSeqWithArray(PETSC_COMM_SELF, num_ghosts, p_ghosts, &mGhosts);
+#endif
+
+    std::vector<PetscInt> from_indices(mGhostIndices.begin(), mGhostIndices.end());
+    IS from_is;
+    IS to_is;
+    PetscInt* p_from = (num_ghosts > 0) ? &from_indices[0] : NULL;
+#if (PETSC_VERSION_MAJOR == 3 && PETSC_VERSION_MINOR >= 2) //PETSc 3.2 or later
+    ISCreateGeneral(PETSC_COMM_SELF, num_ghosts, p_from, PETSC_COPY_VALUES, &from_is);
+#else
+    ISCreateGeneral(PETSC_COMM_SELF, num_ghosts, p_from, &from_is);
+#endif
+    ISCreateStride(PETSC_COMM_SELF, num_ghosts, 0, 1, &to_is);
+    VecScatterCreate(mDistributed, from_is, mGhosts, to_is, &mToGhosts);
+    ISDestroy(PETSC_DESTROY_PARAM(from_is));
+    ISDestroy(PETSC_DESTROY_PARAM(to_is));
+}
+
+unsigned GhostedVector::GetSize()
+{
+    return mSize;
+}
+
+unsigned GhostedVector::GetNumGhosts()
+{
+    return mGhostIndices.size();
+}
+
+bool GhostedVector::HasIndex(unsigned globalIndex)
+{
+    if (globalIndex >= mLo && globalIndex < mHi)
+    {
+        return true;
+    }
+    return std::binary_search(mGhostIndices.begin(), mGhostIndices.end(), globalIndex);
+}
+
+double& GhostedVector::operator[](unsigned globalIndex)
+{
+    if (globalIndex >= mLo && globalIndex < mHi)
+    {
+        return mData[globalIndex - mLo];
+    }
+    std::vector<unsigned>::iterator it = std::lower_bound(mGhostIndices.begin(), mGhostIndices.end(), globalIndex);
+    assert(it != mGhostIndices.end() && *it == globalIndex);
+    return mData[(mHi - mLo) + (it - mGhostIndices.begin())];
+}
+
+// The workhorse methods
+
+void GhostedVector::UpdateGhosts()
+{
+    UpdateGhostsBegin();
+    UpdateGhostsEnd();
+}
+
+void GhostedVector::UpdateGhostsBegin()
+{
+    assert(mToGhosts != NULL);
+//PETSc-3.x.x or PETSc-2.3.3
+#if ( (PETSC_VERSION_MAJOR == 3) || (PETSC_VERSION_MAJOR == 2 && PETSC_VERSION_MINOR == 3 && PETSC_VERSION_SUBMINOR == 3)) //2.3.3 or 3.x.x
+    VecScatterBegin(mToGhosts, mDistributed, mGhosts, INSERT_VALUES, SCATTER_FORWARD);
+#else
+//PETSc-2.3.2 or previous
+    VecScatterBegin(mDistributed, mGhosts, INSERT_VALUES, SCATTER_FORWARD, mToGhosts);
+#endif
+}
+
+void GhostedVector::UpdateGhostsEnd()
+{
+    assert(mToGhosts != NULL);
+//PETSc-3.x.x or PETSc-2.3.3
+#if ( (PETSC_VERSION_MAJOR == 3) || (PETSC_VERSION_MAJOR == 2 && PETSC_VERSION_MINOR == 3 && PETSC_VERSION_SUBMINOR == 3)) //2.3.3 or 3.x.x
+    VecScatterEnd(mToGhosts, mDistributed, mGhosts, INSERT_VALUES, SCATTER_FORWARD);
+#else
+//PETSc-2.3.2 or previous
+    VecScatterEnd(mDistributed, mGhosts, INSERT_VALUES, SCATTER_FORWARD, mToGhosts);
+#endif
+}
@@ -0,0 +1,157 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef GHOSTEDVECTOR_HPP_
+#define GHOSTEDVECTOR_HPP_
+
+#include <vector>
+#include <petscvec.h>
+
+/**
+ * Helper class holding the locally owned part of a distributed vector together
+ * with copies of a fixed set of non-local ("ghost") entries.
+ *
+ * This is the cheap alternative to ReplicatableVector when a process only ever
+ * needs to read values at a few non-local indices (e.g. the halo nodes of the
+ * elements it assembles): memory is proportional to the local problem size and
+ * UpdateGhosts() only communicates the ghost values, rather than gathering the
+ * whole vector onto every process.
+ *
+ * Entries are accessed by global index.  Locally owned entries are stored first,
+ * followed by the ghost entries in increasing global index order.
+ */
+class GhostedVector
+{
+private:
+
+    std::vector<double> mData;          /**< Locally owned entries, followed by the ghost entries. */
+    unsigned mLo;                       /**< The start of our ownership range. */
+    unsigned mHi;                       /**< One past the end of our ownership range. */
+    unsigned mSize;                     /**< The global length of the vector. */
+    std::vector<unsigned> mGhostIndices;/**< The (sorted) global indices of the ghost entries. */
+    VecScatter mToGhosts;               /**< Scatter context filling the ghost entries. */
+    Vec mDistributed;                   /**< Distributed PETSc vector wrapping the owned entries. */
+    Vec mGhosts;                        /**< Sequential PETSc vector wrapping the ghost entries. */
+
+    /**
+     * Clear PETSc objects. Used in resize method and destructor.
+     */
+    void RemovePetscContext();
+
+    /**
+     * Prevent copying, since the PETSc objects wrap mData and would be destroyed twice.
+     * Note that we do not define this method.
+     */
+    GhostedVector(const GhostedVector&);
+
+    /**
+     * Prevent copy-assignment, for the same reason.
+     * Note that we do not define this method.
+     *
+     * @return reference by convention
+     */
+    GhostedVector& operator=(const GhostedVector&);
+
+public:
+
+    /**
+     * Default constructor.
+     * Note that the vector will need to be resized before it can be used.
+     */
+    GhostedVector();
+
+    /**
+     * Destructor.
+     * Remove PETSc context.
+     */
+    ~GhostedVector();
+
+    /**
+     * Set the layout of the vector.  This is collective.
+     *
+     * @param lo  The start of our ownership range
+     * @param hi  One past the end of our ownership range
+     * @param size  The global size of the vector
+     * @param rGhostIndices  Global indices of the non-local entries needed on this process.
+     *     Duplicates, and indices in our own ownership range, are ignored.
+     */
+    void Resize(unsigned lo, unsigned hi, unsigned size, const std::vector<unsigned>& rGhostIndices);
+
+    /**
+     * @return the global size of the vector.
+     */
+    unsigned GetSize();
+
+    /**
+     * @return the number of ghost entries held on this process.
+     */
+    unsigned GetNumGhosts();
+
+    /**
+     * @return whether the entry with this global index is available on this process
+     * (either locally owned or a ghost).
+     *
+     * @param globalIndex  the global index
+     */
+    bool HasIndex(unsigned globalIndex);
+
+    /**
+     * Access the vector.
+     *
+     * @param globalIndex  the global index of a locally owned or ghost entry
+     * @return reference to component of the vector
+     */
+    double& operator[](unsigned globalIndex);
+
+    /**
+     * Refresh the ghost entries from the processes that own them.  This is collective.
+     */
+    void UpdateGhosts();
+
+    /**
+     * Start refreshing the ghost entries.  This is collective, and must be matched by
+     * a call to UpdateGhostsEnd().  Locally owned entries may be read in between, but
+     * neither owned nor ghost entries may be written, and ghost entries will not be
+     * up to date until UpdateGhostsEnd() returns.
+     */
+    void UpdateGhostsBegin();
+
+    /**
+     * Finish refreshing the ghost entries started by UpdateGhostsBegin().  This is collective.
+     */
+    void UpdateGhostsEnd();
+};
+
+#endif /*GHOSTEDVECTOR_HPP_*/
@@ -0,0 +1,394 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "Profiler.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdio>
+#include <iostream>
+#include <sstream>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "OutputFileHandler.hpp"
+#include "PetscTools.hpp"
+
+Profiler* Profiler::mpInstance = NULL;
+
+Profiler::Profiler()
+    : mEnabled(true),
+      mTracing(false),
+      mStartTime(0.0)
+{
+    // One slot per thread, plus the shared slot
+#ifdef _OPENMP
+    mThreadStates.resize(omp_get_max_threads() + 1u);
+#else
+    mThreadStates.resize(2u);
+#endif
+    Reset();
+}
+
+Profiler* Profiler::Instance()
+{
+    if (mpInstance == NULL)
+    {
+        mpInstance = new Profiler();
+    }
+    return mpInstance;
+}
+
+void Profiler::Destroy()
+{
+    if (mpInstance)
+    {
+        delete mpInstance;
+        mpInstance = NULL;
+    }
+}
+
+unsigned Profiler::GetThreadIndex() const
+{
+#ifdef _OPENMP
+    if (omp_get_active_level() > 1)
+    {
+        // Thread numbers in a nested region are only unique within their team
+        return GetSharedSlot();
+    }
+    unsigned thread = omp_get_thread_num();
+    return (thread < GetSharedSlot()) ? thread : GetSharedSlot();
+#else
+    return 0u;
+#endif
+}
+
+unsigned Profiler::AddChild(ThreadState& rState, const char* pName)
+{
+    RegionNode node;
+    node.pName = pName;
+    node.name = pName;
+    node.parent = rState.current;
+    node.numCalls = 0u;
+    node.totalTime = 0.0;
+    node.startTime = 0.0;
+
+    unsigned region = rState.regions.size();
+    rState.regions.push_back(node);
+    rState.regions[rState.current].children.push_back(region);
+    return region;
+}
+
+std::string Profiler::GetRegionPath(const ThreadState& rState, unsigned region) const
+{
+    std::string path = rState.regions[region].name;
+    for (unsigned parent = rState.regions[region].parent; parent != 0u; parent = rState.regions[parent].parent)
+    {
+        path = rState.regions[parent].name + "/" + path;
+    }
+    return path;
+}
+
+void Profiler::Reset()
+{
+    for (unsigned thread=0; thread<mThreadStates.size(); thread++)
+    {
+        ThreadState& r_state = mThreadStates[thread];
+        r_state.regions.clear();
+        r_state.trace.clear();
+
+        RegionNode root;
+        root.pName = "";
+        root.parent = 0u;
+        root.numCalls = 0u;
+        root.totalTime = 0.0;
+        root.startTime = 0.0;
+        r_state.regions.push_back(root);
+        r_state.current = 0u;
+    }
+    mStartTime = Timer::GetWallTime();
+}
+
+void Profiler::Enable()
+{
+    for (unsigned thread=0; thread<mThreadStates.size(); thread++)
+    {
+        mThreadStates[thread].current = 0u;
+    }
+    mEnabled = true;
+}
+
+void Profiler::Disable()
+{
+    mEnabled = false;
+}
+
+bool Profiler::IsEnabled() const
+{
+    return mEnabled;
+}
+
+void Profiler::SetTracing(bool tracing)
+{
+    mTracing = tracing;
+}
+
+unsigned Profiler::GetCurrentDepth() const
+{
+    const ThreadState& r_state = mThreadStates[GetThreadIndex()];
+    unsigned depth = 0u;
+    for (unsigned region = r_state.current; region != 0u; region = r_state.regions[region].parent)
+    {
+        depth++;
+    }
+    return depth;
+}
+
+void Profiler::GatherStrings(const std::string& rLocal, std::vector<std::string>& rAll, bool toAll)
+{
+    if (!PetscTools::IsParallel() || PetscTools::IsIsolated())
+    {
+        rAll.assign(1u, rLocal);
+        return;
+    }
+
+    const unsigned num_procs = PetscTools::GetNumProcs();
+    int local_length = rLocal.length();
+    std::vector<int> lengths(num_procs);
+    if (toAll)
+    {
+        MPI_Allgather(&local_length, 1, MPI_INT, &lengths[0], 1, MPI_INT, PETSC_COMM_WORLD);
+    }
+    else
+    {
+        MPI_Gather(&local_length, 1, MPI_INT, &lengths[0], 1, MPI_INT, PetscTools::MASTER_RANK, PETSC_COMM_WORLD);
+    }
+
+    std::vector<int> offsets(num_procs, 0);
+    for (unsigned proc=1; proc<num_procs; proc++)
+    {
+        offsets[proc] = offsets[proc-1] + lengths[proc-1];
+    }
+    std::vector<char> all_chars(std::max(1, offsets[num_procs-1] + lengths[num_procs-1]));
+    std::vector<char> local_chars(rLocal.begin(), rLocal.end());
+    local_chars.push_back('\0'); // So there's always something to point at
+
+    if (toAll)
+    {
+        MPI_Allgatherv(&local_chars[0], local_length, MPI_CHAR, &all_chars[0], &lengths[0], &offsets[0], MPI_CHAR, PETSC_COMM_WORLD);
+    }
+    else
+    {
+        MPI_Gatherv(&local_chars[0], local_length, MPI_CHAR, &all_chars[0], &lengths[0], &offsets[0], MPI_CHAR, PetscTools::MASTER_RANK, PETSC_COMM_WORLD);
+    }
+
+    rAll.clear();
+    if (toAll || PetscTools::AmMaster())
+    {
+        for (unsigned proc=0; proc<num_procs; proc++)
+        {
+            rAll.push_back(std::string(all_chars.begin() + offsets[proc], all_chars.begin() + offsets[proc] + lengths[proc]));
+        }
+    }
+}
+
+std::map<std::string, ProfilerRegionStatistics> Profiler::GatherStatistics()
+{
+    // Summarise this process: calls summed, and time maximised, over threads
+    std::map<std::string, std::pair<unsigned long, double> > local_summary;
+    for (unsigned thread=0; thread<mThreadStates.size(); thread++)
+    {
+        const ThreadState& r_state = mThreadStates[thread];
+        for (unsigned region=1; region<r_state.regions.size(); region++)
+        {
+            std::pair<unsigned long, double>& r_entry = local_summary[GetRegionPath(r_state, region)];
+            r_entry.first += r_state.regions[region].numCalls;
+            r_entry.second = std::max(r_entry.second, r_state.regions[region].totalTime);
+        }
+    }
+
+    std::ostringstream local_buffer;
+    local_buffer.precision(17);
+    for (std::map<std::string, std::pair<unsigned long, double> >::const_iterator it = local_summary.begin();
+         it != local_summary.end();
+         ++it)
+    {
+        local_buffer << it->first << '\t' << it->second.first << '\t' << it->second.second << '\n';
+    }
+
+    std::vector<std::string> buffers;
+    GatherStrings(local_buffer.str(), buffers, true);
+    const unsigned num_procs = buffers.size();
+
+    // Combine the processes
+    std::map<std::string, std::vector<double> > times;
+    std::map<std::string, ProfilerRegionStatistics> statistics;
+    for (unsigned proc=0; proc<num_procs; proc++)
+    {
+        std::istringstream buffer(buffers[proc]);
+        std::string path;
+        while (std::getline(buffer, path, '\t'))
+        {
+            unsigned long num_calls;
+            double time;
+            buffer >> num_calls >> time;
+            buffer.ignore(); // The newline
+
+            if (statistics.find(path) == statistics.end())
+            {
+                statistics[path].numCalls = 0u;
+                times[path].assign(num_procs, 0.0);
+            }
+            statistics[path].numCalls += num_calls;
+            times[path][proc] = time;
+        }
+    }
+
+    for (std::map<std::string, ProfilerRegionStatistics>::iterator it = statistics.begin();
+         it != statistics.end();
+         ++it)
+    {
+        const std::vector<double>& r_times = times[it->first];
+        ProfilerRegionStatistics& r_stats = it->second;
+        r_stats.minTime = r_times[0];
+        r_stats.maxTime = r_times[0];
+        r_stats.meanTime = 0.0;
+        r_stats.slowestProcess = 0u;
+        for (unsigned proc=0; proc<num_procs; proc++)
+        {
+            r_stats.meanTime += r_times[proc]/num_procs;
+            r_stats.minTime = std::min(r_stats.minTime, r_times[proc]);
+            if (r_times[proc] > r_stats.maxTime)
+            {
+                r_stats.maxTime = r_times[proc];
+                r_stats.slowestProcess = proc;
+            }
+        }
+    }
+    return statistics;
+}
+
+void Profiler::Report()
+{
+    std::map<std::string, ProfilerRegionStatistics> statistics = GatherStatistics();
+    if (PetscTools::AmMaster())
+    {
+        std::cout.flush();
+        printf("%-40s %10s %10s %10s %10s %9s %8s\n",
+               "Region", "Calls", "Min (s)", "Mean (s)", "Max (s)", "Max/mean", "Slowest");
+        for (std::map<std::string, ProfilerRegionStatistics>::const_iterator it = statistics.begin();
+             it != statistics.end();
+             ++it)
+        {
+            // Indent each region's name according to its depth
+            size_t depth = std::count(it->first.begin(), it->first.end(), '/');
+            size_t last_slash = it->first.find_last_of('/');
+            std::string label = std::string(2*depth, ' ')
+                                + ((last_slash == std::string::npos) ? it->first : it->first.substr(last_slash+1));
+
+            const ProfilerRegionStatistics& r_stats = it->second;
+            printf("%-40s %10lu %10.4f %10.4f %10.4f %9.2f %8u\n",
+                   label.c_str(), r_stats.numCalls, r_stats.minTime, r_stats.meanTime, r_stats.maxTime,
+                   r_stats.GetImbalance(), r_stats.slowestProcess);
+        }
+        std::cout.flush();
+    }
+}
+
+/**
+ * Escape a string for inclusion in JSON output.
+ *
+ * @param rString  the string
+ * @return the escaped string
+ */
+static std::string EscapeForJson(const std::string& rString)
+{
+    std::string escaped;
+    for (std::string::const_iterator it = rString.begin(); it != rString.end(); ++it)
+    {
+        if (*it == '"' || *it == '\\')
+        {
+            escaped += '\\';
+        }
+        escaped += *it;
+    }
+    return escaped;
+}
+
+void Profiler::WriteChromeTrace(const std::string& rDirectory, const std::string& rFileName)
+{
+    std::ostringstream local_events;
+    local_events.precision(15);
+    const unsigned rank = PetscTools::GetMyRank();
+    for (unsigned thread=0; thread<mThreadStates.size(); thread++)
+    {
+        const ThreadState& r_state = mThreadStates[thread];
+        for (unsigned i=0; i<r_state.trace.size(); i++)
+        {
+            const TraceEvent& r_event = r_state.trace[i];
+            local_events << ",\n{\"name\":\"" << EscapeForJson(r_state.regions[r_event.region].name)
+                         << "\",\"cat\":\"" << EscapeForJson(GetRegionPath(r_state, r_event.region))
+                         << "\",\"ph\":\"X\",\"ts\":" << 1e6*(r_event.beginTime - mStartTime)
+                         << ",\"dur\":" << 1e6*(r_event.endTime - r_event.beginTime)
+                         << ",\"pid\":" << rank << ",\"tid\":" << thread << "}";
+        }
+    }
+
+    std::vector<std::string> buffers;
+    GatherStrings(local_events.str(), buffers, false);
+
+    OutputFileHandler handler(rDirectory, false);
+    if (PetscTools::AmMaster())
+    {
+        out_stream p_file = handler.OpenOutputFile(rFileName);
+        (*p_file) << "{\"traceEvents\":[\n";
+        // Name each process so the timeline is labelled by rank
+        for (unsigned proc=0; proc<buffers.size(); proc++)
+        {
+            (*p_file) << (proc == 0 ? "" : ",\n")
+                      << "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" << proc
+                      << ",\"args\":{\"name\":\"Process " << proc << "\"}}";
+        }
+        for (unsigned proc=0; proc<buffers.size(); proc++)
+        {
+            (*p_file) << buffers[proc];
+        }
+        (*p_file) << "\n],\"displayTimeUnit\":\"ms\"}\n";
+        p_file->close();
+    }
+    PetscTools::Barrier("Profiler::WriteChromeTrace");
+}
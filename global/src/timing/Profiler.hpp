@@ -0,0 +1,445 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef PROFILER_HPP_
+#define PROFILER_HPP_
+
+#include <cstring>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Exception.hpp"
+#include "Timer.hpp"
+
+/**
+ * Statistics for one profiled region, gathered over all processes by
+ * Profiler::GatherStatistics().  Times are inclusive of nested regions.
+ * Where a process runs several threads, its time for a region is the longest
+ * of its threads' times.  Processes that never entered the region count as
+ * spending no time in it.
+ */
+struct ProfilerRegionStatistics
+{
+    /** Total number of times the region was entered, over all processes and threads. */
+    unsigned long numCalls;
+
+    /** The least time spent in the region by any process, in seconds. */
+    double minTime;
+
+    /** The mean time spent in the region per process, in seconds. */
+    double meanTime;
+
+    /** The greatest time spent in the region by any process, in seconds. */
+    double maxTime;
+
+    /** The process that spent longest in the region. */
+    unsigned slowestProcess;
+
+    /**
+     * @return the load imbalance, max/mean (1 means perfectly balanced)
+     */
+    double GetImbalance() const
+    {
+        return (meanTime > 0.0) ? maxTime/meanTime : 1.0;
+    }
+};
+
+/**
+ * A lightweight hierarchical profiler.
+ *
+ * Code is divided into named regions, which may be nested arbitrarily; the
+ * same name used in different contexts gives different regions (so "Solve/Assemble"
+ * and "Output/Assemble" are timed separately).  Each process, and each OpenMP
+ * thread if used, keeps its own tree of regions, recording entry counts and
+ * inclusive wall-clock time.  Entering and leaving a region is purely local
+ * (no communication or barriers), so timings are not distorted by synchronisation
+ * and the slow process is not hidden by the others waiting for it.
+ *
+ * At the end of a run, GatherStatistics() or Report() (which must be called
+ * collectively) combine the trees from all processes, giving min/mean/max time
+ * per region and which process was slowest.  Optionally every region entry can
+ * be recorded and written as a Chrome trace (viewable in chrome://tracing or
+ * Perfetto) with WriteChromeTrace().
+ *
+ * Regions are most easily delimited with a ProfilerRegion object:
+ * \code
+ * {
+ *     ProfilerRegion region("Assemble");
+ *     // ... work ...
+ * }
+ * \endcode
+ *
+ * Region names are compared by pointer first, so using string literals keeps
+ * the cost of entering a region to a few comparisons and a timer call.
+ *
+ * Unlike the GenericEventHandler subclasses, which time a fixed list of events
+ * and optionally synchronise on every event (CHASTE_EVENT_BARRIERS), the
+ * profiler never synchronises while timing.
+ */
+class Profiler
+{
+private:
+
+    /** A node in a thread's tree of regions. */
+    struct RegionNode
+    {
+        /** The name pointer passed when the region was created (for fast lookup). */
+        const char* pName;
+
+        /** The region name. */
+        std::string name;
+
+        /** The parent region (the root is its own parent). */
+        unsigned parent;
+
+        /** The nested regions. */
+        std::vector<unsigned> children;
+
+        /** The number of times the region has been left. */
+        unsigned long numCalls;
+
+        /** Total time spent in the region. */
+        double totalTime;
+
+        /** When the region was most recently entered. */
+        double startTime;
+    };
+
+    /** A single visit to a region, recorded when tracing. */
+    struct TraceEvent
+    {
+        /** The region visited. */
+        unsigned region;
+
+        /** When the region was entered. */
+        double beginTime;
+
+        /** When the region was left. */
+        double endTime;
+    };
+
+    /** The profiling state of one thread. */
+    struct ThreadState
+    {
+        /** The tree of regions; entry 0 is the root, and never timed. */
+        std::vector<RegionNode> regions;
+
+        /** The region the thread is currently in. */
+        unsigned current;
+
+        /** Region visits, when tracing. */
+        std::vector<TraceEvent> trace;
+    };
+
+    /** The state of each thread, followed by the slot shared by any other threads (see GetThreadIndex()). */
+    std::vector<ThreadState> mThreadStates;
+
+    /** Whether the profiler is recording. */
+    bool mEnabled;
+
+    /** Whether every region visit is being recorded, for WriteChromeTrace(). */
+    bool mTracing;
+
+    /** When the profiler was last reset, used as the origin for traces. */
+    double mStartTime;
+
+    /** Pointer to the single instance. */
+    static Profiler* mpInstance;
+
+    /**
+     * Private constructor.  Use Instance() to access the profiler.
+     */
+    Profiler();
+
+    /**
+     * @return the slot in mThreadStates used by the calling thread.  Threads of the
+     * outermost parallel region have their own slot, as long as there were enough
+     * when the profiler was created; any other thread (e.g. in a nested region, or
+     * after omp_set_num_threads() raised the thread count) uses the shared slot.
+     */
+    unsigned GetThreadIndex() const;
+
+    /**
+     * @return the slot in mThreadStates shared by threads without a slot of their own.
+     * Accesses to it are serialised, and regions entered concurrently from several
+     * threads in it may be nested in each other.
+     */
+    inline unsigned GetSharedSlot() const
+    {
+        return mThreadStates.size() - 1u;
+    }
+
+    /**
+     * Enter a region in the given thread state.
+     *
+     * @param rState  the thread state
+     * @param pName  the region name
+     */
+    inline void BeginRegionInState(ThreadState& rState, const char* pName)
+    {
+        const std::vector<unsigned>& r_children = rState.regions[rState.current].children;
+        unsigned region = 0u;
+        for (unsigned i=0; i<r_children.size(); i++)
+        {
+            const RegionNode& r_child = rState.regions[r_children[i]];
+            if (r_child.pName == pName || strcmp(r_child.name.c_str(), pName) == 0)
+            {
+                region = r_children[i];
+                break;
+            }
+        }
+        if (region == 0u)
+        {
+            region = AddChild(rState, pName);
+        }
+        rState.current = region;
+        rState.regions[region].startTime = Timer::GetWallTime();
+    }
+
+    /**
+     * Leave the current region of the given thread state.
+     *
+     * @param rState  the thread state
+     * @param now  the current wall-clock time
+     * @return false if no region had begun (so nothing was done)
+     */
+    inline bool EndRegionInState(ThreadState& rState, double now)
+    {
+        if (rState.current == 0u)
+        {
+            return false;
+        }
+        RegionNode& r_node = rState.regions[rState.current];
+        r_node.totalTime += now - r_node.startTime;
+        r_node.numCalls++;
+        if (mTracing)
+        {
+            TraceEvent event;
+            event.region = rState.current;
+            event.beginTime = r_node.startTime;
+            event.endTime = now;
+            rState.trace.push_back(event);
+        }
+        rState.current = r_node.parent;
+        return true;
+    }
+
+    /**
+     * Add a new child region.
+     *
+     * @param rState  the thread state
+     * @param pName  the region name
+     * @return the index of the new region
+     */
+    unsigned AddChild(ThreadState& rState, const char* pName);
+
+    /**
+     * @return the full path of a region, with names separated by '/'
+     *
+     * @param rState  the thread state
+     * @param region  the region
+     */
+    std::string GetRegionPath(const ThreadState& rState, unsigned region) const;
+
+    /**
+     * Gather a text buffer from every process.
+     *
+     * @param rLocal  this process's buffer
+     * @param rAll  filled in with each process's buffer
+     * @param toAll  whether every process needs the result, or just the master
+     */
+    static void GatherStrings(const std::string& rLocal, std::vector<std::string>& rAll, bool toAll);
+
+public:
+
+    /**
+     * @return the single instance of the profiler (created on first use).
+     */
+    static Profiler* Instance();
+
+    /**
+     * Destroy the profiler, freeing all recorded data.
+     */
+    static void Destroy();
+
+    /**
+     * Enter a region, nested in the current region of the calling thread.
+     *
+     * @param pName  the region name
+     */
+    inline void BeginRegion(const char* pName)
+    {
+        if (!mEnabled)
+        {
+            return;
+        }
+        unsigned thread = GetThreadIndex();
+        if (thread == GetSharedSlot())
+        {
+#ifdef _OPENMP
+#pragma omp critical(chaste_profiler_shared_slot)
+#endif
+            BeginRegionInState(mThreadStates[thread], pName);
+        }
+        else
+        {
+            BeginRegionInState(mThreadStates[thread], pName);
+        }
+    }
+
+    /**
+     * Leave the current region of the calling thread.
+     */
+    inline void EndRegion()
+    {
+        if (!mEnabled)
+        {
+            return;
+        }
+        double now = Timer::GetWallTime();
+        unsigned thread = GetThreadIndex();
+        bool had_begun;
+        if (thread == GetSharedSlot())
+        {
+#ifdef _OPENMP
+#pragma omp critical(chaste_profiler_shared_slot)
+#endif
+            had_begun = EndRegionInState(mThreadStates[thread], now);
+        }
+        else
+        {
+            had_begun = EndRegionInState(mThreadStates[thread], now);
+        }
+        if (!had_begun)
+        {
+            EXCEPTION("Profiler::EndRegion() called when no region had begun.");
+        }
+    }
+
+    /**
+     * Discard all recorded data (and any regions in progress).
+     */
+    void Reset();
+
+    /**
+     * Start recording (the default).  Any regions in progress are abandoned.
+     */
+    void Enable();
+
+    /**
+     * Stop recording; BeginRegion() and EndRegion() then do nothing.
+     */
+    void Disable();
+
+    /**
+     * @return whether the profiler is recording
+     */
+    bool IsEnabled() const;
+
+    /**
+     * Set whether to record every region visit, for WriteChromeTrace().  This uses
+     * memory in proportion to the number of visits, so is off by default.
+     *
+     * @param tracing  whether to record visits
+     */
+    void SetTracing(bool tracing);
+
+    /**
+     * @return the nesting depth of the calling thread's current region (0 if in no region)
+     */
+    unsigned GetCurrentDepth() const;
+
+    /**
+     * Combine the region timings from all processes.  Must be called collectively;
+     * every process receives the same result.  Regions still in progress are
+     * counted up to their last entry only.
+     *
+     * @return statistics for each region, keyed by path (names separated by '/')
+     */
+    std::map<std::string, ProfilerRegionStatistics> GatherStatistics();
+
+    /**
+     * Print a table of region timings, with imbalance statistics, on the master
+     * process.  Must be called collectively.
+     */
+    void Report();
+
+    /**
+     * Write the recorded region visits from all processes as a Chrome trace
+     * (JSON) file, with one 'pid' per process and one 'tid' per thread.  Times
+     * are relative to when each process's profiler was last reset.  Must be
+     * called collectively.
+     *
+     * @param rDirectory  the output directory, relative to CHASTE_TEST_OUTPUT (not cleaned)
+     * @param rFileName  the file name
+     */
+    void WriteChromeTrace(const std::string& rDirectory, const std::string& rFileName);
+};
+
+/**
+ * Times the enclosing scope as a Profiler region.
+ */
+class ProfilerRegion
+{
+public:
+
+    /**
+     * Constructor.  Enters the region.
+     *
+     * @param pName  the region name
+     */
+    ProfilerRegion(const char* pName)
+    {
+        Profiler::Instance()->BeginRegion(pName);
+    }
+
+    /**
+     * Destructor.  Leaves the region.
+     */
+    ~ProfilerRegion()
+    {
+        try
+        {
+            Profiler::Instance()->EndRegion();
+        }
+        catch (Exception&)
+        {
+            // The region was abandoned by Profiler::Reset() or Enable(); destructors mustn't throw
+        }
+    }
+};
+
+#endif /*PROFILER_HPP_*/
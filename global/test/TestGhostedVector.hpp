@@ -0,0 +1,115 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef TESTGHOSTEDVECTOR_HPP_
+#define TESTGHOSTEDVECTOR_HPP_
+#include <cxxtest/TestSuite.h>
+#include <petscvec.h>
+
+#include "PetscSetupAndFinalize.hpp"
+#include "GhostedVector.hpp"
+#include "DistributedVectorFactory.hpp"
+#include "PetscTools.hpp"
+
+class TestGhostedVector : public CxxTest::TestSuite
+{
+public:
+
+    void TestGhostUpdate()
+    {
+        for (unsigned vec_size=1; vec_size<10; vec_size++)
+        {
+            DistributedVectorFactory factory(vec_size);
+            unsigned lo = factory.GetLow();
+            unsigned hi = factory.GetHigh();
+
+            // Ghost the entries either side of our ownership range, plus entry 0 (twice)
+            std::vector<unsigned> ghosts;
+            if (lo > 0)
+            {
+                ghosts.push_back(lo-1);
+            }
+            if (hi < vec_size)
+            {
+                ghosts.push_back(hi);
+            }
+            ghosts.push_back(0);
+            ghosts.push_back(0);
+
+            GhostedVector ghosted_vector;
+            ghosted_vector.Resize(lo, hi, vec_size, ghosts);
+            TS_ASSERT_EQUALS(ghosted_vector.GetSize(), vec_size);
+
+            unsigned expected_num_ghosts = (lo > 0) + (hi < vec_size) + (lo > 1 ? 1 : 0);
+            TS_ASSERT_EQUALS(ghosted_vector.GetNumGhosts(), expected_num_ghosts);
+
+            for (unsigned global_index=lo; global_index<hi; global_index++)
+            {
+                ghosted_vector[global_index] = 10.0*global_index;
+            }
+            ghosted_vector.UpdateGhosts();
+
+            for (unsigned global_index=0; global_index<vec_size; global_index++)
+            {
+                bool expect_present = (global_index >= lo && global_index < hi)
+                                      || (global_index + 1 == lo)
+                                      || (global_index == hi)
+                                      || (global_index == 0);
+                TS_ASSERT_EQUALS(ghosted_vector.HasIndex(global_index), expect_present);
+                if (expect_present)
+                {
+                    TS_ASSERT_DELTA(ghosted_vector[global_index], 10.0*global_index, 1e-12);
+                }
+            }
+
+            // Changing owned values and updating again refreshes the ghosts
+            for (unsigned global_index=lo; global_index<hi; global_index++)
+            {
+                ghosted_vector[global_index] = -1.0*global_index;
+            }
+            ghosted_vector.UpdateGhosts();
+            if (hi < vec_size)
+            {
+                TS_ASSERT_DELTA(ghosted_vector[hi], -1.0*hi, 1e-12);
+            }
+            if (lo > 0)
+            {
+                TS_ASSERT_DELTA(ghosted_vector[0], 0.0, 1e-12);
+            }
+        }
+    }
+};
+
+#endif /*TESTGHOSTEDVECTOR_HPP_*/
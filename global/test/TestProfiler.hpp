@@ -0,0 +1,235 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef TESTPROFILER_HPP_
+#define TESTPROFILER_HPP_
+
+#include <cxxtest/TestSuite.h>
+
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <string>
+
+#include "FileFinder.hpp"
+#include "PetscTools.hpp"
+#include "Profiler.hpp"
+#include "Timer.hpp"
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include "PetscSetupAndFinalize.hpp"
+
+class TestProfiler : public CxxTest::TestSuite
+{
+private:
+
+    /**
+     * Spin for (roughly) the given time.
+     *
+     * @param duration  how long to wait for, in seconds
+     */
+    void BusyWait(double duration)
+    {
+        double start = Timer::GetWallTime();
+        while (Timer::GetWallTime() - start < duration)
+        {
+        }
+    }
+
+public:
+
+    void TestNestedRegions() throw(Exception)
+    {
+        Profiler* p_profiler = Profiler::Instance();
+        p_profiler->Reset();
+        TS_ASSERT(p_profiler->IsEnabled());
+        TS_ASSERT_EQUALS(p_profiler->GetCurrentDepth(), 0u);
+
+        for (unsigned i=0; i<3; i++)
+        {
+            ProfilerRegion outer("Outer");
+            TS_ASSERT_EQUALS(p_profiler->GetCurrentDepth(), 1u);
+            {
+                ProfilerRegion inner("Inner");
+                TS_ASSERT_EQUALS(p_profiler->GetCurrentDepth(), 2u);
+                BusyWait(0.01);
+            }
+            // The same name in a different place in the tree is a different region
+            p_profiler->BeginRegion("Outer");
+            p_profiler->EndRegion();
+        }
+        TS_ASSERT_EQUALS(p_profiler->GetCurrentDepth(), 0u);
+
+        // Make the last process the slowest
+        if (PetscTools::AmTopMost())
+        {
+            ProfilerRegion region("Unbalanced");
+            BusyWait(0.05);
+        }
+
+        std::map<std::string, ProfilerRegionStatistics> statistics = p_profiler->GatherStatistics();
+        TS_ASSERT_EQUALS(statistics.size(), 4u);
+        TS_ASSERT_EQUALS(statistics.count("Outer"), 1u);
+        TS_ASSERT_EQUALS(statistics.count("Outer/Inner"), 1u);
+        TS_ASSERT_EQUALS(statistics.count("Outer/Outer"), 1u);
+        TS_ASSERT_EQUALS(statistics.count("Unbalanced"), 1u);
+
+        const unsigned num_procs = PetscTools::GetNumProcs();
+        TS_ASSERT_EQUALS(statistics["Outer"].numCalls, 3u*num_procs);
+        TS_ASSERT_EQUALS(statistics["Outer/Inner"].numCalls, 3u*num_procs);
+        TS_ASSERT_EQUALS(statistics["Unbalanced"].numCalls, 1u);
+
+        ProfilerRegionStatistics& r_inner = statistics["Outer/Inner"];
+        TS_ASSERT_LESS_THAN_EQUALS(0.03, r_inner.minTime);
+        TS_ASSERT_LESS_THAN_EQUALS(r_inner.minTime, r_inner.meanTime);
+        TS_ASSERT_LESS_THAN_EQUALS(r_inner.meanTime, r_inner.maxTime);
+        TS_ASSERT_LESS_THAN_EQUALS(r_inner.maxTime, statistics["Outer"].maxTime);
+        TS_ASSERT_LESS_THAN_EQUALS(1.0, r_inner.GetImbalance());
+
+        // Only the top process entered this region, so it's the slowest
+        ProfilerRegionStatistics& r_unbalanced = statistics["Unbalanced"];
+        TS_ASSERT_EQUALS(r_unbalanced.slowestProcess, num_procs-1);
+        TS_ASSERT_LESS_THAN_EQUALS(0.05, r_unbalanced.maxTime);
+        TS_ASSERT_DELTA(r_unbalanced.GetImbalance(), (double)num_procs, 1e-6);
+        if (PetscTools::IsParallel())
+        {
+            TS_ASSERT_EQUALS(r_unbalanced.minTime, 0.0);
+        }
+
+        p_profiler->Report();
+    }
+
+    void TestEnableAndDisable() throw(Exception)
+    {
+        Profiler* p_profiler = Profiler::Instance();
+        p_profiler->Reset();
+
+        TS_ASSERT_THROWS_THIS(p_profiler->EndRegion(),
+                              "Profiler::EndRegion() called when no region had begun.");
+
+        p_profiler->Disable();
+        TS_ASSERT(!p_profiler->IsEnabled());
+        {
+            ProfilerRegion region("Ignored");
+            TS_ASSERT_EQUALS(p_profiler->GetCurrentDepth(), 0u);
+        }
+        TS_ASSERT(p_profiler->GatherStatistics().empty());
+
+        // Re-enabling abandons any region left open
+        p_profiler->Enable();
+        p_profiler->BeginRegion("Abandoned");
+        TS_ASSERT_EQUALS(p_profiler->GetCurrentDepth(), 1u);
+        p_profiler->Enable();
+        TS_ASSERT_EQUALS(p_profiler->GetCurrentDepth(), 0u);
+        TS_ASSERT_EQUALS(p_profiler->GatherStatistics()["Abandoned"].numCalls, 0u);
+
+        Profiler::Destroy();
+    }
+
+    void TestMoreThreadsThanWhenCreated() throw(Exception)
+    {
+        // Create the profiler with a slot for only one thread, then use more
+        Profiler::Destroy();
+#ifdef _OPENMP
+        const int max_threads = omp_get_max_threads();
+        omp_set_num_threads(1);
+#endif
+        Profiler* p_profiler = Profiler::Instance();
+#ifdef _OPENMP
+        omp_set_num_threads(4);
+#endif
+
+        const unsigned num_repeats = 100u;
+        unsigned num_threads = 1u;
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+        {
+#ifdef _OPENMP
+#pragma omp single
+            num_threads = omp_get_num_threads();
+#endif
+            for (unsigned i=0; i<num_repeats; i++)
+            {
+                ProfilerRegion region("Threaded");
+            }
+        }
+#ifdef _OPENMP
+        omp_set_num_threads(max_threads);
+#endif
+
+        // Every visit is counted, whether or not the thread had a slot of its own
+        TS_ASSERT_EQUALS(p_profiler->GetCurrentDepth(), 0u);
+        std::map<std::string, ProfilerRegionStatistics> statistics = p_profiler->GatherStatistics();
+        TS_ASSERT_EQUALS(statistics["Threaded"].numCalls, num_repeats*num_threads*PetscTools::GetNumProcs());
+
+        Profiler::Destroy();
+    }
+
+    void TestChromeTrace() throw(Exception)
+    {
+        Profiler* p_profiler = Profiler::Instance();
+        p_profiler->SetTracing(true);
+        for (unsigned i=0; i<2; i++)
+        {
+            ProfilerRegion outer("Solve");
+            ProfilerRegion inner("Assemble \"rhs\"");
+        }
+        p_profiler->WriteChromeTrace("TestProfiler", "trace.json");
+
+        FileFinder trace_file("TestProfiler/trace.json", RelativeTo::ChasteTestOutput);
+        TS_ASSERT(trace_file.IsFile());
+
+        std::ifstream trace(trace_file.GetAbsolutePath().c_str());
+        std::string contents((std::istreambuf_iterator<char>(trace)), std::istreambuf_iterator<char>());
+        TS_ASSERT_EQUALS(contents.find("{\"traceEvents\":["), 0u);
+        TS_ASSERT_DIFFERS(contents.find("\"cat\":\"Solve/Assemble \\\"rhs\\\"\""), std::string::npos);
+
+        // Two events for each region on each process
+        unsigned num_events = 0;
+        for (size_t pos = contents.find("\"ph\":\"X\""); pos != std::string::npos; pos = contents.find("\"ph\":\"X\"", pos+1))
+        {
+            num_events++;
+        }
+        TS_ASSERT_EQUALS(num_events, 4u*PetscTools::GetNumProcs());
+
+        Profiler::Destroy();
+    }
+};
+
+#endif /*TESTPROFILER_HPP_*/
@@ -257,6 +257,9 @@ public:
                 TS_ASSERT_DELTA(random, generated_numbers[i], 1e-12);
             }
 
+            // The seed, which keys counter-based streams, is restored too
+            TS_ASSERT_EQUALS(p_gen->GetSeed(), 7u);
+
             RandomNumberGenerator::Destroy();
         }
     }
@@ -510,6 +513,127 @@ public:
         TS_ASSERT_DELTA(p_gen->ExponentialRandomDeviate(3.0), 0.1137, 1e-4);
         TS_ASSERT_DELTA(p_gen->ExponentialRandomDeviate(4.0), 0.2847, 1e-4);
     }
+
+    void TestPhiloxKnownAnswers()
+    {
+        // Known-answer tests from the Random123 distribution (kat_vectors, philox4x32_10)
+        {
+            boost::uint32_t counter[4] = {0u, 0u, 0u, 0u};
+            boost::uint32_t key[2] = {0u, 0u};
+            boost::uint32_t output[4];
+            CounterBasedRandomStream::Philox4x32(counter, key, output);
+            TS_ASSERT_EQUALS(output[0], 0x6627e8d5u);
+            TS_ASSERT_EQUALS(output[1], 0xe169c58du);
+            TS_ASSERT_EQUALS(output[2], 0xbc57ac4cu);
+            TS_ASSERT_EQUALS(output[3], 0x9b00dbd8u);
+        }
+        {
+            boost::uint32_t counter[4] = {0xffffffffu, 0xffffffffu, 0xffffffffu, 0xffffffffu};
+            boost::uint32_t key[2] = {0xffffffffu, 0xffffffffu};
+            boost::uint32_t output[4];
+            CounterBasedRandomStream::Philox4x32(counter, key, output);
+            TS_ASSERT_EQUALS(output[0], 0x408f276du);
+            TS_ASSERT_EQUALS(output[1], 0x41c83b0eu);
+            TS_ASSERT_EQUALS(output[2], 0xa20bc7c6u);
+            TS_ASSERT_EQUALS(output[3], 0x6d5451fdu);
+        }
+        {
+            boost::uint32_t counter[4] = {0x243f6a88u, 0x85a308d3u, 0x13198a2eu, 0x03707344u};
+            boost::uint32_t key[2] = {0xa4093822u, 0x299f31d0u};
+            boost::uint32_t output[4];
+            CounterBasedRandomStream::Philox4x32(counter, key, output);
+            TS_ASSERT_EQUALS(output[0], 0xd16cfe09u);
+            TS_ASSERT_EQUALS(output[1], 0x94fdccebu);
+            TS_ASSERT_EQUALS(output[2], 0x5001e420u);
+            TS_ASSERT_EQUALS(output[3], 0x24126ea1u);
+        }
+    }
+
+    void TestCounterBasedStreams()
+    {
+        RandomNumberGenerator::Destroy();
+        RandomNumberGenerator* p_gen = RandomNumberGenerator::Instance();
+        TS_ASSERT_EQUALS(p_gen->GetSeed(), 0u);
+        p_gen->Reseed(3);
+        TS_ASSERT_EQUALS(p_gen->GetSeed(), 3u);
+
+        // Reproducibility across platforms
+        CounterBasedRandomStream stream = p_gen->GetStream(17, 5, 2);
+        TS_ASSERT_DELTA(stream.ranf(), 0.669732717300, 1e-12);
+        TS_ASSERT_DELTA(stream.ranf(), 0.879593532091, 1e-12);
+        TS_ASSERT_DELTA(stream.ranf(), 0.988280581881, 1e-12);
+        TS_ASSERT_DELTA(stream.ranf(), 0.229560902976, 1e-12);
+
+        // Streams do not depend on, or affect, the main generator, nor the order in which they are visited
+        std::vector<double> forward_draws;
+        for (unsigned cell_id=0; cell_id<10; cell_id++)
+        {
+            p_gen->ranf();
+            CounterBasedRandomStream cell_stream = p_gen->GetStream(cell_id, 5);
+            forward_draws.push_back(cell_stream.ranf());
+        }
+        for (unsigned i=0; i<10; i++)
+        {
+            unsigned cell_id = 9 - i;
+            CounterBasedRandomStream cell_stream = p_gen->GetStream(cell_id, 5);
+            TS_ASSERT_EQUALS(cell_stream.ranf(), forward_draws[cell_id]);
+        }
+
+        // Different time steps, purposes and seeds give different streams
+        double first = p_gen->GetStream(0, 0, 0).ranf();
+        TS_ASSERT_DIFFERS(p_gen->GetStream(0, 1, 0).ranf(), first);
+        TS_ASSERT_DIFFERS(p_gen->GetStream(0, 0, 1).ranf(), first);
+        TS_ASSERT_DIFFERS(p_gen->GetStream(1, 0, 0).ranf(), first);
+        p_gen->Reseed(4);
+        TS_ASSERT_DIFFERS(p_gen->GetStream(0, 0, 0).ranf(), first);
+
+        // Bulk draws match individual draws
+        std::vector<double> bulk_draws(7);
+        p_gen->GetStream(3, 8, 1).FillUnitReals(bulk_draws);
+        CounterBasedRandomStream single_stream = p_gen->GetStream(3, 8, 1);
+        for (unsigned i=0; i<bulk_draws.size(); i++)
+        {
+            TS_ASSERT_EQUALS(bulk_draws[i], single_stream.ranf());
+        }
+
+        // Sanity check the distributions
+        CounterBasedRandomStream stats_stream = p_gen->GetStream(0, 0, 0);
+        unsigned num_samples = 100000;
+        std::vector<double> uniform_samples(num_samples);
+        stats_stream.FillUnitReals(uniform_samples);
+
+        double uniform_mean = 0.0;
+        double normal_mean = 0.0;
+        double normal_variance = 0.0;
+        double exponential_mean = 0.0;
+        std::vector<unsigned> counts(7, 0u);
+        for (unsigned i=0; i<num_samples; i++)
+        {
+            TS_ASSERT_LESS_THAN_EQUALS(0.0, uniform_samples[i]);
+            TS_ASSERT_LESS_THAN(uniform_samples[i], 1.0);
+            uniform_mean += uniform_samples[i]/num_samples;
+
+            double normal = stats_stream.NormalRandomDeviate(1.0, 2.0);
+            normal_mean += normal/num_samples;
+            normal_variance += (normal - 1.0)*(normal - 1.0)/num_samples;
+
+            exponential_mean += stats_stream.ExponentialRandomDeviate(4.0)/num_samples;
+
+            unsigned value = stats_stream.randMod(7);
+            TS_ASSERT_LESS_THAN(value, 7u);
+            counts[value]++;
+        }
+        TS_ASSERT_DELTA(uniform_mean, 0.5, 1e-2);
+        TS_ASSERT_DELTA(normal_mean, 1.0, 2e-2);
+        TS_ASSERT_DELTA(normal_variance, 4.0, 1e-1);
+        TS_ASSERT_DELTA(exponential_mean, 0.25, 1e-2);
+        for (unsigned value=0; value<7; value++)
+        {
+            TS_ASSERT_DELTA(counts[value], num_samples/7.0, 0.05*num_samples/7.0);
+        }
+
+        RandomNumberGenerator::Destroy();
+    }
 };
 
 #endif /*TESTRANDOMNUMBERGENERATOR_HPP_*/
@@ -0,0 +1,396 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "AbstractEnsembleRunner.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <climits>
+#include <limits>
+
+#include "Exception.hpp"
+#include "FileFinder.hpp"
+#include "OutputFileHandler.hpp"
+#include "PetscTools.hpp"
+#include "Warnings.hpp"
+
+const char AbstractEnsembleRunner::TASK_PENDING;
+const char AbstractEnsembleRunner::TASK_COMPLETED;
+const char AbstractEnsembleRunner::TASK_FAILED;
+
+/** MPI tag for messages from a worker carrying results and asking for more work. */
+const int ENSEMBLE_RESULTS_TAG = 3001;
+
+/** MPI tag for messages from the dispatcher giving a worker a block of tasks. */
+const int ENSEMBLE_WORK_TAG = 3002;
+
+AbstractEnsembleRunner::AbstractEnsembleRunner(unsigned numTasks, const std::vector<std::string>& rSummaryNames)
+    : mNumTasks(numTasks),
+      mSummaryNames(rSummaryNames),
+      mMaxTasksPerRun(UINT_MAX),
+      mNumTasksRunOnThisProcess(0u),
+      mFileId(0),
+      mSummaryDatasetId(0),
+      mStatusDatasetId(0)
+{
+    if (mSummaryNames.empty())
+    {
+        EXCEPTION("An ensemble must produce at least one summary value per task.");
+    }
+}
+
+AbstractEnsembleRunner::~AbstractEnsembleRunner()
+{
+    CloseResultsFile();
+}
+
+void AbstractEnsembleRunner::SetMaxTasksPerRun(unsigned maxTasks)
+{
+    mMaxTasksPerRun = maxTasks;
+}
+
+unsigned AbstractEnsembleRunner::GetNumTasksRunOnThisProcess() const
+{
+    return mNumTasksRunOnThisProcess;
+}
+
+unsigned AbstractEnsembleRunner::Run(const std::string& rDirectory, const std::string& rFileName, bool resume)
+{
+    if (PetscTools::IsIsolated())
+    {
+        EXCEPTION("An ensemble cannot be run while processes are isolated.");
+    }
+
+    OutputFileHandler handler(rDirectory, !resume);
+    mFileName = handler.GetOutputDirectoryFullPath() + rFileName + ".h5";
+
+    // Find out what's already been done
+    std::vector<char> status(mNumTasks, TASK_PENDING);
+    try
+    {
+        if (PetscTools::AmMaster())
+        {
+            OpenResultsFile(resume, status);
+        }
+    }
+    catch (Exception& e)
+    {
+        PetscTools::ReplicateException(true);
+        throw;
+    }
+    PetscTools::ReplicateException(false);
+
+    if (PetscTools::IsParallel() && mNumTasks > 0)
+    {
+        MPI_Bcast(&status[0], mNumTasks, MPI_CHAR, PetscTools::MASTER_RANK, PETSC_COMM_WORLD);
+    }
+
+    std::vector<unsigned> pending;
+    for (unsigned task=0; task<mNumTasks; task++)
+    {
+        if (status[task] == TASK_PENDING)
+        {
+            pending.push_back(task);
+        }
+    }
+    unsigned num_left_over = 0u;
+    if (pending.size() > mMaxTasksPerRun)
+    {
+        num_left_over = pending.size() - mMaxTasksPerRun;
+        pending.resize(mMaxTasksPerRun);
+    }
+
+    // Run the tasks, with each process working on its own
+    mNumTasksRunOnThisProcess = 0u;
+    bool use_dispatcher = PetscTools::IsParallel();
+    PetscTools::IsolateProcesses(true);
+
+    if (!use_dispatcher)
+    {
+        std::vector<double> summary;
+        for (unsigned i=0; i<pending.size(); i++)
+        {
+            char task_status = RunOneTask(pending[i], summary);
+            RecordResult(pending[i], task_status, &summary[0]);
+        }
+    }
+    else if (PetscTools::GetMyRank() == PetscTools::MASTER_RANK)
+    {
+        RunAsDispatcher(pending);
+    }
+    else
+    {
+        RunAsWorker(pending);
+    }
+
+    PetscTools::IsolateProcesses(false);
+    CloseResultsFile();
+    PetscTools::Barrier("AbstractEnsembleRunner::Run");
+
+    return num_left_over;
+}
+
+char AbstractEnsembleRunner::RunOneTask(unsigned taskIndex, std::vector<double>& rSummary)
+{
+    mNumTasksRunOnThisProcess++;
+    try
+    {
+        rSummary = RunTask(taskIndex);
+        if (rSummary.size() != mSummaryNames.size())
+        {
+            EXCEPTION("Ensemble task " << taskIndex << " returned " << rSummary.size()
+                      << " summary values; expected " << mSummaryNames.size() << ".");
+        }
+    }
+    catch (Exception& e)
+    {
+        WARNING("Ensemble task " << taskIndex << " failed: " << e.GetShortMessage());
+        rSummary.assign(mSummaryNames.size(), std::numeric_limits<double>::quiet_NaN());
+        return TASK_FAILED;
+    }
+    return TASK_COMPLETED;
+}
+
+void AbstractEnsembleRunner::RunAsDispatcher(const std::vector<unsigned>& rPending)
+{
+    const unsigned num_workers = PetscTools::GetNumProcs() - 1;
+    const unsigned record_size = 2 + mSummaryNames.size();
+    unsigned next_task = 0u;
+    unsigned num_active_workers = num_workers;
+    std::vector<double> buffer;
+
+    while (num_active_workers > 0)
+    {
+        // Wait for a worker to report in
+        MPI_Status mpi_status;
+        MPI_Probe(MPI_ANY_SOURCE, ENSEMBLE_RESULTS_TAG, PETSC_COMM_WORLD, &mpi_status);
+        int count;
+        MPI_Get_count(&mpi_status, MPI_DOUBLE, &count);
+        buffer.resize(std::max(count, 1));
+        MPI_Recv(&buffer[0], count, MPI_DOUBLE, mpi_status.MPI_SOURCE, ENSEMBLE_RESULTS_TAG, PETSC_COMM_WORLD, MPI_STATUS_IGNORE);
+
+        // Record any results it has sent
+        assert(count % record_size == 0);
+        for (unsigned offset=0; offset<(unsigned)count; offset += record_size)
+        {
+            RecordResult((unsigned)buffer[offset], (char)buffer[offset+1], &buffer[offset+2]);
+        }
+
+        // Hand out the next block of work; blocks get smaller as the work runs out,
+        // so that workers finish at about the same time
+        unsigned num_remaining = rPending.size() - next_task;
+        unsigned block_size = (num_remaining == 0) ? 0 : std::max(1u, num_remaining/(2*num_workers));
+        unsigned block[2] = {next_task, next_task + block_size};
+        next_task += block_size;
+        MPI_Send(block, 2, MPI_UNSIGNED, mpi_status.MPI_SOURCE, ENSEMBLE_WORK_TAG, PETSC_COMM_WORLD);
+        if (block_size == 0)
+        {
+            num_active_workers--;
+        }
+    }
+}
+
+void AbstractEnsembleRunner::RunAsWorker(const std::vector<unsigned>& rPending)
+{
+    std::vector<double> buffer;
+    std::vector<double> summary;
+    while (true)
+    {
+        // Send back results so far, asking for more work
+        double dummy = 0.0;
+        double* p_buffer = buffer.empty() ? &dummy : &buffer[0];
+        MPI_Send(p_buffer, buffer.size(), MPI_DOUBLE, PetscTools::MASTER_RANK, ENSEMBLE_RESULTS_TAG, PETSC_COMM_WORLD);
+
+        unsigned block[2];
+        MPI_Recv(block, 2, MPI_UNSIGNED, PetscTools::MASTER_RANK, ENSEMBLE_WORK_TAG, PETSC_COMM_WORLD, MPI_STATUS_IGNORE);
+        if (block[0] == block[1])
+        {
+            break;
+        }
+
+        buffer.clear();
+        for (unsigned i=block[0]; i<block[1]; i++)
+        {
+            char task_status = RunOneTask(rPending[i], summary);
+            buffer.push_back(rPending[i]);
+            buffer.push_back(task_status);
+            buffer.insert(buffer.end(), summary.begin(), summary.end());
+        }
+    }
+}
+
+void AbstractEnsembleRunner::OpenResultsFile(bool resume, std::vector<char>& rStatus)
+{
+    const unsigned num_columns = mSummaryNames.size();
+    hsize_t summary_dims[2] = {mNumTasks, num_columns};
+    hsize_t status_dims[1] = {mNumTasks};
+
+    if (resume && FileFinder(mFileName, RelativeTo::Absolute).Exists())
+    {
+        mFileId = H5Fopen(mFileName.c_str(), H5F_ACC_RDWR, H5P_DEFAULT);
+        if (mFileId < 0)
+        {
+            mFileId = 0;
+            EXCEPTION("AbstractEnsembleRunner could not open " << mFileName << " to resume.");
+        }
+        mSummaryDatasetId = H5Dopen(mFileId, "Summary", H5P_DEFAULT);
+        mStatusDatasetId = H5Dopen(mFileId, "Status", H5P_DEFAULT);
+        if (mSummaryDatasetId < 0 || mStatusDatasetId < 0)
+        {
+            CloseResultsFile();
+            EXCEPTION("Results file " << mFileName << " is not from an ensemble run.");
+        }
+
+        // Check the ensemble matches
+        hid_t dataspace = H5Dget_space(mSummaryDatasetId);
+        hsize_t existing_dims[2] = {0, 0};
+        int rank = H5Sget_simple_extent_ndims(dataspace);
+        if (rank == 2)
+        {
+            H5Sget_simple_extent_dims(dataspace, existing_dims, NULL);
+        }
+        H5Sclose(dataspace);
+        if (existing_dims[0] != summary_dims[0] || existing_dims[1] != summary_dims[1])
+        {
+            CloseResultsFile();
+            EXCEPTION("Cannot resume from " << mFileName << ": it holds results for a different ensemble.");
+        }
+
+        if (mNumTasks > 0)
+        {
+            H5Dread(mStatusDatasetId, H5T_NATIVE_CHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, &rStatus[0]);
+        }
+        return;
+    }
+
+    mFileId = H5Fcreate(mFileName.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, H5P_DEFAULT);
+    if (mFileId < 0)
+    {
+        mFileId = 0;
+        EXCEPTION("AbstractEnsembleRunner could not create " << mFileName);
+    }
+
+    // Summary table, initially all NaN
+    double nan = std::numeric_limits<double>::quiet_NaN();
+    hid_t dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    H5Pset_fill_value(dcpl, H5T_NATIVE_DOUBLE, &nan);
+    H5Pset_fill_time(dcpl, H5D_FILL_TIME_ALLOC);
+    hid_t summary_space = H5Screate_simple(2, summary_dims, NULL);
+    mSummaryDatasetId = H5Dcreate(mFileId, "Summary", H5T_NATIVE_DOUBLE, summary_space, H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    H5Sclose(summary_space);
+    H5Pclose(dcpl);
+
+    // Column names, as fixed-length strings
+    unsigned max_name_length = 0u;
+    for (unsigned i=0; i<num_columns; i++)
+    {
+        max_name_length = std::max(max_name_length, (unsigned)mSummaryNames[i].length());
+    }
+    std::vector<char> names(num_columns*(max_name_length+1), '\0');
+    for (unsigned i=0; i<num_columns; i++)
+    {
+        std::copy(mSummaryNames[i].begin(), mSummaryNames[i].end(), names.begin() + i*(max_name_length+1));
+    }
+    hsize_t names_dims[1] = {num_columns};
+    hid_t names_space = H5Screate_simple(1, names_dims, NULL);
+    hid_t string_type = H5Tcopy(H5T_C_S1);
+    H5Tset_size(string_type, max_name_length+1);
+    hid_t attribute_id = H5Acreate(mSummaryDatasetId, "Column Names", string_type, names_space, H5P_DEFAULT, H5P_DEFAULT);
+    H5Awrite(attribute_id, string_type, &names[0]);
+    H5Aclose(attribute_id);
+    H5Tclose(string_type);
+    H5Sclose(names_space);
+
+    // Task status, initially all pending
+    hid_t status_space = H5Screate_simple(1, status_dims, NULL);
+    mStatusDatasetId = H5Dcreate(mFileId, "Status", H5T_NATIVE_CHAR, status_space, H5P_DEFAULT, H5P_DEFAULT, H5P_DEFAULT);
+    H5Sclose(status_space);
+    if (mSummaryDatasetId < 0 || mStatusDatasetId < 0)
+    {
+        CloseResultsFile();
+        EXCEPTION("AbstractEnsembleRunner could not create datasets in " << mFileName);
+    }
+    if (mNumTasks > 0)
+    {
+        H5Dwrite(mStatusDatasetId, H5T_NATIVE_CHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, &rStatus[0]);
+    }
+    H5Fflush(mFileId, H5F_SCOPE_GLOBAL);
+}
+
+void AbstractEnsembleRunner::RecordResult(unsigned taskIndex, char status, const double* pSummary)
+{
+    assert(mFileId > 0);
+    assert(taskIndex < mNumTasks);
+
+    // Write the summary row first, so a task is never marked as done without its results
+    hsize_t row_count[2] = {1, mSummaryNames.size()};
+    hsize_t row_offset[2] = {taskIndex, 0};
+    hid_t memspace = H5Screate_simple(2, row_count, NULL);
+    hid_t filespace = H5Dget_space(mSummaryDatasetId);
+    H5Sselect_hyperslab(filespace, H5S_SELECT_SET, row_offset, NULL, row_count, NULL);
+    H5Dwrite(mSummaryDatasetId, H5T_NATIVE_DOUBLE, memspace, filespace, H5P_DEFAULT, pSummary);
+    H5Sclose(filespace);
+    H5Sclose(memspace);
+
+    hsize_t status_count[1] = {1};
+    hsize_t status_offset[1] = {taskIndex};
+    memspace = H5Screate_simple(1, status_count, NULL);
+    filespace = H5Dget_space(mStatusDatasetId);
+    H5Sselect_hyperslab(filespace, H5S_SELECT_SET, status_offset, NULL, status_count, NULL);
+    H5Dwrite(mStatusDatasetId, H5T_NATIVE_CHAR, memspace, filespace, H5P_DEFAULT, &status);
+    H5Sclose(filespace);
+    H5Sclose(memspace);
+
+    H5Fflush(mFileId, H5F_SCOPE_GLOBAL);
+}
+
+void AbstractEnsembleRunner::CloseResultsFile()
+{
+    if (mSummaryDatasetId > 0)
+    {
+        H5Dclose(mSummaryDatasetId);
+        mSummaryDatasetId = 0;
+    }
+    if (mStatusDatasetId > 0)
+    {
+        H5Dclose(mStatusDatasetId);
+        mStatusDatasetId = 0;
+    }
+    if (mFileId > 0)
+    {
+        H5Fclose(mFileId);
+        mFileId = 0;
+    }
+}
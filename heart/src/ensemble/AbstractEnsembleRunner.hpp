@@ -0,0 +1,206 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef ABSTRACTENSEMBLERUNNER_HPP_
+#define ABSTRACTENSEMBLERUNNER_HPP_
+
+#include <string>
+#include <vector>
+
+#include <hdf5.h>
+
+/**
+ * Runs a large ensemble of independent simulations (e.g. single-cell drug-block
+ * or uncertainty quantification sweeps, or batches of small tissue simulations)
+ * in parallel, collecting a fixed set of summary values from each (APD, CV,
+ * etc.) into a single HDF5 table.
+ *
+ * Subclasses say how to run task i, and what summary values it produces, by
+ * overriding RunTask().  Tasks are handed out dynamically: the master process
+ * acts as a dispatcher, giving each worker process a block of tasks whenever it
+ * finishes its previous block, with block sizes shrinking as the work runs out
+ * (guided self-scheduling).  Slow or expensive tasks therefore don't hold up
+ * the rest of the ensemble.  While running tasks each process is isolated (see
+ * PetscTools::IsolateProcesses()), so any Chaste code called by RunTask() works
+ * as if run sequentially.  When run on a single process, tasks are simply run
+ * in order.
+ *
+ * The results file doubles as a checkpoint.  Results are written (and flushed)
+ * as they come in, together with a status flag for each task, so a batch that
+ * is killed, or stopped early using SetMaxTasksPerRun(), can be resumed by
+ * calling Run() again with resume=true; only unfinished tasks are then run.
+ *
+ * The file contains two datasets:
+ *  - "Summary", of size (number of tasks) x (number of summary values), with
+ *    the column names stored in its "Column Names" attribute.  Entries for tasks
+ *    not yet run, or that failed, are NaN.
+ *  - "Status", with one entry per task: TASK_PENDING, TASK_COMPLETED or TASK_FAILED.
+ */
+class AbstractEnsembleRunner
+{
+private:
+
+    /** The number of tasks in the ensemble. */
+    unsigned mNumTasks;
+
+    /** The names of the summary values produced by each task. */
+    std::vector<std::string> mSummaryNames;
+
+    /** The maximum number of tasks to run in a single call to Run(). */
+    unsigned mMaxTasksPerRun;
+
+    /** The number of tasks run by this process in the most recent call to Run(). */
+    unsigned mNumTasksRunOnThisProcess;
+
+    /** The full path to the results file. */
+    std::string mFileName;
+
+    /** The results file (open on the master process only, during Run()). */
+    hid_t mFileId;
+
+    /** The "Summary" dataset. */
+    hid_t mSummaryDatasetId;
+
+    /** The "Status" dataset. */
+    hid_t mStatusDatasetId;
+
+    /**
+     * Create the results file, or open an existing one when resuming.
+     * Called on the master process only.
+     *
+     * @param resume  whether to resume from an existing file (if there is one)
+     * @param rStatus  filled in with the status of each task
+     */
+    void OpenResultsFile(bool resume, std::vector<char>& rStatus);
+
+    /**
+     * Record the result of one task in the results file.
+     * Called on the master process only.
+     *
+     * @param taskIndex  the task
+     * @param status  whether the task completed or failed
+     * @param pSummary  the summary values for the task
+     */
+    void RecordResult(unsigned taskIndex, char status, const double* pSummary);
+
+    /** Close the results file, if it is open. */
+    void CloseResultsFile();
+
+    /**
+     * Run a single task, catching any failure.
+     *
+     * @param taskIndex  the task
+     * @param rSummary  filled in with the summary values (NaN if the task failed)
+     * @return TASK_COMPLETED or TASK_FAILED
+     */
+    char RunOneTask(unsigned taskIndex, std::vector<double>& rSummary);
+
+    /**
+     * The master's side of a parallel run: hand out blocks of tasks on request
+     * and record the results sent back.
+     *
+     * @param rPending  the tasks to run
+     */
+    void RunAsDispatcher(const std::vector<unsigned>& rPending);
+
+    /**
+     * A worker's side of a parallel run: repeatedly request a block of tasks,
+     * run them, and send back the results with the next request.
+     *
+     * @param rPending  the tasks to run (as known by every process)
+     */
+    void RunAsWorker(const std::vector<unsigned>& rPending);
+
+protected:
+
+    /**
+     * Run one member of the ensemble.  This is called on a single, isolated,
+     * process.  Throwing an Exception marks the task as failed.
+     *
+     * @param taskIndex  which task to run, in [0, number of tasks)
+     * @return the summary values, in the order given to the constructor
+     */
+    virtual std::vector<double> RunTask(unsigned taskIndex)=0;
+
+public:
+
+    /** Status of a task that has not been run yet. */
+    static const char TASK_PENDING = 0;
+
+    /** Status of a task that ran successfully. */
+    static const char TASK_COMPLETED = 1;
+
+    /** Status of a task that threw an exception. */
+    static const char TASK_FAILED = 2;
+
+    /**
+     * Constructor.
+     *
+     * @param numTasks  the number of tasks in the ensemble
+     * @param rSummaryNames  the names of the summary values produced by each task
+     */
+    AbstractEnsembleRunner(unsigned numTasks, const std::vector<std::string>& rSummaryNames);
+
+    /**
+     * Destructor.
+     */
+    virtual ~AbstractEnsembleRunner();
+
+    /**
+     * Limit the number of tasks run by each call to Run(), e.g. to fit a batch
+     * into a queue's time limit.  Remaining tasks can be run by resuming.
+     *
+     * @param maxTasks  the maximum number of tasks to run
+     */
+    void SetMaxTasksPerRun(unsigned maxTasks);
+
+    /**
+     * @return the number of tasks run by this process in the most recent call to Run()
+     */
+    unsigned GetNumTasksRunOnThisProcess() const;
+
+    /**
+     * Run the ensemble.  Must be called collectively.
+     *
+     * @param rDirectory  the output directory, relative to CHASTE_TEST_OUTPUT
+     * @param rFileName  the results file name, without the ".h5" extension
+     * @param resume  whether to carry on from the results of a previous run, rather than
+     *     starting afresh (the output directory is only cleaned when starting afresh)
+     * @return the number of tasks still to be run
+     */
+    unsigned Run(const std::string& rDirectory, const std::string& rFileName, bool resume=false);
+};
+
+#endif /*ABSTRACTENSEMBLERUNNER_HPP_*/
@@ -35,13 +35,16 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "FibreReader.hpp"
 
+#include <algorithm>
 #include <sstream>
 #include "Exception.hpp"
+#include "PetscTools.hpp"
 
 template<unsigned DIM>
 FibreReader<DIM>::FibreReader(const FileFinder& rFileFinder, FibreFileType fibreFileType)
    : mFileIsBinary(false), // overwritten by ReadNumLinesOfDataFromFile() if applicable.
-     mNextIndex(0u)
+     mNextIndex(0u),
+     mBinaryDataOffset(0)
 {
     if (fibreFileType == AXISYM)
     {
@@ -62,6 +65,10 @@ FibreReader<DIM>::FibreReader(const FileFinder& rFileFinder, FibreFileType fibre
 
     // Note: this method will close the file on error
     ReadNumLinesOfDataFromFile();
+    if (mFileIsBinary)
+    {
+        mBinaryDataOffset = mDataFile.tellg();
+    }
 }
 
 template<unsigned DIM>
@@ -167,6 +174,12 @@ void FibreReader<DIM>::GetFibreSheetAndNormalMatrix(unsigned fibreIndex,
 
     }
 
+    TransposeAndCheckFibreMatrix(rFibreMatrix, checkOrthogonality);
+}
+
+template<unsigned DIM>
+void FibreReader<DIM>::TransposeAndCheckFibreMatrix(c_matrix<double,DIM,DIM>& rFibreMatrix, bool checkOrthogonality)
+{
     // The binary file and ascii file are row-major. However, we store column major matrices.
     rFibreMatrix = trans(rFibreMatrix);
 
@@ -235,14 +248,159 @@ void FibreReader<DIM>::GetFibreVector(unsigned fibreIndex,
         }
     }
 
+    if (checkNormalised)
+    {
+        CheckFibreVectorIsNormalised(rFibreVector);
+    }
+}
 
-    if (checkNormalised && fabs(norm_2(rFibreVector)-1)>1e-4)
+template<unsigned DIM>
+void FibreReader<DIM>::CheckFibreVectorIsNormalised(const c_vector<double,DIM>& rFibreVector)
+{
+    if (fabs(norm_2(rFibreVector)-1)>1e-4)
     {
         EXCEPTION("Read vector " << rFibreVector << " from file "
                       << mFilePath << " which is not normalised (tolerance 1e-4)");
     }
 }
 
+template<unsigned DIM>
+void FibreReader<DIM>::GetFibreSheetAndNormalMatrices(const std::vector<unsigned>& rFibreIndices,
+                                                      std::vector<c_matrix<double,DIM,DIM> >& rFibreMatrices,
+                                                      bool checkOrthogonality)
+{
+    if (mNumItemsPerLine != DIM*DIM)
+    {
+        EXCEPTION("Use GetFibreVectors when reading axisymmetric fibres");
+    }
+    rFibreMatrices.resize(rFibreIndices.size());
+    if (mFileIsBinary)
+    {
+        std::vector<double> data;
+        ReadBinaryLines(rFibreIndices, data);
+        for (unsigned i=0; i<rFibreIndices.size(); i++)
+        {
+            std::copy(data.begin() + i*mNumItemsPerLine, data.begin() + (i+1)*mNumItemsPerLine, &(rFibreMatrices[i](0,0)));
+            TransposeAndCheckFibreMatrix(rFibreMatrices[i], checkOrthogonality);
+        }
+    }
+    else
+    {
+        for (unsigned i=0; i<rFibreIndices.size(); i++)
+        {
+            GetFibreSheetAndNormalMatrix(rFibreIndices[i], rFibreMatrices[i], checkOrthogonality);
+        }
+    }
+}
+
+template<unsigned DIM>
+void FibreReader<DIM>::GetFibreVectors(const std::vector<unsigned>& rFibreIndices,
+                                       std::vector<c_vector<double,DIM> >& rFibreVectors,
+                                       bool checkNormalised)
+{
+    if (mNumItemsPerLine != DIM)
+    {
+        EXCEPTION("Use GetFibreSheetAndNormalMatrices when reading orthotropic fibres");
+    }
+    rFibreVectors.resize(rFibreIndices.size());
+    if (mFileIsBinary)
+    {
+        std::vector<double> data;
+        ReadBinaryLines(rFibreIndices, data);
+        for (unsigned i=0; i<rFibreIndices.size(); i++)
+        {
+            std::copy(data.begin() + i*DIM, data.begin() + (i+1)*DIM, rFibreVectors[i].begin());
+            if (checkNormalised)
+            {
+                CheckFibreVectorIsNormalised(rFibreVectors[i]);
+            }
+        }
+    }
+    else
+    {
+        for (unsigned i=0; i<rFibreIndices.size(); i++)
+        {
+            GetFibreVector(rFibreIndices[i], rFibreVectors[i], checkNormalised);
+        }
+    }
+}
+
+template<unsigned DIM>
+void FibreReader<DIM>::ReadBinaryLines(const std::vector<unsigned>& rIndices, std::vector<double>& rData)
+{
+    assert(mFileIsBinary);
+    rData.resize(rIndices.size()*mNumItemsPerLine);
+
+    // Group the indices into runs of consecutive lines
+    std::vector<int> run_starts;
+    std::vector<int> run_lengths;
+    for (unsigned i=0; i<rIndices.size(); i++)
+    {
+        if (i > 0 && rIndices[i] <= rIndices[i-1])
+        {
+            EXCEPTION("Fibre reads must be monotonically increasing; " << rIndices[i]
+                      << " is before expected next index " << rIndices[i-1]+1);
+        }
+        if (rIndices[i] >= mNumLinesOfData)
+        {
+            EXCEPTION("Fibre index " << rIndices[i] << " is beyond the end of " << mFilePath);
+        }
+        if (!run_starts.empty() && rIndices[i] == (unsigned)(run_starts.back() + run_lengths.back()))
+        {
+            run_lengths.back()++;
+        }
+        else
+        {
+            run_starts.push_back(rIndices[i]);
+            run_lengths.push_back(1);
+        }
+    }
+
+    const std::streamoff line_size = mNumItemsPerLine*sizeof(double);
+    if (PetscTools::IsSequential() || PetscTools::IsIsolated())
+    {
+        unsigned offset = 0u;
+        for (unsigned run=0; run<run_starts.size(); run++)
+        {
+            mDataFile.seekg(mBinaryDataOffset + run_starts[run]*line_size, std::ios::beg);
+            mDataFile.read((char*)&rData[offset], run_lengths[run]*line_size);
+            offset += run_lengths[run]*mNumItemsPerLine;
+        }
+    }
+    else
+    {
+        // Every process describes the lines it wants with a file view, and then they all read at once
+        MPI_File file_handle;
+        int ierr = MPI_File_open(PetscTools::GetWorld(), const_cast<char*>(mFilePath.c_str()), MPI_MODE_RDONLY, MPI_INFO_NULL, &file_handle);
+        if (ierr != MPI_SUCCESS)
+        {
+            EXCEPTION("Failed to open fibre file " << mFilePath << " for parallel reading");
+        }
+
+        MPI_Datatype line_type;
+        MPI_Type_contiguous(mNumItemsPerLine, MPI_DOUBLE, &line_type);
+        MPI_Type_commit(&line_type);
+
+        // MPI needs valid pointers even for empty runs
+        int dummy = 0;
+        MPI_Datatype file_type;
+        MPI_Type_indexed(run_starts.size(),
+                         run_lengths.empty() ? &dummy : &run_lengths[0],
+                         run_starts.empty() ? &dummy : &run_starts[0],
+                         line_type, &file_type);
+        MPI_Type_commit(&file_type);
+
+        MPI_File_set_view(file_handle, mBinaryDataOffset, line_type, file_type, const_cast<char*>("native"), MPI_INFO_NULL);
+        MPI_Status status;
+        double dummy_buffer;
+        MPI_File_read_all(file_handle, rData.empty() ? &dummy_buffer : &rData[0], rIndices.size(), line_type, &status);
+
+        MPI_Type_free(&file_type);
+        MPI_Type_free(&line_type);
+        MPI_File_close(&file_handle);
+    }
+}
+
 
 template<unsigned DIM>
 unsigned FibreReader<DIM>::GetTokensAtNextLine()
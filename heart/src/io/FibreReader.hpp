@@ -81,6 +81,9 @@ private:
     /** Vector which entries read from a line in a file is put into. */
     std::vector<double> mTokens;
 
+    /** Offset in bytes of the first item of data in a binary file. */
+    std::streamoff mBinaryDataOffset;
+
     /**
      *  Read a line of numbers from #mDataFile.
      *  Sets up the member variable #mTokens with the data in the next line.
@@ -95,6 +98,34 @@ private:
      */
     void ReadNumLinesOfDataFromFile();
 
+    /**
+     * Read the lines with the given indices from a binary file.  Runs of consecutive
+     * indices are read as single blocks.  When running in parallel this is a collective
+     * MPI-IO read in which each process only touches the parts of the file it asked for,
+     * so must be called on every process (in PetscTools::GetWorld()).
+     *
+     * @param rIndices  the (strictly increasing) indices of the lines to read
+     * @param rData  filled in with #mNumItemsPerLine entries for each index
+     */
+    void ReadBinaryLines(const std::vector<unsigned>& rIndices, std::vector<double>& rData);
+
+    /**
+     * Convert a row-major fibre-sheet matrix as read from file into the column-major
+     * form we store, optionally checking that it is orthogonal.
+     *
+     * @param rFibreMatrix  matrix to be transposed in place
+     * @param checkOrthogonality  if true, checks if the matrix is orthogonal
+     *    and throws an exception if not
+     */
+    void TransposeAndCheckFibreMatrix(c_matrix<double,DIM,DIM>& rFibreMatrix, bool checkOrthogonality);
+
+    /**
+     * Check that a fibre vector is normalised, throwing if not.
+     *
+     * @param rFibreVector  the vector
+     */
+    void CheckFibreVectorIsNormalised(const c_vector<double,DIM>& rFibreVector);
+
 public:
     /**
      * Create a new FibreReader.
@@ -148,6 +179,37 @@ public:
      */
     void GetFibreVector(unsigned fibreIndex, c_vector<double,DIM>& rFibreVector, bool checkNormalised=true);
 
+    /**
+     * Read the fibre direction matrices for a set of elements in one go, e.g. those owned
+     * by this process.  See GetFibreSheetAndNormalMatrix() for the form of each matrix.
+     *
+     * For binary files this does one collective read when running in parallel, in which
+     * each process only loads the lines it asks for, so it must then be called on all
+     * processes (even those with nothing to read).  Do not mix with the single-index
+     * GetFibre... methods.
+     *
+     * @param rFibreIndices  which fibre matrices to read, in strictly increasing order
+     * @param rFibreMatrices  filled in with one matrix per index
+     * @param checkOrthogonality  if true, checks if the matrices are orthogonal
+     *    and throws an exception if not
+     */
+    void GetFibreSheetAndNormalMatrices(const std::vector<unsigned>& rFibreIndices,
+                                        std::vector<c_matrix<double,DIM,DIM> >& rFibreMatrices,
+                                        bool checkOrthogonality=true);
+
+    /**
+     * Read the fibre direction vectors for a set of elements in one go.  The axisymmetric
+     * equivalent of GetFibreSheetAndNormalMatrices(), with the same collective semantics.
+     *
+     * @param rFibreIndices  which fibre vectors to read, in strictly increasing order
+     * @param rFibreVectors  filled in with one vector per index
+     * @param checkNormalised  if true, checks if the read vectors are normalised
+     *   and throws an exception if not
+     */
+    void GetFibreVectors(const std::vector<unsigned>& rFibreIndices,
+                         std::vector<c_vector<double,DIM> >& rFibreVectors,
+                         bool checkNormalised=true);
+
     /**
      *  @return the number of lines of data in the file - this is the value read from
      *  the first line.
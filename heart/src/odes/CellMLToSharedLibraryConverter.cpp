@@ -37,12 +37,21 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <sstream>
 #include <fstream>      // for std::ofstream
+#include <iomanip>
+#include <iterator>
+#include <map>
+#include <set>
+#include <cstdio> // For rename()
 #include <sys/stat.h> // For mkdir()
 #include <ctime>
 #include <cstring> // For strerror()
 #include <cerrno> // For errno
 
 #include <boost/foreach.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/interprocess/sync/file_lock.hpp>
+#include <boost/interprocess/sync/scoped_lock.hpp>
 
 #include "ChasteSyscalls.hpp"
 #include "Exception.hpp"
@@ -51,6 +60,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "PetscTools.hpp"
 #include "DynamicModelLoaderRegistry.hpp"
 #include "GetCurrentWorkingDirectory.hpp"
+#include "BoostFilesystem.hpp"
+#include "Version.hpp"
 
 #define IGNORE_EXCEPTIONS(code) \
     try {                       \
@@ -106,21 +117,21 @@ DynamicCellModelLoaderPtr CellMLToSharedLibraryConverter::Convert(const FileFind
     }
     if (extension == "cellml")
     {
-        // Split the path into folder and leaf
-        size_t slash_position = absolute_path.find_last_of("/\\");
-        assert(slash_position != std::string::npos);
-        std::string folder = absolute_path.substr(0, slash_position+1); // Include trailing slash
-        std::string leaf = absolute_path.substr(slash_position+1, dot_position-slash_position); // Include dot
-        std::string so_path = folder + "lib" + leaf + msSoSuffix;
         // Does the .so file already exist (and was it modified after the .cellml?)
-        FileFinder so_file(so_path, RelativeTo::Absolute);
-        if (!so_file.Exists() || rFilePath.IsNewerThan(so_file))
+        FileFinder so_file = GetSoFileForCellml(rFilePath);
+        bool needs_building = SoNeedsBuilding(rFilePath);
+        if (isCollective)
+        {
+            // Another job sharing the cache may fill it at any moment, so make sure all processes agree
+            needs_building = PetscTools::ReplicateBool(needs_building);
+        }
+        if (needs_building)
         {
             if (!isCollective)
             {
                 EXCEPTION("Unable to convert .cellml to .so unless called collectively, due to possible race conditions.");
             }
-            ConvertCellmlToSo(absolute_path, folder);
+            ConvertCellmlToSo(absolute_path, so_file.GetParent().GetAbsolutePath());
         }
         // Load the .so
         p_loader = DynamicModelLoaderRegistry::Instance()->GetLoader(so_file);
@@ -139,13 +150,151 @@ DynamicCellModelLoaderPtr CellMLToSharedLibraryConverter::Convert(const FileFind
     return p_loader;
 }
 
-void CellMLToSharedLibraryConverter::ConvertCellmlToSo(const std::string& rCellmlFullPath,
-                                                       const std::string& rCellmlFolder)
+std::vector<DynamicCellModelLoaderPtr> CellMLToSharedLibraryConverter::Convert(const std::vector<FileFinder>& rFilePaths)
 {
-    FileFinder tmp_folder;
-    FileFinder build_folder;
+    // Work out which models need compiling; every process must reach the same decision
+    std::vector<FileFinder> to_build;
+    std::set<std::string> paths_to_build;
+    BOOST_FOREACH(const FileFinder& r_file_path, rFilePaths)
+    {
+        std::string absolute_path = r_file_path.GetAbsolutePath();
+        if (r_file_path.GetExtension() == ".cellml"
+            && r_file_path.Exists()
+            && paths_to_build.find(absolute_path) == paths_to_build.end()
+            && PetscTools::ReplicateBool(SoNeedsBuilding(r_file_path)))
+        {
+            to_build.push_back(r_file_path);
+            paths_to_build.insert(absolute_path);
+        }
+    }
 
-    std::string old_cwd = GetCurrentWorkingDirectory();
+    if (!to_build.empty())
+    {
+        CheckBuildTreeExists();
+
+#ifdef CHASTE_CMAKE ///todo: #2656 - ignoring all cmake-specific code, revise after cmake transition
+#define COVERAGE_IGNORE
+        // Each model is built in its own temporary project, so builds can proceed concurrently
+        const unsigned num_builders = PetscTools::GetNumProcs();
+#undef COVERAGE_IGNORE
+#else
+        // SCons builds run in the Chaste source tree, and so must not overlap
+        const unsigned num_builders = 1u;
+#endif
+        try
+        {
+            for (unsigned i=0; i<to_build.size(); i++)
+            {
+                if (i % num_builders == PetscTools::GetMyRank())
+                {
+                    FileFinder so_file = GetSoFileForCellml(to_build[i]);
+                    BuildSharedLibrary(to_build[i].GetAbsolutePath(),
+                                       so_file.GetParent().GetAbsolutePath(),
+                                       mCacheFolder.IsPathSet());
+                }
+            }
+        }
+        catch (Exception& e)
+        {
+            PetscTools::ReplicateException(true);
+            EXCEPTION("Conversion of CellML to Chaste shared object failed. Error was: " + e.GetMessage());
+        }
+        // This also has the effect of a barrier, ensuring all processes wait for the
+        // shared libraries to be created.
+        PetscTools::ReplicateException(false);
+    }
+
+    // Everything needed now exists, so the loaders can be created without further communication
+    std::vector<DynamicCellModelLoaderPtr> loaders;
+    BOOST_FOREACH(const FileFinder& r_file_path, rFilePaths)
+    {
+        loaders.push_back(Convert(r_file_path, false));
+    }
+    return loaders;
+}
+
+void CellMLToSharedLibraryConverter::SetCacheFolder(const FileFinder& rCacheFolder)
+{
+    mCacheFolder = rCacheFolder;
+}
+
+FileFinder CellMLToSharedLibraryConverter::GetCacheEntryFolder(const FileFinder& rCellmlFile) const
+{
+    if (!mCacheFolder.IsPathSet())
+    {
+        EXCEPTION("No cache folder has been set for CellML conversion.");
+    }
+
+    // The files copied into the build: the model itself, its options file, etc.
+    // Generated sources and previously built libraries are excluded.
+    std::string model_name = rCellmlFile.GetLeafNameNoExtension();
+    std::vector<FileFinder> candidate_files = rCellmlFile.GetParent().FindMatches(model_name + "*");
+    std::map<std::string, FileFinder> input_files;
+    BOOST_FOREACH(const FileFinder& r_file, candidate_files)
+    {
+        std::string extension = r_file.GetExtension();
+        if (r_file.IsFile() && extension != ".cpp" && extension != ".hpp" && extension != "." + msSoSuffix)
+        {
+            input_files[r_file.GetLeafName()] = r_file;
+        }
+    }
+
+    // 64-bit FNV-1a hash of the inputs and the build configuration
+    boost::uint64_t hash = 14695981039346656037ull;
+    std::stringstream key;
+    key << mComponentName << '\0' << ChasteBuildType() << '\0'
+        << ChasteBuildInfo::GetVersionString() << '\0'
+        << ChasteBuildInfo::GetCompilerType() << '\0'
+        << ChasteBuildInfo::GetCompilerVersion() << '\0'
+        << ChasteBuildInfo::GetCompilerFlags() << '\0';
+#ifdef CHASTE_CMAKE
+    key << "cmake" << '\0';
+#else
+    key << "scons" << '\0';
+#endif
+    for (std::map<std::string, FileFinder>::const_iterator it = input_files.begin();
+         it != input_files.end();
+         ++it)
+    {
+        std::ifstream input_file(it->second.GetAbsolutePath().c_str(), std::ios::binary);
+        std::string contents((std::istreambuf_iterator<char>(input_file)), std::istreambuf_iterator<char>());
+        key << it->first << '\0' << contents << '\0';
+    }
+    const std::string key_string = key.str();
+    for (std::string::const_iterator it = key_string.begin(); it != key_string.end(); ++it)
+    {
+        hash ^= static_cast<unsigned char>(*it);
+        hash *= 1099511628211ull;
+    }
+
+    std::stringstream entry_name;
+    entry_name << model_name << "_" << std::hex << std::setw(16) << std::setfill('0') << hash;
+    return FileFinder(entry_name.str(), mCacheFolder);
+}
+
+FileFinder CellMLToSharedLibraryConverter::GetSoFileForCellml(const FileFinder& rCellmlFile) const
+{
+    std::string so_name = "lib" + rCellmlFile.GetLeafNameNoExtension() + "." + msSoSuffix;
+    if (mCacheFolder.IsPathSet())
+    {
+        return FileFinder(so_name, GetCacheEntryFolder(rCellmlFile));
+    }
+    return FileFinder(so_name, rCellmlFile.GetParent());
+}
+
+bool CellMLToSharedLibraryConverter::SoNeedsBuilding(const FileFinder& rCellmlFile) const
+{
+    FileFinder so_file = GetSoFileForCellml(rCellmlFile);
+    if (!so_file.Exists())
+    {
+        return true;
+    }
+    // Cache entries are keyed by content, so can never be out of date
+    return !mCacheFolder.IsPathSet() && rCellmlFile.IsNewerThan(so_file);
+}
+
+void CellMLToSharedLibraryConverter::CheckBuildTreeExists() const
+{
     // Check that the Chaste build tree exists
     FileFinder chaste_root("", RelativeTo::ChasteBuildRoot);
 
@@ -160,119 +309,198 @@ void CellMLToSharedLibraryConverter::ConvertCellmlToSo(const std::string& rCellm
         EXCEPTION("Unable to convert CellML model: required Chaste component '" << mComponentName
                   << "' does not exist in '" << chaste_root.GetAbsolutePath() << "'.");
     }
+}
+
+void CellMLToSharedLibraryConverter::ConvertCellmlToSo(const std::string& rCellmlFullPath,
+                                                       const std::string& rCellmlFolder)
+{
+    CheckBuildTreeExists();
+
     // Try the conversion
     try
     {
         // Need to create a .so file from the CellML...
         if (PetscTools::AmMaster())
         {
-            // Create a temporary folder within heart/dynamic
-            std::stringstream folder_name;
-            folder_name << "dynamic/tmp_" << getpid() << "_" << time(NULL);
+            BuildSharedLibrary(rCellmlFullPath, rCellmlFolder, mCacheFolder.IsPathSet());
+        }
+    }
+    catch (Exception& e)
+    {
+        PetscTools::ReplicateException(true);
+        EXCEPTION("Conversion of CellML to Chaste shared object failed. Error was: " + e.GetMessage());
+    }
+    // This also has the effect of a barrier, ensuring all processes wait for the
+    // shared library to be created.
+    PetscTools::ReplicateException(false);
+}
+
+void CellMLToSharedLibraryConverter::BuildSharedLibrary(const std::string& rCellmlFullPath,
+                                                        const std::string& rDestinationFolder,
+                                                        bool isCacheEntry)
+{
+    // A new cache entry won't exist yet, so may have been given without a trailing slash
+    std::string destination_path = rDestinationFolder;
+    if (destination_path.empty() || destination_path[destination_path.length()-1] != '/')
+    {
+        destination_path += '/';
+    }
+
+    FileFinder tmp_folder;
+    FileFinder build_folder;
+
+    std::string old_cwd = GetCurrentWorkingDirectory();
+    FileFinder chaste_root("", RelativeTo::ChasteBuildRoot);
+    FileFinder component_dir(mComponentName, RelativeTo::ChasteBuildRoot);
+
+    FileFinder cellml_file(rCellmlFullPath, RelativeTo::Absolute);
+    std::string cellml_leaf_name = cellml_file.GetLeafNameNoExtension();
+    FileFinder destination_so_file(destination_path + "lib" + cellml_leaf_name + "." + msSoSuffix, RelativeTo::Absolute);
+
+    // When filling a cache entry, hold a lock on it for the duration of the build, so
+    // that concurrent jobs wanting the same model wait for this build rather than repeat it.
+    boost::scoped_ptr<boost::interprocess::file_lock> p_cache_lock;
+    boost::scoped_ptr<boost::interprocess::scoped_lock<boost::interprocess::file_lock> > p_cache_lock_holder;
+    if (isCacheEntry)
+    {
+        std::string lock_path = destination_path + ".lock";
+        try
+        {
+            fs::create_directories(fs::path(destination_path));
+            std::ofstream lock_file(lock_path.c_str(), std::ios::app);
+            lock_file.close();
+            p_cache_lock.reset(new boost::interprocess::file_lock(lock_path.c_str()));
+            p_cache_lock_holder.reset(new boost::interprocess::scoped_lock<boost::interprocess::file_lock>(*p_cache_lock));
+        }
+        catch (const std::exception& e)
+        {
+            EXCEPTION("Unable to lock CellML cache entry '" << destination_path << "': " << e.what());
+        }
+        if (destination_so_file.Exists())
+        {
+            // Another job built this model while we were waiting
+            return;
+        }
+    }
+
+    // Try the conversion
+    try
+    {
+        // Create a temporary folder within heart/dynamic
+        std::stringstream folder_name;
+        folder_name << "dynamic/tmp_" << getpid() << "_" << time(NULL);
 
 #ifdef CHASTE_CMAKE ///todo: #2656 - ignoring all cmake-specific code, revise after cmake transition
 #define COVERAGE_IGNORE
-            tmp_folder.SetPath(component_dir.GetAbsolutePath() + "/" + folder_name.str(), RelativeTo::Absolute);
-            build_folder.SetPath(component_dir.GetAbsolutePath() + "/" + folder_name.str(), RelativeTo::Absolute);
+        tmp_folder.SetPath(component_dir.GetAbsolutePath() + "/" + folder_name.str(), RelativeTo::Absolute);
+        build_folder.SetPath(component_dir.GetAbsolutePath() + "/" + folder_name.str(), RelativeTo::Absolute);
 #undef COVERAGE_IGNORE
 #else
-            tmp_folder.SetPath(component_dir.GetAbsolutePath() + "/" + folder_name.str(), RelativeTo::Absolute);
-            build_folder.SetPath(component_dir.GetAbsolutePath() + "/build/" + ChasteBuildDirName() + "/" + folder_name.str(), RelativeTo::Absolute);
+        tmp_folder.SetPath(component_dir.GetAbsolutePath() + "/" + folder_name.str(), RelativeTo::Absolute);
+        build_folder.SetPath(component_dir.GetAbsolutePath() + "/build/" + ChasteBuildDirName() + "/" + folder_name.str(), RelativeTo::Absolute);
 #endif
 
-            int ret = mkdir((tmp_folder.GetAbsolutePath()).c_str(), 0700);
-            if (ret != 0)
-            {
-                EXCEPTION("Failed to create temporary folder '" << tmp_folder.GetAbsolutePath() << "' for CellML conversion: "
-                          << strerror(errno));
-            }
+        int ret = mkdir((tmp_folder.GetAbsolutePath()).c_str(), 0700);
+        if (ret != 0)
+        {
+            EXCEPTION("Failed to create temporary folder '" << tmp_folder.GetAbsolutePath() << "' for CellML conversion: "
+                      << strerror(errno));
+        }
 
-            // Copy the .cellml file (and any relevant others) into the temporary folder
-            FileFinder cellml_file(rCellmlFullPath, RelativeTo::Absolute);
-            FileFinder cellml_folder = cellml_file.GetParent();
-            std::string cellml_leaf_name = cellml_file.GetLeafNameNoExtension();
-            std::vector<FileFinder> cellml_files = cellml_folder.FindMatches(cellml_leaf_name + "*");
+        // Copy the .cellml file (and any relevant others) into the temporary folder
+        FileFinder cellml_folder = cellml_file.GetParent();
+        std::vector<FileFinder> cellml_files = cellml_folder.FindMatches(cellml_leaf_name + "*");
 
-            BOOST_FOREACH(const FileFinder& r_cellml_file, cellml_files)
-            {
-                r_cellml_file.CopyTo(tmp_folder);
-            }
+        BOOST_FOREACH(const FileFinder& r_cellml_file, cellml_files)
+        {
+            r_cellml_file.CopyTo(tmp_folder);
+        }
 
 #ifdef CHASTE_CMAKE ///todo: #2656 - ignoring all cmake-specific code, revise after cmake transition
 #define COVERAGE_IGNORE
-            std::string cmake_lists_filename = tmp_folder.GetAbsolutePath() + "/CMakeLists.txt";
-            std::ofstream cmake_lists_filestream(cmake_lists_filename.c_str());
-            cmake_lists_filestream << "cmake_minimum_required(VERSION 2.8.10)\n" <<
-                                      "find_package(Chaste COMPONENTS " << mComponentName << ")\n" <<
-                                      "chaste_do_cellml(sources " << cellml_file.GetAbsolutePath() << " " << "ON)\n" <<
-                                      "set(CMAKE_LIBRARY_OUTPUT_DIRECTORY ${CMAKE_BINARY_DIR})\n" <<
-                                      "include_directories(${Chaste_THIRD_PARTY_INCLUDE_DIRS} ${Chaste_INCLUDE_DIRS})\n" <<
-                                      "add_library(" << cellml_leaf_name << " SHARED " << "${sources})\n" <<
-                                      "if (${CMAKE_SYSTEM_NAME} MATCHES \"Darwin\")\n" <<
-                                      "   target_link_libraries(" << cellml_leaf_name << " \"-Wl,-undefined,dynamic_lookup\")\n" <<
-                                      "endif()\n"
-                                      //"target_link_libraries(" << cellml_leaf_name << " ${Chaste_LIBRARIES})\n"
-                                      ;
-            cmake_lists_filestream.close();
-            std::string cmake_args = " -DCMAKE_PREFIX_PATH=" + chaste_root.GetAbsolutePath() +
-                                     " -DCMAKE_BUILD_TYPE=" + ChasteBuildType() +
-                                     " -DChaste_ENABLE_TESTING=OFF" +
-                                     " -DBUILD_SHARED_LIBS=ON";
-            EXPECT0(chdir, tmp_folder.GetAbsolutePath());
-            EXPECT0(system, "cmake" + cmake_args + " .");
-            EXPECT0(system, "cmake --build . --config " + ChasteBuildType());
+        std::string cmake_lists_filename = tmp_folder.GetAbsolutePath() + "/CMakeLists.txt";
+        std::ofstream cmake_lists_filestream(cmake_lists_filename.c_str());
+        cmake_lists_filestream << "cmake_minimum_required(VERSION 2.8.10)\n" <<
+                                  "find_package(Chaste COMPONENTS " << mComponentName << ")\n" <<
+                                  "chaste_do_cellml(sources " << cellml_file.GetAbsolutePath() << " " << "ON)\n" <<
+                                  "set(CMAKE_LIBRARY_OUTPUT_DIRECTORY ${CMAKE_BINARY_DIR})\n" <<
+                                  "include_directories(${Chaste_THIRD_PARTY_INCLUDE_DIRS} ${Chaste_INCLUDE_DIRS})\n" <<
+                                  "add_library(" << cellml_leaf_name << " SHARED " << "${sources})\n" <<
+                                  "if (${CMAKE_SYSTEM_NAME} MATCHES \"Darwin\")\n" <<
+                                  "   target_link_libraries(" << cellml_leaf_name << " \"-Wl,-undefined,dynamic_lookup\")\n" <<
+                                  "endif()\n"
+                                  //"target_link_libraries(" << cellml_leaf_name << " ${Chaste_LIBRARIES})\n"
+                                  ;
+        cmake_lists_filestream.close();
+        std::string cmake_args = " -DCMAKE_PREFIX_PATH=" + chaste_root.GetAbsolutePath() +
+                                 " -DCMAKE_BUILD_TYPE=" + ChasteBuildType() +
+                                 " -DChaste_ENABLE_TESTING=OFF" +
+                                 " -DBUILD_SHARED_LIBS=ON";
+        EXPECT0(chdir, tmp_folder.GetAbsolutePath());
+        EXPECT0(system, "cmake" + cmake_args + " .");
+        EXPECT0(system, "cmake --build . --config " + ChasteBuildType());
 #undef COVERAGE_IGNORE
 #else
-            // Change to Chaste source folder
-            EXPECT0(chdir, chaste_root.GetAbsolutePath());
-            // Run scons to generate C++ code and compile it to a .so
-            EXPECT0(system, "scons --warn=no-all dyn_libs_only=1 build=" + ChasteBuildType() + " " + tmp_folder.GetAbsolutePath());
+        // Change to Chaste source folder
+        EXPECT0(chdir, chaste_root.GetAbsolutePath());
+        // Run scons to generate C++ code and compile it to a .so
+        EXPECT0(system, "scons --warn=no-all dyn_libs_only=1 build=" + ChasteBuildType() + " " + tmp_folder.GetAbsolutePath());
 #endif
 
-            FileFinder so_file(tmp_folder.GetAbsolutePath() + "/lib" + cellml_leaf_name + "." + msSoSuffix, RelativeTo::Absolute);
-            EXCEPT_IF_NOT(so_file.Exists());
-            // CD back
-            EXPECT0(chdir, old_cwd);
+        FileFinder so_file(tmp_folder.GetAbsolutePath() + "/lib" + cellml_leaf_name + "." + msSoSuffix, RelativeTo::Absolute);
+        EXCEPT_IF_NOT(so_file.Exists());
+        // CD back
+        EXPECT0(chdir, old_cwd);
 
-            // Copy the .so to the same folder as the original .cellml file
-            FileFinder destination_folder(rCellmlFolder, RelativeTo::Absolute);
+        // Copy the .so to the destination folder (normally that containing the original .cellml file)
+        FileFinder destination_folder(destination_path, RelativeTo::Absolute);
+        if (isCacheEntry)
+        {
+            // Other jobs may load from the cache without taking the lock, so the library
+            // must appear there atomically
+            FileFinder partial_so_file(destination_so_file.GetAbsolutePath() + ".partial", RelativeTo::Absolute);
+            so_file.CopyTo(partial_so_file);
+            if (rename(partial_so_file.GetAbsolutePath().c_str(), destination_so_file.GetAbsolutePath().c_str()) != 0)
+            {
+                EXCEPTION("Failed to move shared library into CellML cache entry '" << destination_path << "': "
+                          << strerror(errno));
+            }
+        }
+        else
+        {
             so_file.CopyTo(destination_folder);
+        }
 
-            if (mPreserveGeneratedSources)
+        if (mPreserveGeneratedSources)
+        {
+            // Copy generated source code as well
+            std::vector<FileFinder> generated_files = build_folder.FindMatches("*.?pp");
+            BOOST_FOREACH(const FileFinder& r_generated_file, generated_files)
             {
-                // Copy generated source code as well
-                std::vector<FileFinder> generated_files = build_folder.FindMatches("*.?pp");
-                BOOST_FOREACH(const FileFinder& r_generated_file, generated_files)
-                {
-                    r_generated_file.CopyTo(destination_folder);
-                }
+                r_generated_file.CopyTo(destination_folder);
             }
-            // Delete the temporary folders
-            build_folder.DangerousRemove();
-            tmp_folder.DangerousRemove();
         }
+        // Delete the temporary folders
+        build_folder.DangerousRemove();
+        tmp_folder.DangerousRemove();
     }
     catch (Exception& e)
     {
-        PetscTools::ReplicateException(true);
         if (tmp_folder.IsPathSet() && tmp_folder.Exists())
         {
             if (mPreserveGeneratedSources)
             {
                 // Copy any temporary files
-                IGNORE_EXCEPTIONS(build_folder.CopyTo(FileFinder(rCellmlFolder + "/build/", RelativeTo::Absolute)));
-                IGNORE_EXCEPTIONS(tmp_folder.CopyTo(FileFinder(rCellmlFolder + "/tmp/", RelativeTo::Absolute)));
+                IGNORE_EXCEPTIONS(build_folder.CopyTo(FileFinder(destination_path + "/build/", RelativeTo::Absolute)));
+                IGNORE_EXCEPTIONS(tmp_folder.CopyTo(FileFinder(destination_path + "/tmp/", RelativeTo::Absolute)));
             }
             // Delete the temporary folders
             IGNORE_EXCEPTIONS(build_folder.DangerousRemove()); // rm -r under source
             IGNORE_EXCEPTIONS(tmp_folder.DangerousRemove()); // rm -r under source
         }
         IGNORE_RET(chdir, old_cwd);
-        EXCEPTION("Conversion of CellML to Chaste shared object failed. Error was: " + e.GetMessage());
+        throw;
     }
-    // This also has the effect of a barrier, ensuring all processes wait for the
-    // shared library to be created.
-    PetscTools::ReplicateException(false);
 }
 
 void CellMLToSharedLibraryConverter::CreateOptionsFile(const OutputFileHandler& rHandler,
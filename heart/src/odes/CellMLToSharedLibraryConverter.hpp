@@ -80,6 +80,44 @@ public:
     DynamicCellModelLoaderPtr Convert(const FileFinder& rFilePath,
                                       bool isCollective=true);
 
+    /**
+     * @return loaders for several models at once.  Each file is treated as for
+     * the single-file Convert() method, but any .cellml files needing to be
+     * compiled are shared out between the processes and built concurrently
+     * (when building with CMake; SCons builds are always done by the master
+     * process, since SCons cannot safely run more than once in the same tree).
+     *
+     * @param rFilePaths  the models to load
+     *
+     * @note Must be called collectively.
+     */
+    std::vector<DynamicCellModelLoaderPtr> Convert(const std::vector<FileFinder>& rFilePaths);
+
+    /**
+     * Use a persistent cache of compiled models.
+     *
+     * Once this is set, a .cellml file is compiled into a sub-folder of the
+     * cache whose name is derived from a hash of the CellML file (together
+     * with any options file and other files sharing its name prefix, which
+     * are copied into the build), the component name, and the Chaste build
+     * configuration.  Subsequent conversions of the same model, in this or
+     * any later run, load the cached shared library at once.  Builds into
+     * the cache hold a file lock on the cache entry, so concurrent jobs may
+     * safely share a cache folder; the shared library is moved into place
+     * atomically once complete.
+     *
+     * @param rCacheFolder  the cache folder (created if it does not exist)
+     */
+    void SetCacheFolder(const FileFinder& rCacheFolder);
+
+    /**
+     * @return the folder within the cache in which the given .cellml file
+     * would be compiled.  Throws if no cache folder has been set.
+     *
+     * @param rCellmlFile  the model
+     */
+    FileFinder GetCacheEntryFolder(const FileFinder& rCellmlFile) const;
+
     /**
      * Create a PyCml options file for the given model.
      *
@@ -105,12 +143,50 @@ private:
     void ConvertCellmlToSo(const std::string& rCellmlFullPath,
                            const std::string& rCellmlFolder);
 
+    /**
+     * Check that the Chaste build tree and the required component exist,
+     * throwing if not.
+     */
+    void CheckBuildTreeExists() const;
+
+    /**
+     * Compile a .cellml file to a .so on this process alone.  If anything goes
+     * wrong, any temporary files are removed and the exception re-thrown.
+     *
+     * @param rCellmlFullPath  full path to the .cellml file
+     * @param rDestinationFolder  folder in which to put the .so, with trailing slash
+     * @param isCacheEntry  whether rDestinationFolder is a cache entry, in which case the
+     *     entry is locked during the build, and the build skipped if another process has
+     *     already filled it
+     */
+    void BuildSharedLibrary(const std::string& rCellmlFullPath,
+                            const std::string& rDestinationFolder,
+                            bool isCacheEntry);
+
+    /**
+     * @return where the .so for a .cellml file will be: next to the .cellml file,
+     * or in the cache if one is in use.
+     *
+     * @param rCellmlFile  the model
+     */
+    FileFinder GetSoFileForCellml(const FileFinder& rCellmlFile) const;
+
+    /**
+     * @return whether the .so for a .cellml file needs to be (re)built.
+     *
+     * @param rCellmlFile  the model
+     */
+    bool SoNeedsBuilding(const FileFinder& rCellmlFile) const;
+
     /** Whether to save copies of generated C++ source files. */
     bool mPreserveGeneratedSources;
 
     /** Which component to build the loadable module in. */
     std::string mComponentName;
 
+    /** The persistent cache of compiled models, if one is in use. */
+    FileFinder mCacheFolder;
+
     /** The .so suffix is nearly always "so" (as you might expect).  On Mac OSX this is redefined to "dylib" */
     static const std::string msSoSuffix;
 };
@@ -36,7 +36,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "VoltageInterpolaterOntoMechanicsMesh.hpp"
 #include "Hdf5ToCmguiConverter.hpp"
 #include "FineCoarseMeshPair.hpp"
-#include "ReplicatableVector.hpp"
+#include "FineCoarseInterpolationMatrix.hpp"
 #include "HeartConfig.hpp"
 #include "Hdf5DataReader.hpp"
 #include "PetscTools.hpp"
@@ -84,8 +84,11 @@ VoltageInterpolaterOntoMechanicsMesh<DIM>::VoltageInterpolaterOntoMechanicsMesh(
     // set up a vector to read into
     DistributedVectorFactory factory(rElectricsMesh.GetNumNodes());
     Vec voltage = factory.CreateVec();
-    std::vector<double> interpolated_voltages(rMechanicsMesh.GetNumNodes());
-    Vec voltage_coarse = NULL;
+
+    // assemble the interpolation once, with the output distributed as the writer expects
+    DistributedVectorFactory* p_mechanics_factory = rMechanicsMesh.GetDistributedVectorFactory();
+    FineCoarseInterpolationMatrix<DIM> interpolation_matrix(mesh_pair, &factory, 1, p_mechanics_factory->GetLocalOwnership());
+    Vec voltage_coarse = p_mechanics_factory->CreateVec();
 
     for(unsigned time_step=0; time_step<num_timesteps; time_step++)
     {
@@ -94,28 +97,10 @@ VoltageInterpolaterOntoMechanicsMesh<DIM>::VoltageInterpolaterOntoMechanicsMesh(
             std::string var_name = rVariableNames[var_index];
             // read
             reader.GetVariableOverNodes(voltage, var_name, time_step);
-            ReplicatableVector voltage_repl(voltage);
 
             // interpolate
-            for(unsigned i=0; i<mesh_pair.rGetElementsAndWeights().size(); i++)
-            {
-                double interpolated_voltage = 0;
-
-                Element<DIM,DIM>& element = *(rElectricsMesh.GetElement(mesh_pair.rGetElementsAndWeights()[i].ElementNum));
-                for(unsigned node_index = 0; node_index<element.GetNumNodes(); node_index++)
-                {
-                    unsigned global_node_index = element.GetNodeGlobalIndex(node_index);
-                    interpolated_voltage += voltage_repl[global_node_index]*mesh_pair.rGetElementsAndWeights()[i].Weights(node_index);
-                }
-
-                interpolated_voltages[i] = interpolated_voltage;
-            }
-
-            if(voltage_coarse!=NULL)
-            {
-                PetscTools::Destroy(voltage_coarse);
-            }
-            voltage_coarse = PetscTools::CreateVec(interpolated_voltages);
+            interpolation_matrix.Interpolate(voltage, voltage_coarse);
+
             // write
             p_writer->PutVector(columns_id[var_index], voltage_coarse);
         }
@@ -123,11 +108,8 @@ VoltageInterpolaterOntoMechanicsMesh<DIM>::VoltageInterpolaterOntoMechanicsMesh(
         p_writer->AdvanceAlongUnlimitedDimension();
     }
 
-    if(voltage_coarse!=NULL)
-    {
-        PetscTools::Destroy(voltage);
-        PetscTools::Destroy(voltage_coarse);
-    }
+    PetscTools::Destroy(voltage);
+    PetscTools::Destroy(voltage_coarse);
 
     // delete to flush
     delete p_writer;
@@ -40,6 +40,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Exception.hpp"
 #include "DistributedVector.hpp"
 #include "ReplicatableVector.hpp"
+#include "NestedMeshMultigridPreconditioner.hpp"
 
 template <unsigned DIM>
 void BidomainProblem<DIM>::AnalyseMeshForBath()
@@ -151,6 +152,12 @@ AbstractDynamicLinearPdeSolver<DIM, DIM, 2>* BidomainProblem<DIM>::CreateSolver(
     {
         mpSolver->SetFixedExtracellularPotentialNodes(mFixedExtracellularPotentialNodes);
         mpSolver->SetRowForAverageOfPhiZeroed(mRowForAverageOfPhiZeroed);
+        if (!mPhiEMultigridCoarseMeshes.empty())
+        {
+            boost::shared_ptr<GeometricMultigridPreconditioner> p_multigrid(
+                new NestedMeshMultigridPreconditioner<DIM>(mPhiEMultigridCoarseMeshes, *(this->mpMesh)));
+            mpSolver->SetPhiEMultigridPreconditioner(p_multigrid);
+        }
     }
     catch (const Exception& e)
     {
@@ -201,6 +208,12 @@ void BidomainProblem<DIM>::SetNodeForAverageOfPhiZeroed(unsigned node)
     mRowForAverageOfPhiZeroed = 2*node+1;
 }
 
+template<unsigned DIM>
+void BidomainProblem<DIM>::SetPhiEMultigridCoarseMeshes(std::vector<TetrahedralMesh<DIM,DIM>*> coarseMeshes)
+{
+    mPhiEMultigridCoarseMeshes = coarseMeshes;
+}
+
 template<unsigned DIM>
 BidomainTissue<DIM>* BidomainProblem<DIM>::GetBidomainTissue()
 {
@@ -52,6 +52,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "BidomainTissue.hpp"
 #include "HeartRegionCodes.hpp"
 #include "DistributedTetrahedralMesh.hpp"
+#include "TetrahedralMesh.hpp"
 
 /**
  * Class which specifies and solves a bidomain problem.
@@ -134,6 +135,12 @@ protected:
     /** Electrodes used to provide a shock */
     boost::shared_ptr<Electrodes<DIM> > mpElectrodes;
 
+    /**
+     * Coarse meshes (coarsest first) for geometric multigrid on the phi_e block,
+     * if the user wants it.  Not owned, and not archived.
+     */
+    std::vector<TetrahedralMesh<DIM,DIM>*> mPhiEMultigridCoarseMeshes;
+
     /**
      *  Create normal initial condition but overwrite V to zero for bath nodes, if
      *  there are any.
@@ -198,6 +205,17 @@ public:
      */
     void SetNodeForAverageOfPhiZeroed(unsigned node);
 
+    /**
+     * Precondition the extracellular potential block with geometric multigrid on a hierarchy
+     * of meshes, rather than AMG.  Only used with the "blockdiagonal" and "ldufactorisation"
+     * KSP preconditioners, and must be called before Initialise() (and again after loading
+     * from an archive, since the meshes are not archived).
+     *
+     * @param coarseMeshes  coarser meshes covering the same domain as the problem mesh, coarsest first.
+     *     These must exist for the lifetime of the problem.
+     */
+    void SetPhiEMultigridCoarseMeshes(std::vector<TetrahedralMesh<DIM,DIM>*> coarseMeshes);
+
     /**
      *  @return the pde. Can only be called after Initialise()
      */
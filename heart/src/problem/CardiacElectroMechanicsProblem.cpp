@@ -37,6 +37,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "OutputFileHandler.hpp"
 #include "ReplicatableVector.hpp"
+#include "DistributedVector.hpp"
 #include "HeartConfig.hpp"
 #include "LogFile.hpp"
 #include "ChastePoint.hpp"
@@ -269,6 +270,9 @@ CardiacElectroMechanicsProblem<DIM,ELEC_PROB_DIM>::CardiacElectroMechanicsProble
         mpProblemDefinition(pProblemDefinition),
         mHasBath(false),
         mpMeshPair(NULL),
+        mpCalciumInterpolationMatrix(NULL),
+        mpVoltageInterpolationMatrix(NULL),
+        mpStretchInterpolationMatrix(NULL),
         mNoElectricsOutput(false),
         mIsWatchedLocation(false),
         mWatchedElectricsNodeIndex(UNSIGNED_UNSET),
@@ -336,6 +340,9 @@ CardiacElectroMechanicsProblem<DIM,ELEC_PROB_DIM>::~CardiacElectroMechanicsProbl
 
     delete mpElectricsProblem;
     delete mpCardiacMechSolver;
+    delete mpCalciumInterpolationMatrix;
+    delete mpVoltageInterpolationMatrix;
+    delete mpStretchInterpolationMatrix;
     delete mpMeshPair;
 
     LogFile::Close();
@@ -435,6 +442,11 @@ void CardiacElectroMechanicsProblem<DIM,ELEC_PROB_DIM>::Initialise()
     mInterpolatedCalciumConcs.assign(num_quad_points, 0.0);
     mInterpolatedVoltages.assign(num_quad_points, 0.0);
 
+    // Assemble the electrics-to-mechanics interpolation once, so each coupling step is a matrix-vector product
+    DistributedVectorFactory* p_electrics_factory = mpElectricsMesh->GetDistributedVectorFactory();
+    mpCalciumInterpolationMatrix = new FineCoarseInterpolationMatrix<DIM>(*mpMeshPair, p_electrics_factory);
+    mpVoltageInterpolationMatrix = new FineCoarseInterpolationMatrix<DIM>(*mpMeshPair, p_electrics_factory, ELEC_PROB_DIM);
+
     if(mpProblemDefinition->ReadFibreSheetDirectionsFromFile())
     {
        mpCardiacMechSolver->SetVariableFibreSheetDirections(mpProblemDefinition->GetFibreSheetDirectionsFile(),
@@ -464,6 +476,9 @@ void CardiacElectroMechanicsProblem<DIM,ELEC_PROB_DIM>::Initialise()
         // mechanics solve electrics cell models
         mpMeshPair->ComputeCoarseElementsForFineNodes(false);
 
+        mpStretchInterpolationMatrix = new FineCoarseInterpolationMatrix<DIM>(mpMeshPair->rGetCoarseElementsForFineNodes(),
+                                                                              mpMechanicsMesh->GetNumElements(),
+                                                                              mpElectricsMesh->GetDistributedVectorFactory());
     }
 
     if(mpProblemDefinition->GetDeformationAffectsConductivity())
@@ -682,15 +697,23 @@ void CardiacElectroMechanicsProblem<DIM,ELEC_PROB_DIM>::Solve()
 
         if( mpProblemDefinition->GetDeformationAffectsCellModels() )
         {
-            //  Set the stretches on each of the cell models
-            for(unsigned global_index = mpElectricsMesh->GetDistributedVectorFactory()->GetLow();
-                         global_index < mpElectricsMesh->GetDistributedVectorFactory()->GetHigh();
-                         global_index++)
+            //  Set the stretches on each of the cell models, using the stretch in the containing mechanics element
+            DistributedVectorFactory* p_electrics_factory = mpElectricsMesh->GetDistributedVectorFactory();
+            Vec element_stretches = PetscTools::CreateVec(mStretchesForEachMechanicsElement);
+            Vec node_stretches = p_electrics_factory->CreateVec();
+            mpStretchInterpolationMatrix->Interpolate(element_stretches, node_stretches);
+
             {
-                unsigned containing_elem = mpMeshPair->rGetCoarseElementsForFineNodes()[global_index];
-                double stretch = mStretchesForEachMechanicsElement[containing_elem];
-                mpElectricsProblem->GetTissue()->GetCardiacCell(global_index)->SetStretch(stretch);
+                DistributedVector distributed_node_stretches = p_electrics_factory->CreateDistributedVector(node_stretches, true);
+                for (DistributedVector::Iterator index = distributed_node_stretches.Begin();
+                     index != distributed_node_stretches.End();
+                     ++index)
+                {
+                    mpElectricsProblem->GetTissue()->GetCardiacCell(index.Global)->SetStretch(distributed_node_stretches[index]);
+                }
             }
+            PetscTools::Destroy(element_stretches);
+            PetscTools::Destroy(node_stretches);
         }
 
         p_electrics_solver->SetTimeStep(HeartConfig::Instance()->GetPdeTimeStep());
@@ -754,34 +777,15 @@ void CardiacElectroMechanicsProblem<DIM,ELEC_PROB_DIM>::Solve()
                 VecSetValue(calcium_data, node_index ,calcium_value, INSERT_VALUES);
             }
         }
-        PetscTools::Barrier();//not sure this is needed
-
-        //Replicate electrics solution and calcium (replication is inside this constructor of ReplicatableVector)
-        ReplicatableVector electrics_solution_repl(electrics_solution);//size=(number of electrics nodes)*ELEC_PROB_DIM
-        ReplicatableVector calcium_repl(calcium_data);//size = number of electrics nodes
-
-        //interpolate values onto mechanics mesh
-        for(unsigned i=0; i<mpMeshPair->rGetElementsAndWeights().size(); i++)
-        {
-            double interpolated_CaI = 0;
-            double interpolated_voltage = 0;
+        VecAssemblyBegin(calcium_data);
+        VecAssemblyEnd(calcium_data);
 
-            Element<DIM,DIM>& element = *(mpElectricsMesh->GetElement(mpMeshPair->rGetElementsAndWeights()[i].ElementNum));
-
-            for(unsigned node_index = 0; node_index<element.GetNumNodes(); node_index++)
-            {
-                unsigned global_index = element.GetNodeGlobalIndex(node_index);
-                double CaI_at_node =  calcium_repl[global_index];
-                interpolated_CaI += CaI_at_node*mpMeshPair->rGetElementsAndWeights()[i].Weights(node_index);
-                //the following line assumes interleaved solution for ELEC_PROB_DIM>1 (e.g, [Vm_0, phi_e_0, Vm1, phi_e_1...])
-                interpolated_voltage += electrics_solution_repl[global_index*ELEC_PROB_DIM]*mpMeshPair->rGetElementsAndWeights()[i].Weights(node_index);
-            }
-
-            assert(i<mInterpolatedCalciumConcs.size());
-            assert(i<mInterpolatedVoltages.size());
-            mInterpolatedCalciumConcs[i] = interpolated_CaI;
-            mInterpolatedVoltages[i] = interpolated_voltage;
-        }
+        // Interpolate values onto the mechanics quadrature points. Only the electrics values needed
+        // by this process's rows are communicated; the (smaller) interpolated vectors are replicated.
+        // This assumes an interleaved solution for ELEC_PROB_DIM>1 (e.g, [Vm_0, phi_e_0, Vm1, phi_e_1...])
+        mpCalciumInterpolationMatrix->Interpolate(calcium_data, mInterpolatedCalciumConcs);
+        mpVoltageInterpolationMatrix->Interpolate(electrics_solution, mInterpolatedVoltages);
+        assert(mInterpolatedCalciumConcs.size() == mpMeshPair->rGetElementsAndWeights().size());
 
         LOG(2, "  Setting Ca_I. max value = " << Max(mInterpolatedCalciumConcs));
 
@@ -836,6 +840,8 @@ void CardiacElectroMechanicsProblem<DIM,ELEC_PROB_DIM>::Solve()
         MechanicsEventHandler::EndEvent(MechanicsEventHandler::ALL_MECH);
 
         LOG(2, "    Number of newton iterations = " << mpMechanicsSolver->GetNumNewtonIterations());
+        LOG(2, "    Jacobian assemblies (total) = " << mpMechanicsSolver->GetNumJacobianAssemblies()
+                << ", saved by re-use = " << mpMechanicsSolver->GetNumJacobianAssembliesSaved());
 
          // update the current time
         stepper.AdvanceOneTimeStep();
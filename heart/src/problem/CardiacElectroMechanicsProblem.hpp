@@ -49,6 +49,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "AbstractCardiacMechanicsSolver.hpp"
 #include "AbstractCardiacMechanicsSolverInterface.hpp"
 #include "FineCoarseMeshPair.hpp"
+#include "FineCoarseInterpolationMatrix.hpp"
 #include "AbstractConductivityModifier.hpp"
 #include "ElectroMechanicsProblemDefinition.hpp"
 
@@ -143,6 +144,24 @@ protected :
     /** Class wrapping both meshes, useful for transferring information */
     FineCoarseMeshPair<DIM>* mpMeshPair;
 
+    /**
+     * Sparse operator, assembled in Initialise(), interpolating the calcium concentration at the
+     * electrics nodes onto the mechanics quadrature points.
+     */
+    FineCoarseInterpolationMatrix<DIM>* mpCalciumInterpolationMatrix;
+
+    /**
+     * Sparse operator, assembled in Initialise(), interpolating the voltage in the (interleaved,
+     * if ELEC_PROB_DIM>1) electrics solution onto the mechanics quadrature points.
+     */
+    FineCoarseInterpolationMatrix<DIM>* mpVoltageInterpolationMatrix;
+
+    /**
+     * Sparse operator taking the stretch in each mechanics element to the electrics nodes.
+     * Only assembled if the deformation affects the cell models.
+     */
+    FineCoarseInterpolationMatrix<DIM>* mpStretchInterpolationMatrix;
+
     /** Output directory, relative to TEST_OUTPUT */
     std::string mOutputDirectory;
     /** Deformation output-sub-directory */
@@ -217,7 +217,8 @@ HeartConfig::HeartConfig()
     : mUseMassLumping(false),
       mUseMassLumpingForPrecond(false),
       mUseFixedNumberIterations(false),
-      mEvaluateNumItsEveryNSolves(UINT_MAX)
+      mEvaluateNumItsEveryNSolves(UINT_MAX),
+      mUseCompactConductivityTensors(false)
 {
     assert(mpInstance.get() == NULL);
     mUseFixedSchemaLocation = true;
@@ -2917,6 +2918,16 @@ bool HeartConfig::GetUseReactionDiffusionOperatorSplitting()
     return mUseReactionDiffusionOperatorSplitting;
 }
 
+void HeartConfig::SetUseCompactConductivityTensors(bool useCompactTensors)
+{
+    mUseCompactConductivityTensors = useCompactTensors;
+}
+
+bool HeartConfig::GetUseCompactConductivityTensors()
+{
+    return mUseCompactConductivityTensors;
+}
+
 void HeartConfig::SetUseFixedNumberIterationsLinearSolver(bool useFixedNumberIterations, unsigned evaluateNumItsEveryNSolves)
 {
     mUseFixedNumberIterations = useFixedNumberIterations;
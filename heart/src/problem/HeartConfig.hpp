@@ -125,6 +125,10 @@ private:
             archive & mUseFixedNumberIterations;
             archive & mEvaluateNumItsEveryNSolves;
         }
+        if (version > 2)
+        {
+            archive & mUseCompactConductivityTensors;
+        }
 
         PetscTools::Barrier("HeartConfig::save");
     }
@@ -159,6 +163,10 @@ private:
             archive & mUseFixedNumberIterations;
             archive & mEvaluateNumItsEveryNSolves;
         }
+        if (version > 2)
+        {
+            archive & mUseCompactConductivityTensors;
+        }
     }
     BOOST_SERIALIZATION_SPLIT_MEMBER()
 
@@ -759,6 +767,12 @@ public:
      */
     unsigned GetEvaluateNumItsEveryNSolves();
 
+    /**
+     *  @return whether conductivity tensors should be stored compactly (see
+     *  Set method documentation).
+     */
+    bool GetUseCompactConductivityTensors();
+
 
     ///////////////////////////////////////////////////////////////
     //
@@ -1189,6 +1203,17 @@ public:
      */
     void SetUseFixedNumberIterationsLinearSolver(bool useFixedNumberIterations = true, unsigned evaluateNumItsEveryNSolves=UINT_MAX);
 
+    /**
+     * Store per-element conductivity tensors compactly: only the fibre (and sheet) directions
+     * are kept, in single precision, and each tensor is formed when the assembler asks for it.
+     * This greatly reduces memory use on large meshes with fibre orientation, at the cost of
+     * tensors that are only accurate to single precision.
+     * See AbstractConductivityTensors::SetUseCompactStorage().
+     *
+     * @param useCompactTensors  Whether to use compact storage (defaults to true)
+     */
+    void SetUseCompactConductivityTensors(bool useCompactTensors = true);
+
     /**
      * @return whether HeartConfig has a drug concentration and any IC50s set up
      */
@@ -1364,6 +1389,11 @@ private:
      */
     unsigned mEvaluateNumItsEveryNSolves;
 
+    /**
+     * Whether to store conductivity tensors compactly (see SetUseCompactConductivityTensors()).
+     */
+    bool mUseCompactConductivityTensors;
+
     /**
      * CheckSimulationIsDefined is a convenience method for checking if the "<"Simulation">" element
      * has been defined and therefore is safe to use the Simulation().get() pointer to access
@@ -1388,7 +1418,7 @@ private:
 };
 
 
-BOOST_CLASS_VERSION(HeartConfig, 2)
+BOOST_CLASS_VERSION(HeartConfig, 3)
 #include "SerializationExportWrapper.hpp"
 // Declare identifier for the serializer
 CHASTE_CLASS_EXPORT(HeartConfig)
@@ -42,7 +42,9 @@ AbstractConductivityTensors<ELEMENT_DIM,SPACE_DIM>::AbstractConductivityTensors(
     : mpMesh(NULL),
       mUseNonConstantConductivities(false),
       mUseFibreOrientation(false),
-      mInitialised(false)
+      mInitialised(false),
+      mUseCompactStorage(false),
+      mNumCompactDirections(0u)
 {
     double init_data[]={DBL_MAX, DBL_MAX, DBL_MAX};
 
@@ -108,7 +110,58 @@ void AbstractConductivityTensors<ELEMENT_DIM,SPACE_DIM>::SetNonConstantConductiv
 }
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
-c_matrix<double,SPACE_DIM,SPACE_DIM>& AbstractConductivityTensors<ELEMENT_DIM,SPACE_DIM>::operator[](const unsigned global_index)
+void AbstractConductivityTensors<ELEMENT_DIM,SPACE_DIM>::SetUseCompactStorage(bool useCompactStorage)
+{
+    assert(!mInitialised);
+    mUseCompactStorage = useCompactStorage;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+bool AbstractConductivityTensors<ELEMENT_DIM,SPACE_DIM>::GetUseCompactStorage() const
+{
+    return mUseCompactStorage;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+std::vector<unsigned> AbstractConductivityTensors<ELEMENT_DIM,SPACE_DIM>::GetLocalElementIndices()
+{
+    std::vector<unsigned> local_element_indices;
+    local_element_indices.reserve(mpMesh->GetNumLocalElements());
+    for (typename AbstractTetrahedralMesh<ELEMENT_DIM,SPACE_DIM>::ElementIterator it = mpMesh->GetElementIteratorBegin();
+         it != mpMesh->GetElementIteratorEnd();
+         ++it)
+    {
+        local_element_indices.push_back(it->GetIndex());
+    }
+    return local_element_indices;
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void AbstractConductivityTensors<ELEMENT_DIM,SPACE_DIM>::AddCompactElement(const c_vector<double, SPACE_DIM>& rConductivities,
+                                                                         const c_matrix<double,SPACE_DIM,SPACE_DIM>& rOrientation,
+                                                                         unsigned numDirections)
+{
+    assert(mUseCompactStorage);
+    assert(numDirections < SPACE_DIM);
+    mNumCompactDirections = numDirections;
+    if (mUseFibreOrientation)
+    {
+        for (unsigned direction=0; direction<numDirections; direction++)
+        {
+            for (unsigned dim=0; dim<SPACE_DIM; dim++)
+            {
+                mCompactDirections.push_back(rOrientation(dim, direction));
+            }
+        }
+    }
+    if (mUseNonConstantConductivities)
+    {
+        mCompactConductivities.push_back(rConductivities);
+    }
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+c_matrix<double,SPACE_DIM,SPACE_DIM> AbstractConductivityTensors<ELEMENT_DIM,SPACE_DIM>::operator[](const unsigned global_index)
 {
     assert(mInitialised);
     if (global_index >= this->mpMesh->GetNumElements() )
@@ -123,7 +176,41 @@ c_matrix<double,SPACE_DIM,SPACE_DIM>& AbstractConductivityTensors<ELEMENT_DIM,SP
     else
     {
         unsigned local_index = mpMesh->SolveElementMapping(global_index); //This will throw if we don't own the element
-        return mTensors[local_index];
+        if (!mUseCompactStorage)
+        {
+            return mTensors[local_index];
+        }
+
+        const c_vector<double, SPACE_DIM>& r_conductivities = mUseNonConstantConductivities
+                                                              ? mCompactConductivities[local_index]
+                                                              : mConstantConductivities;
+        c_matrix<double,SPACE_DIM,SPACE_DIM> tensor;
+        if (!mUseFibreOrientation)
+        {
+            noalias(tensor) = zero_matrix<double>(SPACE_DIM, SPACE_DIM);
+            for (unsigned dim=0; dim<SPACE_DIM; dim++)
+            {
+                tensor(dim,dim) = r_conductivities[dim];
+            }
+            return tensor;
+        }
+
+        // g_k I + sum_{i<k} (g_i - g_k) a_i a_i^T; see AddCompactElement()
+        const unsigned k = mNumCompactDirections;
+        noalias(tensor) = r_conductivities[k] * identity_matrix<double>(SPACE_DIM);
+        for (unsigned direction=0; direction<k; direction++)
+        {
+            const float* p_a = &mCompactDirections[(local_index*k + direction)*SPACE_DIM];
+            double weight = r_conductivities[direction] - r_conductivities[k];
+            for (unsigned i=0; i<SPACE_DIM; i++)
+            {
+                for (unsigned j=0; j<SPACE_DIM; j++)
+                {
+                    tensor(i,j) += weight * p_a[i] * p_a[j];
+                }
+            }
+        }
+        return tensor;
     }
 }
 
@@ -77,6 +77,55 @@ protected:
     /** Fibre file reader */
     std::auto_ptr<FibreReader<SPACE_DIM> > mFileReader;
 
+    /**
+     * Whether to keep only the fibre directions (in single precision) and conductivities
+     * for each element, forming each tensor when it is requested, rather than storing
+     * a full tensor per element.  See SetUseCompactStorage().
+     */
+    bool mUseCompactStorage;
+
+    /**
+     * How many direction vectors per element are kept in #mCompactDirections: these are
+     * the leading columns of the orientation matrix, the last one being implied.
+     */
+    unsigned mNumCompactDirections;
+
+    /**
+     * In compact mode, the #mNumCompactDirections direction vectors of each local element,
+     * stored contiguously in single precision.
+     */
+    std::vector<float> mCompactDirections;
+
+    /**
+     * In compact mode with non-constant conductivities, a copy of the conductivities of
+     * each local element (the vector given to SetNonConstantConductivities() need not
+     * outlive Init()).
+     */
+    std::vector<c_vector<double, SPACE_DIM> > mCompactConductivities;
+
+    /**
+     * In compact mode, record what is needed to form the tensor of the next local element.
+     * Called by Init() in subclasses for each local element in turn.
+     *
+     * The tensor is A diag(g) A^T where A is the orientation matrix.  Since the columns of A
+     * are orthonormal, if the conductivities along the last SPACE_DIM-k columns are all equal
+     * to g_k then this is g_k I + sum_{i<k} (g_i - g_k) a_i a_i^T, so only the first k columns
+     * a_i need storing.
+     *
+     * @param rConductivities  the conductivities g along each direction of the element
+     * @param rOrientation  the orientation matrix A of the element
+     * @param numDirections  how many leading columns k of rOrientation to store
+     */
+    void AddCompactElement(const c_vector<double, SPACE_DIM>& rConductivities,
+                           const c_matrix<double,SPACE_DIM,SPACE_DIM>& rOrientation,
+                           unsigned numDirections);
+
+    /**
+     * @return the global indices of the elements owned by this process, in the order they
+     * are iterated over (used for reading the fibre file in one go).
+     */
+    std::vector<unsigned> GetLocalElementIndices();
+
 public:
 
     AbstractConductivityTensors();
@@ -124,6 +173,25 @@ public:
      */
     void SetNonConstantConductivities(std::vector<c_vector<double, SPACE_DIM> >* pNonConstantConductivities);
 
+    /**
+     * Keep only what is needed to form each element's tensor on demand: the fibre (and
+     * sheet) directions in single precision plus the element's conductivities, rather than
+     * a full double precision tensor.  This reduces the per-element memory from
+     * SPACE_DIM*SPACE_DIM doubles to (SPACE_DIM-1)*SPACE_DIM floats for orthotropic media
+     * (one direction for axisymmetric media), at the cost of a few flops per element on
+     * each access, and tensors that are only accurate to single precision.
+     *
+     * Only has an effect for per-element tensors.  Must be called before Init().
+     *
+     * @param useCompactStorage  whether to use compact storage
+     */
+    void SetUseCompactStorage(bool useCompactStorage=true);
+
+    /**
+     * @return whether compact storage is being used (see SetUseCompactStorage())
+     */
+    bool GetUseCompactStorage() const;
+
     /**
      *  Computes the tensors based in all the info set
      * @param pMesh a pointer to the mesh on which these tensors are to be used
@@ -131,11 +199,12 @@ public:
     virtual void Init(AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM> *pMesh) throw (Exception) = 0;
 
     /**
-     *  @return the diffussion tensor of the element number "index"
+     *  @return (a copy of) the diffussion tensor of the element number "index".  This is
+     *  returned by value since in compact mode the tensor is formed on each call.
      *
      *  @param global_index Global index of the element of the mesh
      */
-    c_matrix<double,SPACE_DIM,SPACE_DIM>& operator[](const unsigned global_index);
+    c_matrix<double,SPACE_DIM,SPACE_DIM> operator[](const unsigned global_index);
 };
 
 
@@ -83,6 +83,8 @@ void AxisymmetricConductivityTensors<ELEMENT_DIM, SPACE_DIM>::Init(AbstractTetra
         c_vector<double,SPACE_DIM> fibre_vector((zero_vector<double>(SPACE_DIM)));
         fibre_vector[0]=1.0;
 
+        std::vector<c_vector<double,SPACE_DIM> > local_fibre_vectors;
+
         if (this->mUseFibreOrientation)
         {
             // open file
@@ -91,6 +93,9 @@ void AxisymmetricConductivityTensors<ELEMENT_DIM, SPACE_DIM>::Init(AbstractTetra
             {
                 EXCEPTION("The size of the fibre file does not match the number of elements in the mesh");
             }
+
+            // Read the fibres for all our elements in one go (collectively, for binary files)
+            this->mFileReader->GetFibreVectors(this->GetLocalElementIndices(), local_fibre_vectors);
         }
 
         if (this->mUseNonConstantConductivities)
@@ -103,7 +108,16 @@ void AxisymmetricConductivityTensors<ELEMENT_DIM, SPACE_DIM>::Init(AbstractTetra
 
         // reserve() allocates all the memory at once, more efficient than relying
         // on the automatic reallocation scheme.
-        this->mTensors.reserve(this->mpMesh->GetNumLocalElements());
+        if (this->mUseCompactStorage)
+        {
+            // Only the fibre direction is needed; see AddCompactElement()
+            this->mCompactDirections.reserve(this->mUseFibreOrientation ? this->mpMesh->GetNumLocalElements()*SPACE_DIM : 0u);
+            this->mCompactConductivities.reserve(this->mUseNonConstantConductivities ? this->mpMesh->GetNumLocalElements() : 0u);
+        }
+        else
+        {
+            this->mTensors.reserve(this->mpMesh->GetNumLocalElements());
+        }
 
         c_matrix<double, SPACE_DIM, SPACE_DIM> conductivity_matrix(zero_matrix<double>(SPACE_DIM,SPACE_DIM));
 
@@ -156,18 +170,32 @@ void AxisymmetricConductivityTensors<ELEMENT_DIM, SPACE_DIM>::Init(AbstractTetra
 
             if (this->mUseFibreOrientation)
             {
-                unsigned current_fibre_global_index = it->GetIndex();
-                this->mFileReader->GetFibreVector(current_fibre_global_index, fibre_vector);
+                fibre_vector = local_fibre_vectors[local_element_index];
             }
 
-            this->mTensors.push_back( conductivity_matrix(1,1) * identity_matrix<double>(SPACE_DIM) +
-                                      (conductivity_matrix(0,0) - conductivity_matrix(1,1)) * outer_prod(fibre_vector,fibre_vector));
+            if (this->mUseCompactStorage)
+            {
+                c_vector<double, SPACE_DIM> conductivities;
+                c_matrix<double, SPACE_DIM, SPACE_DIM> orientation_matrix(zero_matrix<double>(SPACE_DIM,SPACE_DIM));
+                for (unsigned dim=0; dim<SPACE_DIM; dim++)
+                {
+                    // The transverse conductivity applies in every direction other than the fibre
+                    conductivities[dim] = (dim == 0 ? conductivity_matrix(0,0) : conductivity_matrix(1,1));
+                    orientation_matrix(dim,0) = fibre_vector[dim];
+                }
+                this->AddCompactElement(conductivities, orientation_matrix, 1u);
+            }
+            else
+            {
+                this->mTensors.push_back( conductivity_matrix(1,1) * identity_matrix<double>(SPACE_DIM) +
+                                          (conductivity_matrix(0,0) - conductivity_matrix(1,1)) * outer_prod(fibre_vector,fibre_vector));
+            }
 
             local_element_index++;
         }
 
-        assert(this->mTensors.size() == this->mpMesh->GetNumLocalElements());
-        assert(this->mTensors.size() == local_element_index);
+        assert(this->mUseCompactStorage || this->mTensors.size() == this->mpMesh->GetNumLocalElements());
+        assert(local_element_index == this->mpMesh->GetNumLocalElements());
 
         if (this->mUseFibreOrientation)
         {
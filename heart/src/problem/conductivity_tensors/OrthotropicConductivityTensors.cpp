@@ -57,6 +57,7 @@ void OrthotropicConductivityTensors<ELEMENT_DIM, SPACE_DIM>::Init(AbstractTetrah
     else
     {
         c_matrix<double,SPACE_DIM,SPACE_DIM> orientation_matrix((identity_matrix<double>(SPACE_DIM)));
+        std::vector<c_matrix<double,SPACE_DIM,SPACE_DIM> > local_orientation_matrices;
 
         if (this->mUseFibreOrientation)
         {
@@ -66,6 +67,9 @@ void OrthotropicConductivityTensors<ELEMENT_DIM, SPACE_DIM>::Init(AbstractTetrah
             {
                 EXCEPTION("The size of the fibre file does not match the number of elements in the mesh");
             }
+
+            // Read the fibres for all our elements in one go (collectively, for binary files)
+            this->mFileReader->GetFibreSheetAndNormalMatrices(this->GetLocalElementIndices(), local_orientation_matrices);
         }
 
         if (this->mUseNonConstantConductivities)
@@ -78,7 +82,16 @@ void OrthotropicConductivityTensors<ELEMENT_DIM, SPACE_DIM>::Init(AbstractTetrah
 
         // reserve() allocates all the memory at once, more efficient than relying
         // on the automatic reallocation scheme.
-        this->mTensors.reserve(this->mpMesh->GetNumLocalElements());
+        if (this->mUseCompactStorage)
+        {
+            // Only the fibre and sheet directions are needed; see AddCompactElement()
+            this->mCompactDirections.reserve(this->mUseFibreOrientation ? this->mpMesh->GetNumLocalElements()*(SPACE_DIM-1)*SPACE_DIM : 0u);
+            this->mCompactConductivities.reserve(this->mUseNonConstantConductivities ? this->mpMesh->GetNumLocalElements() : 0u);
+        }
+        else
+        {
+            this->mTensors.reserve(this->mpMesh->GetNumLocalElements());
+        }
 
         c_matrix<double, SPACE_DIM, SPACE_DIM> conductivity_matrix(zero_matrix<double>(SPACE_DIM,SPACE_DIM));
 
@@ -125,18 +138,29 @@ void OrthotropicConductivityTensors<ELEMENT_DIM, SPACE_DIM>::Init(AbstractTetrah
 
             if (this->mUseFibreOrientation)
             {
-                unsigned current_fibre_global_index = it->GetIndex();
-                this->mFileReader->GetFibreSheetAndNormalMatrix(current_fibre_global_index, orientation_matrix);
+                orientation_matrix = local_orientation_matrices[local_element_index];
             }
 
-            c_matrix<double,SPACE_DIM,SPACE_DIM> temp;
-            noalias(temp) = prod(orientation_matrix, conductivity_matrix);
-            this->mTensors.push_back( prod(temp, trans(orientation_matrix) ) );
+            if (this->mUseCompactStorage)
+            {
+                c_vector<double, SPACE_DIM> conductivities;
+                for (unsigned dim=0; dim<SPACE_DIM; dim++)
+                {
+                    conductivities[dim] = conductivity_matrix(dim,dim);
+                }
+                this->AddCompactElement(conductivities, orientation_matrix, SPACE_DIM-1);
+            }
+            else
+            {
+                c_matrix<double,SPACE_DIM,SPACE_DIM> temp;
+                noalias(temp) = prod(orientation_matrix, conductivity_matrix);
+                this->mTensors.push_back( prod(temp, trans(orientation_matrix) ) );
+            }
 
             local_element_index++;
         }
-        assert(this->mTensors.size() == this->mpMesh->GetNumLocalElements());
-        assert(this->mTensors.size() == local_element_index);
+        assert(this->mUseCompactStorage || this->mTensors.size() == this->mpMesh->GetNumLocalElements());
+        assert(local_element_index == this->mpMesh->GetNumLocalElements());
 
         if (this->mUseFibreOrientation)
         {
@@ -0,0 +1,288 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "MatrixBasedRhsAssembler.hpp"
+
+#include <algorithm>
+#include <typeinfo>
+#include <cmath>
+
+#include "GaussianQuadratureRule.hpp"
+#include "LinearBasisFunction.hpp"
+#include "HeartConfig.hpp"
+#include "HeartEventHandler.hpp"
+#include "HeartRegionCodes.hpp"
+#include "PdeSimulationTime.hpp"
+#include "PetscVecTools.hpp"
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM, unsigned PROBLEM_DIM>
+MatrixBasedRhsAssembler<ELEMENT_DIM,SPACE_DIM,PROBLEM_DIM>::MatrixBasedRhsAssembler(
+        AbstractTetrahedralMesh<ELEMENT_DIM,SPACE_DIM>* pMesh,
+        AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>* pTissue,
+        bool bathSimulation,
+        bool useSvi)
+    : mpMesh(pMesh),
+      mpTissue(pTissue),
+      mUseSvi(useSvi)
+{
+    assert(pMesh);
+    assert(pTissue);
+
+    DistributedVectorFactory* p_factory = mpMesh->GetDistributedVectorFactory();
+    if (bathSimulation)
+    {
+        mIsTissueNode.resize(p_factory->GetLocalOwnership());
+        for (unsigned global_index=p_factory->GetLow(); global_index<p_factory->GetHigh(); global_index++)
+        {
+            mIsTissueNode[global_index - p_factory->GetLow()]
+                = !HeartRegionCode::IsRegionBath(mpMesh->GetNode(global_index)->GetRegion());
+        }
+    }
+
+    if (!mUseSvi)
+    {
+        return;
+    }
+
+    // Same quadrature rule and basis as the FE assemblers
+    GaussianQuadratureRule<ELEMENT_DIM> quad_rule(2);
+    for (unsigned quad_index=0; quad_index<quad_rule.GetNumQuadPoints(); quad_index++)
+    {
+        c_vector<double, ELEMENT_DIM+1> phi;
+        LinearBasisFunction<ELEMENT_DIM>::ComputeBasisFunctions(quad_rule.rGetQuadPoint(quad_index), phi);
+        mBasisFunctionsAtQuadPoints.push_back(phi);
+        mQuadWeights.push_back(quad_rule.GetWeight(quad_index));
+    }
+
+    // Work out which elements can do SVI (as in AbstractCorrectionTermAssembler), and store their geometry
+    for (typename AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::ElementIterator iter = mpMesh->GetElementIteratorBegin();
+         iter != mpMesh->GetElementIteratorEnd();
+         ++iter)
+    {
+        Element<ELEMENT_DIM, SPACE_DIM>& r_element = *iter;
+        if (!r_element.GetOwnership() || HeartRegionCode::IsRegionBath(r_element.GetUnsignedAttribute()))
+        {
+            continue;
+        }
+
+        // See if the nodes in this element all use the same cell model
+        const std::type_info& r_zero_info = typeid(*(mpTissue->GetCardiacCellOrHaloCell(r_element.GetNodeGlobalIndex(0))));
+        bool can_do_svi = true;
+        for (unsigned local_index=1; local_index<r_element.GetNumNodes(); local_index++)
+        {
+            const std::type_info& r_info = typeid(*(mpTissue->GetCardiacCellOrHaloCell(r_element.GetNodeGlobalIndex(local_index))));
+            if (r_zero_info != r_info)
+            {
+                can_do_svi = false;
+                break;
+            }
+        }
+
+        if (can_do_svi)
+        {
+            c_matrix<double, SPACE_DIM, ELEMENT_DIM> jacobian;
+            c_matrix<double, ELEMENT_DIM, SPACE_DIM> inverse_jacobian;
+            double jacobian_determinant;
+            mpMesh->GetInverseJacobianForElement(r_element.GetIndex(), jacobian, jacobian_determinant, inverse_jacobian);
+
+            for (unsigned local_index=0; local_index<ELEMENT_DIM+1; local_index++)
+            {
+                mSviElementNodes.push_back(r_element.GetNodeGlobalIndex(local_index));
+            }
+            mSviElementJacobianDeterminants.push_back(jacobian_determinant);
+        }
+    }
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM, unsigned PROBLEM_DIM>
+void MatrixBasedRhsAssembler<ELEMENT_DIM,SPACE_DIM,PROBLEM_DIM>::ComputeMatrixBasedRhs(
+        Vec currentSolution, Mat massMatrix, Vec vecForConstructingRhs, Vec rhs)
+{
+    DistributedVectorFactory* p_factory = mpMesh->GetDistributedVectorFactory();
+    const unsigned lo = p_factory->GetLow();
+    const unsigned num_local_nodes = p_factory->GetLocalOwnership();
+    assert(mIsTissueNode.empty() || mIsTissueNode.size() == num_local_nodes);
+
+    const double Am = HeartConfig::Instance()->GetSurfaceAreaToVolumeRatio();
+    const double Am_Cm_over_dt = Am * HeartConfig::Instance()->GetCapacitance() * PdeSimulationTime::GetPdeTimeStepInverse();
+
+    //////////////////////////////////////////
+    // Set up z in b=Mz
+    //////////////////////////////////////////
+    double* p_current_solution;
+    double* p_z;
+    VecGetArray(currentSolution, &p_current_solution);
+    VecGetArray(vecForConstructingRhs, &p_z);
+    for (unsigned local_index=0; local_index<num_local_nodes; local_index++)
+    {
+        const unsigned offset = PROBLEM_DIM*local_index;
+        if (mIsTissueNode.empty() || mIsTissueNode[local_index])
+        {
+            const unsigned global_index = lo + local_index;
+            p_z[offset] = Am_Cm_over_dt*p_current_solution[offset]
+                          - Am*mpTissue->GetIionicCacheValue(global_index)
+                          - mpTissue->GetIntracellularStimulusCacheValue(global_index);
+        }
+        else
+        {
+            p_z[offset] = 0.0;
+        }
+        // No source term in the elliptic equation
+        for (unsigned i=1; i<PROBLEM_DIM; i++)
+        {
+            p_z[offset + i] = 0.0;
+        }
+    }
+    VecRestoreArray(vecForConstructingRhs, &p_z);
+    VecRestoreArray(currentSolution, &p_current_solution);
+
+    //////////////////////////////////////////
+    // b = Mz
+    //////////////////////////////////////////
+    MatMult(massMatrix, vecForConstructingRhs, rhs);
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM, unsigned PROBLEM_DIM>
+void MatrixBasedRhsAssembler<ELEMENT_DIM,SPACE_DIM,PROBLEM_DIM>::AddCorrectionTerm(Vec rhs)
+{
+    if (!mUseSvi)
+    {
+        return;
+    }
+
+    // The criterion and the correction both need the ionic cache at halo nodes
+    assert(mpTissue->GetDoCacheReplication());
+    mpTissue->FinishCacheReplication();
+
+    HeartEventHandler::BeginEvent(HeartEventHandler::ASSEMBLE_RHS);
+
+    const double DELTA_IIONIC = 1; // tolerance
+    const double Am = HeartConfig::Instance()->GetSurfaceAreaToVolumeRatio();
+    const unsigned num_quad_points = mQuadWeights.size();
+
+    std::vector<std::vector<double> > state_vars_at_nodes(ELEMENT_DIM+1);
+    std::vector<double> state_vars_at_quad_point;
+
+    for (unsigned svi_index=0; svi_index<mSviElementJacobianDeterminants.size(); svi_index++)
+    {
+        const unsigned* p_nodes = &mSviElementNodes[svi_index*(ELEMENT_DIM+1)];
+
+        // Only correct elements across which the ionic current varies significantly
+        c_vector<double, ELEMENT_DIM+1> iionic;
+        for (unsigned i=0; i<ELEMENT_DIM+1; i++)
+        {
+            iionic(i) = mpTissue->GetIionicCacheValue(p_nodes[i]);
+        }
+        double diionic = 0.0;
+        for (unsigned i=0; i<ELEMENT_DIM+1; i++)
+        {
+            for (unsigned j=i+1; j<ELEMENT_DIM+1; j++)
+            {
+                diionic = std::max(diionic, fabs(iionic(i) - iionic(j)));
+            }
+        }
+        if (diionic <= DELTA_IIONIC)
+        {
+            continue;
+        }
+
+        // All nodes have the same cell model, so any of them can compute the ionic current
+        AbstractCardiacCellInterface* p_any_cell = mpTissue->GetCardiacCellOrHaloCell(p_nodes[0]);
+        for (unsigned i=0; i<ELEMENT_DIM+1; i++)
+        {
+            state_vars_at_nodes[i] = mpTissue->GetCardiacCellOrHaloCell(p_nodes[i])->GetStdVecStateVariables();
+        }
+        const unsigned num_state_vars = state_vars_at_nodes[0].size();
+        state_vars_at_quad_point.resize(num_state_vars);
+
+        c_vector<double, PROBLEM_DIM*(ELEMENT_DIM+1)> b_elem = zero_vector<double>(PROBLEM_DIM*(ELEMENT_DIM+1));
+        for (unsigned quad_index=0; quad_index<num_quad_points; quad_index++)
+        {
+            const c_vector<double, ELEMENT_DIM+1>& r_phi = mBasisFunctionsAtQuadPoints[quad_index];
+
+            double iionic_interp = 0.0;
+            std::fill(state_vars_at_quad_point.begin(), state_vars_at_quad_point.end(), 0.0);
+            for (unsigned i=0; i<ELEMENT_DIM+1; i++)
+            {
+                iionic_interp += r_phi(i)*iionic(i);
+                for (unsigned var=0; var<num_state_vars; var++)
+                {
+                    state_vars_at_quad_point[var] += r_phi(i)*state_vars_at_nodes[i][var];
+                }
+            }
+            double ionic_sv_interp = p_any_cell->GetIIonic(&state_vars_at_quad_point);
+
+            // Add on the SVI ionic current, and take away the ICI (linearly interpolated
+            // ionic current) that was included in M z.  No correction for phi_e.
+            double wJ = mSviElementJacobianDeterminants[svi_index] * mQuadWeights[quad_index];
+            double factor = (-Am) * (ionic_sv_interp - iionic_interp) * wJ;
+            for (unsigned i=0; i<ELEMENT_DIM+1; i++)
+            {
+                b_elem(PROBLEM_DIM*i) += r_phi(i)*factor;
+            }
+        }
+
+        unsigned p_indices[PROBLEM_DIM*(ELEMENT_DIM+1)];
+        for (unsigned i=0; i<ELEMENT_DIM+1; i++)
+        {
+            for (unsigned j=0; j<PROBLEM_DIM; j++)
+            {
+                p_indices[PROBLEM_DIM*i + j] = PROBLEM_DIM*p_nodes[i] + j;
+            }
+        }
+        PetscVecTools::AddMultipleValues<PROBLEM_DIM*(ELEMENT_DIM+1)>(rhs, p_indices, b_elem);
+    }
+
+    HeartEventHandler::EndEvent(HeartEventHandler::ASSEMBLE_RHS);
+}
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM, unsigned PROBLEM_DIM>
+unsigned MatrixBasedRhsAssembler<ELEMENT_DIM,SPACE_DIM,PROBLEM_DIM>::GetNumSviElements() const
+{
+    return mSviElementJacobianDeterminants.size();
+}
+
+///////////////////////////////////////////////////////
+// explicit instantiation
+///////////////////////////////////////////////////////
+
+template class MatrixBasedRhsAssembler<1,1,1>;
+template class MatrixBasedRhsAssembler<1,2,1>;
+template class MatrixBasedRhsAssembler<1,3,1>;
+template class MatrixBasedRhsAssembler<2,2,1>;
+template class MatrixBasedRhsAssembler<3,3,1>;
+template class MatrixBasedRhsAssembler<1,1,2>;
+template class MatrixBasedRhsAssembler<2,2,2>;
+template class MatrixBasedRhsAssembler<3,3,2>;
@@ -0,0 +1,143 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef MATRIXBASEDRHSASSEMBLER_HPP_
+#define MATRIXBASEDRHSASSEMBLER_HPP_
+
+#include <vector>
+#include <petscvec.h>
+#include <petscmat.h>
+
+#include "UblasIncludes.hpp"
+#include "AbstractTetrahedralMesh.hpp"
+#include "AbstractCardiacTissue.hpp"
+
+/**
+ * Computes the right-hand side of the monodomain (PROBLEM_DIM=1) or bidomain
+ * (PROBLEM_DIM=2) linear system in matrix-based form, b = M z (+ c_correction),
+ * for MonodomainSolver and BidomainSolver.
+ *
+ * The vector z = (Am Cm/dt) V - Am Iionic - Istim is formed in a single pass over
+ * the locally owned entries, with the bath nodes (which get z=0) worked out once
+ * at construction.  The phi_e entries of z are zero in the bidomain case.
+ *
+ * If state variable interpolation (SVI) is used, everything about the correction
+ * term which does not depend on the solution - which elements can do SVI, their
+ * nodes, Jacobian determinants, and the basis functions at the quadrature points -
+ * is also precomputed, so each step only interpolates the nodal state variables and
+ * ionic currents onto the quadrature points and evaluates the ionic current there.
+ * The correction term is added after the halo exchange of the tissue's caches has
+ * completed, so if the tissue has been told to overlap cache replication, the
+ * exchange is in flight while z and M z are computed.
+ */
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM, unsigned PROBLEM_DIM>
+class MatrixBasedRhsAssembler
+{
+private:
+
+    /** The mesh. */
+    AbstractTetrahedralMesh<ELEMENT_DIM,SPACE_DIM>* mpMesh;
+
+    /** The tissue, holding the cells and the Iionic and stimulus caches. */
+    AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>* mpTissue;
+
+    /**
+     * Whether each locally owned node (by local index) is a tissue node.
+     * Empty if there is no bath, in which case all nodes are tissue nodes.
+     */
+    std::vector<bool> mIsTissueNode;
+
+    /** Whether to add the SVI correction term. */
+    bool mUseSvi;
+
+    /**
+     * Global node indices of the locally owned elements which can do SVI,
+     * ELEMENT_DIM+1 consecutive entries per element.
+     */
+    std::vector<unsigned> mSviElementNodes;
+
+    /** Jacobian determinant of each element in #mSviElementNodes. */
+    std::vector<double> mSviElementJacobianDeterminants;
+
+    /** Values of the basis functions at each quadrature point of the reference element. */
+    std::vector<c_vector<double, ELEMENT_DIM+1> > mBasisFunctionsAtQuadPoints;
+
+    /** Weight of each quadrature point. */
+    std::vector<double> mQuadWeights;
+
+public:
+
+    /**
+     * Constructor.  This should be called after the tissue has been set up, since
+     * whether an element can do SVI depends on the cell models at its nodes.
+     *
+     * @param pMesh  the mesh
+     * @param pTissue  the tissue
+     * @param bathSimulation  whether some nodes are bath nodes
+     * @param useSvi  whether to add the state variable interpolation correction term
+     */
+    MatrixBasedRhsAssembler(AbstractTetrahedralMesh<ELEMENT_DIM,SPACE_DIM>* pMesh,
+                            AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>* pTissue,
+                            bool bathSimulation,
+                            bool useSvi);
+
+    /**
+     * Set rhs = M z, where z is computed from the current solution and the
+     * tissue's caches.  Only locally owned cache entries are read.
+     *
+     * @param currentSolution  the current solution (V, or interleaved V and phi_e)
+     * @param massMatrix  the (bidomain) mass matrix M
+     * @param vecForConstructingRhs  work vector with the same layout as rhs, used to hold z
+     * @param rhs  the vector to set
+     */
+    void ComputeMatrixBasedRhs(Vec currentSolution, Mat massMatrix, Vec vecForConstructingRhs, Vec rhs);
+
+    /**
+     * Add the SVI correction term to rhs, if SVI is being used.  This first
+     * completes any halo exchange of the tissue's caches which is still in
+     * progress.  Values are added with ADD_VALUES, so rhs must be finalised
+     * afterwards.
+     *
+     * @param rhs  the vector to add to
+     */
+    void AddCorrectionTerm(Vec rhs);
+
+    /**
+     * @return the number of locally owned elements on which SVI may be applied.
+     */
+    unsigned GetNumSviElements() const;
+};
+
+#endif /*MATRIXBASEDRHSASSEMBLER_HPP_*/
@@ -72,6 +72,7 @@ void AbstractBidomainSolver<ELEMENT_DIM,SPACE_DIM>::InitialiseForSolve(Vec initi
     }
 
     this->mpLinearSystem->SetKspType(HeartConfig::Instance()->GetKSPSolver());
+    this->mpLinearSystem->SetPhiEMultigrid(mpPhiEMultigrid);
 
     /// \todo: block preconditioners only make sense in Bidomain... Add some warning/error message
     if(std::string("twolevelsblockdiagonal") == std::string(HeartConfig::Instance()->GetKSPPreconditioner()))
@@ -331,6 +332,12 @@ void AbstractBidomainSolver<ELEMENT_DIM,SPACE_DIM>::SetRowForAverageOfPhiZeroed(
     mRowForAverageOfPhiZeroed = row;
 }
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void AbstractBidomainSolver<ELEMENT_DIM,SPACE_DIM>::SetPhiEMultigridPreconditioner(boost::shared_ptr<GeometricMultigridPreconditioner> pPhiEMultigrid)
+{
+    mpPhiEMultigrid = pPhiEMultigrid;
+}
+
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void AbstractBidomainSolver<ELEMENT_DIM,SPACE_DIM>::FinaliseForBath(bool computeMatrix, bool computeVector)
 {
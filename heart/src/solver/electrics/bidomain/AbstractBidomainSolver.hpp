@@ -39,6 +39,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "AbstractDynamicLinearPdeSolver.hpp"
 #include "BidomainTissue.hpp"
 #include "HeartConfig.hpp"
+#include "GeometricMultigridPreconditioner.hpp"
 
 /**
  *  Abstract Bidomain class containing some common functionality
@@ -76,6 +77,12 @@ protected:
      */
     unsigned mRowForAverageOfPhiZeroed;
 
+    /**
+     * Geometric multigrid to use for the phi_e block of the block preconditioners,
+     * instead of AMG.  Empty if unset.
+     */
+    boost::shared_ptr<GeometricMultigridPreconditioner> mpPhiEMultigrid;
+
     /**
      * Create the linear system object if it hasn't been already.
      * Can use an initial solution as PETSc template, or base it on the mesh size.
@@ -186,6 +193,14 @@ public:
      */
      void SetRowForAverageOfPhiZeroed(unsigned rowMeanPhiEZero);
 
+    /**
+     * Use geometric multigrid on the phi_e block when the KSP preconditioner is
+     * "blockdiagonal" or "ldufactorisation".  Must be called before the first solve.
+     * It is set from the problem class.
+     * @param pPhiEMultigrid  the multigrid hierarchy, whose finest level is this solver's mesh
+     */
+    void SetPhiEMultigridPreconditioner(boost::shared_ptr<GeometricMultigridPreconditioner> pPhiEMultigrid);
+
     /**
      *  @return the boundary conditions being used
      */
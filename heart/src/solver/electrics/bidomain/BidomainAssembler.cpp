@@ -53,8 +53,8 @@ c_matrix<double,2*(ELEMENT_DIM+1),2*(ELEMENT_DIM+1)>
     double Am = this->mpConfig->GetSurfaceAreaToVolumeRatio();
     double Cm = this->mpConfig->GetCapacitance();
 
-    const c_matrix<double, SPACE_DIM, SPACE_DIM>& sigma_i = this->mpCardiacTissue->rGetIntracellularConductivityTensor(pElement->GetIndex());
-    const c_matrix<double, SPACE_DIM, SPACE_DIM>& sigma_e = this->mpCardiacTissue->rGetExtracellularConductivityTensor(pElement->GetIndex());
+    c_matrix<double, SPACE_DIM, SPACE_DIM> sigma_i = this->mpCardiacTissue->GetIntracellularConductivityTensor(pElement->GetIndex());
+    c_matrix<double, SPACE_DIM, SPACE_DIM> sigma_e = this->mpCardiacTissue->GetExtracellularConductivityTensor(pElement->GetIndex());
 
 
     c_matrix<double, SPACE_DIM, ELEMENT_DIM+1> temp = prod(sigma_i, rGradPhi);
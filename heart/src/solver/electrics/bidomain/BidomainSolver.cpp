@@ -94,71 +94,13 @@ void BidomainSolver<ELEMENT_DIM,SPACE_DIM>::SetupLinearSystem(
 
     HeartEventHandler::BeginEvent(HeartEventHandler::ASSEMBLE_RHS);
 
-    //////////////////////////////////////////
-    // Set up z in b=Mz
-    //////////////////////////////////////////
-    DistributedVectorFactory* p_factory = this->mpMesh->GetDistributedVectorFactory();
-
-    // dist stripe for the current Voltage
-    DistributedVector distributed_current_solution = p_factory->CreateDistributedVector(currentSolution);
-    DistributedVector::Stripe distributed_current_solution_vm(distributed_current_solution, 0);
-
-    // dist stripe for z
-    DistributedVector dist_vec_matrix_based = p_factory->CreateDistributedVector(mVecForConstructingRhs);
-    DistributedVector::Stripe dist_vec_matrix_based_vm(dist_vec_matrix_based, 0);
-    DistributedVector::Stripe dist_vec_matrix_based_phie(dist_vec_matrix_based, 1);
-
-    double Am = HeartConfig::Instance()->GetSurfaceAreaToVolumeRatio();
-    double Cm  = HeartConfig::Instance()->GetCapacitance();
-
-    if(!(this->mBathSimulation))
-    {
-        for (DistributedVector::Iterator index = dist_vec_matrix_based.Begin();
-             index!= dist_vec_matrix_based.End();
-             ++index)
-        {
-            double V = distributed_current_solution_vm[index];
-            double F = - Am*this->mpBidomainTissue->rGetIionicCacheReplicated()[index.Global]
-                       - this->mpBidomainTissue->rGetIntracellularStimulusCacheReplicated()[index.Global];
-
-            dist_vec_matrix_based_vm[index] = Am*Cm*V*PdeSimulationTime::GetPdeTimeStepInverse() + F;
-            dist_vec_matrix_based_phie[index] = 0.0;
-        }
-    }
-    else
-    {
-        for (DistributedVector::Iterator index = dist_vec_matrix_based.Begin();
-             index!= dist_vec_matrix_based.End();
-             ++index)
-        {
-
-            if ( !HeartRegionCode::IsRegionBath( this->mpMesh->GetNode(index.Global)->GetRegion() ))
-            {
-                double V = distributed_current_solution_vm[index];
-                double F = - Am*this->mpBidomainTissue->rGetIionicCacheReplicated()[index.Global]
-                           - this->mpBidomainTissue->rGetIntracellularStimulusCacheReplicated()[index.Global];
-
-                dist_vec_matrix_based_vm[index] = Am*Cm*V*PdeSimulationTime::GetPdeTimeStepInverse() + F;
-            }
-            else
-            {
-                dist_vec_matrix_based_vm[index] = 0.0;
-            }
-
-            dist_vec_matrix_based_phie[index] = 0.0;
-
-        }
-    }
-
-    dist_vec_matrix_based.Restore();
-
     //////////////////////////////////////////
     // b = Mz
     //////////////////////////////////////////
-    MatMult(mMassMatrix, mVecForConstructingRhs, this->mpLinearSystem->rGetRhsVector());
+    mpRhsAssembler->ComputeMatrixBasedRhs(currentSolution, mMassMatrix, mVecForConstructingRhs, this->mpLinearSystem->rGetRhsVector());
 
     // assembling RHS is not finished yet, as Neumann bcs are added below, but
-    // the event will be begun again inside mpBidomainAssembler->AssembleVector();
+    // the event will be begun again inside mpBidomainNeumannSurfaceTermAssembler->AssembleVector();
     HeartEventHandler::EndEvent(HeartEventHandler::ASSEMBLE_RHS);
 
 
@@ -173,12 +115,7 @@ void BidomainSolver<ELEMENT_DIM,SPACE_DIM>::SetupLinearSystem(
     /////////////////////////////////////////
     // apply correction term
     /////////////////////////////////////////
-    if(mpBidomainCorrectionTermAssembler)
-    {
-        mpBidomainCorrectionTermAssembler->SetVectorToAssemble(this->mpLinearSystem->rGetRhsVector(), false/*don't zero vector!*/);
-        // don't need to set current solution
-        mpBidomainCorrectionTermAssembler->AssembleVector();
-    }
+    mpRhsAssembler->AddCorrectionTerm(this->mpLinearSystem->rGetRhsVector());
 
     this->mpLinearSystem->FinaliseRhsVector();
 
@@ -223,16 +160,14 @@ BidomainSolver<ELEMENT_DIM,SPACE_DIM>::BidomainSolver(
 
     mpBidomainNeumannSurfaceTermAssembler = new BidomainNeumannSurfaceTermAssembler<ELEMENT_DIM,SPACE_DIM>(pMesh,pBoundaryConditions);
 
-    if(HeartConfig::Instance()->GetUseStateVariableInterpolation())
+    bool use_svi = HeartConfig::Instance()->GetUseStateVariableInterpolation();
+    mpRhsAssembler = new MatrixBasedRhsAssembler<ELEMENT_DIM,SPACE_DIM,2>(this->mpMesh, this->mpBidomainTissue, bathSimulation, use_svi);
+    if (use_svi)
     {
-        mpBidomainCorrectionTermAssembler
-            = new BidomainCorrectionTermAssembler<ELEMENT_DIM,SPACE_DIM>(this->mpMesh,this->mpBidomainTissue);
-        //We are going to need those caches after all
+        //We are going to need those caches after all, but only for the correction
+        //term, so the halo exchange can overlap with computing M z
         pTissue->SetCacheReplication(true);
-    }
-    else
-    {
-        mpBidomainCorrectionTermAssembler = NULL;
+        pTissue->SetOverlapCacheReplication(true);
     }
 }
 
@@ -248,10 +183,9 @@ BidomainSolver<ELEMENT_DIM,SPACE_DIM>::~BidomainSolver()
         PetscTools::Destroy(mMassMatrix);
     }
 
-    if(mpBidomainCorrectionTermAssembler)
-    {
-        delete mpBidomainCorrectionTermAssembler;
-    }
+    // Leave the tissue replicating its caches in full in SolveCellSystems()
+    this->mpBidomainTissue->SetOverlapCacheReplication(false);
+    delete mpRhsAssembler;
 }
 
 ///////////////////////////////////////////////////////
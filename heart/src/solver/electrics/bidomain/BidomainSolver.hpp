@@ -48,7 +48,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "HeartConfig.hpp"
 #include "BidomainAssembler.hpp"
 #include "BidomainMassMatrixAssembler.hpp"
-#include "BidomainCorrectionTermAssembler.hpp"
+#include "MatrixBasedRhsAssembler.hpp"
 #include "BidomainNeumannSurfaceTermAssembler.hpp"
 
 /**
@@ -72,8 +72,10 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  *  Also allows state variable interpolation (SVI) to be used on elements for which it
  *  will be needed, if the appropriate HeartConfig boolean is set.
  *  See wiki page ChasteGuides/StateVariableInterpolation for more details on this. In this
- *  case the vector [c_correction, 0] is added to the above, and another assembler is
- *  used to create the c_correction.
+ *  case the vector [c_correction, 0] is added to the above.
+ *
+ *  The terms M( (chi*C/dt) V^{n} + F^{n} ) and c_correction are computed by a
+ *  MatrixBasedRhsAssembler.
  *
  */
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
@@ -98,10 +100,10 @@ private:
     BidomainNeumannSurfaceTermAssembler<ELEMENT_DIM,SPACE_DIM>* mpBidomainNeumannSurfaceTermAssembler;
 
     /**
-     * If using state variable interpolation, points to an assembler to use in
-     * computing the correction term to apply to the RHS.
+     * Computes M z, and the state variable interpolation correction term
+     * if that is being used.
      */
-    BidomainCorrectionTermAssembler<ELEMENT_DIM,SPACE_DIM>* mpBidomainCorrectionTermAssembler;
+    MatrixBasedRhsAssembler<ELEMENT_DIM,SPACE_DIM,2>* mpRhsAssembler;
 
 
     /** Overloaded InitialiseForSolve() which calls base version but also
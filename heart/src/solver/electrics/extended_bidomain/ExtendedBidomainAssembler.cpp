@@ -56,9 +56,9 @@ c_matrix<double,3*(ELEMENT_DIM+1),3*(ELEMENT_DIM+1)>
     double Cm1 = mpExtendedBidomainTissue->GetCmFirstCell();
     double Cm2 = mpExtendedBidomainTissue->GetCmSecondCell();
 
-    const c_matrix<double, SPACE_DIM, SPACE_DIM>& sigma_i_first_cell = mpExtendedBidomainTissue->rGetIntracellularConductivityTensor(pElement->GetIndex());
-    const c_matrix<double, SPACE_DIM, SPACE_DIM>& sigma_i_second_cell = mpExtendedBidomainTissue->rGetIntracellularConductivityTensorSecondCell(pElement->GetIndex());
-    const c_matrix<double, SPACE_DIM, SPACE_DIM>& sigma_e = mpExtendedBidomainTissue->rGetExtracellularConductivityTensor(pElement->GetIndex());
+    c_matrix<double, SPACE_DIM, SPACE_DIM> sigma_i_first_cell = mpExtendedBidomainTissue->GetIntracellularConductivityTensor(pElement->GetIndex());
+    c_matrix<double, SPACE_DIM, SPACE_DIM> sigma_i_second_cell = mpExtendedBidomainTissue->GetIntracellularConductivityTensorSecondCell(pElement->GetIndex());
+    c_matrix<double, SPACE_DIM, SPACE_DIM> sigma_e = mpExtendedBidomainTissue->GetExtracellularConductivityTensor(pElement->GetIndex());
 
     double delta_t = PdeSimulationTime::GetPdeTimeStep();
 
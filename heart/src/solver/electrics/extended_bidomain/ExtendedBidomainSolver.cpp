@@ -124,9 +124,9 @@ void ExtendedBidomainSolver<ELEMENT_DIM,SPACE_DIM>::SetupLinearSystem(
         double V_first_cell = distributed_current_solution_v_first_cell[index];
         double V_second_Cell = distributed_current_solution_v_second_cell[index];
 
-        double i_ionic_first_cell = this->mpExtendedBidomainTissue->rGetIionicCacheReplicated()[index.Global];
+        double i_ionic_first_cell = this->mpExtendedBidomainTissue->GetIionicCacheValue(index.Global);
         double i_ionic_second_cell = this->mpExtendedBidomainTissue->rGetIionicCacheReplicatedSecondCell()[index.Global];
-        double intracellular_stimulus_first_cell = this->mpExtendedBidomainTissue->rGetIntracellularStimulusCacheReplicated()[index.Global];
+        double intracellular_stimulus_first_cell = this->mpExtendedBidomainTissue->GetIntracellularStimulusCacheValue(index.Global);
         double intracellular_stimulus_second_cell = this->mpExtendedBidomainTissue->rGetIntracellularStimulusCacheReplicatedSecondCell()[index.Global];
         double extracellular_stimulus =  this->mpExtendedBidomainTissue->rGetExtracellularStimulusCacheReplicated()[index.Global];
         double g_gap = this->mpExtendedBidomainTissue->rGetGgapCacheReplicated()[index.Global];
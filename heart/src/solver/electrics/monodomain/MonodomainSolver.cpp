@@ -78,37 +78,13 @@ void MonodomainSolver<ELEMENT_DIM,SPACE_DIM>::SetupLinearSystem(Vec currentSolut
 
     HeartEventHandler::BeginEvent(HeartEventHandler::ASSEMBLE_RHS);
 
-    //////////////////////////////////////////
-    // Set up z in b=Mz
-    //////////////////////////////////////////
-    DistributedVectorFactory* p_factory = this->mpMesh->GetDistributedVectorFactory();
-    // dist stripe for the current Voltage
-    DistributedVector distributed_current_solution = p_factory->CreateDistributedVector(currentSolution);
-    // dist stripe for z (return value)
-    DistributedVector dist_vec_matrix_based = p_factory->CreateDistributedVector(mVecForConstructingRhs);
-
-    double Am = HeartConfig::Instance()->GetSurfaceAreaToVolumeRatio();
-    double Cm = HeartConfig::Instance()->GetCapacitance();
-
-    for (DistributedVector::Iterator index = dist_vec_matrix_based.Begin();
-         index!= dist_vec_matrix_based.End();
-         ++index)
-    {
-        double V = distributed_current_solution[index];
-        double F = - Am*this->mpMonodomainTissue->rGetIionicCacheReplicated()[index.Global]
-                   - this->mpMonodomainTissue->rGetIntracellularStimulusCacheReplicated()[index.Global];
-
-        dist_vec_matrix_based[index] = Am*Cm*V*PdeSimulationTime::GetPdeTimeStepInverse() + F;
-    }
-    dist_vec_matrix_based.Restore();
-
     //////////////////////////////////////////
     // b = Mz
     //////////////////////////////////////////
-    MatMult(mMassMatrix, mVecForConstructingRhs, this->mpLinearSystem->rGetRhsVector());
+    mpRhsAssembler->ComputeMatrixBasedRhs(currentSolution, mMassMatrix, mVecForConstructingRhs, this->mpLinearSystem->rGetRhsVector());
 
     // assembling RHS is not finished yet, as Neumann bcs are added below, but
-    // the event will be begun again inside mpMonodomainAssembler->AssembleVector();
+    // the event will be begun again inside mpNeumannSurfaceTermsAssembler->AssembleVector();
     HeartEventHandler::EndEvent(HeartEventHandler::ASSEMBLE_RHS);
 
     /////////////////////////////////////////
@@ -120,12 +96,7 @@ void MonodomainSolver<ELEMENT_DIM,SPACE_DIM>::SetupLinearSystem(Vec currentSolut
     /////////////////////////////////////////
     // apply correction term
     /////////////////////////////////////////
-    if(mpMonodomainCorrectionTermAssembler)
-    {
-        mpMonodomainCorrectionTermAssembler->SetVectorToAssemble(this->mpLinearSystem->rGetRhsVector(), false/*don't zero vector!*/);
-        // don't need to set current solution
-        mpMonodomainCorrectionTermAssembler->AssembleVector();
-    }
+    mpRhsAssembler->AddCorrectionTerm(this->mpLinearSystem->rGetRhsVector());
 
     // finalise
     this->mpLinearSystem->FinaliseRhsVector();
@@ -200,16 +171,14 @@ MonodomainSolver<ELEMENT_DIM,SPACE_DIM>::MonodomainSolver(
     pTissue->SetCacheReplication(false);
     mVecForConstructingRhs = NULL;
 
-    if(HeartConfig::Instance()->GetUseStateVariableInterpolation())
+    bool use_svi = HeartConfig::Instance()->GetUseStateVariableInterpolation();
+    mpRhsAssembler = new MatrixBasedRhsAssembler<ELEMENT_DIM,SPACE_DIM,1>(this->mpMesh, this->mpMonodomainTissue, false, use_svi);
+    if (use_svi)
     {
-        mpMonodomainCorrectionTermAssembler
-            = new MonodomainCorrectionTermAssembler<ELEMENT_DIM,SPACE_DIM>(this->mpMesh,this->mpMonodomainTissue);
-        //We are going to need those caches after all
+        //We are going to need those caches after all, but only for the correction
+        //term, so the halo exchange can overlap with computing M z
         pTissue->SetCacheReplication(true);
-    }
-    else
-    {
-        mpMonodomainCorrectionTermAssembler = NULL;
+        pTissue->SetOverlapCacheReplication(true);
     }
 }
 
@@ -225,10 +194,9 @@ MonodomainSolver<ELEMENT_DIM,SPACE_DIM>::~MonodomainSolver()
         PetscTools::Destroy(mMassMatrix);
     }
 
-    if(mpMonodomainCorrectionTermAssembler)
-    {
-        delete mpMonodomainCorrectionTermAssembler;
-    }
+    // Leave the tissue replicating its caches in full in SolveCellSystems()
+    mpMonodomainTissue->SetOverlapCacheReplication(false);
+    delete mpRhsAssembler;
 }
 
 
@@ -39,7 +39,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "AbstractDynamicLinearPdeSolver.hpp"
 #include "MassMatrixAssembler.hpp"
 #include "NaturalNeumannSurfaceTermAssembler.hpp"
-#include "MonodomainCorrectionTermAssembler.hpp"
+#include "MatrixBasedRhsAssembler.hpp"
 #include "MonodomainTissue.hpp"
 #include "MonodomainAssembler.hpp"
 
@@ -68,7 +68,9 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
  *  See wiki page ChasteGuides/StateVariableInterpolation for more details on this.
  *  In this case the equation is
  *  ( (chi*C/dt) M  + K ) V^{n+1} = (chi*C/dt) M V^{n} + M F^{n} + c_surf + c_correction
- *  and another assembler is used to create the c_correction.
+ *
+ *  The terms M( (chi*C/dt) V^{n} + F^{n} ) and c_correction are computed by a
+ *  MatrixBasedRhsAssembler.
  */
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 class MonodomainSolver
@@ -89,10 +91,10 @@ private:
     NaturalNeumannSurfaceTermAssembler<ELEMENT_DIM,SPACE_DIM,1>* mpNeumannSurfaceTermsAssembler;
 
     /**
-     * If using state variable interpolation, points to an assembler to use in
-     * computing the correction term to apply to the RHS.
+     * Computes M z, and the state variable interpolation correction term
+     * if that is being used.
      */
-    MonodomainCorrectionTermAssembler<ELEMENT_DIM,SPACE_DIM>* mpMonodomainCorrectionTermAssembler;
+    MatrixBasedRhsAssembler<ELEMENT_DIM,SPACE_DIM,1>* mpRhsAssembler;
 
     /** The mass matrix, used to computing the RHS vector */
     Mat mMassMatrix;
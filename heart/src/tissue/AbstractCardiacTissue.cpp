@@ -36,6 +36,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "AbstractCardiacTissue.hpp"
 
 #include <boost/scoped_array.hpp>
+#include <climits>
+#include <map>
 
 #include "DistributedVector.hpp"
 #include "AxisymmetricConductivityTensors.hpp"
@@ -49,6 +51,10 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "AbstractCvodeCell.hpp"
 #include "Warnings.hpp"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
 AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::AbstractCardiacTissue(
             AbstractCardiacCellFactory<ELEMENT_DIM,SPACE_DIM>* pCellFactory,
@@ -58,6 +64,10 @@ AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::AbstractCardiacTissue(
       mpConductivityModifier(NULL),
       mHasPurkinje(false),
       mDoCacheReplication(true),
+      mUseGhostedCaches(false),
+      mOverlapCacheReplication(false),
+      mCacheReplicationInProgress(false),
+      mNumCellSolveThreads(1u),
       mMeshUnarchived(false),
       mExchangeHalos(exchangeHalos)
 {
@@ -183,6 +193,10 @@ AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::AbstractCardiacTissue(AbstractTetr
       mpDistributedVectorFactory(mpMesh->GetDistributedVectorFactory()),
       mHasPurkinje(false),
       mDoCacheReplication(true),
+      mUseGhostedCaches(false),
+      mOverlapCacheReplication(false),
+      mCacheReplicationInProgress(false),
+      mNumCellSolveThreads(1u),
       mMeshUnarchived(true),
       mExchangeHalos(false)
 {
@@ -343,6 +357,7 @@ void AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::CreateIntracellularConductivi
         mpIntracellularConductivityTensors->SetConstantConductivities(intra_conductivities);
     }
 
+    mpIntracellularConductivityTensors->SetUseCompactStorage(mpConfig->GetUseCompactConductivityTensors());
     mpIntracellularConductivityTensors->Init(this->mpMesh);
     HeartEventHandler::EndEvent(HeartEventHandler::READ_MESH);
 }
@@ -361,7 +376,161 @@ bool AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::GetDoCacheReplication()
 }
 
 template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
-const c_matrix<double, SPACE_DIM, SPACE_DIM>& AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::rGetIntracellularConductivityTensor(unsigned elementIndex)
+void AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::SetOverlapCacheReplication(bool overlapCacheReplication)
+{
+    FinishCacheReplication();
+    mOverlapCacheReplication = overlapCacheReplication;
+}
+
+template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
+bool AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::GetOverlapCacheReplication()
+{
+    return mOverlapCacheReplication;
+}
+
+template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
+void AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::FinishCacheReplication()
+{
+    if (mCacheReplicationInProgress)
+    {
+        HeartEventHandler::BeginEvent(HeartEventHandler::COMMUNICATION);
+        mIionicCacheGhosted.UpdateGhostsEnd();
+        mIntracellularStimulusCacheGhosted.UpdateGhostsEnd();
+        mCacheReplicationInProgress = false;
+        HeartEventHandler::EndEvent(HeartEventHandler::COMMUNICATION);
+    }
+}
+
+template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
+void AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::SetNumCellSolveThreads(unsigned numThreads)
+{
+    assert(numThreads > 0);
+    mNumCellSolveThreads = 1u;
+    mThreadOdeSolvers.clear();
+    mCellOdeSolverIndices.clear();
+    if (numThreads == 1u)
+    {
+        return;
+    }
+
+    // Cells with lookup tables interpolate into row buffers shared by all cells of their class
+    for (unsigned local_index=0; local_index<mCellsDistributed.size(); local_index++)
+    {
+        if (mCellsDistributed[local_index]->GetLookupTableCollection() != NULL)
+        {
+            EXCEPTION("One of the cells uses lookup tables, which are shared between cells, so the cells cannot be solved in threads.");
+        }
+    }
+
+    // Find the distinct solvers used by the local cells
+    std::vector<boost::shared_ptr<AbstractIvpOdeSolver> > solvers;
+    std::map<AbstractIvpOdeSolver*, unsigned> solver_indices;
+    mCellOdeSolverIndices.resize(mCellsDistributed.size(), UINT_MAX);
+    for (unsigned local_index=0; local_index<mCellsDistributed.size(); local_index++)
+    {
+        boost::shared_ptr<AbstractIvpOdeSolver> p_solver = mCellsDistributed[local_index]->GetSolver();
+        if (p_solver)
+        {
+            std::map<AbstractIvpOdeSolver*, unsigned>::iterator it = solver_indices.find(p_solver.get());
+            if (it == solver_indices.end())
+            {
+                it = solver_indices.insert(std::make_pair(p_solver.get(), (unsigned)solvers.size())).first;
+                solvers.push_back(p_solver);
+            }
+            mCellOdeSolverIndices[local_index] = it->second;
+        }
+    }
+
+    // The solvers have working memory, so every other thread needs its own copies
+    mThreadOdeSolvers.push_back(solvers);
+    for (unsigned thread=1; thread<numThreads; thread++)
+    {
+        std::vector<boost::shared_ptr<AbstractIvpOdeSolver> > thread_solvers;
+        for (unsigned i=0; i<solvers.size(); i++)
+        {
+            boost::shared_ptr<AbstractIvpOdeSolver> p_copy = solvers[i]->Clone();
+            if (!p_copy)
+            {
+                mThreadOdeSolvers.clear();
+                mCellOdeSolverIndices.clear();
+                EXCEPTION("One of the cells' ODE solvers cannot be copied, so the cells cannot be solved in threads.");
+            }
+            thread_solvers.push_back(p_copy);
+        }
+        mThreadOdeSolvers.push_back(thread_solvers);
+    }
+    mNumCellSolveThreads = numThreads;
+}
+
+template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
+unsigned AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::GetNumCellSolveThreads()
+{
+    return mNumCellSolveThreads;
+}
+
+template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
+void AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::SetUseGhostedCaches(bool useGhostedCaches)
+{
+    if (useGhostedCaches == mUseGhostedCaches)
+    {
+        return;
+    }
+    FinishCacheReplication();
+
+    unsigned lo = mpDistributedVectorFactory->GetLow();
+    unsigned hi = mpDistributedVectorFactory->GetHigh();
+    unsigned problem_size = mpDistributedVectorFactory->GetProblemSize();
+
+    if (useGhostedCaches)
+    {
+        if (mHasPurkinje)
+        {
+            EXCEPTION("Ghosted caches are not supported for tissues with Purkinje cells.");
+        }
+
+        // The ghosts are the non-local nodes of elements containing a local node, i.e. those
+        // that can appear in the elements this process assembles.
+        std::vector<unsigned> ghost_nodes;
+        if (mExchangeHalos)
+        {
+            ghost_nodes = mHaloNodes;
+        }
+        else if (PetscTools::IsParallel())
+        {
+            std::vector<std::vector<unsigned> > nodes_to_send_per_process;
+            std::vector<std::vector<unsigned> > nodes_to_receive_per_process;
+            mpMesh->CalculateNodeExchange(nodes_to_send_per_process, nodes_to_receive_per_process);
+            for (unsigned proc=0; proc<nodes_to_receive_per_process.size(); proc++)
+            {
+                ghost_nodes.insert(ghost_nodes.end(),
+                                   nodes_to_receive_per_process[proc].begin(),
+                                   nodes_to_receive_per_process[proc].end());
+            }
+        }
+
+        mIionicCacheGhosted.Resize(lo, hi, problem_size, ghost_nodes);
+        mIntracellularStimulusCacheGhosted.Resize(lo, hi, problem_size, ghost_nodes);
+
+        // Release the memory held by the full-size caches
+        mIionicCacheReplicated.Resize(0);
+        mIntracellularStimulusCacheReplicated.Resize(0);
+    }
+    else
+    {
+        mIionicCacheReplicated.Resize(problem_size);
+        mIntracellularStimulusCacheReplicated.Resize(problem_size);
+    }
+    mUseGhostedCaches = useGhostedCaches;
+}
+
+template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
+bool AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::GetUseGhostedCaches()
+{
+    return mUseGhostedCaches;
+}
+
+template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
+c_matrix<double, SPACE_DIM, SPACE_DIM> AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::GetIntracellularConductivityTensor(unsigned elementIndex)
 {
     assert( mpIntracellularConductivityTensors);
     if (mpConductivityModifier==NULL)
@@ -375,7 +544,7 @@ const c_matrix<double, SPACE_DIM, SPACE_DIM>& AbstractCardiacTissue<ELEMENT_DIM,
 }
 
 template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
-const c_matrix<double, SPACE_DIM, SPACE_DIM>& AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::rGetExtracellularConductivityTensor(unsigned elementIndex)
+c_matrix<double, SPACE_DIM, SPACE_DIM> AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::GetExtracellularConductivityTensor(unsigned elementIndex)
 {
      EXCEPTION("Monodomain tissues do not have extracellular conductivity tensors.");
 }
@@ -459,9 +628,103 @@ void AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::SetUpHaloCells(AbstractCardia
 }
 
 
+template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
+void AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::SolveCellSystem(unsigned globalIndex, unsigned localIndex, DistributedVector::Stripe& rVoltage,
+                                                                   double time, double nextTime, bool updateVoltage)
+{
+    double voltage_before_update = rVoltage[globalIndex];
+    mCellsDistributed[localIndex]->SetVoltage( voltage_before_update );
+
+    // Added a try-catch here to provide more output to screen when an error occurs.
+    /// \todo This may want to go to std::cerr ??
+    try
+    {
+        if (!updateVoltage)
+        {
+            // solve ODE system at this node.
+            // Note: Voltage is not being updated. The voltage is updated in the PDE solve.
+#ifndef CHASTE_CVODE
+            mCellsDistributed[localIndex]->ComputeExceptVoltage(time, nextTime);
+#else
+            // If CVODE is enabled, and this is a CVODE cell
+            // there's a chance we can recover this by doing a reset so put the above call in a try...catch.
+            try
+            {
+                mCellsDistributed[localIndex]->ComputeExceptVoltage(time, nextTime);
+            }
+            catch (Exception &e)
+            {
+                // Try an 'emergency' reset if this is a CVODE cell.
+                // See #2594 for why we think this may be necessary.
+                if(dynamic_cast<AbstractCvodeCell*>(mCellsDistributed[localIndex]))
+                {
+                    // Reset the CVODE cell, this leads to a call to CVodeReInit.
+                    static_cast<AbstractCvodeCell*>(mCellsDistributed[localIndex])->ResetSolver();
+                    mCellsDistributed[localIndex]->ComputeExceptVoltage(time, nextTime);
+#ifdef _OPENMP
+#pragma omp critical(cardiac_tissue_cell_output)
+#endif
+                    WARNING("Global node " << globalIndex << " had an ODE solving problem in t = [" << time <<
+                            ", " << nextTime << "] ms. This was fixed by a reset of CVODE, but may suggest PDE time"
+                            " step should be reduced, or CVODE tolerances relaxed.");
+                }
+                else
+                {
+                    throw e;
+                }
+            }
+#endif // CHASTE_CVODE
+        }
+        else
+        {
+            // solve, including updating the voltage (for the operator-splitting implementation of the monodomain solver)
+            mCellsDistributed[localIndex]->SolveAndUpdateState(time, nextTime);
+            rVoltage[globalIndex] = mCellsDistributed[localIndex]->GetVoltage();
+        }
+    }
+    catch (Exception &e)
+    {
+        // Cells may be being solved in threads, so keep each cell's output together
+#ifdef _OPENMP
+#pragma omp critical(cardiac_tissue_cell_output)
+#endif
+        {
+            std::cout << std::setprecision(16);
+            std::cout << "Global node " << globalIndex << " had problems with ODE solve between "
+                    "t = " << time << " and " << nextTime << "ms.\n";
+
+            std::cout << "Voltage at this node before solve was " << voltage_before_update << "mV\n"
+                    "(this SHOULD NOT necessarily be the same as the one in the state variables,\n"
+                    "which can be ignored and stay at the initial condition - the voltage is dictated by PDE instead of state variable.)\n";
+
+            std::cout << "Stimulus current (NB converted to micro-Amps per cm^3) applied here is equal to:\n\t"
+                << mCellsDistributed[localIndex]->GetIntracellularStimulus(time) << " at t = " << time     << "ms,\n\t"
+                << mCellsDistributed[localIndex]->GetIntracellularStimulus(nextTime) << " at t = " << nextTime << "ms.\n";
+
+            std::cout << "Cell model: " << dynamic_cast<AbstractUntemplatedParameterisedSystem*>(mCellsDistributed[localIndex])->GetSystemName() << "\n";
+
+            std::cout << "All state variables are now:\n";
+            std::vector<double> state_vars = mCellsDistributed[localIndex]->GetStdVecStateVariables();
+            std::vector<std::string> state_var_names = mCellsDistributed[localIndex]->rGetStateVariableNames();
+            for (unsigned i=0; i<state_vars.size(); i++)
+            {
+                std::cout << "\t" << state_var_names[i] << "\t:\t" << state_vars[i] << "\n";
+            }
+            std::cout << std::flush;
+        }
+
+        throw e;
+    }
+    // update the Iionic and stimulus caches
+    UpdateCaches(globalIndex, localIndex, nextTime);
+}
+
 template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
 void AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::SolveCellSystems(Vec existingSolution, double time, double nextTime, bool updateVoltage)
 {
+    // The caches are about to be rewritten, so complete any halo exchange a previous solve left in progress
+    FinishCacheReplication();
+
     if(mHasPurkinje)
     {
         // can't do Purkinje and operator splitting
@@ -482,87 +745,66 @@ void AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::SolveCellSystems(Vec existing
     DistributedVector::Stripe voltage(dist_solution, 0);
     try
     {
-        double voltage_before_update;
-        for (DistributedVector::Iterator index = dist_solution.Begin();
-             index != dist_solution.End();
-             ++index)
+        if (mNumCellSolveThreads > 1u)
         {
-            voltage_before_update = voltage[index];
-            mCellsDistributed[index.Local]->SetVoltage( voltage_before_update );
-
-            // Added a try-catch here to provide more output to screen when an error occurs.
-            /// \todo This may want to go to std::cerr ??
-            try
+            assert(mCellOdeSolverIndices.size() == mCellsDistributed.size());
+            const unsigned num_local_cells = mCellsDistributed.size();
+            const unsigned lo = mpDistributedVectorFactory->GetLow();
+
+            // Each thread keeps the first failure among its cells.  Cells are handed out in
+            // increasing order, so the lowest-numbered of these is the one a serial solve would have hit.
+            std::vector<unsigned> first_failed_cell(mNumCellSolveThreads, UINT_MAX);
+            std::vector<boost::shared_ptr<Exception> > first_failure(mNumCellSolveThreads);
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic, 16) num_threads(mNumCellSolveThreads)
+#endif
+            for (unsigned local_index=0; local_index<num_local_cells; local_index++)
             {
-                if (!updateVoltage)
+                unsigned thread = 0u;
+#ifdef _OPENMP
+                thread = omp_get_thread_num();
+#endif
+                if (mCellOdeSolverIndices[local_index] != UINT_MAX)
                 {
-                    // solve ODE system at this node.
-                    // Note: Voltage is not being updated. The voltage is updated in the PDE solve.
-#ifndef CHASTE_CVODE
-                    mCellsDistributed[index.Local]->ComputeExceptVoltage(time, nextTime);
-#else
-                    // If CVODE is enabled, and this is a CVODE cell
-                    // there's a chance we can recover this by doing a reset so put the above call in a try...catch.
-                    try
-                    {
-                        mCellsDistributed[index.Local]->ComputeExceptVoltage(time, nextTime);
-                    }
-                    catch (Exception &e)
-                    {
-                        // Try an 'emergency' reset if this is a CVODE cell.
-                        // See #2594 for why we think this may be necessary.
-                        if(dynamic_cast<AbstractCvodeCell*>(mCellsDistributed[index.Local]))
-                        {
-                            // Reset the CVODE cell, this leads to a call to CVodeReInit.
-                            static_cast<AbstractCvodeCell*>(mCellsDistributed[index.Local])->ResetSolver();
-                            mCellsDistributed[index.Local]->ComputeExceptVoltage(time, nextTime);
-                            WARNING("Global node " << index.Global << " had an ODE solving problem in t = [" << time <<
-                                    ", " << nextTime << "] ms. This was fixed by a reset of CVODE, but may suggest PDE time"
-                                    " step should be reduced, or CVODE tolerances relaxed.");
-                        }
-                        else
-                        {
-                            throw e;
-                        }
-                    }
-#endif // CHASTE_CVODE
+                    mCellsDistributed[local_index]->SetSolver(mThreadOdeSolvers[thread][mCellOdeSolverIndices[local_index]]);
                 }
-                else
+                try
+                {
+                    SolveCellSystem(lo + local_index, local_index, voltage, time, nextTime, updateVoltage);
+                }
+                catch (Exception &e)
                 {
-                    // solve, including updating the voltage (for the operator-splitting implementation of the monodomain solver)
-                    mCellsDistributed[index.Local]->SolveAndUpdateState(time, nextTime);
-                    voltage[index] = mCellsDistributed[index.Local]->GetVoltage();
+                    if (first_failed_cell[thread] == UINT_MAX)
+                    {
+                        first_failed_cell[thread] = local_index;
+                        first_failure[thread].reset(new Exception(e));
+                    }
                 }
             }
-            catch (Exception &e)
-            {
-                std::cout << std::setprecision(16);
-                std::cout << "Global node " << index.Global << " had problems with ODE solve between "
-                        "t = " << time << " and " << nextTime << "ms.\n";
 
-                std::cout << "Voltage at this node before solve was " << voltage_before_update << "mV\n"
-                        "(this SHOULD NOT necessarily be the same as the one in the state variables,\n"
-                        "which can be ignored and stay at the initial condition - the voltage is dictated by PDE instead of state variable.)\n";
-
-                std::cout << "Stimulus current (NB converted to micro-Amps per cm^3) applied here is equal to:\n\t"
-                    << mCellsDistributed[index.Local]->GetIntracellularStimulus(time) << " at t = " << time     << "ms,\n\t"
-                    << mCellsDistributed[index.Local]->GetIntracellularStimulus(nextTime) << " at t = " << nextTime << "ms.\n";
-
-                std::cout << "Cell model: " << dynamic_cast<AbstractUntemplatedParameterisedSystem*>(mCellsDistributed[index.Local])->GetSystemName() << "\n";
-
-                std::cout << "All state variables are now:\n";
-                std::vector<double> state_vars = mCellsDistributed[index.Local]->GetStdVecStateVariables();
-                std::vector<std::string> state_var_names = mCellsDistributed[index.Local]->rGetStateVariableNames();
-                for (unsigned i=0; i<state_vars.size(); i++)
+            unsigned failed_thread = UINT_MAX;
+            for (unsigned thread=0; thread<mNumCellSolveThreads; thread++)
+            {
+                if (first_failed_cell[thread] != UINT_MAX
+                    && (failed_thread == UINT_MAX || first_failed_cell[thread] < first_failed_cell[failed_thread]))
                 {
-                    std::cout << "\t" << state_var_names[i] << "\t:\t" << state_vars[i] << "\n";
+                    failed_thread = thread;
                 }
-                std::cout << std::flush;
-
-                throw e;
             }
-            // update the Iionic and stimulus caches
-            UpdateCaches(index.Global, index.Local, nextTime);
+            if (failed_thread != UINT_MAX)
+            {
+                throw *(first_failure[failed_thread]);
+            }
+        }
+        else
+        {
+            for (DistributedVector::Iterator index = dist_solution.Begin();
+                 index != dist_solution.End();
+                 ++index)
+            {
+                SolveCellSystem(index.Global, index.Local, voltage, time, nextTime, updateVoltage);
+            }
         }
 
         if (updateVoltage)
@@ -694,7 +936,18 @@ void AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::SolveCellSystems(Vec existing
     HeartEventHandler::BeginEvent(HeartEventHandler::COMMUNICATION);
     if ( mDoCacheReplication )
     {
-        ReplicateCaches();
+        if (mOverlapCacheReplication && mUseGhostedCaches)
+        {
+            // Only start sending the halo values; see FinishCacheReplication()
+            assert(!mHasPurkinje);
+            mIionicCacheGhosted.UpdateGhostsBegin();
+            mIntracellularStimulusCacheGhosted.UpdateGhostsBegin();
+            mCacheReplicationInProgress = true;
+        }
+        else
+        {
+            ReplicateCaches();
+        }
     }
     HeartEventHandler::EndEvent(HeartEventHandler::COMMUNICATION);
 }
@@ -702,15 +955,43 @@ void AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::SolveCellSystems(Vec existing
 template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
 ReplicatableVector& AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::rGetIionicCacheReplicated()
 {
+    if (mUseGhostedCaches)
+    {
+        EXCEPTION("The replicated caches are not available when using ghosted caches; use GetIionicCacheValue() instead.");
+    }
     return mIionicCacheReplicated;
 }
 
 template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
 ReplicatableVector& AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::rGetIntracellularStimulusCacheReplicated()
 {
+    if (mUseGhostedCaches)
+    {
+        EXCEPTION("The replicated caches are not available when using ghosted caches; use GetIntracellularStimulusCacheValue() instead.");
+    }
     return mIntracellularStimulusCacheReplicated;
 }
 
+template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
+double AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::GetIionicCacheValue(unsigned globalIndex)
+{
+    if (mUseGhostedCaches)
+    {
+        return mIionicCacheGhosted[globalIndex];
+    }
+    return mIionicCacheReplicated[globalIndex];
+}
+
+template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
+double AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::GetIntracellularStimulusCacheValue(unsigned globalIndex)
+{
+    if (mUseGhostedCaches)
+    {
+        return mIntracellularStimulusCacheGhosted[globalIndex];
+    }
+    return mIntracellularStimulusCacheReplicated[globalIndex];
+}
+
 template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
 ReplicatableVector& AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::rGetPurkinjeIionicCacheReplicated()
 {
@@ -728,8 +1009,16 @@ ReplicatableVector& AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::rGetPurkinjeIn
 template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
 void AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::UpdateCaches(unsigned globalIndex, unsigned localIndex, double nextTime)
 {
-    mIionicCacheReplicated[globalIndex] = mCellsDistributed[localIndex]->GetIIonic();
-    mIntracellularStimulusCacheReplicated[globalIndex] = mCellsDistributed[localIndex]->GetIntracellularStimulus(nextTime);
+    if (mUseGhostedCaches)
+    {
+        mIionicCacheGhosted[globalIndex] = mCellsDistributed[localIndex]->GetIIonic();
+        mIntracellularStimulusCacheGhosted[globalIndex] = mCellsDistributed[localIndex]->GetIntracellularStimulus(nextTime);
+    }
+    else
+    {
+        mIionicCacheReplicated[globalIndex] = mCellsDistributed[localIndex]->GetIIonic();
+        mIntracellularStimulusCacheReplicated[globalIndex] = mCellsDistributed[localIndex]->GetIntracellularStimulus(nextTime);
+    }
 }
 
 template <unsigned ELEMENT_DIM,unsigned SPACE_DIM>
@@ -747,6 +1036,14 @@ void AbstractCardiacTissue<ELEMENT_DIM,SPACE_DIM>::ReplicateCaches()
     // which is not implemented with Purkinje. See commented code below if introducing this.
     assert(!mHasPurkinje);
 
+    if (mUseGhostedCaches)
+    {
+        // Only the halo values need communicating
+        mIionicCacheGhosted.UpdateGhosts();
+        mIntracellularStimulusCacheGhosted.UpdateGhosts();
+        return;
+    }
+
     mIionicCacheReplicated.Replicate(mpDistributedVectorFactory->GetLow(), mpDistributedVectorFactory->GetHigh());
     mIntracellularStimulusCacheReplicated.Replicate(mpDistributedVectorFactory->GetLow(), mpDistributedVectorFactory->GetHigh());
 
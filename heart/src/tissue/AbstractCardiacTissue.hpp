@@ -56,6 +56,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "AbstractConductivityTensors.hpp"
 #include "AbstractPurkinjeCellFactory.hpp"
 #include "ReplicatableVector.hpp"
+#include "GhostedVector.hpp"
+#include "DistributedVector.hpp"
 #include "HeartConfig.hpp"
 #include "ArchiveLocationInfo.hpp"
 #include "AbstractDynamicallyLoadableEntity.hpp"
@@ -150,6 +152,11 @@ private:
         assert(mpDistributedVectorFactory == mpMesh->GetDistributedVectorFactory());
         assert(mpDistributedVectorFactory->GetLow()==mpMesh->GetDistributedVectorFactory()->GetLow());
         assert(mpDistributedVectorFactory->GetLocalOwnership()==mpMesh->GetDistributedVectorFactory()->GetLocalOwnership());
+
+        if (version >= 4)
+        {
+            archive & mUseGhostedCaches;
+        }
     }
 
     /**
@@ -212,6 +219,14 @@ private:
         assert(mpDistributedVectorFactory->GetLocalOwnership()==mpMesh->GetDistributedVectorFactory()->GetLocalOwnership());
         // archive & mMeshUnarchived; Not archived since set to true when archiving constructor is called.
 
+        if (version >= 4)
+        {
+            bool use_ghosted_caches;
+            archive & use_ghosted_caches;
+            // The ghost layout depends on the (possibly new) partitioning, so is recomputed
+            SetUseGhostedCaches(use_ghosted_caches);
+        }
+
         // not archiving mpConductivityModifier for the time being (mechanics simulations are only use-case at the moment, and they
         // do not get archived...). mpConductivityModifier has to be reset to NULL upon load.
         mpConductivityModifier = NULL;
@@ -263,6 +278,20 @@ protected:
      */
     ReplicatableVector mPurkinjeIntracellularStimulusCacheReplicated;
 
+    /**
+     *  Cache containing the ionic currents for locally owned nodes and the
+     *  halo nodes of locally assembled elements.  Used instead of
+     *  #mIionicCacheReplicated when #mUseGhostedCaches is set.
+     */
+    GhostedVector mIionicCacheGhosted;
+
+    /**
+     *  Cache containing the stimulus currents for locally owned nodes and the
+     *  halo nodes of locally assembled elements.  Used instead of
+     *  #mIntracellularStimulusCacheReplicated when #mUseGhostedCaches is set.
+     */
+    GhostedVector mIntracellularStimulusCacheGhosted;
+
     /** Local pointer to the HeartConfig singleton instance, for convenience. */
     HeartConfig* mpConfig;
 
@@ -283,7 +312,7 @@ protected:
 
     /**
      * This class, if not NULL, will be used to modify the conductivity that is obtained from
-     * mpIntracellularConductivityTensors when rGetIntracellularConductivityTensor() is called.
+     * mpIntracellularConductivityTensors when GetIntracellularConductivityTensor() is called.
      * For example, it is required when conductivities become deformation dependent.
      */
     AbstractConductivityModifier<ELEMENT_DIM,SPACE_DIM>* mpConductivityModifier;
@@ -302,6 +331,47 @@ protected:
      */
     bool mDoCacheReplication;
 
+    /**
+     * Whether the Iionic and stimulus caches only hold locally owned and halo
+     * entries (#mIionicCacheGhosted etc.) rather than being the size of the
+     * whole problem on every process.
+     *
+     * Defaults to false.
+     */
+    bool mUseGhostedCaches;
+
+    /**
+     * Whether SolveCellSystems() should only start the halo exchange of ghosted
+     * caches, leaving FinishCacheReplication() to complete it.  Not archived; the
+     * solver which wants the overlap sets it.
+     *
+     * Defaults to false.
+     */
+    bool mOverlapCacheReplication;
+
+    /** Whether a halo exchange of the ghosted caches has been started but not finished. */
+    bool mCacheReplicationInProgress;
+
+    /**
+     * The number of threads with which SolveCellSystems() solves the cell models.
+     * Not archived.
+     *
+     * Defaults to 1.
+     */
+    unsigned mNumCellSolveThreads;
+
+    /**
+     * When solving the cells in threads, the ODE solvers for each thread: one for each
+     * distinct solver used by the local cells.  Thread 0 uses the cells' own solvers.
+     */
+    std::vector<std::vector<boost::shared_ptr<AbstractIvpOdeSolver> > > mThreadOdeSolvers;
+
+    /**
+     * When solving the cells in threads, the index into #mThreadOdeSolvers[thread] of the
+     * solver for each local cell, or UINT_MAX if the cell doesn't use one (e.g. CVODE cells).
+     */
+    std::vector<unsigned> mCellOdeSolverIndices;
+
     /**
      * Whether the mesh was unarchived or got from elsewhere.
      */
@@ -350,6 +420,20 @@ protected:
      */
     void SetUpHaloCells(AbstractCardiacCellFactory<ELEMENT_DIM,SPACE_DIM>* pCellFactory);
 
+    /**
+     * Solve the cell model at one node and update the caches, printing some diagnostic
+     * information if the solve fails.  Used by SolveCellSystems().
+     *
+     * @param globalIndex  global index of the node
+     * @param localIndex  local index of the node
+     * @param rVoltage  the voltage part of the current solution
+     * @param time  the current simulation time
+     * @param nextTime  when to simulate the cell until
+     * @param updateVoltage  whether to also solve for the voltage
+     */
+    void SolveCellSystem(unsigned globalIndex, unsigned localIndex, DistributedVector::Stripe& rVoltage,
+                         double time, double nextTime, bool updateVoltage);
+
 public:
     /**
      * This constructor is called from the Initialise() method of the CardiacProblem class.
@@ -391,10 +475,70 @@ public:
      */
     bool GetDoCacheReplication();
 
+    /**
+     * Set whether the Iionic and intracellular stimulus caches should only hold
+     * entries for locally owned nodes and for the other nodes of locally assembled
+     * elements, instead of being replicated in full on every process.
+     *
+     * This reduces memory use, and "replicating" the caches (when #mDoCacheReplication is set)
+     * only communicates the halo values.  While it is in use the caches should be read through
+     * GetIionicCacheValue() and GetIntracellularStimulusCacheValue().  This is collective.
+     *
+     * @param useGhostedCaches  whether to use ghosted caches
+     */
+    void SetUseGhostedCaches(bool useGhostedCaches=true);
+
+    /**
+     * @return whether the caches are ghosted rather than replicated.
+     */
+    bool GetUseGhostedCaches();
+
+    /**
+     * Set whether SolveCellSystems() should return as soon as the halo exchange of
+     * ghosted caches has been started, so that the caller can overlap it with work
+     * that only reads locally owned cache entries.  The caller must then call
+     * FinishCacheReplication() before reading any halo entry.  Has no effect unless
+     * ghosted caches are in use, since full replication cannot be split.
+     *
+     * @param overlapCacheReplication  whether to overlap cache replication
+     */
+    void SetOverlapCacheReplication(bool overlapCacheReplication=true);
+
+    /**
+     * @return whether cache replication is overlapped with the caller's work.
+     */
+    bool GetOverlapCacheReplication();
+
+    /**
+     * Complete a halo exchange of the caches started by SolveCellSystems(), if any.
+     * This is collective, and does nothing if no exchange is in progress.
+     */
+    void FinishCacheReplication();
+
+    /**
+     * Set the number of (OpenMP) threads with which SolveCellSystems() solves the cell
+     * models on this process.  Each thread gets its own copies of the cells' ODE solvers
+     * (see AbstractIvpOdeSolver::Clone()), and cells are handed out to threads dynamically,
+     * since their cost can vary a lot (e.g. near a wavefront).  Purkinje cells are always
+     * solved in serial, and nothing is threaded unless Chaste is compiled with OpenMP.
+     *
+     * Must be called again if the cells' solvers are changed.  Throws if any of them cannot
+     * be copied, or if any cell uses lookup tables (as PyCml "Opt" models do), since the
+     * interpolated rows of the tables are shared by all cells of the same class.
+     *
+     * @param numThreads  the number of threads (1, the default, to solve in serial)
+     */
+    void SetNumCellSolveThreads(unsigned numThreads);
+
+    /**
+     * @return the number of threads with which the cell models are solved.
+     */
+    unsigned GetNumCellSolveThreads();
+
     /** @return the intracellular conductivity tensor for the given element
      * @param elementIndex  index of the element of interest
      */
-    const c_matrix<double, SPACE_DIM, SPACE_DIM>& rGetIntracellularConductivityTensor(unsigned elementIndex);
+    c_matrix<double, SPACE_DIM, SPACE_DIM> GetIntracellularConductivityTensor(unsigned elementIndex);
 
     /**
      * @return the extracellular conductivity tensor for the given element
@@ -403,7 +547,7 @@ public:
      *
      * @param elementIndex  index of the element of interest
      */
-    virtual const c_matrix<double, SPACE_DIM, SPACE_DIM>& rGetExtracellularConductivityTensor(unsigned elementIndex);
+    virtual c_matrix<double, SPACE_DIM, SPACE_DIM> GetExtracellularConductivityTensor(unsigned elementIndex);
 
     /**
      * @return a pointer to a cell, indexed by the global node index.
@@ -446,10 +590,25 @@ public:
      */
     virtual void SolveCellSystems(Vec existingSolution, double time, double nextTime, bool updateVoltage=false);
 
-    /** @return the entire ionic current cache */
+    /** @return the entire ionic current cache (not available when using ghosted caches) */
     ReplicatableVector& rGetIionicCacheReplicated();
 
-    /** @return the entire stimulus current cache */
+    /**
+     * @return the cached ionic current at a node.  This works whether or not the caches are
+     * ghosted, for locally owned nodes and (once the caches have been replicated) halo nodes.
+     *
+     * @param globalIndex  global node index
+     */
+    double GetIionicCacheValue(unsigned globalIndex);
+
+    /**
+     * @return the cached intracellular stimulus current at a node.  See GetIionicCacheValue().
+     *
+     * @param globalIndex  global node index
+     */
+    double GetIntracellularStimulusCacheValue(unsigned globalIndex);
+
+    /** @return the entire stimulus current cache (not available when using ghosted caches) */
     ReplicatableVector& rGetIntracellularStimulusCacheReplicated();
 
     /** @return the entire Purkinje ionic current cache */
@@ -501,7 +660,7 @@ public:
 
     /**
      * Set a modifier class which will be used to modifier a conductivity obtained from mpIntracellularConductivityTensors
-     * when rGetIntracellularConductivityTensor() is called. For example, it is required when conductivities become deformation-dependent.
+     * when GetIntracellularConductivityTensor() is called. For example, it is required when conductivities become deformation-dependent.
      * @param pModifier Pointer to the concrete modifier class
      */
     void SetConductivityModifier(AbstractConductivityModifier<ELEMENT_DIM,SPACE_DIM>* pModifier);
@@ -739,7 +898,7 @@ template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 struct version<AbstractCardiacTissue<ELEMENT_DIM, SPACE_DIM> >
 {
     ///Macro to set the version number of templated archive in known versions of Boost
-    CHASTE_VERSION_CONTENT(3);
+    CHASTE_VERSION_CONTENT(4);
 };
 } // namespace serialization
 } // namespace boost
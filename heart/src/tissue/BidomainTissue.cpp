@@ -159,6 +159,7 @@ void BidomainTissue<SPACE_DIM>::CreateExtracellularConductivityTensors()
         mpExtracellularConductivityTensors->SetConstantConductivities(extra_conductivities);
     }
 
+    mpExtracellularConductivityTensors->SetUseCompactStorage(this->mpConfig->GetUseCompactConductivityTensors());
     mpExtracellularConductivityTensors->Init(this->mpMesh);
 }
 
@@ -173,7 +174,7 @@ BidomainTissue<SPACE_DIM>::~BidomainTissue()
 
 
 template <unsigned SPACE_DIM>
-const c_matrix<double, SPACE_DIM, SPACE_DIM>& BidomainTissue<SPACE_DIM>::rGetExtracellularConductivityTensor(unsigned elementIndex)
+c_matrix<double, SPACE_DIM, SPACE_DIM> BidomainTissue<SPACE_DIM>::GetExtracellularConductivityTensor(unsigned elementIndex)
 {
     assert(mpExtracellularConductivityTensors);
     if(this->mpConductivityModifier==NULL)
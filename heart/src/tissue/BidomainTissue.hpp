@@ -109,7 +109,7 @@ public:
      * @return the extracellular conductivity tensor for the given element
      * @param elementIndex  index of the element of interest
      */
-     const c_matrix<double, SPACE_DIM, SPACE_DIM>& rGetExtracellularConductivityTensor(unsigned elementIndex);
+     c_matrix<double, SPACE_DIM, SPACE_DIM> GetExtracellularConductivityTensor(unsigned elementIndex);
 };
 
 // Declare identifier for the serializer
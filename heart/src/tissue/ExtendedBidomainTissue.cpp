@@ -292,6 +292,7 @@ void ExtendedBidomainTissue<SPACE_DIM>::CreateIntracellularConductivityTensorSec
         mpIntracellularConductivityTensorsSecondCell->SetConstantConductivities(mIntracellularConductivitiesSecondCell);
     }
 
+    mpIntracellularConductivityTensorsSecondCell->SetUseCompactStorage(this->mpConfig->GetUseCompactConductivityTensors());
     mpIntracellularConductivityTensorsSecondCell->Init(this->mpMesh);
     HeartEventHandler::EndEvent(HeartEventHandler::READ_MESH);
 }
@@ -427,6 +428,7 @@ void ExtendedBidomainTissue<SPACE_DIM>::CreateExtracellularConductivityTensors()
     {
         mpExtracellularConductivityTensors->SetConstantConductivities(extra_conductivities);
     }
+    mpExtracellularConductivityTensors->SetUseCompactStorage(this->mpConfig->GetUseCompactConductivityTensors());
     mpExtracellularConductivityTensors->Init(this->mpMesh);
 }
 
@@ -468,7 +470,7 @@ c_vector<double, SPACE_DIM>  ExtendedBidomainTissue<SPACE_DIM>::GetIntracellular
 }
 
 template <unsigned SPACE_DIM>
-const c_matrix<double, SPACE_DIM, SPACE_DIM>& ExtendedBidomainTissue<SPACE_DIM>::rGetExtracellularConductivityTensor(unsigned elementIndex)
+c_matrix<double, SPACE_DIM, SPACE_DIM> ExtendedBidomainTissue<SPACE_DIM>::GetExtracellularConductivityTensor(unsigned elementIndex)
 {
     assert(mpExtracellularConductivityTensors);
     if (this->mpConductivityModifier==NULL)
@@ -482,7 +484,7 @@ const c_matrix<double, SPACE_DIM, SPACE_DIM>& ExtendedBidomainTissue<SPACE_DIM>:
 }
 
 template <unsigned SPACE_DIM>
-const c_matrix<double, SPACE_DIM, SPACE_DIM>& ExtendedBidomainTissue<SPACE_DIM>::rGetIntracellularConductivityTensorSecondCell(unsigned elementIndex)
+c_matrix<double, SPACE_DIM, SPACE_DIM> ExtendedBidomainTissue<SPACE_DIM>::GetIntracellularConductivityTensorSecondCell(unsigned elementIndex)
 {
     assert(mpIntracellularConductivityTensorsSecondCell);
     if (this->mpConductivityModifier==NULL)
@@ -315,13 +315,13 @@ public:
      * @return the extracellular conductivity tensor for the given element
      * @param elementIndex  index of the element of interest
      */
-     const c_matrix<double, SPACE_DIM, SPACE_DIM>& rGetExtracellularConductivityTensor(unsigned elementIndex);
+     c_matrix<double, SPACE_DIM, SPACE_DIM> GetExtracellularConductivityTensor(unsigned elementIndex);
 
      /**
       * @return the intracellular conductivity tensor for the given element for tehs econd cell
       * @param elementIndex  index of the element of interest
       */
-      const c_matrix<double, SPACE_DIM, SPACE_DIM>& rGetIntracellularConductivityTensorSecondCell(unsigned elementIndex);
+      c_matrix<double, SPACE_DIM, SPACE_DIM> GetIntracellularConductivityTensorSecondCell(unsigned elementIndex);
 
 
      /** @return the entire ionic current cache for the second cell*/
@@ -546,6 +546,83 @@ public:
         }
 
     }
+    void TestCompactStorageFromBinaryFibres() throw (Exception)
+    {
+        DistributedTetrahedralMesh<3,3> mesh;
+        mesh.ConstructCuboid(1,1,1);
+        std::vector<c_vector<double, 3> > non_constant_conductivities;
+        for (AbstractTetrahedralMesh<3,3>::ElementIterator it = mesh.GetElementIteratorBegin();
+             it != mesh.GetElementIteratorEnd();
+             ++it)
+        {
+            non_constant_conductivities.push_back((it->GetIndex()+1)*Create_c_vector(3.0,1.0,0.5));
+        }
+
+        // Full tensors from an ascii file...
+        OrthotropicConductivityTensors<3,3> ortho_tensors;
+        ortho_tensors.SetNonConstantConductivities(&non_constant_conductivities);
+        ortho_tensors.SetFibreOrientationFile(FileFinder("heart/test/data/fibre_tests/Orthotropic3D.ortho", RelativeTo::ChasteSourceRoot));
+        ortho_tensors.Init(&mesh);
+        TS_ASSERT(!ortho_tensors.GetUseCompactStorage());
+
+        // ...and compact ones from the equivalent binary file, read collectively
+        OrthotropicConductivityTensors<3,3> compact_ortho_tensors;
+        compact_ortho_tensors.SetUseCompactStorage();
+        TS_ASSERT(compact_ortho_tensors.GetUseCompactStorage());
+        compact_ortho_tensors.SetNonConstantConductivities(&non_constant_conductivities);
+        compact_ortho_tensors.SetFibreOrientationFile(FileFinder("heart/test/data/fibre_tests/Orthotropic3DBin.ortho", RelativeTo::ChasteSourceRoot));
+        compact_ortho_tensors.Init(&mesh);
+
+        AxisymmetricConductivityTensors<3,3> axi_tensors;
+        axi_tensors.SetConstantConductivities(Create_c_vector(3.0,1.0,1.0));
+        axi_tensors.SetFibreOrientationFile(FileFinder("heart/test/data/fibre_tests/SimpleAxisymmetric2.axi", RelativeTo::ChasteSourceRoot));
+        axi_tensors.Init(&mesh);
+
+        AxisymmetricConductivityTensors<3,3> compact_axi_tensors;
+        compact_axi_tensors.SetUseCompactStorage();
+        compact_axi_tensors.SetConstantConductivities(Create_c_vector(3.0,1.0,1.0));
+        compact_axi_tensors.SetFibreOrientationFile(FileFinder("heart/test/data/fibre_tests/SimpleAxisymmetric2Bin.axi", RelativeTo::ChasteSourceRoot));
+        compact_axi_tensors.Init(&mesh);
+
+        // Heterogeneous conductivities without fibres
+        OrthotropicConductivityTensors<3,3> compact_hetero_tensors;
+        compact_hetero_tensors.SetUseCompactStorage();
+        compact_hetero_tensors.SetNonConstantConductivities(&non_constant_conductivities);
+        compact_hetero_tensors.Init(&mesh);
+
+        unsigned local_element_index = 0;
+        for (AbstractTetrahedralMesh<3,3>::ElementIterator it = mesh.GetElementIteratorBegin();
+             it != mesh.GetElementIteratorEnd();
+             ++it)
+        {
+            unsigned element_index = it->GetIndex();
+            for (unsigned i=0; i<3; i++)
+            {
+                for (unsigned j=0; j<3; j++)
+                {
+                    // Directions are only held in single precision
+                    TS_ASSERT_DELTA(compact_ortho_tensors[element_index](i,j), ortho_tensors[element_index](i,j), 1e-5*(element_index+1));
+                    TS_ASSERT_DELTA(compact_axi_tensors[element_index](i,j), axi_tensors[element_index](i,j), 1e-5);
+                    TS_ASSERT_DELTA(compact_hetero_tensors[element_index](i,j),
+                                    (i==j ? non_constant_conductivities[local_element_index][i] : 0.0), 1e-12);
+                }
+            }
+            local_element_index++;
+        }
+
+        // Tensors are returned by value, so holding two at once is safe in compact mode
+        if (mesh.GetNumLocalElements() > 1)
+        {
+            AbstractTetrahedralMesh<3,3>::ElementIterator it = mesh.GetElementIteratorBegin();
+            unsigned first_index = it->GetIndex();
+            unsigned second_index = (++it)->GetIndex();
+            const c_matrix<double,3,3>& r_first = compact_hetero_tensors[first_index];
+            const c_matrix<double,3,3>& r_second = compact_hetero_tensors[second_index];
+            TS_ASSERT_DELTA(r_first(0,0), non_constant_conductivities[0][0], 1e-12);
+            TS_ASSERT_DELTA(r_second(0,0), non_constant_conductivities[1][0], 1e-12);
+            TS_ASSERT_DIFFERS(r_first(0,0), r_second(0,0));
+        }
+    }
 };
 
 #endif /*TESTFIBREORIENTATIONTENSORS_HPP_*/
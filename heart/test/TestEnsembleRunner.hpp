@@ -0,0 +1,239 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef TESTENSEMBLERUNNER_HPP_
+#define TESTENSEMBLERUNNER_HPP_
+
+#include <cxxtest/TestSuite.h>
+
+#include <cmath>
+#include <vector>
+#include <string>
+
+#include <hdf5.h>
+
+#include "AbstractEnsembleRunner.hpp"
+#include "OutputFileHandler.hpp"
+#include "PetscTools.hpp"
+#include "Warnings.hpp"
+#include "IsNan.hpp"
+#include "PetscSetupAndFinalize.hpp"
+
+/**
+ * A toy ensemble: task i produces (i, i^2), except that every seventh task fails.
+ */
+class ToyEnsembleRunner : public AbstractEnsembleRunner
+{
+private:
+    static std::vector<std::string> GetNames()
+    {
+        std::vector<std::string> names;
+        names.push_back("Index");
+        names.push_back("IndexSquared");
+        return names;
+    }
+
+protected:
+    std::vector<double> RunTask(unsigned taskIndex)
+    {
+        // Tasks run in isolation
+        TS_ASSERT(PetscTools::IsSequential());
+        TS_ASSERT(PetscTools::AmMaster());
+
+        if (taskIndex % 7 == 6)
+        {
+            EXCEPTION("Task " << taskIndex << " went wrong");
+        }
+        std::vector<double> summary;
+        summary.push_back(taskIndex);
+        summary.push_back(taskIndex*taskIndex);
+        return summary;
+    }
+
+public:
+    ToyEnsembleRunner(unsigned numTasks)
+        : AbstractEnsembleRunner(numTasks, GetNames())
+    {
+    }
+};
+
+class TestEnsembleRunner : public CxxTest::TestSuite
+{
+private:
+
+    /**
+     * Read the results file back in (on the master process).
+     */
+    void ReadResults(const std::string& rDirectory, unsigned numTasks,
+                     std::vector<double>& rSummary, std::vector<char>& rStatus)
+    {
+        OutputFileHandler handler(rDirectory, false);
+        std::string file_name = handler.GetOutputDirectoryFullPath() + "ensemble.h5";
+        rSummary.resize(2*numTasks);
+        rStatus.resize(numTasks);
+
+        hid_t file_id = H5Fopen(file_name.c_str(), H5F_ACC_RDONLY, H5P_DEFAULT);
+        TS_ASSERT_LESS_THAN(0, file_id);
+        hid_t summary_id = H5Dopen(file_id, "Summary", H5P_DEFAULT);
+        H5Dread(summary_id, H5T_NATIVE_DOUBLE, H5S_ALL, H5S_ALL, H5P_DEFAULT, &rSummary[0]);
+        H5Dclose(summary_id);
+        hid_t status_id = H5Dopen(file_id, "Status", H5P_DEFAULT);
+        H5Dread(status_id, H5T_NATIVE_CHAR, H5S_ALL, H5S_ALL, H5P_DEFAULT, &rStatus[0]);
+        H5Dclose(status_id);
+        H5Fclose(file_id);
+    }
+
+public:
+
+    void TestRunEnsemble() throw(Exception)
+    {
+        unsigned num_tasks = 50;
+        ToyEnsembleRunner runner(num_tasks);
+        unsigned num_left = runner.Run("TestEnsembleRunner", "ensemble");
+        TS_ASSERT_EQUALS(num_left, 0u);
+
+        // Every task was run exactly once, somewhere (by the workers, when there are any)
+        unsigned num_run_here = runner.GetNumTasksRunOnThisProcess();
+        unsigned total_run;
+        MPI_Allreduce(&num_run_here, &total_run, 1, MPI_UNSIGNED, MPI_SUM, PETSC_COMM_WORLD);
+        TS_ASSERT_EQUALS(total_run, num_tasks);
+        if (PetscTools::IsParallel() && PetscTools::AmMaster())
+        {
+            TS_ASSERT_EQUALS(num_run_here, 0u);
+        }
+        TS_ASSERT(!PetscTools::IsIsolated());
+
+        if (PetscTools::AmMaster())
+        {
+            std::vector<double> summary;
+            std::vector<char> status;
+            ReadResults("TestEnsembleRunner", num_tasks, summary, status);
+            for (unsigned i=0; i<num_tasks; i++)
+            {
+                if (i % 7 == 6)
+                {
+                    TS_ASSERT_EQUALS(status[i], AbstractEnsembleRunner::TASK_FAILED);
+                    TS_ASSERT(std::isnan(summary[2*i]));
+                }
+                else
+                {
+                    TS_ASSERT_EQUALS(status[i], AbstractEnsembleRunner::TASK_COMPLETED);
+                    TS_ASSERT_DELTA(summary[2*i], i, 1e-12);
+                    TS_ASSERT_DELTA(summary[2*i+1], i*i, 1e-12);
+                }
+            }
+        }
+
+        // Failures are reported as warnings, wherever they happened
+        unsigned num_warnings = Warnings::Instance()->GetNumWarnings();
+        unsigned total_warnings;
+        MPI_Allreduce(&num_warnings, &total_warnings, 1, MPI_UNSIGNED, MPI_SUM, PETSC_COMM_WORLD);
+        TS_ASSERT_EQUALS(total_warnings, 7u);
+        Warnings::QuietDestroy();
+    }
+
+    void TestResumeEnsemble() throw(Exception)
+    {
+        unsigned num_tasks = 20;
+        std::string dirname = "TestEnsembleRunnerResume";
+
+        // Only do some of the work...
+        {
+            ToyEnsembleRunner runner(num_tasks);
+            runner.SetMaxTasksPerRun(8);
+            TS_ASSERT_EQUALS(runner.Run(dirname, "ensemble"), 12u);
+
+            if (PetscTools::AmMaster())
+            {
+                std::vector<double> summary;
+                std::vector<char> status;
+                ReadResults(dirname, num_tasks, summary, status);
+                TS_ASSERT_EQUALS(status[7], AbstractEnsembleRunner::TASK_COMPLETED);
+                TS_ASSERT_EQUALS(status[8], AbstractEnsembleRunner::TASK_PENDING);
+                TS_ASSERT(std::isnan(summary[2*8]));
+            }
+        }
+
+        // ...then carry on where we left off
+        {
+            ToyEnsembleRunner runner(num_tasks);
+            TS_ASSERT_EQUALS(runner.Run(dirname, "ensemble", true), 0u);
+
+            unsigned num_run_here = runner.GetNumTasksRunOnThisProcess();
+            unsigned total_run;
+            MPI_Allreduce(&num_run_here, &total_run, 1, MPI_UNSIGNED, MPI_SUM, PETSC_COMM_WORLD);
+            TS_ASSERT_EQUALS(total_run, 12u);
+
+            if (PetscTools::AmMaster())
+            {
+                std::vector<double> summary;
+                std::vector<char> status;
+                ReadResults(dirname, num_tasks, summary, status);
+                for (unsigned i=0; i<num_tasks; i++)
+                {
+                    TS_ASSERT_DIFFERS(status[i], AbstractEnsembleRunner::TASK_PENDING);
+                }
+                TS_ASSERT_DELTA(summary[2*19+1], 361.0, 1e-12);
+            }
+        }
+
+        // A finished ensemble has nothing left to do
+        {
+            ToyEnsembleRunner runner(num_tasks);
+            TS_ASSERT_EQUALS(runner.Run(dirname, "ensemble", true), 0u);
+            TS_ASSERT_EQUALS(runner.GetNumTasksRunOnThisProcess(), 0u);
+        }
+
+        // But a different ensemble can't resume from this file
+        {
+            ToyEnsembleRunner runner(num_tasks + 1);
+            TS_ASSERT_THROWS_CONTAINS(runner.Run(dirname, "ensemble", true),
+                                      "it holds results for a different ensemble.");
+        }
+        Warnings::QuietDestroy();
+    }
+
+    void TestExceptions() throw(Exception)
+    {
+        // Each task isolates its process, so the ensemble itself must start with all processes working together
+        ToyEnsembleRunner runner(10);
+        PetscTools::IsolateProcesses(true);
+        TS_ASSERT_THROWS_THIS(runner.Run("TestEnsembleRunnerExceptions", "ensemble"),
+                              "An ensemble cannot be run while processes are isolated.");
+        PetscTools::IsolateProcesses(false);
+    }
+};
+
+#endif /*TESTENSEMBLERUNNER_HPP_*/
@@ -225,22 +225,22 @@ public:
 
         if (mesh.CalculateDesignatedOwnershipOfElement(0u))
         {
-             TS_ASSERT_EQUALS(bidomain_tissue.rGetIntracellularConductivityTensor(0u)(0,0),1.0);//within first cuboid
-             TS_ASSERT_EQUALS(bidomain_tissue.rGetExtracellularConductivityTensor(0u)(0,0),51.0);//within first cuboid
+             TS_ASSERT_EQUALS(bidomain_tissue.GetIntracellularConductivityTensor(0u)(0,0),1.0);//within first cuboid
+             TS_ASSERT_EQUALS(bidomain_tissue.GetExtracellularConductivityTensor(0u)(0,0),51.0);//within first cuboid
         }
 
         if (mesh.CalculateDesignatedOwnershipOfElement(4u))
         {
-            TS_ASSERT_EQUALS(bidomain_tissue.rGetIntracellularConductivityTensor(4u)(0,0),11.0);//within second cuboid
-            TS_ASSERT_EQUALS(bidomain_tissue.rGetIntracellularConductivityTensor(4u)(1,1),22.0);//within second cuboid
-            TS_ASSERT_EQUALS(bidomain_tissue.rGetExtracellularConductivityTensor(4u)(0,0),151.0);//within second cuboid
-            TS_ASSERT_EQUALS(bidomain_tissue.rGetExtracellularConductivityTensor(4u)(1,1),152.0);//within second cuboid
+            TS_ASSERT_EQUALS(bidomain_tissue.GetIntracellularConductivityTensor(4u)(0,0),11.0);//within second cuboid
+            TS_ASSERT_EQUALS(bidomain_tissue.GetIntracellularConductivityTensor(4u)(1,1),22.0);//within second cuboid
+            TS_ASSERT_EQUALS(bidomain_tissue.GetExtracellularConductivityTensor(4u)(0,0),151.0);//within second cuboid
+            TS_ASSERT_EQUALS(bidomain_tissue.GetExtracellularConductivityTensor(4u)(1,1),152.0);//within second cuboid
         }
 
         if (mesh.CalculateDesignatedOwnershipOfElement(8u))
         {
-            TS_ASSERT_EQUALS(bidomain_tissue.rGetIntracellularConductivityTensor(8u)(0,0),15.0);//elsewhere, e.g. element 8
-            TS_ASSERT_EQUALS(bidomain_tissue.rGetExtracellularConductivityTensor(8u)(0,0),65.0);//elsewhere, e.g. element 8
+            TS_ASSERT_EQUALS(bidomain_tissue.GetIntracellularConductivityTensor(8u)(0,0),15.0);//elsewhere, e.g. element 8
+            TS_ASSERT_EQUALS(bidomain_tissue.GetExtracellularConductivityTensor(8u)(0,0),65.0);//elsewhere, e.g. element 8
         }
 
 
@@ -302,15 +302,15 @@ public:
         //CreateIntracellularConductivityTensor called in the constructor
         BidomainTissue<3> bidomain_tissue( &cell_factory_for_het );
 
-        TS_ASSERT_EQUALS(bidomain_tissue.rGetIntracellularConductivityTensor(0u)(0,0),1.0);//within first ellipsoid
-        TS_ASSERT_EQUALS(bidomain_tissue.rGetIntracellularConductivityTensor(4u)(0,0),11.0);//within second ellipsoid
-        TS_ASSERT_EQUALS(bidomain_tissue.rGetIntracellularConductivityTensor(4u)(1,1),22.0);//within second ellipsoid
-        TS_ASSERT_EQUALS(bidomain_tissue.rGetIntracellularConductivityTensor(8u)(0,0),15.0);//elsewhere, e.g. element 8
+        TS_ASSERT_EQUALS(bidomain_tissue.GetIntracellularConductivityTensor(0u)(0,0),1.0);//within first ellipsoid
+        TS_ASSERT_EQUALS(bidomain_tissue.GetIntracellularConductivityTensor(4u)(0,0),11.0);//within second ellipsoid
+        TS_ASSERT_EQUALS(bidomain_tissue.GetIntracellularConductivityTensor(4u)(1,1),22.0);//within second ellipsoid
+        TS_ASSERT_EQUALS(bidomain_tissue.GetIntracellularConductivityTensor(8u)(0,0),15.0);//elsewhere, e.g. element 8
 
-        TS_ASSERT_EQUALS(bidomain_tissue.rGetExtracellularConductivityTensor(0u)(0,0),51.0);//within first ellipsoid
-        TS_ASSERT_EQUALS(bidomain_tissue.rGetExtracellularConductivityTensor(4u)(0,0),151.0);//within second ellipsoid
-        TS_ASSERT_EQUALS(bidomain_tissue.rGetExtracellularConductivityTensor(4u)(1,1),152.0);//within second ellipsoid
-        TS_ASSERT_EQUALS(bidomain_tissue.rGetExtracellularConductivityTensor(8u)(0,0),65.0);//elsewhere, e.g. element 8
+        TS_ASSERT_EQUALS(bidomain_tissue.GetExtracellularConductivityTensor(0u)(0,0),51.0);//within first ellipsoid
+        TS_ASSERT_EQUALS(bidomain_tissue.GetExtracellularConductivityTensor(4u)(0,0),151.0);//within second ellipsoid
+        TS_ASSERT_EQUALS(bidomain_tissue.GetExtracellularConductivityTensor(4u)(1,1),152.0);//within second ellipsoid
+        TS_ASSERT_EQUALS(bidomain_tissue.GetExtracellularConductivityTensor(8u)(0,0),65.0);//elsewhere, e.g. element 8
     }
 
     void TestSaveAndLoadCardiacPDE()
@@ -354,8 +354,8 @@ public:
                 HeartConfig::Instance()->SetPrintingTimeStep(saved_printing_timestep);
                 TS_ASSERT_DELTA(HeartConfig::Instance()->GetPrintingTimeStep(), saved_printing_timestep, 1e-9);
 
-                intra_tensor_before_archiving = bidomain_tissue.rGetIntracellularConductivityTensor(0);
-                extra_tensor_before_archiving = bidomain_tissue.rGetExtracellularConductivityTensor(0);
+                intra_tensor_before_archiving = bidomain_tissue.GetIntracellularConductivityTensor(0);
+                extra_tensor_before_archiving = bidomain_tissue.GetExtracellularConductivityTensor(0);
 
                 // Save
                 ArchiveOpener<boost::archive::text_oarchive, std::ofstream> arch_opener(archive_dir, archive_file);
@@ -378,8 +378,8 @@ public:
 
                 assert(p_bidomain_tissue!=NULL);
 
-                const c_matrix<double, 3, 3>& intra_tensor_after_archiving = p_bidomain_tissue->rGetIntracellularConductivityTensor(0);
-                const c_matrix<double, 3, 3>& extra_tensor_after_archiving = dynamic_cast<BidomainTissue<3>*>(p_bidomain_tissue)->rGetExtracellularConductivityTensor(0); //Naughty Gary using dynamic cast, but only for testing...
+                const c_matrix<double, 3, 3>& intra_tensor_after_archiving = p_bidomain_tissue->GetIntracellularConductivityTensor(0);
+                const c_matrix<double, 3, 3>& extra_tensor_after_archiving = dynamic_cast<BidomainTissue<3>*>(p_bidomain_tissue)->GetExtracellularConductivityTensor(0); //Naughty Gary using dynamic cast, but only for testing...
 
                 for(unsigned i=0; i<3; i++)
                 {
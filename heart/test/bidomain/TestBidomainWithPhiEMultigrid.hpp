@@ -0,0 +1,190 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef TESTBIDOMAINWITHPHIEMULTIGRID_HPP_
+#define TESTBIDOMAINWITHPHIEMULTIGRID_HPP_
+
+#include <cxxtest/TestSuite.h>
+#include <algorithm>
+#include <vector>
+
+#include "BidomainProblem.hpp"
+#include "LuoRudy1991.hpp"
+#include "PlaneStimulusCellFactory.hpp"
+#include "TetrahedralMesh.hpp"
+#include "DistributedTetrahedralMesh.hpp"
+#include "HeartRegionCodes.hpp"
+#include "HeartConfig.hpp"
+#include "ReplicatableVector.hpp"
+#include "PetscSetupAndFinalize.hpp"
+
+/**
+ * Bidomain problem with a bath which records the largest number of KSP iterations
+ * taken by any of its linear solves.
+ */
+class IterationCountingBidomainProblem : public BidomainProblem<2>
+{
+private:
+    /** The largest number of iterations taken by a linear solve. */
+    unsigned mMaxNumIterations;
+
+public:
+    /**
+     * Constructor.
+     * @param pCellFactory  the cell factory
+     */
+    IterationCountingBidomainProblem(AbstractCardiacCellFactory<2>* pCellFactory)
+        : BidomainProblem<2>(pCellFactory, true),
+          mMaxNumIterations(0u)
+    {
+    }
+
+    /**
+     * Record the iterations taken by the last linear solve.
+     * @param time  the current time
+     */
+    void OnEndOfTimestep(double time)
+    {
+        BidomainProblem<2>::OnEndOfTimestep(time);
+        mMaxNumIterations = std::max(mMaxNumIterations, this->mpSolver->GetLinearSystem()->GetNumIterations());
+    }
+
+    /** @return the largest number of iterations taken by a linear solve. */
+    unsigned GetMaxNumIterations()
+    {
+        return mMaxNumIterations;
+    }
+};
+
+class TestBidomainWithPhiEMultigrid : public CxxTest::TestSuite
+{
+private:
+
+    /**
+     * Solve a 2D bidomain problem with a bath strip, on a regular slab mesh.
+     *
+     * @param rPreconditioner  the KSP preconditioner
+     * @param useMultigrid  whether to use geometric multigrid, rather than AMG, on the phi_e block
+     * @param rSolution  filled in with the solution at the end time
+     * @return the largest number of iterations taken by a linear solve
+     */
+    unsigned SolveWithBath(const std::string& rPreconditioner, bool useMultigrid, std::vector<double>& rSolution)
+    {
+        HeartConfig::Instance()->Reset();
+        HeartConfig::Instance()->SetSimulationDuration(0.5); //ms
+        // Print every PDE step, so that every linear solve is counted
+        HeartConfig::Instance()->SetOdePdeAndPrintingTimeSteps(0.01, 0.05, 0.05);
+        HeartConfig::Instance()->SetKSPSolver("gmres");
+        HeartConfig::Instance()->SetKSPPreconditioner(rPreconditioner.c_str());
+        HeartConfig::Instance()->SetUseAbsoluteTolerance(1e-6);
+        HeartConfig::Instance()->SetOutputDirectory("BidomainWithPhiEMultigrid");
+        HeartConfig::Instance()->SetOutputFilenamePrefix(rPreconditioner + (useMultigrid ? "_multigrid" : "_amg"));
+
+        // Nested regular meshes, with the right-hand quarter of the domain being bath
+        DistributedTetrahedralMesh<2,2> mesh;
+        mesh.ConstructRegularSlabMesh(0.0125, 0.2, 0.2);
+        for (AbstractTetrahedralMesh<2,2>::ElementIterator iter = mesh.GetElementIteratorBegin();
+             iter != mesh.GetElementIteratorEnd();
+             ++iter)
+        {
+            if (iter->CalculateCentroid()[0] > 0.15)
+            {
+                iter->SetAttribute(HeartRegionCode::GetValidBathId());
+            }
+        }
+        TetrahedralMesh<2,2> coarsest_mesh;
+        coarsest_mesh.ConstructRegularSlabMesh(0.05, 0.2, 0.2);
+        TetrahedralMesh<2,2> coarse_mesh;
+        coarse_mesh.ConstructRegularSlabMesh(0.025, 0.2, 0.2);
+        std::vector<TetrahedralMesh<2,2>*> coarse_meshes;
+        coarse_meshes.push_back(&coarsest_mesh);
+        coarse_meshes.push_back(&coarse_mesh);
+
+        PlaneStimulusCellFactory<CellLuoRudy1991FromCellML, 2> cell_factory(-600.0*1000);
+        IterationCountingBidomainProblem bidomain_problem(&cell_factory);
+        bidomain_problem.SetMesh(&mesh);
+
+        // No electrodes, so phi_e is only fixed by the average-phi_e row
+        bidomain_problem.SetNodeForAverageOfPhiZeroed(0);
+        if (useMultigrid)
+        {
+            bidomain_problem.SetPhiEMultigridCoarseMeshes(coarse_meshes);
+        }
+        bidomain_problem.Initialise();
+        bidomain_problem.Solve();
+
+        ReplicatableVector solution(bidomain_problem.GetSolution());
+        rSolution.assign(solution.GetSize(), 0.0);
+        for (unsigned i=0; i<solution.GetSize(); i++)
+        {
+            rSolution[i] = solution[i];
+        }
+        return bidomain_problem.GetMaxNumIterations();
+    }
+
+public:
+
+    void TestMultigridMatchesAmg() throw(Exception)
+    {
+        std::vector<std::string> preconditioners;
+        preconditioners.push_back("blockdiagonal");
+        preconditioners.push_back("ldufactorisation");
+
+        for (unsigned i=0; i<preconditioners.size(); i++)
+        {
+            std::vector<double> amg_solution;
+            std::vector<double> multigrid_solution;
+            SolveWithBath(preconditioners[i], false, amg_solution);
+            unsigned multigrid_iterations = SolveWithBath(preconditioners[i], true, multigrid_solution);
+
+            TS_ASSERT_EQUALS(multigrid_solution.size(), amg_solution.size());
+            for (unsigned j=0; j<amg_solution.size(); j++)
+            {
+                TS_ASSERT_DELTA(multigrid_solution[j], amg_solution[j], 1e-3);
+            }
+
+            // The stimulated edge has depolarised
+            TS_ASSERT_LESS_THAN(0.0, multigrid_solution[0]);
+
+            // The multigrid hierarchy preconditions the singular, bath-containing phi_e block effectively
+            TS_ASSERT_LESS_THAN(0u, multigrid_iterations);
+            TS_ASSERT_LESS_THAN(multigrid_iterations, 50u);
+        }
+
+        HeartConfig::Instance()->Reset();
+    }
+};
+
+#endif /*TESTBIDOMAINWITHPHIEMULTIGRID_HPP_*/
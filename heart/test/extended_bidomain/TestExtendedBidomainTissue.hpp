@@ -303,23 +303,23 @@ public:
         extended_bidomain_tissue.CreateIntracellularConductivityTensorSecondCell();
 
         //first cell
-//        TS_ASSERT_EQUALS(extended_bidomain_tissue.rGetIntracellularConductivityTensor(0u)(0,0),1.0);//within first cuboid
+//        TS_ASSERT_EQUALS(extended_bidomain_tissue.GetIntracellularConductivityTensor(0u)(0,0),1.0);//within first cuboid
         //Line above commented due to curious problem with IntelProduction interprocedural optimisation
-        TS_ASSERT_EQUALS(extended_bidomain_tissue.rGetIntracellularConductivityTensor(4u)(0,0),11.0);//within second cuboid
-        TS_ASSERT_EQUALS(extended_bidomain_tissue.rGetIntracellularConductivityTensor(4u)(1,1),22.0);//within second cuboid
-        TS_ASSERT_EQUALS(extended_bidomain_tissue.rGetIntracellularConductivityTensor(8u)(0,0),15.0);//elsewhere, e.g. element 8
+        TS_ASSERT_EQUALS(extended_bidomain_tissue.GetIntracellularConductivityTensor(4u)(0,0),11.0);//within second cuboid
+        TS_ASSERT_EQUALS(extended_bidomain_tissue.GetIntracellularConductivityTensor(4u)(1,1),22.0);//within second cuboid
+        TS_ASSERT_EQUALS(extended_bidomain_tissue.GetIntracellularConductivityTensor(8u)(0,0),15.0);//elsewhere, e.g. element 8
 
         //second cell, should be the same as first cell
-        TS_ASSERT_EQUALS(extended_bidomain_tissue.rGetIntracellularConductivityTensorSecondCell(0u)(0,0),1.0);//within first cuboid
-        TS_ASSERT_EQUALS(extended_bidomain_tissue.rGetIntracellularConductivityTensorSecondCell(4u)(0,0),11.0);//within second cuboid
-        TS_ASSERT_EQUALS(extended_bidomain_tissue.rGetIntracellularConductivityTensorSecondCell(4u)(1,1),22.0);//within second cuboid
-        TS_ASSERT_EQUALS(extended_bidomain_tissue.rGetIntracellularConductivityTensorSecondCell(8u)(0,0),15.0);//elsewhere, e.g. element 8
+        TS_ASSERT_EQUALS(extended_bidomain_tissue.GetIntracellularConductivityTensorSecondCell(0u)(0,0),1.0);//within first cuboid
+        TS_ASSERT_EQUALS(extended_bidomain_tissue.GetIntracellularConductivityTensorSecondCell(4u)(0,0),11.0);//within second cuboid
+        TS_ASSERT_EQUALS(extended_bidomain_tissue.GetIntracellularConductivityTensorSecondCell(4u)(1,1),22.0);//within second cuboid
+        TS_ASSERT_EQUALS(extended_bidomain_tissue.GetIntracellularConductivityTensorSecondCell(8u)(0,0),15.0);//elsewhere, e.g. element 8
 
         //sigma_e
-        TS_ASSERT_EQUALS(extended_bidomain_tissue.rGetExtracellularConductivityTensor(0u)(0,0),51.0);//within first cuboid
-        TS_ASSERT_EQUALS(extended_bidomain_tissue.rGetExtracellularConductivityTensor(4u)(0,0),151.0);//within second cuboid
-        TS_ASSERT_EQUALS(extended_bidomain_tissue.rGetExtracellularConductivityTensor(4u)(1,1),152.0);//within second cuboid
-        TS_ASSERT_EQUALS(extended_bidomain_tissue.rGetExtracellularConductivityTensor(8u)(0,0),65.0);//elsewhere, e.g. element 8
+        TS_ASSERT_EQUALS(extended_bidomain_tissue.GetExtracellularConductivityTensor(0u)(0,0),51.0);//within first cuboid
+        TS_ASSERT_EQUALS(extended_bidomain_tissue.GetExtracellularConductivityTensor(4u)(0,0),151.0);//within second cuboid
+        TS_ASSERT_EQUALS(extended_bidomain_tissue.GetExtracellularConductivityTensor(4u)(1,1),152.0);//within second cuboid
+        TS_ASSERT_EQUALS(extended_bidomain_tissue.GetExtracellularConductivityTensor(8u)(0,0),65.0);//elsewhere, e.g. element 8
 
     }
 
@@ -384,22 +384,22 @@ public:
        extended_bidomain_tissue.CreateIntracellularConductivityTensorSecondCell();
 
        //first cell
-       TS_ASSERT_EQUALS(extended_bidomain_tissue.rGetIntracellularConductivityTensor(0u)(0,0),1.0);//within first cuboid
-       TS_ASSERT_EQUALS(extended_bidomain_tissue.rGetIntracellularConductivityTensor(1u)(0,0),30.0);//within no cuboid (modified from 15 to 30!)
-       TS_ASSERT_EQUALS(extended_bidomain_tissue.rGetIntracellularConductivityTensor(2u)(1,1),22.0);//within second cuboid
-       TS_ASSERT_EQUALS(extended_bidomain_tissue.rGetIntracellularConductivityTensor(3u)(0,0),15.0);//within no cuboid
+       TS_ASSERT_EQUALS(extended_bidomain_tissue.GetIntracellularConductivityTensor(0u)(0,0),1.0);//within first cuboid
+       TS_ASSERT_EQUALS(extended_bidomain_tissue.GetIntracellularConductivityTensor(1u)(0,0),30.0);//within no cuboid (modified from 15 to 30!)
+       TS_ASSERT_EQUALS(extended_bidomain_tissue.GetIntracellularConductivityTensor(2u)(1,1),22.0);//within second cuboid
+       TS_ASSERT_EQUALS(extended_bidomain_tissue.GetIntracellularConductivityTensor(3u)(0,0),15.0);//within no cuboid
 
        //second cell, should be the same as first cell
-       TS_ASSERT_EQUALS(extended_bidomain_tissue.rGetIntracellularConductivityTensorSecondCell(0u)(0,0),1.0);//within first cuboid
-       TS_ASSERT_EQUALS(extended_bidomain_tissue.rGetIntracellularConductivityTensorSecondCell(1u)(0,0),30.0);//within no cuboid (modified from 15 to 30!)
-       TS_ASSERT_EQUALS(extended_bidomain_tissue.rGetIntracellularConductivityTensorSecondCell(2u)(1,1),22.0);//within second cuboid
-       TS_ASSERT_EQUALS(extended_bidomain_tissue.rGetIntracellularConductivityTensorSecondCell(3u)(0,0),15.0);//within no cuboid
+       TS_ASSERT_EQUALS(extended_bidomain_tissue.GetIntracellularConductivityTensorSecondCell(0u)(0,0),1.0);//within first cuboid
+       TS_ASSERT_EQUALS(extended_bidomain_tissue.GetIntracellularConductivityTensorSecondCell(1u)(0,0),30.0);//within no cuboid (modified from 15 to 30!)
+       TS_ASSERT_EQUALS(extended_bidomain_tissue.GetIntracellularConductivityTensorSecondCell(2u)(1,1),22.0);//within second cuboid
+       TS_ASSERT_EQUALS(extended_bidomain_tissue.GetIntracellularConductivityTensorSecondCell(3u)(0,0),15.0);//within no cuboid
 
        //sigma_e
-       TS_ASSERT_EQUALS(extended_bidomain_tissue.rGetExtracellularConductivityTensor(0u)(0,0),51.0);//within first cuboid
-       TS_ASSERT_EQUALS(extended_bidomain_tissue.rGetExtracellularConductivityTensor(1u)(0,0),130.0);//within no cuboid (modified from 65 to 130!)
-       TS_ASSERT_EQUALS(extended_bidomain_tissue.rGetExtracellularConductivityTensor(2u)(1,1),152.0);//within second cuboid
-       TS_ASSERT_EQUALS(extended_bidomain_tissue.rGetExtracellularConductivityTensor(3u)(0,0),65.0);//within no cuboid
+       TS_ASSERT_EQUALS(extended_bidomain_tissue.GetExtracellularConductivityTensor(0u)(0,0),51.0);//within first cuboid
+       TS_ASSERT_EQUALS(extended_bidomain_tissue.GetExtracellularConductivityTensor(1u)(0,0),130.0);//within no cuboid (modified from 65 to 130!)
+       TS_ASSERT_EQUALS(extended_bidomain_tissue.GetExtracellularConductivityTensor(2u)(1,1),152.0);//within second cuboid
+       TS_ASSERT_EQUALS(extended_bidomain_tissue.GetExtracellularConductivityTensor(3u)(0,0),65.0);//within no cuboid
    }
 
     void TestExtendedTissueHeterogeneousGgap3D() throw (Exception)
@@ -588,9 +588,9 @@ public:
             HeartConfig::Instance()->SetPrintingTimeStep(saved_printing_timestep);
             TS_ASSERT_DELTA(HeartConfig::Instance()->GetPrintingTimeStep(), saved_printing_timestep, 1e-9);
 
-            intra_tensor_before_archiving = extended_tissue.rGetIntracellularConductivityTensor(0);
-            intra_tensor_second_cell_before_archiving = extended_tissue.rGetIntracellularConductivityTensorSecondCell(0);
-            extra_tensor_before_archiving = extended_tissue.rGetExtracellularConductivityTensor(0);
+            intra_tensor_before_archiving = extended_tissue.GetIntracellularConductivityTensor(0);
+            intra_tensor_second_cell_before_archiving = extended_tissue.GetIntracellularConductivityTensorSecondCell(0);
+            extra_tensor_before_archiving = extended_tissue.GetExtracellularConductivityTensor(0);
 
             // Save
             ArchiveOpener<boost::archive::text_oarchive, std::ofstream> arch_opener(archive_dir, archive_file);
@@ -616,9 +616,9 @@ public:
             ExtendedBidomainTissue<3>* p_extended_tissue = dynamic_cast<ExtendedBidomainTissue<3>*>(p_abstract_tissue);
             assert(p_extended_tissue != NULL);
 
-            const c_matrix<double, 3, 3>& intra_tensor_after_archiving = p_extended_tissue->rGetIntracellularConductivityTensor(0);
-            const c_matrix<double, 3, 3>& intra_tensor_second_cell_after_archiving = p_extended_tissue->rGetIntracellularConductivityTensorSecondCell(0);
-            const c_matrix<double, 3, 3>& extra_tensor_after_archiving = p_extended_tissue->rGetExtracellularConductivityTensor(0);
+            const c_matrix<double, 3, 3>& intra_tensor_after_archiving = p_extended_tissue->GetIntracellularConductivityTensor(0);
+            const c_matrix<double, 3, 3>& intra_tensor_second_cell_after_archiving = p_extended_tissue->GetIntracellularConductivityTensorSecondCell(0);
+            const c_matrix<double, 3, 3>& extra_tensor_after_archiving = p_extended_tissue->GetExtracellularConductivityTensor(0);
 
             //check before archiving = after archiving
             for(unsigned i=0; i<3; i++)
@@ -443,6 +443,72 @@ public:
         }
     }
 
+    void TestReadingSetsOfFibres() throw (Exception)
+    {
+        // Read a subset of the lines, with a gap, as a process would for its own elements
+        std::vector<unsigned> indices;
+        indices.push_back(0u);
+        indices.push_back(1u);
+        indices.push_back(2u);
+        indices.push_back(4u);
+        indices.push_back(5u);
+
+        FileFinder ortho_finder("heart/test/data/fibre_tests/Orthotropic3D.ortho", RelativeTo::ChasteSourceRoot);
+        FileFinder ortho_finder_bin("heart/test/data/fibre_tests/Orthotropic3DBin.ortho", RelativeTo::ChasteSourceRoot);
+        FibreReader<3> single_reader(ortho_finder, ORTHO);
+        FibreReader<3> ascii_reader(ortho_finder, ORTHO);
+        FibreReader<3> binary_reader(ortho_finder_bin, ORTHO);
+
+        std::vector<c_matrix<double,3,3> > ascii_matrices;
+        std::vector<c_matrix<double,3,3> > binary_matrices;
+        ascii_reader.GetFibreSheetAndNormalMatrices(indices, ascii_matrices);
+        binary_reader.GetFibreSheetAndNormalMatrices(indices, binary_matrices);
+        TS_ASSERT_EQUALS(ascii_matrices.size(), indices.size());
+        TS_ASSERT_EQUALS(binary_matrices.size(), indices.size());
+        for (unsigned i=0; i<indices.size(); i++)
+        {
+            c_matrix<double,3,3> matrix;
+            single_reader.GetFibreSheetAndNormalMatrix(indices[i], matrix);
+            TS_ASSERT_DELTA(UblasMatrixInfinityNorm<3>(ascii_matrices[i] - matrix), 0.0, 1e-9);
+            TS_ASSERT_DELTA(UblasMatrixInfinityNorm<3>(binary_matrices[i] - matrix), 0.0, 1e-9);
+        }
+        std::vector<c_vector<double,3> > wrong_vectors;
+        TS_ASSERT_THROWS_THIS(binary_reader.GetFibreVectors(indices, wrong_vectors),
+                              "Use GetFibreSheetAndNormalMatrices when reading orthotropic fibres");
+
+        FileFinder axi_finder("heart/test/data/fibre_tests/SimpleAxisymmetric2.axi", RelativeTo::ChasteSourceRoot);
+        FileFinder axi_finder_bin("heart/test/data/fibre_tests/SimpleAxisymmetric2Bin.axi", RelativeTo::ChasteSourceRoot);
+        FibreReader<3> single_axi_reader(axi_finder, AXISYM);
+        FibreReader<3> binary_axi_reader(axi_finder_bin, AXISYM);
+
+        std::vector<c_vector<double,3> > binary_vectors;
+        binary_axi_reader.GetFibreVectors(indices, binary_vectors);
+        TS_ASSERT_EQUALS(binary_vectors.size(), indices.size());
+        for (unsigned i=0; i<indices.size(); i++)
+        {
+            c_vector<double,3> vector;
+            single_axi_reader.GetFibreVector(indices[i], vector);
+            TS_ASSERT_DELTA(norm_inf(binary_vectors[i] - vector), 0.0, 1e-9);
+        }
+
+        // Reading nothing is fine
+        std::vector<unsigned> no_indices;
+        binary_axi_reader.GetFibreVectors(no_indices, binary_vectors);
+        TS_ASSERT(binary_vectors.empty());
+
+        std::vector<unsigned> bad_indices;
+        bad_indices.push_back(2u);
+        bad_indices.push_back(1u);
+        TS_ASSERT_THROWS_THIS(binary_axi_reader.GetFibreVectors(bad_indices, binary_vectors),
+                              "Fibre reads must be monotonically increasing; 1 is before expected next index 3");
+        bad_indices[0] = 6u;
+        bad_indices.resize(1u);
+        TS_ASSERT_THROWS_CONTAINS(binary_axi_reader.GetFibreVectors(bad_indices, binary_vectors),
+                                  "Fibre index 6 is beyond the end of");
+        TS_ASSERT_THROWS_THIS(binary_axi_reader.GetFibreSheetAndNormalMatrices(indices, binary_matrices),
+                              "Use GetFibreVectors when reading axisymmetric fibres");
+    }
+
 };
 
 
@@ -357,6 +357,60 @@ public:
 #endif
     }
 
+    void TestCellmlConverterCache() throw(Exception)
+    {
+        std::string dirname = "TestCellmlConverterCache";
+        std::string model = "luo_rudy_1991_dyn";
+        std::string so_name = "lib" + model + "." + CellMLToSharedLibraryConverter::msSoSuffix;
+        OutputFileHandler handler(dirname + "/model");
+        OutputFileHandler cache_handler(dirname + "/cache");
+        FileFinder cellml_file_src("heart/dynamic/" + model + ".cellml", RelativeTo::ChasteSourceRoot);
+        FileFinder cellml_file = handler.CopyFileTo(cellml_file_src);
+
+        CellMLToSharedLibraryConverter converter;
+        TS_ASSERT_THROWS_THIS(converter.GetCacheEntryFolder(cellml_file),
+                              "No cache folder has been set for CellML conversion.");
+        converter.SetCacheFolder(cache_handler.FindFile(""));
+
+        // The first conversion builds into the cache, not next to the .cellml file
+        FileFinder cache_entry = converter.GetCacheEntryFolder(cellml_file);
+        FileFinder cached_so_file(so_name, cache_entry);
+        TS_ASSERT(!cached_so_file.Exists());
+        DynamicCellModelLoaderPtr p_loader = converter.Convert(cellml_file);
+        TS_ASSERT(cached_so_file.Exists());
+        TS_ASSERT(!handler.FindFile(so_name).Exists());
+        RunLr91Test(*p_loader, 0u);
+
+        // An identical model elsewhere is found in the cache, so doesn't even need a collective call
+        OutputFileHandler copy_handler(dirname + "/copy");
+        FileFinder cellml_copy = copy_handler.CopyFileTo(cellml_file_src);
+        CellMLToSharedLibraryConverter other_converter;
+        other_converter.SetCacheFolder(cache_handler.FindFile(""));
+        TS_ASSERT_EQUALS(other_converter.GetCacheEntryFolder(cellml_copy).GetAbsolutePath(), cache_entry.GetAbsolutePath());
+        DynamicCellModelLoaderPtr p_loader2 = other_converter.Convert(cellml_copy, false);
+        TS_ASSERT(p_loader2 == p_loader);
+
+        // Adding an options file changes the key
+        other_converter.CreateOptionsFile(copy_handler, model, std::vector<std::string>());
+        FileFinder other_cache_entry = other_converter.GetCacheEntryFolder(cellml_copy);
+        TS_ASSERT_DIFFERS(other_cache_entry.GetAbsolutePath(), cache_entry.GetAbsolutePath());
+        TS_ASSERT_THROWS_THIS(other_converter.Convert(cellml_copy, false),
+                              "Unable to convert .cellml to .so unless called collectively, due to possible race conditions.");
+
+        // Convert several models at once; only the new one is built
+        std::vector<FileFinder> models;
+        models.push_back(cellml_file);
+        models.push_back(cellml_copy);
+        models.push_back(cellml_copy);
+        std::vector<DynamicCellModelLoaderPtr> loaders = converter.Convert(models);
+        TS_ASSERT_EQUALS(loaders.size(), 3u);
+        TS_ASSERT(loaders[0] == p_loader);
+        TS_ASSERT(loaders[1] != p_loader);
+        TS_ASSERT(loaders[2] == loaders[1]);
+        TS_ASSERT(FileFinder(so_name, other_cache_entry).Exists());
+        RunLr91Test(*loaders[1], 0u);
+    }
+
     void TestArchiving() throw(Exception)
     {
 #ifdef CHASTE_CAN_CHECKPOINT_DLLS
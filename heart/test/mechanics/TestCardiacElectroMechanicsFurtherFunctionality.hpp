@@ -168,7 +168,7 @@ public:
         // test directly that the conductivity hasn't been modified
         for(unsigned i=0; i<electrics_mesh.GetNumElements(); i++)
         {
-            const c_matrix<double,2,2>& r_tensor = problem.mpElectricsProblem->GetTissue()->rGetIntracellularConductivityTensor(i);
+            const c_matrix<double,2,2>& r_tensor = problem.mpElectricsProblem->GetTissue()->GetIntracellularConductivityTensor(i);
             TS_ASSERT_DELTA(r_tensor(0,0), default_conductivity, 1e-9);
             TS_ASSERT_DELTA(r_tensor(0,1), 0.0,                  1e-9);
             TS_ASSERT_DELTA(r_tensor(1,0), 0.0,                  1e-9);
@@ -279,7 +279,7 @@ public:
         for(unsigned i=0; i<electrics_mesh.GetNumElements(); i++)
         {
             // sigma = F^{-1} sigma_undef F^{-T},
-            const c_matrix<double,2,2>& r_tensor = problem.mpElectricsProblem->GetTissue()->rGetIntracellularConductivityTensor(i);
+            const c_matrix<double,2,2>& r_tensor = problem.mpElectricsProblem->GetTissue()->GetIntracellularConductivityTensor(i);
             c_vector<double,2> centroid = electrics_mesh.GetElement(i)->CalculateCentroid();
             if(centroid(0)+centroid(1)<0.1)
             {
@@ -51,6 +51,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "OdeSolution.hpp"
 #include "AbstractCardiacCellFactory.hpp"
 #include "DistributedVector.hpp"
+#include "ReplicatableVector.hpp"
 #include "PetscTools.hpp"
 #include "TetrahedralMesh.hpp"
 #include "DistributedTetrahedralMesh.hpp"
@@ -58,8 +59,13 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "PlaneStimulusCellFactory.hpp"
 #include "ArchiveOpener.hpp"
 #include "DiFrancescoNoble1985.hpp"
+#include "LuoRudy1991Opt.hpp"
 #include "MonodomainProblem.hpp"
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include "PetscSetupAndFinalize.hpp"
 
 class MyCardiacCellFactory : public AbstractCardiacCellFactory<1>
@@ -127,6 +133,43 @@ public:
     }
 };
 
+/** Cell factory making PyCml-optimised cells, which use lookup tables. */
+class LookupTableCellFactory : public AbstractCardiacCellFactory<1>
+{
+private:
+    boost::shared_ptr<SimpleStimulus> mpStimulus;
+
+public:
+
+    LookupTableCellFactory()
+        : AbstractCardiacCellFactory<1>(),
+          mpStimulus(new SimpleStimulus(-80.0, 0.5))
+    {
+    }
+
+    AbstractCardiacCell* CreateCardiacCellForTissueNode(Node<1>* pNode)
+    {
+        if (pNode->GetIndex() == 0)
+        {
+            return new CellLuoRudy1991FromCellMLOpt(mpSolver, mpStimulus);
+        }
+        else
+        {
+            return new CellLuoRudy1991FromCellMLOpt(mpSolver, mpZeroStimulus);
+        }
+    }
+};
+
+/** An ODE solver which can't be copied for use in threads. */
+class UncopyableEulerIvpOdeSolver : public EulerIvpOdeSolver
+{
+public:
+    boost::shared_ptr<AbstractIvpOdeSolver> Clone() const
+    {
+        return boost::shared_ptr<AbstractIvpOdeSolver>();
+    }
+};
+
 class TestMonodomainTissue : public CxxTest::TestSuite
 {
 public:
@@ -222,9 +265,9 @@ public:
         value_ode = ode_system_not_stim.GetIIonic();
         TS_ASSERT_DELTA(value_tissue, value_ode, 1e-10);
 
-        TS_ASSERT_THROWS_THIS(monodomain_tissue.rGetExtracellularConductivityTensor(0),
+        TS_ASSERT_THROWS_THIS(monodomain_tissue.GetExtracellularConductivityTensor(0),
                               "Monodomain tissues do not have extracellular conductivity tensors.");
-        TS_ASSERT_THROWS_THIS(monodomain_tissue.rGetIntracellularConductivityTensor(1),
+        TS_ASSERT_THROWS_THIS(monodomain_tissue.GetIntracellularConductivityTensor(1),
                               "Conductivity tensor requested for element with global_index=1, but there are only 1 elements in the mesh.");
 
         PetscTools::Destroy(voltage);
@@ -442,6 +485,164 @@ public:
         PetscTools::Destroy(voltage2);
     }
 
+    void TestGhostedCaches() throw(Exception)
+    {
+        HeartConfig::Instance()->Reset();
+        DistributedTetrahedralMesh<1,1> mesh;
+        mesh.ConstructRegularSlabMesh(0.1, 1.0); // [0,1] with h=0.1, ie 11 node mesh
+
+        MyCardiacCellFactory cell_factory;
+        cell_factory.SetMesh(&mesh);
+        MonodomainTissue<1> replicated_tissue( &cell_factory );
+
+        MyCardiacCellFactory cell_factory_ghosted;
+        cell_factory_ghosted.SetMesh(&mesh);
+        MonodomainTissue<1> ghosted_tissue( &cell_factory_ghosted );
+        TS_ASSERT(!ghosted_tissue.GetUseGhostedCaches());
+        ghosted_tissue.SetUseGhostedCaches();
+        TS_ASSERT(ghosted_tissue.GetUseGhostedCaches());
+        TS_ASSERT_THROWS_CONTAINS(ghosted_tissue.rGetIionicCacheReplicated(),
+                                  "The replicated caches are not available when using ghosted caches");
+        TS_ASSERT_THROWS_CONTAINS(ghosted_tissue.rGetIntracellularStimulusCacheReplicated(),
+                                  "The replicated caches are not available when using ghosted caches");
+
+        Vec voltage = PetscTools::CreateAndSetVec(11, -81.4354);
+        replicated_tissue.SolveCellSystems(voltage, 0, 0.1);
+        ghosted_tissue.SolveCellSystems(voltage, 0, 0.1);
+
+        // Local and halo values agree with the fully replicated caches
+        ReplicatableVector& r_iionic = replicated_tissue.rGetIionicCacheReplicated();
+        ReplicatableVector& r_stimulus = replicated_tissue.rGetIntracellularStimulusCacheReplicated();
+        for (unsigned i=0; i<mesh.GetNumNodes(); i++)
+        {
+            if (mesh.GetDistributedVectorFactory()->IsGlobalIndexLocal(i))
+            {
+                TS_ASSERT_DELTA(ghosted_tissue.GetIionicCacheValue(i), r_iionic[i], 1e-12);
+                TS_ASSERT_DELTA(ghosted_tissue.GetIntracellularStimulusCacheValue(i), r_stimulus[i], 1e-12);
+            }
+        }
+        for (DistributedTetrahedralMesh<1,1>::HaloNodeIterator it=mesh.GetHaloNodeIteratorBegin();
+                it != mesh.GetHaloNodeIteratorEnd();
+                ++it)
+        {
+            unsigned index = (*it)->GetIndex();
+            TS_ASSERT_DELTA(ghosted_tissue.GetIionicCacheValue(index), r_iionic[index], 1e-12);
+            TS_ASSERT_DELTA(ghosted_tissue.GetIntracellularStimulusCacheValue(index), r_stimulus[index], 1e-12);
+        }
+
+        // Switching back restores the full-size caches
+        ghosted_tissue.SetUseGhostedCaches(false);
+        TS_ASSERT_EQUALS(ghosted_tissue.rGetIionicCacheReplicated().GetSize(), 11u);
+
+        PetscTools::Destroy(voltage);
+    }
+
+    void TestThreadedCellSolve() throw(Exception)
+    {
+        HeartConfig::Instance()->Reset();
+        DistributedTetrahedralMesh<1,1> mesh;
+        mesh.ConstructRegularSlabMesh(0.01, 1.0); // 101 nodes
+        unsigned num_nodes = mesh.GetNumNodes();
+
+        MyCardiacCellFactory cell_factory;
+        cell_factory.SetMesh(&mesh);
+        MonodomainTissue<1> serial_tissue( &cell_factory );
+        TS_ASSERT_EQUALS(serial_tissue.GetNumCellSolveThreads(), 1u);
+
+        MyCardiacCellFactory cell_factory_threaded;
+        cell_factory_threaded.SetMesh(&mesh);
+        MonodomainTissue<1> threaded_tissue( &cell_factory_threaded );
+        threaded_tissue.SetNumCellSolveThreads(4);
+        TS_ASSERT_EQUALS(threaded_tissue.GetNumCellSolveThreads(), 4u);
+
+#ifdef _OPENMP
+        // Built with OpenMP (e.g. Chaste_USE_OPENMP=ON), so the threaded tissue really does get 4 threads
+        unsigned num_threads = 0u;
+#pragma omp parallel num_threads(4)
+        {
+#pragma omp single
+            num_threads = omp_get_num_threads();
+        }
+        TS_ASSERT_EQUALS(num_threads, 4u);
+#endif // _OPENMP
+
+        // Each cell is solved in exactly the same way, whichever thread it is given to
+        Vec serial_voltage = PetscTools::CreateAndSetVec(num_nodes, -83.853);
+        Vec threaded_voltage = PetscTools::CreateAndSetVec(num_nodes, -83.853);
+        for (unsigned step=0; step<4; step++)
+        {
+            double time = 0.1*step;
+            bool update_voltage = (step%2 == 1);
+            serial_tissue.SolveCellSystems(serial_voltage, time, time+0.1, update_voltage);
+            threaded_tissue.SolveCellSystems(threaded_voltage, time, time+0.1, update_voltage);
+        }
+
+        ReplicatableVector serial_voltage_repl(serial_voltage);
+        ReplicatableVector threaded_voltage_repl(threaded_voltage);
+        for (unsigned i=0; i<num_nodes; i++)
+        {
+            TS_ASSERT_EQUALS(threaded_tissue.rGetIionicCacheReplicated()[i], serial_tissue.rGetIionicCacheReplicated()[i]);
+            TS_ASSERT_EQUALS(threaded_tissue.rGetIntracellularStimulusCacheReplicated()[i], serial_tissue.rGetIntracellularStimulusCacheReplicated()[i]);
+            TS_ASSERT_EQUALS(threaded_voltage_repl[i], serial_voltage_repl[i]);
+        }
+
+        // Solvers which can't be copied can't be used in threads
+        boost::shared_ptr<AbstractIvpOdeSolver> p_uncopyable(new UncopyableEulerIvpOdeSolver);
+        threaded_tissue.rGetCellsDistributed()[0]->SetSolver(p_uncopyable);
+        TS_ASSERT_THROWS_THIS(threaded_tissue.SetNumCellSolveThreads(2),
+                              "One of the cells' ODE solvers cannot be copied, so the cells cannot be solved in threads.");
+        TS_ASSERT_EQUALS(threaded_tissue.GetNumCellSolveThreads(), 1u);
+
+        PetscTools::Destroy(serial_voltage);
+        PetscTools::Destroy(threaded_voltage);
+    }
+
+    void TestThreadedCellSolveWithLookupTables() throw(Exception)
+    {
+        HeartConfig::Instance()->Reset();
+        DistributedTetrahedralMesh<1,1> mesh;
+        mesh.ConstructRegularSlabMesh(0.01, 1.0); // 101 nodes
+        unsigned num_nodes = mesh.GetNumNodes();
+
+        LookupTableCellFactory cell_factory;
+        cell_factory.SetMesh(&mesh);
+        MonodomainTissue<1> serial_tissue( &cell_factory );
+
+        LookupTableCellFactory cell_factory_threaded;
+        cell_factory_threaded.SetMesh(&mesh);
+        MonodomainTissue<1> threaded_tissue( &cell_factory_threaded );
+
+        // Threads would race on the tables' shared row buffers, so the tissue stays serial
+        if (mesh.GetDistributedVectorFactory()->GetLocalOwnership() > 0u)
+        {
+            TS_ASSERT_THROWS_THIS(threaded_tissue.SetNumCellSolveThreads(4),
+                                  "One of the cells uses lookup tables, which are shared between cells, so the cells cannot be solved in threads.");
+        }
+        TS_ASSERT_EQUALS(threaded_tissue.GetNumCellSolveThreads(), 1u);
+
+        Vec serial_voltage = PetscTools::CreateAndSetVec(num_nodes, -83.853);
+        Vec threaded_voltage = PetscTools::CreateAndSetVec(num_nodes, -83.853);
+        for (unsigned step=0; step<4; step++)
+        {
+            double time = 0.1*step;
+            serial_tissue.SolveCellSystems(serial_voltage, time, time+0.1, true);
+            threaded_tissue.SolveCellSystems(threaded_voltage, time, time+0.1, true);
+        }
+
+        ReplicatableVector serial_voltage_repl(serial_voltage);
+        ReplicatableVector threaded_voltage_repl(threaded_voltage);
+        for (unsigned i=0; i<num_nodes; i++)
+        {
+            TS_ASSERT_EQUALS(threaded_tissue.rGetIionicCacheReplicated()[i], serial_tissue.rGetIionicCacheReplicated()[i]);
+            TS_ASSERT_EQUALS(threaded_voltage_repl[i], serial_voltage_repl[i]);
+        }
+        // The stimulated cell has started to depolarise
+        TS_ASSERT_LESS_THAN(serial_voltage_repl[num_nodes-1], serial_voltage_repl[0]);
+
+        PetscTools::Destroy(serial_voltage);
+        PetscTools::Destroy(threaded_voltage);
+    }
+
     void TestSaveAndLoadCardiacTissue() throw (Exception)
     {
         HeartConfig::Instance()->Reset();
@@ -470,7 +671,7 @@ public:
             MonodomainTissue<1> monodomain_tissue( &cell_factory );
             monodomain_tissue.SetCacheReplication(cache_replication_saved); // Not the default to check it is archived...
 
-            tensor_before_archiving = monodomain_tissue.rGetIntracellularConductivityTensor(1);
+            tensor_before_archiving = monodomain_tissue.GetIntracellularConductivityTensor(1);
 
             // Get some info about the first cell on this process (if any)
             const std::vector<AbstractCardiacCellInterface*>& r_cells = monodomain_tissue.rGetCellsDistributed();
@@ -504,8 +705,8 @@ public:
             AbstractCardiacTissue<1>* p_monodomain_tissue;
             (*p_arch) >> p_monodomain_tissue;
 
-            // Test rGetIntracellularConductivityTensor
-            const c_matrix<double, 1, 1>& tensor_after_archiving = p_monodomain_tissue->rGetIntracellularConductivityTensor(1);
+            // Test GetIntracellularConductivityTensor
+            const c_matrix<double, 1, 1>& tensor_after_archiving = p_monodomain_tissue->GetIntracellularConductivityTensor(1);
             TS_ASSERT_DELTA(tensor_before_archiving(0,0), tensor_after_archiving(0,0), 1e-9);
 
             TS_ASSERT_EQUALS(cache_replication_saved, p_monodomain_tissue->GetDoCacheReplication());
@@ -54,6 +54,15 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "TenTusscher2006Epi.hpp"
 #include "Mahajan2008.hpp"
 #include "PlaneStimulusCellFactory.hpp"
+#include "MonodomainTissue.hpp"
+#include "MonodomainCorrectionTermAssembler.hpp"
+#include "MatrixBasedRhsAssembler.hpp"
+#include "MassMatrixAssembler.hpp"
+#include "DistributedVector.hpp"
+#include "PdeSimulationTime.hpp"
+#include "PetscVecTools.hpp"
+#include "PetscMatTools.hpp"
+#include "ReplicatableVector.hpp"
 #include "PetscSetupAndFinalize.hpp"
 
 // stimulate a block of cells (an interval in 1d, a block in a corner in 2d)
@@ -477,6 +486,154 @@ public:
         monodomain_problem.Solve();
     }
 
+    void TestMatrixBasedRhsAssemblerMatchesAssemblers() throw (Exception)
+    {
+        HeartConfig::Instance()->SetUseStateVariableInterpolation(true);
+        PdeSimulationTime::SetTime(0.0);
+        PdeSimulationTime::SetPdeTimeStepAndNextTime(0.01, 0.01);
+
+        DistributedTetrahedralMesh<1,1> mesh;
+        mesh.ConstructRegularSlabMesh(0.01, 0.2);
+        DistributedVectorFactory* p_factory = mesh.GetDistributedVectorFactory();
+
+        BlockCellFactory<1> cell_factory;
+        cell_factory.SetMesh(&mesh);
+        MonodomainTissue<1> tissue(&cell_factory, true /* exchange halos, for SVI */);
+
+        // A voltage step half way along, so that the ionic current varies a lot across one element
+        Vec voltage = p_factory->CreateVec();
+        {
+            DistributedVector dist_voltage = p_factory->CreateDistributedVector(voltage);
+            for (DistributedVector::Iterator index = dist_voltage.Begin(); index != dist_voltage.End(); ++index)
+            {
+                dist_voltage[index] = (mesh.GetNode(index.Global)->rGetLocation()[0] < 0.1) ? 20.0 : -84.0;
+            }
+            dist_voltage.Restore();
+        }
+        tissue.SolveCellSystems(voltage, 0.0, 0.01);
+
+        MatrixBasedRhsAssembler<1,1,1> rhs_assembler(&mesh, &tissue, false, true);
+        if (PetscTools::IsSequential())
+        {
+            // All the cells are the same type, so every element can do SVI
+            TS_ASSERT_EQUALS(rhs_assembler.GetNumSviElements(), mesh.GetNumElements());
+        }
+
+        // M z against the mass matrix times the vector computed by hand
+        Mat mass_matrix;
+        PetscTools::SetupMat(mass_matrix, mesh.GetNumNodes(), mesh.GetNumNodes(), 3, p_factory->GetLocalOwnership(), p_factory->GetLocalOwnership());
+        MassMatrixAssembler<1,1> mass_matrix_assembler(&mesh);
+        mass_matrix_assembler.SetMatrixToAssemble(mass_matrix);
+        mass_matrix_assembler.Assemble();
+        PetscMatTools::Finalise(mass_matrix);
+
+        double Am = HeartConfig::Instance()->GetSurfaceAreaToVolumeRatio();
+        double Cm = HeartConfig::Instance()->GetCapacitance();
+        Vec z = p_factory->CreateVec();
+        {
+            DistributedVector dist_voltage = p_factory->CreateDistributedVector(voltage);
+            DistributedVector dist_z = p_factory->CreateDistributedVector(z);
+            for (DistributedVector::Iterator index = dist_z.Begin(); index != dist_z.End(); ++index)
+            {
+                dist_z[index] = Am*Cm*dist_voltage[index]/0.01 - Am*tissue.GetIionicCacheValue(index.Global)
+                                - tissue.GetIntracellularStimulusCacheValue(index.Global);
+            }
+            dist_z.Restore();
+        }
+        Vec rhs_by_hand = p_factory->CreateVec();
+        MatMult(mass_matrix, z, rhs_by_hand);
+
+        Vec work = p_factory->CreateVec();
+        Vec rhs = p_factory->CreateVec();
+        rhs_assembler.ComputeMatrixBasedRhs(voltage, mass_matrix, work, rhs);
+
+        ReplicatableVector rhs_by_hand_repl(rhs_by_hand);
+        ReplicatableVector rhs_repl(rhs);
+        for (unsigned i=0; i<mesh.GetNumNodes(); i++)
+        {
+            TS_ASSERT_DELTA(rhs_repl[i], rhs_by_hand_repl[i], 1e-9*fabs(rhs_by_hand_repl[i]));
+        }
+
+        // The SVI correction against MonodomainCorrectionTermAssembler
+        Vec correction_from_assembler = p_factory->CreateVec();
+        MonodomainCorrectionTermAssembler<1,1> correction_assembler(&mesh, &tissue);
+        correction_assembler.SetVectorToAssemble(correction_from_assembler, true);
+        correction_assembler.AssembleVector();
+
+        Vec correction = p_factory->CreateVec();
+        PetscVecTools::Zero(correction);
+        rhs_assembler.AddCorrectionTerm(correction);
+        PetscVecTools::Finalise(correction);
+
+        ReplicatableVector correction_from_assembler_repl(correction_from_assembler);
+        ReplicatableVector correction_repl(correction);
+        double max_correction = 0.0;
+        for (unsigned i=0; i<mesh.GetNumNodes(); i++)
+        {
+            TS_ASSERT_DELTA(correction_repl[i], correction_from_assembler_repl[i], 1e-12 + 1e-10*fabs(correction_from_assembler_repl[i]));
+            max_correction = std::max(max_correction, fabs(correction_repl[i]));
+        }
+        // Only the elements either side of the step get corrected
+        TS_ASSERT_LESS_THAN(0.0, max_correction);
+        TS_ASSERT_DELTA(correction_repl[0], 0.0, 1e-12);
+        TS_ASSERT_DELTA(correction_repl[mesh.GetNumNodes()-1], 0.0, 1e-12);
+
+        PetscTools::Destroy(voltage);
+        PetscTools::Destroy(z);
+        PetscTools::Destroy(rhs_by_hand);
+        PetscTools::Destroy(work);
+        PetscTools::Destroy(rhs);
+        PetscTools::Destroy(correction_from_assembler);
+        PetscTools::Destroy(correction);
+        PetscTools::Destroy(mass_matrix);
+    }
+
+    void TestGhostedCachesMatchReplicatedCaches() throw (Exception)
+    {
+        // With SVI the halo exchange of ghosted caches overlaps with computing the RHS
+        std::vector<double> solutions[2];
+        for (unsigned use_ghosted=0; use_ghosted<2; use_ghosted++)
+        {
+            HeartConfig::Instance()->Reset();
+            HeartConfig::Instance()->SetSimulationDuration(1.0); //ms
+            HeartConfig::Instance()->SetOdePdeAndPrintingTimeSteps(0.01, 0.01, 0.1);
+            HeartConfig::Instance()->SetOutputDirectory("monodomain_svi_ghosted_caches");
+            HeartConfig::Instance()->SetOutputFilenamePrefix("results");
+            HeartConfig::Instance()->SetUseStateVariableInterpolation();
+
+            DistributedTetrahedralMesh<1,1> mesh;
+            mesh.ConstructRegularSlabMesh(0.02, 1.0);
+
+            BlockCellFactory<1> cell_factory;
+            MonodomainProblem<1> monodomain_problem( &cell_factory );
+            monodomain_problem.SetMesh(&mesh);
+            monodomain_problem.Initialise();
+            monodomain_problem.GetTissue()->SetUseGhostedCaches(use_ghosted == 1u);
+            TS_ASSERT_EQUALS(monodomain_problem.GetTissue()->GetUseGhostedCaches(), (use_ghosted == 1u));
+
+            // Solve in two parts, so that the tissue is solved again by a new solver
+            monodomain_problem.Solve();
+            HeartConfig::Instance()->SetSimulationDuration(2.0); //ms
+            monodomain_problem.Solve();
+
+            ReplicatableVector final_voltage;
+            final_voltage.ReplicatePetscVector(monodomain_problem.GetSolution());
+            for (unsigned i=0; i<final_voltage.GetSize(); i++)
+            {
+                solutions[use_ghosted].push_back(final_voltage[i]);
+            }
+        }
+
+        TS_ASSERT_EQUALS(solutions[1].size(), solutions[0].size());
+        for (unsigned i=0; i<solutions[0].size(); i++)
+        {
+            TS_ASSERT_DELTA(solutions[1][i], solutions[0][i], 1e-10);
+        }
+        // The stimulus has started a wave
+        TS_ASSERT_LESS_THAN(0.0, solutions[0][0]);
+        HeartConfig::Instance()->Reset();
+    }
+
     /*
      * This is the same as TestConductionVelocityConvergesFasterWithSvi1d with i=2, but solves in two parts.
      * If that test changes, check the hardcoded values here!
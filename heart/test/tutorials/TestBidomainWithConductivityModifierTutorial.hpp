@@ -185,8 +185,8 @@ public:
         if (mesh.GetElementIteratorBegin() != mesh.GetElementIteratorEnd())
         {
             unsigned first_element = mesh.GetElementIteratorBegin()->GetIndex();
-            orig_intra_conductivity_0 = p_bidomain_tissue->rGetIntracellularConductivityTensor(first_element)(0,0);
-            orig_extra_conductivity_0 = p_bidomain_tissue->rGetExtracellularConductivityTensor(first_element)(0,0);
+            orig_intra_conductivity_0 = p_bidomain_tissue->GetIntracellularConductivityTensor(first_element)(0,0);
+            orig_extra_conductivity_0 = p_bidomain_tissue->GetExtracellularConductivityTensor(first_element)(0,0);
 
             TS_ASSERT_DELTA(orig_intra_conductivity_0, 1.75, 1e-9); // hard-coded using default
             TS_ASSERT_DELTA(orig_extra_conductivity_0, 7.0, 1e-9); // hard-coded using default
@@ -209,15 +209,15 @@ public:
             unsigned index = elt_iter->GetIndex();
             if (index == 0u)
             {
-                TS_ASSERT_DELTA(p_bidomain_tissue->rGetIntracellularConductivityTensor(0)(0,0), 3.14, 1e-9);
-                TS_ASSERT_DELTA(p_bidomain_tissue->rGetExtracellularConductivityTensor(0)(0,0), 3.14, 1e-9);
-                TS_ASSERT_DELTA(p_bidomain_tissue->rGetIntracellularConductivityTensor(0)(1,1), 0.707, 1e-9);
-                TS_ASSERT_DELTA(p_bidomain_tissue->rGetExtracellularConductivityTensor(0)(1,1), 0.707, 1e-9);
+                TS_ASSERT_DELTA(p_bidomain_tissue->GetIntracellularConductivityTensor(0)(0,0), 3.14, 1e-9);
+                TS_ASSERT_DELTA(p_bidomain_tissue->GetExtracellularConductivityTensor(0)(0,0), 3.14, 1e-9);
+                TS_ASSERT_DELTA(p_bidomain_tissue->GetIntracellularConductivityTensor(0)(1,1), 0.707, 1e-9);
+                TS_ASSERT_DELTA(p_bidomain_tissue->GetExtracellularConductivityTensor(0)(1,1), 0.707, 1e-9);
             }
             else
             {
-                TS_ASSERT_DELTA(p_bidomain_tissue->rGetIntracellularConductivityTensor(index)(0,0), 1.0*index*orig_intra_conductivity_0, 1e-9);
-                TS_ASSERT_DELTA(p_bidomain_tissue->rGetExtracellularConductivityTensor(index)(0,0), 1.5*index*orig_extra_conductivity_0, 1e-9);
+                TS_ASSERT_DELTA(p_bidomain_tissue->GetIntracellularConductivityTensor(index)(0,0), 1.0*index*orig_intra_conductivity_0, 1e-9);
+                TS_ASSERT_DELTA(p_bidomain_tissue->GetExtracellularConductivityTensor(index)(0,0), 1.5*index*orig_extra_conductivity_0, 1e-9);
             }
         }
     }
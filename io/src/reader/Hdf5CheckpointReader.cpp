@@ -0,0 +1,169 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <cassert>
+
+#include "Hdf5CheckpointReader.hpp"
+
+#include "Exception.hpp"
+#include "PetscTools.hpp"
+
+Hdf5CheckpointReader::Hdf5CheckpointReader(const FileFinder& rDirectory, const std::string& rBaseName)
+    : mFileName(rDirectory.GetAbsolutePath() + rBaseName + ".h5"),
+      mFileId(0)
+{
+    FileFinder h5_file(mFileName, RelativeTo::Absolute);
+    if (!h5_file.Exists())
+    {
+        EXCEPTION("Hdf5CheckpointReader could not open " << mFileName << " , as it does not exist.");
+    }
+
+    hid_t fapl = H5Pcreate(H5P_FILE_ACCESS);
+    H5Pset_fapl_mpio(fapl, PETSC_COMM_WORLD, MPI_INFO_NULL);
+    mFileId = H5Fopen(mFileName.c_str(), H5F_ACC_RDONLY, fapl);
+    H5Pclose(fapl);
+
+    if (mFileId < 0)
+    {
+        mFileId = 0;
+        EXCEPTION("Hdf5CheckpointReader could not open " << mFileName);
+    }
+}
+
+Hdf5CheckpointReader::~Hdf5CheckpointReader()
+{
+    Close();
+}
+
+bool Hdf5CheckpointReader::HasDataset(const std::string& rName)
+{
+    assert(mFileId > 0);
+    return (H5Lexists(mFileId, rName.c_str(), H5P_DEFAULT) > 0);
+}
+
+hid_t Hdf5CheckpointReader::OpenDataset(const std::string& rName, unsigned numRows, unsigned* pNumColumns)
+{
+    if (!HasDataset(rName))
+    {
+        EXCEPTION("The dataset " << rName << " does not exist in " << mFileName);
+    }
+    hid_t dataset_id = H5Dopen(mFileId, rName.c_str(), H5P_DEFAULT);
+    hid_t dataspace = H5Dget_space(dataset_id);
+    int rank = H5Sget_simple_extent_ndims(dataspace);
+    hsize_t dims[2] = {0, 1};
+    if (rank == 2)
+    {
+        H5Sget_simple_extent_dims(dataspace, dims, NULL);
+    }
+    H5Sclose(dataspace);
+
+    if (rank != 2 || dims[0] != numRows || (pNumColumns == NULL && dims[1] != 1))
+    {
+        H5Dclose(dataset_id);
+        EXCEPTION("The dataset " << rName << " in " << mFileName << " does not have the expected size.");
+    }
+    if (pNumColumns)
+    {
+        *pNumColumns = dims[1];
+    }
+    return dataset_id;
+}
+
+void Hdf5CheckpointReader::ReadRows(hid_t datasetId, unsigned numColumns, unsigned lo, unsigned hi, double* pData)
+{
+    hid_t filespace = H5Dget_space(datasetId);
+    hid_t memspace;
+    if (hi > lo)
+    {
+        hsize_t count[2] = {hi - lo, numColumns};
+        hsize_t offset[2] = {lo, 0};
+        memspace = H5Screate_simple(2, count, NULL);
+        H5Sselect_hyperslab(filespace, H5S_SELECT_SET, offset, NULL, count, NULL);
+    }
+    else
+    {
+        memspace = H5Screate(H5S_NULL);
+        H5Sselect_none(filespace);
+    }
+
+    hid_t dxpl = H5Pcreate(H5P_DATASET_XFER);
+    H5Pset_dxpl_mpio(dxpl, H5FD_MPIO_COLLECTIVE);
+    herr_t err = H5Dread(datasetId, H5T_NATIVE_DOUBLE, memspace, filespace, dxpl, pData);
+
+    H5Pclose(dxpl);
+    H5Sclose(memspace);
+    H5Sclose(filespace);
+
+    if (err < 0)
+    {
+        EXCEPTION("Hdf5CheckpointReader failed to read from " << mFileName);
+    }
+}
+
+void Hdf5CheckpointReader::ReadVector(const std::string& rName, Vec vector)
+{
+    PetscInt size, lo, hi;
+    VecGetSize(vector, &size);
+    VecGetOwnershipRange(vector, &lo, &hi);
+
+    hid_t dataset_id = OpenDataset(rName, size, NULL);
+    double* p_data;
+    VecGetArray(vector, &p_data);
+    ReadRows(dataset_id, 1, lo, hi, p_data);
+    VecRestoreArray(vector, &p_data);
+    H5Dclose(dataset_id);
+}
+
+unsigned Hdf5CheckpointReader::ReadDistributedArray(const std::string& rName,
+                                                    DistributedVectorFactory& rFactory,
+                                                    std::vector<double>& rLocalData)
+{
+    unsigned num_columns;
+    hid_t dataset_id = OpenDataset(rName, rFactory.GetProblemSize(), &num_columns);
+    rLocalData.resize(rFactory.GetLocalOwnership()*num_columns);
+    double* p_data = rLocalData.empty() ? NULL : &rLocalData[0];
+    ReadRows(dataset_id, num_columns, rFactory.GetLow(), rFactory.GetHigh(), p_data);
+    H5Dclose(dataset_id);
+    return num_columns;
+}
+
+void Hdf5CheckpointReader::Close()
+{
+    if (mFileId > 0)
+    {
+        H5Fclose(mFileId);
+        mFileId = 0;
+    }
+}
@@ -0,0 +1,135 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef HDF5CHECKPOINTREADER_HPP_
+#define HDF5CHECKPOINTREADER_HPP_
+
+#include <string>
+#include <vector>
+
+#include <hdf5.h>
+#include <petscvec.h>
+
+#include "FileFinder.hpp"
+#include "DistributedVectorFactory.hpp"
+
+/**
+ * Reads bulk checkpoint data written by Hdf5CheckpointWriter.
+ *
+ * Each process reads just the slab of each dataset corresponding to the
+ * ownership range of the vector or factory it is given, so the number of
+ * processes (and the partitioning) need not match the one used when writing.
+ */
+class Hdf5CheckpointReader
+{
+private:
+
+    /** The full path to the HDF5 file being read. */
+    std::string mFileName;
+
+    /** The HDF5 file ID. */
+    hid_t mFileId;
+
+    /**
+     * Open a dataset and check it has the expected shape.
+     *
+     * @param rName  the dataset name
+     * @param numRows  the expected global number of rows
+     * @param pNumColumns  if non-NULL, set to the number of columns; otherwise the dataset must have one column
+     * @return the dataset ID, to be closed by the caller
+     */
+    hid_t OpenDataset(const std::string& rName, unsigned numRows, unsigned* pNumColumns);
+
+    /**
+     * Collectively read a block of rows from an open dataset.
+     *
+     * @param datasetId  the dataset
+     * @param numColumns  the number of columns in the dataset
+     * @param lo  first row to read on this process
+     * @param hi  one past the last row to read on this process
+     * @param pData  where to put the rows
+     */
+    void ReadRows(hid_t datasetId, unsigned numColumns, unsigned lo, unsigned hi, double* pData);
+
+public:
+
+    /**
+     * Constructor.  Collectively opens the file for reading.
+     *
+     * @param rDirectory  the directory containing the file
+     * @param rBaseName  the file name, without the ".h5" extension
+     */
+    Hdf5CheckpointReader(const FileFinder& rDirectory, const std::string& rBaseName);
+
+    /**
+     * Destructor.  Closes the file if that hasn't already been done.
+     */
+    ~Hdf5CheckpointReader();
+
+    /**
+     * @return whether the file contains the given dataset.
+     * @param rName  the dataset name
+     */
+    bool HasDataset(const std::string& rName);
+
+    /**
+     * Fill the locally owned part of a vector from a dataset written by
+     * Hdf5CheckpointWriter::WriteVector.  The vector's global size must match.
+     *
+     * @param rName  the dataset name
+     * @param vector  the (already created) vector to fill
+     */
+    void ReadVector(const std::string& rName, Vec vector);
+
+    /**
+     * Read the locally owned rows of a dataset written by
+     * Hdf5CheckpointWriter::WriteDistributedArray.
+     *
+     * @param rName  the dataset name
+     * @param rFactory  the factory giving the (current) ownership of rows
+     * @param rLocalData  filled with the locally owned rows (row-major)
+     * @return the number of values stored for each global index
+     */
+    unsigned ReadDistributedArray(const std::string& rName,
+                                  DistributedVectorFactory& rFactory,
+                                  std::vector<double>& rLocalData);
+
+    /**
+     * Close the file.  This is collective.
+     */
+    void Close();
+};
+
+#endif // HDF5CHECKPOINTREADER_HPP_
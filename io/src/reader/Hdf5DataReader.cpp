@@ -401,6 +401,84 @@ void Hdf5DataReader::GetVariableOverNodes(Vec data,
     }
 }
 
+std::vector<double> Hdf5DataReader::GetVariableOverNodes(const std::string& rVariableName,
+                                                         unsigned timestep,
+                                                         const std::vector<unsigned>& rNodeIndices)
+{
+    if (!mIsDataComplete)
+    {
+        EXCEPTION("You can only get a vector for complete data");
+    }
+    if (!mIsUnlimitedDimensionSet && timestep!=0)
+    {
+        EXCEPTION("The dataset '" << mDatasetName << "' does not contain time dependent data");
+    }
+
+    std::map<std::string, unsigned>::iterator col_iter = mVariableToColumnIndex.find(rVariableName);
+    if (col_iter == mVariableToColumnIndex.end())
+    {
+        EXCEPTION("The dataset '" << mDatasetName << "' does not contain data for variable " << rVariableName);
+    }
+    unsigned column_index = (*col_iter).second;
+
+    // Check for valid timestep
+    if (timestep >= mNumberTimesteps)
+    {
+        EXCEPTION("The dataset '" << mDatasetName << "' does not contain data for timestep number " << timestep);
+    }
+
+    std::vector<double> ret(rNodeIndices.size());
+    if (rNodeIndices.empty())
+    {
+        return ret;
+    }
+
+    // A contiguous run of nodes can be read as a hyperslab, otherwise select the individual entries
+    bool is_contiguous = true;
+    for (unsigned i=0; i<rNodeIndices.size(); i++)
+    {
+        if (rNodeIndices[i] >= mDatasetDims[1])
+        {
+            EXCEPTION("The dataset '" << mDatasetName << "' doesn't contain info for node " << rNodeIndices[i]);
+        }
+        if (rNodeIndices[i] != rNodeIndices[0] + i)
+        {
+            is_contiguous = false;
+        }
+    }
+
+    hsize_t v_size[1] = {rNodeIndices.size()};
+    hid_t memspace = H5Screate_simple(1, v_size, NULL);
+    hid_t selection_space = H5Dget_space(mVariablesDatasetId);
+
+    if (is_contiguous)
+    {
+        hsize_t offset[3] = {timestep, rNodeIndices[0], column_index};
+        hsize_t count[3]  = {1, rNodeIndices.size(), 1};
+        H5Sselect_hyperslab(selection_space, H5S_SELECT_SET, offset, NULL, count, NULL);
+    }
+    else
+    {
+        std::vector<hsize_t> coords(3*rNodeIndices.size());
+        for (unsigned i=0; i<rNodeIndices.size(); i++)
+        {
+            coords[3*i] = timestep;
+            coords[3*i + 1] = rNodeIndices[i];
+            coords[3*i + 2] = column_index;
+        }
+        H5Sselect_elements(selection_space, H5S_SELECT_SET, rNodeIndices.size(), &coords[0]);
+    }
+
+    herr_t err = H5Dread(mVariablesDatasetId, H5T_NATIVE_DOUBLE, memspace, selection_space, H5P_DEFAULT, &ret[0]);
+    UNUSED_OPT(err);
+    assert(err==0);
+
+    H5Sclose(selection_space);
+    H5Sclose(memspace);
+
+    return ret;
+}
+
 std::vector<double> Hdf5DataReader::GetUnlimitedDimensionValues()
 {
     // Data buffer to return
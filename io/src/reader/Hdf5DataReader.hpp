@@ -122,6 +122,21 @@ public:
      */
     void GetVariableOverNodes(Vec data, const std::string& rVariableName, unsigned timestep=0);
 
+    /**
+     * @return the values of a given variable at a given time step at a list of nodes.
+     *
+     * Unlike the version taking a Vec, this reads only on the calling process, so it may be
+     * used to read an arbitrary subset of nodes (such as a process's owned and halo nodes)
+     * without any communication.
+     *
+     * @param rVariableName  name of a variable in the data file
+     * @param timestep the time step for which the data is obtained
+     * @param rNodeIndices the indices of the nodes, in the order in which values are to be returned
+     */
+    std::vector<double> GetVariableOverNodes(const std::string& rVariableName,
+                                             unsigned timestep,
+                                             const std::vector<unsigned>& rNodeIndices);
+
     /**
      * @return the unlimited dimension values.
      */
@@ -0,0 +1,191 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <algorithm>
+#include <cassert>
+
+#include "Hdf5CheckpointWriter.hpp"
+
+#include "Exception.hpp"
+#include "PetscTools.hpp"
+#include "Warnings.hpp"
+
+/** Number of values (doubles) aimed for in each chunk of a compressed dataset. */
+const unsigned CHECKPOINT_TARGET_CHUNK_ENTRIES = 65536u;
+
+Hdf5CheckpointWriter::Hdf5CheckpointWriter(const FileFinder& rDirectory,
+                                           const std::string& rBaseName,
+                                           bool useCompression)
+    : mFileName(rDirectory.GetAbsolutePath() + rBaseName + ".h5"),
+      mFileId(0),
+      mUseCompression(useCompression)
+{
+    if (mUseCompression)
+    {
+        if (!H5Zfilter_avail(H5Z_FILTER_DEFLATE))
+        {
+            mUseCompression = false;
+            WARNING("Deflate compression is not available in this HDF5 library; checkpoint data will not be compressed.");
+        }
+#if (H5_VERS_MAJOR == 1 && (H5_VERS_MINOR < 10 || (H5_VERS_MINOR == 10 && H5_VERS_RELEASE < 2)))
+        else if (PetscTools::IsParallel())
+        {
+            // Older HDF5 versions can't write filtered datasets through MPI-IO
+            mUseCompression = false;
+            WARNING("Parallel compressed writes need HDF5 1.10.2 or later; checkpoint data will not be compressed.");
+        }
+#endif
+    }
+
+    // Set up a property list saying how we'll open the file
+    hid_t fapl = H5Pcreate(H5P_FILE_ACCESS);
+    H5Pset_fapl_mpio(fapl, PETSC_COMM_WORLD, MPI_INFO_NULL);
+    mFileId = H5Fcreate(mFileName.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, fapl);
+    H5Pclose(fapl);
+
+    if (mFileId < 0)
+    {
+        mFileId = 0;
+        EXCEPTION("Hdf5CheckpointWriter could not create " << mFileName);
+    }
+}
+
+Hdf5CheckpointWriter::~Hdf5CheckpointWriter()
+{
+    Close();
+}
+
+void Hdf5CheckpointWriter::WriteRows(const std::string& rName,
+                                     unsigned numRows,
+                                     unsigned numColumns,
+                                     unsigned lo,
+                                     unsigned hi,
+                                     const double* pData)
+{
+    assert(mFileId > 0);
+    assert(numColumns > 0);
+    assert(lo <= hi && hi <= numRows);
+
+    hsize_t dataset_dims[2] = {numRows, numColumns};
+    hid_t filespace = H5Screate_simple(2, dataset_dims, NULL);
+
+    hid_t dcpl = H5Pcreate(H5P_DATASET_CREATE);
+    if (mUseCompression && numRows > 0)
+    {
+        unsigned chunk_rows = std::max(1u, CHECKPOINT_TARGET_CHUNK_ENTRIES/numColumns);
+        hsize_t chunk_dims[2] = {std::min(numRows, chunk_rows), numColumns};
+        H5Pset_chunk(dcpl, 2, chunk_dims);
+        H5Pset_shuffle(dcpl); // Byte-shuffling makes doubles much more compressible
+        H5Pset_deflate(dcpl, 1);
+    }
+
+    hid_t dataset_id = H5Dcreate(mFileId, rName.c_str(), H5T_NATIVE_DOUBLE, filespace,
+                                 H5P_DEFAULT, dcpl, H5P_DEFAULT);
+    H5Pclose(dcpl);
+    if (dataset_id < 0)
+    {
+        H5Sclose(filespace);
+        EXCEPTION("Hdf5CheckpointWriter could not create dataset " << rName << " in " << mFileName);
+    }
+
+    // Select the hyperslab of rows owned by this process
+    hid_t memspace;
+    if (hi > lo)
+    {
+        hsize_t count[2] = {hi - lo, numColumns};
+        hsize_t offset[2] = {lo, 0};
+        memspace = H5Screate_simple(2, count, NULL);
+        H5Sselect_hyperslab(filespace, H5S_SELECT_SET, offset, NULL, count, NULL);
+    }
+    else
+    {
+        memspace = H5Screate(H5S_NULL);
+        H5Sselect_none(filespace);
+    }
+
+    // Compressed datasets may only be written collectively
+    hid_t dxpl = H5Pcreate(H5P_DATASET_XFER);
+    H5Pset_dxpl_mpio(dxpl, H5FD_MPIO_COLLECTIVE);
+    herr_t err = H5Dwrite(dataset_id, H5T_NATIVE_DOUBLE, memspace, filespace, dxpl, pData);
+
+    H5Pclose(dxpl);
+    H5Sclose(memspace);
+    H5Sclose(filespace);
+    H5Dclose(dataset_id);
+
+    if (err < 0)
+    {
+        EXCEPTION("Hdf5CheckpointWriter failed to write dataset " << rName << " to " << mFileName);
+    }
+}
+
+void Hdf5CheckpointWriter::WriteVector(const std::string& rName, Vec vector)
+{
+    PetscInt size, lo, hi;
+    VecGetSize(vector, &size);
+    VecGetOwnershipRange(vector, &lo, &hi);
+
+    double* p_data;
+    VecGetArray(vector, &p_data);
+    WriteRows(rName, size, 1, lo, hi, p_data);
+    VecRestoreArray(vector, &p_data);
+}
+
+void Hdf5CheckpointWriter::WriteDistributedArray(const std::string& rName,
+                                                 DistributedVectorFactory& rFactory,
+                                                 const std::vector<double>& rLocalData,
+                                                 unsigned numColumns)
+{
+    if (rLocalData.size() != rFactory.GetLocalOwnership()*numColumns)
+    {
+        EXCEPTION("Local data for dataset " << rName << " has the wrong size for the given partitioning.");
+    }
+    const double* p_data = rLocalData.empty() ? NULL : &rLocalData[0];
+    WriteRows(rName, rFactory.GetProblemSize(), numColumns, rFactory.GetLow(), rFactory.GetHigh(), p_data);
+}
+
+bool Hdf5CheckpointWriter::IsCompressionEnabled() const
+{
+    return mUseCompression;
+}
+
+void Hdf5CheckpointWriter::Close()
+{
+    if (mFileId > 0)
+    {
+        H5Fclose(mFileId);
+        mFileId = 0;
+    }
+}
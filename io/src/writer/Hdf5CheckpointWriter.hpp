@@ -0,0 +1,149 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef HDF5CHECKPOINTWRITER_HPP_
+#define HDF5CHECKPOINTWRITER_HPP_
+
+#include <string>
+#include <vector>
+
+#include <hdf5.h>
+#include <petscvec.h>
+
+#include "FileFinder.hpp"
+#include "DistributedVectorFactory.hpp"
+
+/**
+ * Writes the bulk numerical state of a checkpoint (PETSc vectors and other
+ * distributed per-node data) to a single HDF5 file.
+ *
+ * Each item is stored as one contiguous dataset indexed by global index, written
+ * collectively by all processes using the parallel (MPI-IO) HDF5 driver.  Since
+ * nothing in the file depends on the partitioning used when it was written, the
+ * data can be read back on any number of processes by Hdf5CheckpointReader.
+ *
+ * Small metadata (flags, settings, object graphs) should still go through the
+ * Boost archives; this class is only meant for the large arrays.  It is not yet
+ * used by CardiacSimulationArchiver or CellBasedSimulationArchiver, which still
+ * write everything (including cell model state and node locations) to Boost
+ * archives.
+ *
+ * Lossless (deflate) compression may optionally be requested.  Writing filtered
+ * datasets in parallel requires HDF5 1.10.2 or later, so with older libraries
+ * compression is only used when running sequentially.
+ */
+class Hdf5CheckpointWriter
+{
+private:
+
+    /** The full path to the HDF5 file being written. */
+    std::string mFileName;
+
+    /** The HDF5 file ID. */
+    hid_t mFileId;
+
+    /** Whether datasets are written with deflate compression. */
+    bool mUseCompression;
+
+    /**
+     * Create a (rows x columns) dataset and collectively write a block of rows to it.
+     *
+     * @param rName  the dataset name
+     * @param numRows  the global number of rows
+     * @param numColumns  the number of columns (values per row)
+     * @param lo  first row owned by this process
+     * @param hi  one past the last row owned by this process
+     * @param pData  this process's rows, stored contiguously
+     */
+    void WriteRows(const std::string& rName,
+                   unsigned numRows,
+                   unsigned numColumns,
+                   unsigned lo,
+                   unsigned hi,
+                   const double* pData);
+
+public:
+
+    /**
+     * Constructor.  Collectively creates (or truncates) the file.
+     *
+     * @param rDirectory  the directory to write to
+     * @param rBaseName  the file name, without the ".h5" extension
+     * @param useCompression  whether to compress datasets (defaults to false)
+     */
+    Hdf5CheckpointWriter(const FileFinder& rDirectory,
+                         const std::string& rBaseName,
+                         bool useCompression=false);
+
+    /**
+     * Destructor.  Closes the file if that hasn't already been done.
+     */
+    ~Hdf5CheckpointWriter();
+
+    /**
+     * Write a distributed PETSc vector as a 1D dataset of its global size.
+     *
+     * @param rName  the dataset name
+     * @param vector  the vector to write
+     */
+    void WriteVector(const std::string& rName, Vec vector);
+
+    /**
+     * Write distributed data with a fixed number of values per global index
+     * (e.g. node locations or cell model state variables) as a
+     * (problem size x numColumns) dataset.
+     *
+     * @param rName  the dataset name
+     * @param rFactory  the factory giving the ownership of rows
+     * @param rLocalData  the locally owned rows, stored contiguously (row-major)
+     * @param numColumns  the number of values stored for each global index
+     */
+    void WriteDistributedArray(const std::string& rName,
+                               DistributedVectorFactory& rFactory,
+                               const std::vector<double>& rLocalData,
+                               unsigned numColumns);
+
+    /**
+     * @return whether datasets written by this writer are compressed.
+     */
+    bool IsCompressionEnabled() const;
+
+    /**
+     * Close the file.  This is collective.
+     */
+    void Close();
+};
+
+#endif // HDF5CHECKPOINTWRITER_HPP_
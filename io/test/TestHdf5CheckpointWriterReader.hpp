@@ -0,0 +1,186 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef TESTHDF5CHECKPOINTWRITERREADER_HPP_
+#define TESTHDF5CHECKPOINTWRITERREADER_HPP_
+
+#include <cxxtest/TestSuite.h>
+
+#include <fstream>
+
+#include "Hdf5CheckpointWriter.hpp"
+#include "Hdf5CheckpointReader.hpp"
+#include "PetscSetupAndFinalize.hpp"
+#include "OutputFileHandler.hpp"
+#include "PetscTools.hpp"
+#include "DistributedVectorFactory.hpp"
+#include "Warnings.hpp"
+
+class TestHdf5CheckpointWriterReader : public CxxTest::TestSuite
+{
+public:
+
+    void TestWriteAndReadOnDifferentPartition() throw(Exception)
+    {
+        OutputFileHandler handler("TestHdf5CheckpointWriterReader");
+        FileFinder dir = handler.FindFile("");
+
+        const unsigned size = 100;
+        const unsigned num_columns = 3;
+
+        // Write with the default partition
+        {
+            DistributedVectorFactory factory(size);
+            Vec vec = factory.CreateVec();
+            for (unsigned i=factory.GetLow(); i<factory.GetHigh(); i++)
+            {
+                VecSetValue(vec, i, 0.5*i, INSERT_VALUES);
+            }
+            VecAssemblyBegin(vec);
+            VecAssemblyEnd(vec);
+
+            std::vector<double> local_data;
+            for (unsigned i=factory.GetLow(); i<factory.GetHigh(); i++)
+            {
+                for (unsigned j=0; j<num_columns; j++)
+                {
+                    local_data.push_back(i + 0.1*j);
+                }
+            }
+
+            Hdf5CheckpointWriter writer(dir, "checkpoint");
+            writer.WriteVector("Vector", vec);
+            writer.WriteDistributedArray("Array", factory, local_data, num_columns);
+
+            // Wrong amount of local data
+            std::vector<double> bad_data(local_data.size()+1);
+            TS_ASSERT_THROWS_THIS(writer.WriteDistributedArray("Bad", factory, bad_data, num_columns),
+                                  "Local data for dataset Bad has the wrong size for the given partitioning.");
+            writer.Close();
+
+            PetscTools::Destroy(vec);
+        }
+
+        // Read back with everything owned by the master process
+        {
+            unsigned local_size = PetscTools::AmMaster() ? size : 0;
+            DistributedVectorFactory factory(size, local_size);
+            Vec vec = factory.CreateVec();
+
+            Hdf5CheckpointReader reader(dir, "checkpoint");
+            TS_ASSERT(reader.HasDataset("Vector"));
+            TS_ASSERT(!reader.HasDataset("Bad"));
+            reader.ReadVector("Vector", vec);
+
+            std::vector<double> local_data;
+            TS_ASSERT_EQUALS(reader.ReadDistributedArray("Array", factory, local_data), num_columns);
+            TS_ASSERT_EQUALS(local_data.size(), local_size*num_columns);
+
+            double* p_vec;
+            VecGetArray(vec, &p_vec);
+            for (unsigned i=0; i<local_size; i++)
+            {
+                TS_ASSERT_DELTA(p_vec[i], 0.5*i, 1e-12);
+                for (unsigned j=0; j<num_columns; j++)
+                {
+                    TS_ASSERT_DELTA(local_data[i*num_columns+j], i + 0.1*j, 1e-12);
+                }
+            }
+            VecRestoreArray(vec, &p_vec);
+
+            // A vector of the wrong size
+            Vec wrong_vec = PetscTools::CreateVec(size+1);
+            TS_ASSERT_THROWS_CONTAINS(reader.ReadVector("Vector", wrong_vec), "does not have the expected size.");
+            TS_ASSERT_THROWS_CONTAINS(reader.ReadVector("Missing", vec), "The dataset Missing does not exist");
+            reader.Close();
+
+            PetscTools::Destroy(wrong_vec);
+            PetscTools::Destroy(vec);
+        }
+
+        TS_ASSERT_THROWS_CONTAINS(Hdf5CheckpointReader(dir, "no_such_file"), "as it does not exist.");
+    }
+
+    void TestCompression() throw(Exception)
+    {
+        OutputFileHandler handler("TestHdf5CheckpointWriterReader", false);
+        FileFinder dir = handler.FindFile("");
+
+        // Smooth data compresses well
+        const unsigned size = 10000;
+        Vec vec = PetscTools::CreateAndSetVec(size, 1.0);
+
+        Hdf5CheckpointWriter plain_writer(dir, "plain");
+        plain_writer.WriteVector("Vector", vec);
+        plain_writer.Close();
+
+        Hdf5CheckpointWriter compressed_writer(dir, "compressed", true);
+        compressed_writer.WriteVector("Vector", vec);
+        bool compressed = compressed_writer.IsCompressionEnabled();
+        compressed_writer.Close();
+
+        if (compressed)
+        {
+            std::ifstream compressed_file(handler.FindFile("compressed.h5").GetAbsolutePath().c_str(), std::ios::binary | std::ios::ate);
+            std::ifstream plain_file(handler.FindFile("plain.h5").GetAbsolutePath().c_str(), std::ios::binary | std::ios::ate);
+            TS_ASSERT_LESS_THAN(compressed_file.tellg(), plain_file.tellg());
+        }
+        else
+        {
+            // HDF5 library can't do parallel compressed writes
+            TS_ASSERT_EQUALS(Warnings::Instance()->GetNumWarnings(), 1u);
+            Warnings::QuietDestroy();
+        }
+
+        // Compression is transparent to the reader
+        Vec read_vec = PetscTools::CreateVec(size);
+        Hdf5CheckpointReader reader(dir, "compressed");
+        reader.ReadVector("Vector", read_vec);
+        double* p_vec;
+        VecGetArray(read_vec, &p_vec);
+        PetscInt lo, hi;
+        VecGetOwnershipRange(read_vec, &lo, &hi);
+        for (PetscInt i=0; i<hi-lo; i++)
+        {
+            TS_ASSERT_DELTA(p_vec[i], 1.0, 1e-12);
+        }
+        VecRestoreArray(read_vec, &p_vec);
+
+        PetscTools::Destroy(read_vec);
+        PetscTools::Destroy(vec);
+    }
+};
+
+#endif /*TESTHDF5CHECKPOINTWRITERREADER_HPP_*/
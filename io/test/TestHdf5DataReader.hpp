@@ -417,6 +417,38 @@ public:
             }
         }
 
+        // Read arbitrary lists of nodes on this process alone
+        std::vector<unsigned> contiguous_nodes;
+        for (unsigned node_index=20; node_index<30; node_index++)
+        {
+            contiguous_nodes.push_back(node_index);
+        }
+        std::vector<unsigned> scattered_nodes;
+        scattered_nodes.push_back(99);
+        scattered_nodes.push_back(3);
+        scattered_nodes.push_back(50);
+        scattered_nodes.push_back(4);
+
+        std::vector<double> contiguous_values = reader.GetVariableOverNodes("I_K", 7, contiguous_nodes);
+        TS_ASSERT_EQUALS(contiguous_values.size(), contiguous_nodes.size());
+        for (unsigned i=0; i<contiguous_nodes.size(); i++)
+        {
+            TS_ASSERT_EQUALS(contiguous_values[i], 7*1000 + 100 + contiguous_nodes[i]);
+        }
+
+        std::vector<double> scattered_values = reader.GetVariableOverNodes("I_Na", 2, scattered_nodes);
+        TS_ASSERT_EQUALS(scattered_values.size(), scattered_nodes.size());
+        for (unsigned i=0; i<scattered_nodes.size(); i++)
+        {
+            TS_ASSERT_EQUALS(scattered_values[i], 2*1000 + 200 + scattered_nodes[i]);
+        }
+
+        TS_ASSERT(reader.GetVariableOverNodes("Node", 0, std::vector<unsigned>()).empty());
+
+        scattered_nodes.push_back(NUMBER_NODES);
+        TS_ASSERT_THROWS_THIS(reader.GetVariableOverNodes("Node", 0, scattered_nodes),
+                              "The dataset 'Data' doesn't contain info for node 100");
+
         std::vector<double> unlimited_values = reader.GetUnlimitedDimensionValues();
 
         for (unsigned i=0; i< unlimited_values.size(); i++)
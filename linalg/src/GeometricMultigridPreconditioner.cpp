@@ -0,0 +1,169 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "GeometricMultigridPreconditioner.hpp"
+#include "PetscTools.hpp"
+#include "Exception.hpp"
+
+#include <cassert>
+#include <petscksp.h>
+
+GeometricMultigridPreconditioner::GeometricMultigridPreconditioner()
+    : mSmootherKspType("richardson"),
+      mSmootherPcType("sor"),
+      mNumSmoothingSteps(2),
+      mAgglomerateCoarseGrid(true)
+{
+}
+
+GeometricMultigridPreconditioner::~GeometricMultigridPreconditioner()
+{
+    for (unsigned level=0; level<mInterpolations.size(); level++)
+    {
+        PetscTools::Destroy(mInterpolations[level]);
+    }
+}
+
+void GeometricMultigridPreconditioner::AddInterpolation(Mat interpolation)
+{
+    if (!mInterpolations.empty())
+    {
+        // The new level's columns are the previous finest level's rows
+        PetscInt num_rows, num_columns, num_previous_rows, num_previous_columns;
+        MatGetSize(interpolation, &num_rows, &num_columns);
+        MatGetSize(mInterpolations.back(), &num_previous_rows, &num_previous_columns);
+        if (num_columns != num_previous_rows)
+        {
+            EXCEPTION("Interpolation matrix does not match the previous level.");
+        }
+    }
+    mInterpolations.push_back(interpolation);
+}
+
+unsigned GeometricMultigridPreconditioner::GetNumLevels() const
+{
+    return mInterpolations.size() + 1;
+}
+
+Mat GeometricMultigridPreconditioner::GetInterpolation(unsigned level)
+{
+    assert(level < mInterpolations.size());
+    return mInterpolations[level];
+}
+
+void GeometricMultigridPreconditioner::SetSmoother(const std::string& kspType, const std::string& pcType, unsigned numSteps)
+{
+    assert(numSteps > 0);
+    mSmootherKspType = kspType;
+    mSmootherPcType = pcType;
+    mNumSmoothingSteps = numSteps;
+}
+
+void GeometricMultigridPreconditioner::SetCoarseGridAgglomeration(bool agglomerate)
+{
+    mAgglomerateCoarseGrid = agglomerate;
+}
+
+void GeometricMultigridPreconditioner::SetUp(PC pc, Mat fineOperator)
+{
+#ifndef NDEBUG
+    if (!mInterpolations.empty())
+    {
+        PetscInt num_local_rows, num_local_columns, num_local_interpolated, num_local_coarse;
+        MatGetLocalSize(fineOperator, &num_local_rows, &num_local_columns);
+        MatGetLocalSize(mInterpolations.back(), &num_local_interpolated, &num_local_coarse);
+        assert(num_local_rows == num_local_interpolated);
+    }
+#endif
+
+    const unsigned num_levels = GetNumLevels();
+
+    PCSetType(pc, PCMG);
+    PCMGSetLevels(pc, num_levels, NULL);
+    PCMGSetType(pc, PC_MG_MULTIPLICATIVE);
+    PCMGSetCycleType(pc, PC_MG_CYCLE_V);
+
+    // Coarse operators are R*A*P, with R = P'
+#if (PETSC_VERSION_MAJOR == 3 && PETSC_VERSION_MINOR >= 8) //PETSc 3.8 or later
+    PCMGSetGalerkin(pc, PC_MG_GALERKIN_BOTH);
+#elif (PETSC_VERSION_MAJOR == 3 && PETSC_VERSION_MINOR >= 2) //PETSc 3.2 or later
+    PCMGSetGalerkin(pc, PETSC_TRUE);
+#else
+    PCMGSetGalerkin(pc);
+#endif
+
+    // Level 0 is the coarsest
+    for (unsigned level=1; level<num_levels; level++)
+    {
+        PCMGSetInterpolation(pc, level, mInterpolations[level-1]);
+
+        KSP smoother;
+        PCMGGetSmoother(pc, level, &smoother);
+        KSPSetType(smoother, mSmootherKspType.c_str());
+        KSPSetTolerances(smoother, PETSC_DEFAULT, PETSC_DEFAULT, PETSC_DEFAULT, mNumSmoothingSteps);
+
+        PC smoother_pc;
+        KSPGetPC(smoother, &smoother_pc);
+        PCSetType(smoother_pc, mSmootherPcType.c_str());
+    }
+
+    KSP coarse_solver;
+    PCMGGetCoarseSolve(pc, &coarse_solver);
+    KSPSetType(coarse_solver, KSPPREONLY);
+    PC coarse_pc;
+    KSPGetPC(coarse_solver, &coarse_pc);
+    if (mAgglomerateCoarseGrid)
+    {
+        // Every process gets a copy of the whole coarse problem and factorises it.
+        // The extracellular potential block may be singular, hence the shift.
+        PCSetType(coarse_pc, PCREDUNDANT);
+        PC redundant_pc;
+#if (PETSC_VERSION_MAJOR == 3 && PETSC_VERSION_MINOR >= 1) //PETSc 3.1 or later
+        KSP redundant_ksp;
+        PCRedundantGetKSP(coarse_pc, &redundant_ksp);
+        KSPGetPC(redundant_ksp, &redundant_pc);
+        PCSetType(redundant_pc, PCLU);
+        PCFactorSetShiftType(redundant_pc, MAT_SHIFT_NONZERO);
+#else
+        PCRedundantGetPC(coarse_pc, &redundant_pc);
+        PCSetType(redundant_pc, PCLU);
+        PCFactorSetShiftNonzero(redundant_pc, PETSC_DECIDE);
+#endif
+    }
+    else
+    {
+        PCSetType(coarse_pc, PCBJACOBI);
+    }
+}
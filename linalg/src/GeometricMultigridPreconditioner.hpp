@@ -0,0 +1,144 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef GEOMETRICMULTIGRIDPRECONDITIONER_HPP_
+#define GEOMETRICMULTIGRIDPRECONDITIONER_HPP_
+
+#include <vector>
+#include <string>
+#include <petscmat.h>
+#include <petscpc.h>
+
+/**
+ * Geometric multigrid for a scalar (e.g. the extracellular potential) block of
+ * a linear system, using PETSc's PCMG with user-supplied interpolation matrices.
+ *
+ * The interpolation (prolongation) operators between consecutive levels are
+ * added coarsest first; restriction is their transpose and the coarse-level
+ * operators are formed by the Galerkin product R A P, so only the finest
+ * operator needs to be assembled.  Each level is smoothed with a few sweeps of
+ * a chosen KSP/PC pair, and the coarsest problem is either gathered onto every
+ * process and solved directly (agglomeration) or approximately solved in place.
+ *
+ * The interpolation matrices must have the parallel row layout of the level they
+ * interpolate onto; in particular the finest one must match the rows of the
+ * operator passed to SetUp().
+ *
+ * This class knows nothing about meshes; see NestedMeshMultigridPreconditioner
+ * for building the interpolation operators from a hierarchy of meshes.
+ */
+class GeometricMultigridPreconditioner
+{
+private:
+
+    /** Interpolation from each level to the next finer one, coarsest first.  Owned. */
+    std::vector<Mat> mInterpolations;
+
+    /** KSP type used to smooth on each level. */
+    std::string mSmootherKspType;
+
+    /** PC type used to smooth on each level. */
+    std::string mSmootherPcType;
+
+    /** Number of pre- and post-smoothing iterations on each level. */
+    unsigned mNumSmoothingSteps;
+
+    /** Whether to gather the coarsest problem onto every process and solve it directly. */
+    bool mAgglomerateCoarseGrid;
+
+public:
+
+    /**
+     * Constructor.  The default smoother is two sweeps of Richardson iteration with
+     * (processor-local) SOR, and the coarsest problem is agglomerated.
+     */
+    GeometricMultigridPreconditioner();
+
+    /**
+     * Destructor frees the interpolation matrices.
+     */
+    virtual ~GeometricMultigridPreconditioner();
+
+    /**
+     * Add the interpolation from the current finest level to a new, finer, level.
+     * This class takes ownership of the matrix.
+     *
+     * @param interpolation  the interpolation matrix, with a row for each unknown of the
+     *     new level and a column for each unknown of the previous finest level
+     */
+    void AddInterpolation(Mat interpolation);
+
+    /**
+     * @return the number of levels, including the coarsest (one more than the number
+     *     of interpolation matrices).
+     */
+    unsigned GetNumLevels() const;
+
+    /**
+     * @return the interpolation from one level to the next finer one
+     * @param level  the coarser of the two levels (0 is the coarsest)
+     */
+    Mat GetInterpolation(unsigned level);
+
+    /**
+     * Choose the smoother used on every level but the coarsest.
+     *
+     * @param kspType  the PETSc KSP type, e.g. "richardson" or "chebyshev"
+     * @param pcType  the PETSc PC type, e.g. "sor" or "jacobi"
+     * @param numSteps  the number of pre- and post-smoothing iterations
+     */
+    void SetSmoother(const std::string& kspType, const std::string& pcType, unsigned numSteps=2);
+
+    /**
+     * Choose how the coarsest problem is solved.
+     *
+     * @param agglomerate  if true (the default), the coarsest problem is gathered onto every
+     *     process and solved with a (shifted) LU factorisation, so the coarse solve involves
+     *     no further communication; if false, it is solved in place with block Jacobi/ILU,
+     *     which is cheaper for large coarse grids but less accurate
+     */
+    void SetCoarseGridAgglomeration(bool agglomerate=true);
+
+    /**
+     * Make a PC object apply one multigrid V-cycle for the given operator.  This should
+     * be called after PCSetOperators() and before PCSetFromOptions()/PCSetUp().
+     *
+     * @param pc  the (created) preconditioner to set up
+     * @param fineOperator  the operator on the finest level
+     */
+    void SetUp(PC pc, Mat fineOperator);
+};
+
+#endif /*GEOMETRICMULTIGRIDPRECONDITIONER_HPP_*/
@@ -629,7 +629,7 @@ void LinearSystem::SetPcType(const char* pcType, boost::shared_ptr<std::vector<P
             delete mpTwoLevelsBlockDiagonalPC;
             mpTwoLevelsBlockDiagonalPC = NULL;
 
-            mpBlockDiagonalPC = new PCBlockDiagonal(mKspSolver);
+            mpBlockDiagonalPC = new PCBlockDiagonal(mKspSolver, mpPhiEMultigrid.get());
         }
         else if (mPcType == "ldufactorisation")
         {
@@ -642,7 +642,7 @@ void LinearSystem::SetPcType(const char* pcType, boost::shared_ptr<std::vector<P
             delete mpTwoLevelsBlockDiagonalPC;
             mpTwoLevelsBlockDiagonalPC = NULL;
 
-            mpLDUFactorisationPC = new PCLDUFactorisation(mKspSolver);
+            mpLDUFactorisationPC = new PCLDUFactorisation(mKspSolver, mpPhiEMultigrid.get());
         }
         else if (mPcType == "twolevelsblockdiagonal")
         {
@@ -671,6 +671,11 @@ void LinearSystem::SetPcType(const char* pcType, boost::shared_ptr<std::vector<P
     }
 }
 
+void LinearSystem::SetPhiEMultigrid(boost::shared_ptr<GeometricMultigridPreconditioner> pPhiEMultigrid)
+{
+    mpPhiEMultigrid = pPhiEMultigrid;
+}
+
 Vec LinearSystem::Solve(Vec lhsGuess)
 {
     /*
@@ -787,7 +792,7 @@ Vec LinearSystem::Solve(Vec lhsGuess)
 #endif
             if (mPcType == "blockdiagonal")
             {
-                mpBlockDiagonalPC = new PCBlockDiagonal(mKspSolver);
+                mpBlockDiagonalPC = new PCBlockDiagonal(mKspSolver, mpPhiEMultigrid.get());
 #ifdef TRACE_KSP
                 if (PetscTools::AmMaster())
                 {
@@ -797,7 +802,7 @@ Vec LinearSystem::Solve(Vec lhsGuess)
             }
             else if (mPcType == "ldufactorisation")
             {
-                mpLDUFactorisationPC = new PCLDUFactorisation(mKspSolver);
+                mpLDUFactorisationPC = new PCLDUFactorisation(mKspSolver, mpPhiEMultigrid.get());
 #ifdef TRACE_KSP
                 if (PetscTools::AmMaster())
                 {
@@ -46,6 +46,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "PCBlockDiagonal.hpp"
 #include "PCLDUFactorisation.hpp"
 #include "PCTwoLevelsBlockDiagonal.hpp"
+#include "GeometricMultigridPreconditioner.hpp"
 #include "ArchiveLocationInfo.hpp"
 //#include <boost/serialization/shared_ptr.hpp>
 
@@ -115,6 +116,9 @@ private:
     /** Pointer to vector containing a list of bath nodes*/
     boost::shared_ptr<std::vector<PetscInt> > mpBathNodes;
 
+    /** Geometric multigrid for the second block of the block preconditioners (may be empty)*/
+    boost::shared_ptr<GeometricMultigridPreconditioner> mpPhiEMultigrid;
+
     /** Whether the matrix used for preconditioning is the same as the LHS*/
     bool mPrecondMatrixIsNotLhs;
 
@@ -340,6 +344,15 @@ public:
     /// \todo: #1082 is this the way of defining a null pointer as the default value of pBathNodes?
     void SetPcType(const char* pcType, boost::shared_ptr<std::vector<PetscInt> > pBathNodes=boost::shared_ptr<std::vector<PetscInt> >() );
 
+    /**
+     * Use geometric multigrid, rather than AMG, on the second diagonal block when
+     * the preconditioner type is "blockdiagonal" or "ldufactorisation".
+     * Must be called before SetPcType() or the first solve to take effect.
+     *
+     * @param pPhiEMultigrid  the multigrid hierarchy for the second block (empty pointer to use AMG)
+     */
+    void SetPhiEMultigrid(boost::shared_ptr<GeometricMultigridPreconditioner> pPhiEMultigrid);
+
     /**
      * Display the left-hand side matrix.
      */
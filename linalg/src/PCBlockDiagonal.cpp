@@ -44,7 +44,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Timer.hpp"
 #endif
 
-PCBlockDiagonal::PCBlockDiagonal(KSP& rKspObject)
+PCBlockDiagonal::PCBlockDiagonal(KSP& rKspObject, GeometricMultigridPreconditioner* pPhiEMultigrid)
 {
 #ifdef TRACE_KSP
     mPCContext.mScatterTime = 0.0;
@@ -54,7 +54,7 @@ PCBlockDiagonal::PCBlockDiagonal(KSP& rKspObject)
 #endif
 
     PCBlockDiagonalCreate(rKspObject);
-    PCBlockDiagonalSetUp();
+    PCBlockDiagonalSetUp(pPhiEMultigrid);
 }
 
 PCBlockDiagonal::~PCBlockDiagonal()
@@ -195,7 +195,7 @@ void PCBlockDiagonal::PCBlockDiagonalCreate(KSP& rKspObject)
 
 }
 
-void PCBlockDiagonal::PCBlockDiagonalSetUp()
+void PCBlockDiagonal::PCBlockDiagonalSetUp(GeometricMultigridPreconditioner* pPhiEMultigrid)
 {
     // These options will get read by PCSetFromOptions
 //     PetscTools::SetOption("-pc_hypre_boomeramg_max_iter", "1");
@@ -244,11 +244,14 @@ void PCBlockDiagonal::PCBlockDiagonalSetUp()
     // Set up amg preconditioner for block A22
     PCCreate(PETSC_COMM_WORLD, &(mPCContext.PC_amg_A22));
 
-    /* Full AMG in the block */
-    PetscPushErrorHandler(PetscIgnoreErrorHandler, NULL);
-    PCSetType(mPCContext.PC_amg_A22, PCHYPRE);
-    // Stop supressing error
-    PetscPopErrorHandler();
+    /* Full AMG in the block, unless we have been given a geometric multigrid (see below) */
+    if (pPhiEMultigrid == NULL)
+    {
+        PetscPushErrorHandler(PetscIgnoreErrorHandler, NULL);
+        PCSetType(mPCContext.PC_amg_A22, PCHYPRE);
+        // Stop supressing error
+        PetscPopErrorHandler();
+    }
 
     //PCHYPRESetType(mPCContext.PC_amg_A22, "boomeramg");
     PetscTools::SetOption("-pc_hypre_type", "boomeramg");
@@ -298,6 +301,12 @@ void PCBlockDiagonal::PCBlockDiagonalSetUp()
 #else
     PCSetOperators(mPCContext.PC_amg_A22, mPCContext.A22_matrix_subblock, mPCContext.A22_matrix_subblock, SAME_PRECONDITIONER);
 #endif
+
+    if (pPhiEMultigrid != NULL)
+    {
+        /* Geometric multigrid in the block */
+        pPhiEMultigrid->SetUp(mPCContext.PC_amg_A22, mPCContext.A22_matrix_subblock);
+    }
     PCSetFromOptions(mPCContext.PC_amg_A22);
     PCSetUp(mPCContext.PC_amg_A22);
 }
@@ -42,6 +42,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <petscksp.h>
 #include <petscpc.h>
 #include "PetscTools.hpp"
+#include "GeometricMultigridPreconditioner.hpp"
 
 /**
  * PETSc will return the control to this function everytime it needs to precondition a vector (i.e. y = inv(M)*x)
@@ -74,7 +75,8 @@ PetscErrorCode PCBlockDiagonalApply(void* pc_context, Vec x, Vec y);
  *                 inv(M) = inv( (A11   0)   = (inv(A11)        0)
  *                               (0   A22) )   (0        inv(A22))
  *
- * The inverses are approximate with one cycle of AMG.
+ * The inverses are approximate with one cycle of AMG, or that of A22 with one
+ * geometric multigrid V-cycle if a GeometricMultigridPreconditioner is given.
  *
  * Note: This class requires PETSc to be build including HYPRE library.
  * If it's not available, it will show the following warning:
@@ -116,8 +118,9 @@ public:
      * Constructor.
      *
      * @param rKspObject KSP object where we want to install the block diagonal preconditioner.
+     * @param pPhiEMultigrid  if given, approximate inv(A22) with this geometric multigrid instead of AMG
      */
-    PCBlockDiagonal(KSP& rKspObject);
+    PCBlockDiagonal(KSP& rKspObject, GeometricMultigridPreconditioner* pPhiEMultigrid=NULL);
 
     ~PCBlockDiagonal();
 
@@ -132,8 +135,10 @@ private:
 
     /**
      * Setups preconditioner.
+     *
+     * @param pPhiEMultigrid  if not NULL, the geometric multigrid to use for block A22
      */
-    void PCBlockDiagonalSetUp();
+    void PCBlockDiagonalSetUp(GeometricMultigridPreconditioner* pPhiEMultigrid);
 };
 
 #endif /*PCBLOCKDIAGONAL_HPP_*/
@@ -44,7 +44,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "Timer.hpp"
 #endif
 
-PCLDUFactorisation::PCLDUFactorisation(KSP& rKspObject)
+PCLDUFactorisation::PCLDUFactorisation(KSP& rKspObject, GeometricMultigridPreconditioner* pPhiEMultigrid)
 {
 #ifdef TRACE_KSP
     mPCContext.mScatterTime = 0.0;
@@ -54,7 +54,7 @@ PCLDUFactorisation::PCLDUFactorisation(KSP& rKspObject)
 #endif
 
     PCLDUFactorisationCreate(rKspObject);
-    PCLDUFactorisationSetUp();
+    PCLDUFactorisationSetUp(pPhiEMultigrid);
 }
 
 PCLDUFactorisation::~PCLDUFactorisation()
@@ -241,7 +241,7 @@ void PCLDUFactorisation::PCLDUFactorisationCreate(KSP& rKspObject)
 #endif
 }
 
-void PCLDUFactorisation::PCLDUFactorisationSetUp()
+void PCLDUFactorisation::PCLDUFactorisationSetUp(GeometricMultigridPreconditioner* pPhiEMultigrid)
 {
     // These options will get read by PCSetFromOptions
 //     PetscTools::SetOption("-pc_hypre_boomeramg_max_iter", "1");
@@ -323,12 +323,20 @@ void PCLDUFactorisation::PCLDUFactorisationSetUp()
     // Choose between the two following blocks in order to approximate inv(A11) with one AMG cycle
     // or with an CG solve with high tolerance
 ////////
-    // We are expecting an error from PETSC on systems that don't have the hypre library, so suppress it
-    // in case it aborts
-    PetscPushErrorHandler(PetscIgnoreErrorHandler, NULL);
-    PCSetType(mPCContext.PC_amg_A22, PCHYPRE);
-    // Stop supressing error
-    PetscPopErrorHandler();
+    if (pPhiEMultigrid != NULL)
+    {
+        // Geometric multigrid, with interpolation operators supplied by the caller
+        pPhiEMultigrid->SetUp(mPCContext.PC_amg_A22, mPCContext.A22_matrix_subblock);
+    }
+    else
+    {
+        // We are expecting an error from PETSC on systems that don't have the hypre library, so suppress it
+        // in case it aborts
+        PetscPushErrorHandler(PetscIgnoreErrorHandler, NULL);
+        PCSetType(mPCContext.PC_amg_A22, PCHYPRE);
+        // Stop supressing error
+        PetscPopErrorHandler();
+    }
 
     PetscTools::SetOption("-pc_hypre_type", "boomeramg");
     PetscTools::SetOption("-pc_hypre_boomeramg_max_iter", "1");
@@ -42,6 +42,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include <petscksp.h>
 #include <petscpc.h>
 #include "PetscTools.hpp"
+#include "GeometricMultigridPreconditioner.hpp"
 
 /**
  * PETSc will return the control to this function everytime it needs to precondition a vector (i.e. y = inv(M)*x)
@@ -144,8 +145,9 @@ public:
      * Constructor.
      *
      * @param rKspObject KSP object where we want to install the block diagonal preconditioner.
+     * @param pPhiEMultigrid  if given, approximate inv(A22) with this geometric multigrid instead of AMG
      */
-    PCLDUFactorisation(KSP& rKspObject);
+    PCLDUFactorisation(KSP& rKspObject, GeometricMultigridPreconditioner* pPhiEMultigrid=NULL);
 
     ~PCLDUFactorisation();
 
@@ -160,8 +162,10 @@ private:
 
     /**
      * Setups preconditioner.
+     *
+     * @param pPhiEMultigrid  if not NULL, the geometric multigrid to use for block A22
      */
-    void PCLDUFactorisationSetUp();
+    void PCLDUFactorisationSetUp(GeometricMultigridPreconditioner* pPhiEMultigrid);
 };
 
 #endif /*PCLDUFACTORISATION_HPP_*/
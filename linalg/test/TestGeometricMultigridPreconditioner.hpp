@@ -0,0 +1,202 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef TESTGEOMETRICMULTIGRIDPRECONDITIONER_HPP_
+#define TESTGEOMETRICMULTIGRIDPRECONDITIONER_HPP_
+
+#include <cxxtest/TestSuite.h>
+#include <cmath>
+#include "LinearSystem.hpp"
+#include "GeometricMultigridPreconditioner.hpp"
+#include "PetscSetupAndFinalize.hpp"
+#include "PetscMatTools.hpp"
+#include "PetscVecTools.hpp"
+#include "DistributedVectorFactory.hpp"
+#include "ReplicatableVector.hpp"
+
+class TestGeometricMultigridPreconditioner : public CxxTest::TestSuite
+{
+private:
+
+    /**
+     * Linear interpolation on a uniform 1D grid, from numCoarse interior nodes to
+     * the 2*numCoarse+1 interior nodes of the grid with half the spacing.
+     */
+    Mat MakeInterpolation(unsigned numCoarse)
+    {
+        unsigned num_fine = 2*numCoarse+1;
+        DistributedVectorFactory coarse_factory(numCoarse);
+        DistributedVectorFactory fine_factory(num_fine);
+
+        Mat interpolation;
+        PetscTools::SetupMat(interpolation, num_fine, numCoarse, 2,
+                             fine_factory.GetLocalOwnership(), coarse_factory.GetLocalOwnership());
+
+        for (unsigned fine=fine_factory.GetLow(); fine<fine_factory.GetHigh(); fine++)
+        {
+            if (fine%2 == 1)
+            {
+                PetscMatTools::SetElement(interpolation, fine, (fine-1)/2, 1.0);
+            }
+            else
+            {
+                if (fine > 0)
+                {
+                    PetscMatTools::SetElement(interpolation, fine, fine/2-1, 0.5);
+                }
+                if (fine/2 < numCoarse)
+                {
+                    PetscMatTools::SetElement(interpolation, fine, fine/2, 0.5);
+                }
+            }
+        }
+        PetscMatTools::Finalise(interpolation);
+        return interpolation;
+    }
+
+    /**
+     * Solve a block diagonal system with interleaved unknowns, where the first block is
+     * a 1D Laplacian plus the identity and the second is a 1D Laplacian.
+     *
+     * @return the number of iterations taken
+     */
+    unsigned SolveBlockSystem(unsigned numNodes, const char* pcType,
+                              boost::shared_ptr<GeometricMultigridPreconditioner> pMultigrid)
+    {
+        DistributedVectorFactory factory(numNodes);
+        Vec solution_wanted = factory.CreateVec(2);
+        Vec rhs = factory.CreateVec(2);
+
+        Mat system_matrix;
+        PetscTools::SetupMat(system_matrix, 2*numNodes, 2*numNodes, 3, 2*factory.GetLocalOwnership(), 2*factory.GetLocalOwnership());
+        for (unsigned node=factory.GetLow(); node<factory.GetHigh(); node++)
+        {
+            for (unsigned block=0; block<2; block++)
+            {
+                unsigned row = 2*node + block;
+                PetscMatTools::SetElement(system_matrix, row, row, (block==0 ? 3.0 : 2.0));
+                if (node > 0)
+                {
+                    PetscMatTools::SetElement(system_matrix, row, row-2, -1.0);
+                }
+                if (node+1 < numNodes)
+                {
+                    PetscMatTools::SetElement(system_matrix, row, row+2, -1.0);
+                }
+            }
+            PetscVecTools::SetElement(solution_wanted, 2*node, 1.0);
+            PetscVecTools::SetElement(solution_wanted, 2*node+1, sin((double)node));
+        }
+        PetscMatTools::Finalise(system_matrix);
+        PetscVecTools::Finalise(solution_wanted);
+        MatMult(system_matrix, solution_wanted, rhs);
+
+        LinearSystem ls = LinearSystem(rhs, system_matrix);
+        ls.SetAbsoluteTolerance(1e-10);
+        ls.SetKspType("cg");
+        ls.SetPhiEMultigrid(pMultigrid);
+        ls.SetPcType(pcType);
+
+        Vec solution = ls.Solve();
+        unsigned num_iterations = ls.GetNumIterations();
+
+        ReplicatableVector solution_repl(solution);
+        ReplicatableVector wanted_repl(solution_wanted);
+        for (unsigned i=0; i<2*numNodes; i++)
+        {
+            TS_ASSERT_DELTA(solution_repl[i], wanted_repl[i], 1e-7);
+        }
+
+        PetscTools::Destroy(system_matrix);
+        PetscTools::Destroy(rhs);
+        PetscTools::Destroy(solution_wanted);
+        PetscTools::Destroy(solution);
+
+        return num_iterations;
+    }
+
+public:
+
+    void TestLevels() throw (Exception)
+    {
+        GeometricMultigridPreconditioner multigrid;
+        TS_ASSERT_EQUALS(multigrid.GetNumLevels(), 1u);
+
+        multigrid.AddInterpolation(MakeInterpolation(7));  // 7 -> 15
+        multigrid.AddInterpolation(MakeInterpolation(15)); // 15 -> 31
+        TS_ASSERT_EQUALS(multigrid.GetNumLevels(), 3u);
+
+        // 15 -> 31 doesn't follow on from 31 nodes
+        Mat wrong_size = MakeInterpolation(15);
+        TS_ASSERT_THROWS_THIS(multigrid.AddInterpolation(wrong_size),
+                              "Interpolation matrix does not match the previous level.");
+        PetscTools::Destroy(wrong_size);
+        TS_ASSERT_EQUALS(multigrid.GetNumLevels(), 3u);
+    }
+
+    void TestBlockPreconditionersWithMultigrid() throw (Exception)
+    {
+        // 7 -> 15 -> 31 -> 63 -> 127 nodes
+        unsigned num_nodes = 127;
+
+        unsigned amg_its = SolveBlockSystem(num_nodes, "blockdiagonal", boost::shared_ptr<GeometricMultigridPreconditioner>());
+
+        boost::shared_ptr<GeometricMultigridPreconditioner> p_multigrid(new GeometricMultigridPreconditioner);
+        for (unsigned num_coarse=7; num_coarse<num_nodes; num_coarse=2*num_coarse+1)
+        {
+            p_multigrid->AddInterpolation(MakeInterpolation(num_coarse));
+        }
+        TS_ASSERT_EQUALS(p_multigrid->GetNumLevels(), 5u);
+
+        unsigned no_pc_its = SolveBlockSystem(num_nodes, "none", p_multigrid);
+        unsigned block_diagonal_its = SolveBlockSystem(num_nodes, "blockdiagonal", p_multigrid);
+        unsigned ldu_its = SolveBlockSystem(num_nodes, "ldufactorisation", p_multigrid);
+
+        TS_ASSERT_LESS_THAN(block_diagonal_its, no_pc_its);
+        TS_ASSERT_LESS_THAN(ldu_its, no_pc_its);
+
+        // Multigrid on the second block should do about as well as AMG
+        TS_ASSERT_LESS_THAN_EQUALS(block_diagonal_its, 2*amg_its);
+        TS_ASSERT_LESS_THAN_EQUALS(block_diagonal_its, 20u);
+        TS_ASSERT_LESS_THAN_EQUALS(ldu_its, 20u);
+
+        // Other smoother and coarse solve
+        p_multigrid->SetSmoother("chebyshev", "jacobi", 3);
+        p_multigrid->SetCoarseGridAgglomeration(false);
+        TS_ASSERT_LESS_THAN_EQUALS(SolveBlockSystem(num_nodes, "blockdiagonal", p_multigrid), 20u);
+    }
+};
+
+#endif /*TESTGEOMETRICMULTIGRIDPRECONDITIONER_HPP_*/
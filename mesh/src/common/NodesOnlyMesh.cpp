@@ -34,6 +34,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 */
 
 #include <map>
+#include <algorithm>
+#include <boost/cstdint.hpp>
 #include "NodesOnlyMesh.hpp"
 #include "ChasteCuboid.hpp"
 
@@ -41,6 +43,7 @@ template<unsigned SPACE_DIM>
 NodesOnlyMesh<SPACE_DIM>::NodesOnlyMesh()
         : MutableMesh<SPACE_DIM, SPACE_DIM>(),
           mMaximumInteractionDistance(1.0),
+          mVerletSkin(0.0),
           mIndexCounter(0u),
           mMinimumNodeDomainBoundarySeparation(1.0),
           mMaxAddedNodeIndex(0u),
@@ -184,6 +187,23 @@ double NodesOnlyMesh<SPACE_DIM>::GetMaximumInteractionDistance()
     return mMaximumInteractionDistance;
 }
 
+template<unsigned SPACE_DIM>
+void NodesOnlyMesh<SPACE_DIM>::SetVerletSkin(double verletSkin)
+{
+    assert(verletSkin >= 0.0);
+    if (verletSkin != mVerletSkin)
+    {
+        mVerletSkin = verletSkin;
+        ClearBoxCollection();
+    }
+}
+
+template<unsigned SPACE_DIM>
+double NodesOnlyMesh<SPACE_DIM>::GetVerletSkin() const
+{
+    return mVerletSkin;
+}
+
 template<unsigned SPACE_DIM>
 double NodesOnlyMesh<SPACE_DIM>::GetWidth(const unsigned& rDimension) const
 {
@@ -235,23 +255,105 @@ void NodesOnlyMesh<SPACE_DIM>::ReMesh(NodeMap& map)
 template<unsigned SPACE_DIM>
 void NodesOnlyMesh<SPACE_DIM>::RemoveDeletedNodes(NodeMap& map)
 {
-    typename std::vector<Node<SPACE_DIM>* >::iterator node_iter = this->mNodes.begin();
-    while (node_iter != this->mNodes.end())
+    // Compact the surviving nodes to the front in a single pass, preserving their order
+    unsigned num_kept = 0;
+    for (unsigned i=0; i<this->mNodes.size(); i++)
     {
-        if ((*node_iter)->IsDeleted())
+        Node<SPACE_DIM>* p_node = this->mNodes[i];
+        if (p_node->IsDeleted())
         {
-            map.SetDeleted((*node_iter)->GetIndex());
+            map.SetDeleted(p_node->GetIndex());
 
-            mNodesMapping.erase((*node_iter)->GetIndex());
+            mNodesMapping.erase(p_node->GetIndex());
 
-            // Free memory before erasing the pointer from the list of nodes.
-            delete (*node_iter);
-            node_iter = this->mNodes.erase(node_iter);
+            delete p_node;
         }
         else
         {
-            ++node_iter;
+            this->mNodes[num_kept++] = p_node;
+        }
+    }
+    this->mNodes.resize(num_kept);
+}
+
+template<unsigned SPACE_DIM>
+void NodesOnlyMesh<SPACE_DIM>::ReorderNodesAlongMortonCurve()
+{
+    // Deleted nodes must have been removed by ReMesh() first
+    assert(this->mDeletedNodeIndices.empty());
+
+    if (this->mNodes.empty())
+    {
+        return;
+    }
+
+    // Quantise each location within the bounding box and interleave the bits of its coordinates
+    ChasteCuboid<SPACE_DIM> bounding_box = this->CalculateBoundingBox(this->mNodes);
+    const unsigned bits_per_dim = std::min(32u, 63u/SPACE_DIM);
+    const double max_coordinate = (double)((boost::uint64_t(1) << bits_per_dim) - 1);
+
+    std::vector<std::pair<boost::uint64_t, unsigned> > keys(this->mNodes.size());
+    for (unsigned i=0; i<this->mNodes.size(); i++)
+    {
+        const c_vector<double, SPACE_DIM>& r_location = this->mNodes[i]->rGetLocation();
+        boost::uint64_t key = 0;
+        for (unsigned d=0; d<SPACE_DIM; d++)
+        {
+            double extent = bounding_box.rGetUpperCorner()[d] - bounding_box.rGetLowerCorner()[d];
+            double scaled = (extent > 0.0) ? (r_location[d] - bounding_box.rGetLowerCorner()[d])/extent : 0.0;
+            boost::uint64_t coordinate = (boost::uint64_t)(scaled*max_coordinate);
+            for (unsigned bit=0; bit<bits_per_dim; bit++)
+            {
+                key |= ((coordinate >> bit) & 1u) << (bit*SPACE_DIM + d);
+            }
         }
+        keys[i] = std::make_pair(key, i);
+    }
+    std::sort(keys.begin(), keys.end());
+
+    // Copy the nodes in curve order, so that nodes close in space are allocated close in memory
+    std::vector<Node<SPACE_DIM>*> reordered_nodes(this->mNodes.size());
+    for (unsigned i=0; i<keys.size(); i++)
+    {
+        Node<SPACE_DIM>* p_old_node = this->mNodes[keys[i].second];
+        Node<SPACE_DIM>* p_node = new Node<SPACE_DIM>(p_old_node->GetIndex(), p_old_node->rGetLocation(), p_old_node->IsBoundaryNode());
+
+        if (p_old_node->HasNodeAttributes())
+        {
+            p_node->SetRadius(p_old_node->GetRadius());
+            p_node->SetRegion(p_old_node->GetRegion());
+            p_node->SetIsParticle(p_old_node->IsParticle());
+
+            for (unsigned j=0; j<p_old_node->GetNumNodeAttributes(); j++)
+            {
+                p_node->AddNodeAttribute(p_old_node->rGetNodeAttributes()[j]);
+            }
+
+            c_vector<double, SPACE_DIM> applied_force = p_old_node->rGetAppliedForce();
+            p_node->AddAppliedForceContribution(applied_force);
+
+            std::vector<unsigned>& r_neighbours = p_old_node->rGetNeighbours();
+            for (unsigned j=0; j<r_neighbours.size(); j++)
+            {
+                p_node->AddNeighbour(r_neighbours[j]);
+            }
+            p_node->SetNeighboursSetUp(p_old_node->GetNeighboursSetUp());
+        }
+        reordered_nodes[i] = p_node;
+    }
+
+    for (unsigned i=0; i<this->mNodes.size(); i++)
+    {
+        delete this->mNodes[i];
+    }
+    this->mNodes.swap(reordered_nodes);
+
+    UpdateNodeIndices();
+
+    // The boxes refer to the old nodes
+    if (mpBoxCollection)
+    {
+        mpBoxCollection->EmptyBoxes();
     }
 }
 
@@ -479,10 +581,10 @@ void NodesOnlyMesh<SPACE_DIM>::EnlargeBoxCollection()
     unsigned d0 = ( mpBoxCollection->GetIsPeriodicInX() ) ? 1 : 0;
     for (unsigned d=d0; d < SPACE_DIM; d++)
     {
-        new_domain_size[2*d] = current_domain_size[2*d] - (mMaximumInteractionDistance - fudge);
-        new_domain_size[2*d+1] = current_domain_size[2*d+1] + (mMaximumInteractionDistance - fudge);
+        new_domain_size[2*d] = current_domain_size[2*d] - (mMaximumInteractionDistance + mVerletSkin - fudge);
+        new_domain_size[2*d+1] = current_domain_size[2*d+1] + (mMaximumInteractionDistance + mVerletSkin - fudge);
     }
-    SetUpBoxCollection(mMaximumInteractionDistance, new_domain_size, new_local_rows);
+    SetUpBoxCollection(mMaximumInteractionDistance + mVerletSkin, new_domain_size, new_local_rows);
 }
 
 template<unsigned SPACE_DIM>
@@ -555,7 +657,7 @@ void NodesOnlyMesh<SPACE_DIM>::SetUpBoxCollection(const std::vector<Node<SPACE_D
         domain_size[2*i+1] = bounding_box.rGetUpperCorner()[i] + 1e-14;
     }
 
-    SetUpBoxCollection(mMaximumInteractionDistance, domain_size);
+    SetUpBoxCollection(mMaximumInteractionDistance + mVerletSkin, domain_size);
 }
 
 template<unsigned SPACE_DIM>
@@ -637,7 +739,7 @@ void NodesOnlyMesh<SPACE_DIM>::LoadBalanceMesh()
         current_domain_size[2*d] = current_domain_size[2*d] + fudge;
         current_domain_size[2*d+1] = current_domain_size[2*d+1] - fudge;
     }
-    SetUpBoxCollection(mMaximumInteractionDistance, current_domain_size, new_rows);
+    SetUpBoxCollection(mMaximumInteractionDistance + mVerletSkin, current_domain_size, new_rows);
 }
 
 template<unsigned SPACE_DIM>
@@ -83,6 +83,9 @@ private:
     /** Nodes separated by a distance less than mMaximumInteractionDistance are neighbours. */
     double mMaximumInteractionDistance;
 
+    /** An extra distance added to #mMaximumInteractionDistance when sizing boxes; see SetVerletSkin(). */
+    double mVerletSkin;
+
     /** A map from node global index to local index in mNodes. */
     std::map<unsigned, unsigned> mNodesMapping;
 
@@ -276,6 +279,25 @@ public:
      */
     double GetMaximumInteractionDistance();
 
+    /**
+     * Set an extra distance to add to the maximum interaction distance when sizing the
+     * boxes. The node pairs found then include every pair within the interaction distance
+     * until some node has moved more than half this distance, so they can be reused over
+     * several time steps as a Verlet list.
+     *
+     * Changing the skin discards the box collection, which is set up again by the next
+     * call to ResizeBoxCollection(). For a periodic mesh the width must be a multiple of
+     * the interaction distance plus skin.
+     *
+     * @param verletSkin the skin distance (defaults to zero).
+     */
+    void SetVerletSkin(double verletSkin);
+
+    /**
+     * @return #mVerletSkin.
+     */
+    double GetVerletSkin() const;
+
     /**
      * Overridden GetWidth method to work in parallel.
      *
@@ -314,6 +336,18 @@ public:
      */
     void ReMesh(NodeMap& rMap);
 
+    /**
+     * Reorder the nodes on this process along a Morton (Z-order) space-filling curve, so that
+     * nodes which are close in space are close in #mNodes and in memory. This improves cache
+     * use in loops over nodes and node pairs, as node order otherwise drifts as cells divide.
+     *
+     * Global node indices are unchanged, so there is no need to update a NodeMap or any
+     * cell-location maps. However, the nodes are reallocated, so any pointers to them are
+     * invalidated and the boxes are emptied; call UpdateBoxCollection() before calculating
+     * node pairs. Must be called after ReMesh(), with no deleted nodes.
+     */
+    void ReorderNodesAlongMortonCurve();
+
     /**
      * Set the initial box collection without passing nodes to the mesh. Used for memory efficient construction in parallel.
      * @param domainSize the initial domain size of the mesh.
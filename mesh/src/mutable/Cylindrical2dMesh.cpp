@@ -43,6 +43,16 @@ mesh_writer.WriteFilesUsingMesh(*this);
 #include "Cylindrical2dMesh.hpp"
 #include "Exception.hpp"
 
+#include <cstring>
+#include <climits>
+
+// Jonathan Shewchuk's triangle
+#define REAL double
+#define VOID void
+#include "triangle.h"
+#undef REAL
+#undef VOID
+
 Cylindrical2dMesh::Cylindrical2dMesh(double width)
   : MutableMesh<2,2>(),
     mWidth(width)
@@ -179,6 +189,294 @@ void Cylindrical2dMesh::CreateHaloNodes()
 }
 
 void Cylindrical2dMesh::ReMesh(NodeMap& rMap)
+{
+    if (!ReMeshOnCylinder(rMap))
+    {
+        ReMeshUsingMirrorNodes(rMap);
+    }
+}
+
+bool Cylindrical2dMesh::ReMeshOnCylinder(NodeMap& rMap)
+{
+    unsigned old_num_all_nodes = GetNumAllNodes();
+
+    // Collect the live nodes; these keep their relative order
+    std::vector<Node<2>*> live_nodes;
+    live_nodes.reserve(old_num_all_nodes);
+    for (unsigned i=0; i<old_num_all_nodes; i++)
+    {
+        if (!mNodes[i]->IsDeleted())
+        {
+            live_nodes.push_back(mNodes[i]);
+        }
+    }
+    unsigned num_live_nodes = live_nodes.size();
+
+    // The halo rows are placed exactly as in CreateHaloNodes(), but are never added to the mesh
+    UpdateTopAndBottom();
+    unsigned num_halo_nodes = (unsigned)(floor(mWidth*2.0));
+    if (num_halo_nodes == 0 || num_live_nodes == 0)
+    {
+        return false;
+    }
+    double halo_node_separation = mWidth/((double)(num_halo_nodes));
+    double y_top_coordinate = mTop + halo_node_separation;
+    double y_bottom_coordinate = mBottom - halo_node_separation;
+
+    /*
+     * Lay out the points to triangulate: the live nodes, then the halo, then
+     * images of the left half shifted right by mWidth and images of the right
+     * half shifted left by mWidth. Each point records the new index of the node
+     * it represents, or UINT_MAX for the halo.
+     */
+    unsigned num_original_points = num_live_nodes + 2*num_halo_nodes;
+    unsigned num_points = 2*num_original_points;
+    std::vector<double> points(2*num_points);
+    std::vector<unsigned> point_to_node(num_points);
+
+    for (unsigned i=0; i<num_live_nodes; i++)
+    {
+        const c_vector<double, 2>& r_location = live_nodes[i]->rGetLocation();
+        assert(0.0 <= r_location[0]);
+        assert(r_location[0] <= mWidth);
+        points[2*i] = r_location[0];
+        points[2*i+1] = r_location[1];
+        point_to_node[i] = i;
+    }
+    for (unsigned i=0; i<num_halo_nodes; i++)
+    {
+        unsigned top = num_live_nodes + 2*i;
+        points[2*top] = 0.5*halo_node_separation + (double)(i)*halo_node_separation;
+        points[2*top+1] = y_top_coordinate;
+        point_to_node[top] = UINT_MAX;
+
+        points[2*(top+1)] = points[2*top];
+        points[2*(top+1)+1] = y_bottom_coordinate;
+        point_to_node[top+1] = UINT_MAX;
+    }
+
+    unsigned next_point = num_original_points;
+    for (unsigned pass=0; pass<2; pass++)
+    {
+        for (unsigned i=0; i<num_original_points; i++)
+        {
+            bool is_left = (points[2*i] < 0.5*mWidth);
+            if (is_left == (pass == 0))
+            {
+                points[2*next_point] = points[2*i] + (is_left ? mWidth : -mWidth);
+                points[2*next_point+1] = points[2*i+1];
+                point_to_node[next_point] = point_to_node[i];
+                next_point++;
+            }
+        }
+    }
+    assert(next_point == num_points);
+
+    struct triangulateio mesher_input, mesher_output;
+    this->InitialiseTriangulateIo(mesher_input);
+    this->InitialiseTriangulateIo(mesher_output);
+
+    mesher_input.numberofpoints = num_points;
+    mesher_input.pointlist = (double *) malloc(2*num_points*sizeof(double));
+    memcpy(mesher_input.pointlist, &points[0], 2*num_points*sizeof(double));
+
+    // Library call
+    triangulate((char*)"Qz", &mesher_input, &mesher_output, NULL);
+
+    /*
+     * Keep the one copy of each periodic triangle whose circumcentre lies in a window
+     * of width mWidth. Both triangles of a cocircular quad share a circumcentre, so
+     * they are always taken from the same copy and the two sides of the cylinder
+     * cannot disagree. The window is offset by half a halo spacing because triangles
+     * on two neighbouring halo nodes have their circumcentres at multiples of the
+     * halo spacing, and so would otherwise sit exactly on its edge.
+     */
+    double window_start = -0.5*halo_node_separation;
+    std::vector<unsigned> kept_triangles;
+    std::vector<unsigned> halo_triangles;
+    unsigned num_periodic_triangles = 0;
+    for (int t=0; t<mesher_output.numberoftriangles; t++)
+    {
+        const int* p_triangle = &mesher_output.trianglelist[3*t];
+        double ax = points[2*p_triangle[0]];
+        double ay = points[2*p_triangle[0]+1];
+        double bx = points[2*p_triangle[1]] - ax;
+        double by = points[2*p_triangle[1]+1] - ay;
+        double cx = points[2*p_triangle[2]] - ax;
+        double cy = points[2*p_triangle[2]+1] - ay;
+
+        double denominator = 2.0*(bx*cy - by*cx);
+        if (denominator <= 0.0)
+        {
+            // A degenerate or inverted triangle; leave it to the mirror-node remesh
+            num_periodic_triangles = UINT_MAX;
+            break;
+        }
+        double circumcentre_x = ax + (cy*(bx*bx + by*by) - by*(cx*cx + cy*cy))/denominator;
+
+        if (window_start <= circumcentre_x && circumcentre_x < window_start + mWidth)
+        {
+            num_periodic_triangles++;
+            if (point_to_node[p_triangle[0]] != UINT_MAX
+                && point_to_node[p_triangle[1]] != UINT_MAX
+                && point_to_node[p_triangle[2]] != UINT_MAX)
+            {
+                kept_triangles.push_back(t);
+            }
+            else
+            {
+                halo_triangles.push_back(t);
+            }
+        }
+    }
+
+    /*
+     * A triangulated cylinder whose boundary is the two halo rows has exactly
+     * 2V - B triangles, where V counts all vertices and B the boundary ones.
+     */
+    if (num_periodic_triangles != 2*num_live_nodes + 2*num_halo_nodes || kept_triangles.empty())
+    {
+        this->FreeTriangulateIo(mesher_input);
+        this->FreeTriangulateIo(mesher_output);
+        return false;
+    }
+
+    // The remesh will succeed, so fill in the map and discard the old elements and deleted nodes
+    rMap.Resize(old_num_all_nodes);
+    rMap.ResetToIdentity();
+    unsigned new_index = 0;
+    for (unsigned i=0; i<old_num_all_nodes; i++)
+    {
+        if (mNodes[i]->IsDeleted())
+        {
+            rMap.SetDeleted(i);
+            delete mNodes[i];
+        }
+        else
+        {
+            rMap.SetNewIndex(i, new_index);
+            new_index++;
+        }
+    }
+
+    for (unsigned i=0; i<mElements.size(); i++)
+    {
+        delete mElements[i];
+    }
+    for (unsigned i=0; i<mBoundaryElements.size(); i++)
+    {
+        delete mBoundaryElements[i];
+    }
+    mElements.clear();
+    mBoundaryElements.clear();
+    mBoundaryNodes.clear();
+    mDeletedElementIndices.clear();
+    mDeletedBoundaryElementIndices.clear();
+    mDeletedNodeIndices.clear();
+
+    if (this->mpDistributedVectorFactory && (mAddedNodes || num_live_nodes != old_num_all_nodes))
+    {
+        delete this->mpDistributedVectorFactory;
+        this->mpDistributedVectorFactory = new DistributedVectorFactory(num_live_nodes);
+    }
+    mAddedNodes = false;
+
+    mNodes = live_nodes;
+    for (unsigned i=0; i<num_live_nodes; i++)
+    {
+        mNodes[i]->SetIndex(i);
+        mNodes[i]->SetAsBoundaryNode(false);
+        mNodes[i]->rGetContainingElementIndices().clear();
+        mNodes[i]->rGetContainingBoundaryElementIndices().clear();
+    }
+
+    // Nodes sharing a triangle with the halo are on the boundary of the tissue
+    for (unsigned i=0; i<halo_triangles.size(); i++)
+    {
+        const int* p_triangle = &mesher_output.trianglelist[3*halo_triangles[i]];
+        for (unsigned j=0; j<3; j++)
+        {
+            unsigned node_index = point_to_node[p_triangle[j]];
+            if (node_index != UINT_MAX && !mNodes[node_index]->IsBoundaryNode())
+            {
+                mNodes[node_index]->SetAsBoundaryNode();
+                mBoundaryNodes.push_back(mNodes[node_index]);
+            }
+        }
+    }
+
+    /*
+     * Create the elements. Elements straddling the periodic boundary are created
+     * with temporary image nodes so that their Jacobians are computed from the
+     * unwrapped triangle, and the images are then swapped for the real nodes, as
+     * in ReconstructCylindricalMesh().
+     */
+    unsigned num_elements = kept_triangles.size();
+    mElements.reserve(num_elements);
+    this->mElementJacobians.resize(num_elements);
+    this->mElementInverseJacobians.resize(num_elements);
+    this->mElementJacobianDeterminants.resize(num_elements);
+
+    for (unsigned elem_index=0; elem_index<num_elements; elem_index++)
+    {
+        const int* p_triangle = &mesher_output.trianglelist[3*kept_triangles[elem_index]];
+
+        std::vector<Node<2>*> nodes(3);
+        std::vector<Node<2>*> image_nodes;
+        for (unsigned j=0; j<3; j++)
+        {
+            unsigned point = p_triangle[j];
+            Node<2>* p_node = mNodes[point_to_node[point]];
+            if (point >= num_original_points)
+            {
+                image_nodes.push_back(new Node<2>(p_node->GetIndex(), false, points[2*point], points[2*point+1]));
+                nodes[j] = image_nodes.back();
+            }
+            else
+            {
+                nodes[j] = p_node;
+            }
+        }
+
+        Element<2,2>* p_element = new Element<2,2>(elem_index, nodes);
+        mElements.push_back(p_element);
+        p_element->CalculateInverseJacobian(this->mElementJacobians[elem_index],
+                                            this->mElementJacobianDeterminants[elem_index],
+                                            this->mElementInverseJacobians[elem_index]);
+
+        unsigned next_image = 0;
+        for (unsigned j=0; j<3; j++)
+        {
+            unsigned point = p_triangle[j];
+            if (point >= num_original_points)
+            {
+                p_element->ReplaceNode(image_nodes[next_image], mNodes[point_to_node[point]]);
+                delete image_nodes[next_image];
+                next_image++;
+            }
+        }
+    }
+
+    this->FreeTriangulateIo(mesher_input);
+    this->FreeTriangulateIo(mesher_output);
+
+    /*
+     * As in ReMeshUsingMirrorNodes(), create a boundary element between two nodes
+     * of the first element to avoid having no boundary elements at all.
+     */
+    std::vector<Node<2>*> boundary_nodes;
+    boundary_nodes.push_back(mElements[0]->GetNode(0));
+    boundary_nodes.push_back(mElements[0]->GetNode(1));
+    BoundaryElement<1,2>* p_boundary_element = new BoundaryElement<1,2>(0, boundary_nodes);
+    p_boundary_element->RegisterWithNodes();
+    mBoundaryElements.push_back(p_boundary_element);
+    this->mBoundaryElementWeightedDirections.assign(1, zero_vector<double>(2));
+    this->mBoundaryElementJacobianDeterminants.assign(1, 0.0);
+
+    return true;
+}
+
+void Cylindrical2dMesh::ReMeshUsingMirrorNodes(NodeMap& rMap)
 {
     unsigned old_num_all_nodes = GetNumAllNodes();
 
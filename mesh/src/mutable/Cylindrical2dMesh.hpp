@@ -192,6 +192,42 @@ private:
      */
     void UseTheseElementsToDecideMeshing(std::set<unsigned>& rMainSideElements);
 
+    /**
+     * This method should only ever be called by the public ReMesh() method.
+     *
+     * Triangulates the nodes directly on the cylinder, without adding mirror
+     * or halo nodes to the mesh. The live nodes, the halo locations and their
+     * periodic images are passed to triangle as plain coordinates, and each
+     * triangle of the periodic Delaunay triangulation is kept exactly once: the
+     * copy whose circumcentre lies in one period of the cylinder. Triangles touching the halo
+     * are then discarded, which leaves the same mesh as the mirror-node remesh
+     * without having to match up or correct the two periodic boundaries.
+     *
+     * The existing nodes are kept (deleted nodes are removed and the rest are
+     * re-indexed) and all elements are rebuilt.
+     *
+     * If the triangulation does not have the expected number of elements
+     * (for example on very small or degenerate meshes) the mesh is left
+     * untouched and false is returned, so that the caller can fall back to
+     * ReMeshUsingMirrorNodes().
+     *
+     * @param rMap a reference to a nodemap which is filled in if the remesh succeeds
+     * @return whether the periodic remesh succeeded
+     */
+    bool ReMeshOnCylinder(NodeMap& rMap);
+
+    /**
+     * This method should only ever be called by the public ReMesh() method.
+     *
+     * Conduct a cylindrical remesh by calling CreateMirrorNodes() to create
+     * mirror image nodes, then calling ReMesh() on the parent class, then
+     * mapping the new node indices and calling ReconstructCylindricalMesh()
+     * to remove surplus nodes, leaving a fully periodic mesh.
+     *
+     * @param rMap a reference to a nodemap which should be created with the required number of nodes.
+     */
+    void ReMeshUsingMirrorNodes(NodeMap& rMap);
+
     /** Needed for serialization. */
     friend class boost::serialization::access;
     /**
@@ -240,10 +276,9 @@ public:
     /**
      * Overridden ReMesh() method.
      *
-     * Conduct a cylindrical remesh by calling CreateMirrorNodes() to create
-     * mirror image nodes, then calling ReMesh() on the parent class, then
-     * mapping the new node indices and calling ReconstructCylindricalMesh()
-     * to remove surplus nodes, leaving a fully periodic mesh.
+     * Conduct a cylindrical remesh by triangulating directly on the cylinder
+     * (see ReMeshOnCylinder()). If that fails, fall back to meshing a doubled
+     * set of mirror image nodes (see ReMeshUsingMirrorNodes()).
      *
      * @param rMap a reference to a nodemap which should be created with the required number of nodes.
      */
@@ -225,6 +225,9 @@ void Cylindrical2dVertexMesh::Scale(const double xScale, const double yScale, co
 
     // Also rescale the width of the mesh (this effectively scales the domain)
     mWidth *= xScale;
+
+    // Node locations and the periodic width have changed
+    InvalidateGeometryCache();
 }
 
 MutableVertexMesh<2, 2>* Cylindrical2dVertexMesh::GetMeshForVtk()
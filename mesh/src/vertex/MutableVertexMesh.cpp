@@ -310,6 +310,8 @@ void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::ClearLocationsOfT3Swaps()
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 unsigned MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::AddNode(Node<SPACE_DIM>* pNewNode)
 {
+    typename VertexMesh<ELEMENT_DIM, SPACE_DIM>::GeometryCacheSuspender geometry_cache_suspender(*this);
+
     if (mDeletedNodeIndices.empty())
     {
         pNewNode->SetIndex(this->mNodes.size());
@@ -329,6 +331,8 @@ unsigned MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::AddNode(Node<SPACE_DIM>* pNe
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 unsigned MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::AddElement(VertexElement<ELEMENT_DIM,SPACE_DIM>* pNewElement)
 {
+    typename VertexMesh<ELEMENT_DIM, SPACE_DIM>::GeometryCacheSuspender geometry_cache_suspender(*this);
+
     unsigned new_element_index = pNewElement->GetIndex();
 
     if (new_element_index == this->mElements.size())
@@ -347,6 +351,7 @@ template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::SetNode(unsigned nodeIndex, ChastePoint<SPACE_DIM> point)
 {
     this->mNodes[nodeIndex]->SetPoint(point);
+    this->InvalidateGeometryCacheForNode(nodeIndex);
 }
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
@@ -354,6 +359,8 @@ unsigned MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::DivideElementAlongGivenAxis(
                                                                                 c_vector<double, SPACE_DIM> axisOfDivision,
                                                                                 bool placeOriginalElementBelow)
 {
+    typename VertexMesh<ELEMENT_DIM, SPACE_DIM>::GeometryCacheSuspender geometry_cache_suspender(*this);
+
     assert(SPACE_DIM == 2);
     assert(ELEMENT_DIM == SPACE_DIM);
 
@@ -554,6 +561,8 @@ unsigned MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::DivideElement(VertexElement<
                                                                   unsigned nodeBIndex,
                                                                   bool placeOriginalElementBelow)
 {
+    typename VertexMesh<ELEMENT_DIM, SPACE_DIM>::GeometryCacheSuspender geometry_cache_suspender(*this);
+
     assert(SPACE_DIM == 2);
     assert(ELEMENT_DIM == SPACE_DIM);
 
@@ -677,6 +686,8 @@ unsigned MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::DivideElement(VertexElement<
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::DeleteElementPriorToReMesh(unsigned index)
 {
+    typename VertexMesh<ELEMENT_DIM, SPACE_DIM>::GeometryCacheSuspender geometry_cache_suspender(*this);
+
     assert(SPACE_DIM == 2);
 
     // Mark any nodes that are contained only in this element as deleted
@@ -701,6 +712,8 @@ void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::DeleteElementPriorToReMesh(unsig
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::DeleteNodePriorToReMesh(unsigned index)
 {
+    typename VertexMesh<ELEMENT_DIM, SPACE_DIM>::GeometryCacheSuspender geometry_cache_suspender(*this);
+
     this->mNodes[index]->MarkAsDeleted();
     mDeletedNodeIndices.push_back(index);
 }
@@ -708,6 +721,8 @@ void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::DeleteNodePriorToReMesh(unsigned
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::DivideEdge(Node<SPACE_DIM>* pNodeA, Node<SPACE_DIM>* pNodeB)
 {
+    typename VertexMesh<ELEMENT_DIM, SPACE_DIM>::GeometryCacheSuspender geometry_cache_suspender(*this);
+
     // Find the indices of the elements owned by each node
     std::set<unsigned> elements_containing_nodeA = pNodeA->rGetContainingElementIndices();
     std::set<unsigned> elements_containing_nodeB = pNodeB->rGetContainingElementIndices();
@@ -784,6 +799,8 @@ void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::DivideEdge(Node<SPACE_DIM>* pNod
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::RemoveDeletedNodesAndElements(VertexElementMap& rElementMap)
 {
+    typename VertexMesh<ELEMENT_DIM, SPACE_DIM>::GeometryCacheSuspender geometry_cache_suspender(*this);
+
     // Make sure the map is big enough.  Each entry will be set in the loop below.
     rElementMap.Resize(this->GetNumAllElements());
 
@@ -823,6 +840,8 @@ void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::RemoveDeletedNodesAndElements(Ve
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::RemoveDeletedNodes()
 {
+    typename VertexMesh<ELEMENT_DIM, SPACE_DIM>::GeometryCacheSuspender geometry_cache_suspender(*this);
+
     // Remove any nodes that have been marked for deletion and store all other nodes in a temporary structure
     std::vector<Node<SPACE_DIM>*> live_nodes;
     for (unsigned i=0; i<this->mNodes.size(); i++)
@@ -854,6 +873,8 @@ void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::RemoveDeletedNodes()
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::ReMesh(VertexElementMap& rElementMap)
 {
+    typename VertexMesh<ELEMENT_DIM, SPACE_DIM>::GeometryCacheSuspender geometry_cache_suspender(*this);
+
     // Make sure that we are in the correct dimension - this code will be eliminated at compile time
     assert(SPACE_DIM==2 || SPACE_DIM==3);
     assert(ELEMENT_DIM == SPACE_DIM);
@@ -1071,6 +1092,8 @@ bool MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::CheckForIntersections()
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::IdentifySwapType(Node<SPACE_DIM>* pNodeA, Node<SPACE_DIM>* pNodeB)
 {
+    typename VertexMesh<ELEMENT_DIM, SPACE_DIM>::GeometryCacheSuspender geometry_cache_suspender(*this);
+
     // Find the sets of elements containing nodes A and B
     std::set<unsigned> nodeA_elem_indices = pNodeA->rGetContainingElementIndices();
     std::set<unsigned> nodeB_elem_indices = pNodeB->rGetContainingElementIndices();
@@ -1401,6 +1424,8 @@ void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::IdentifySwapType(Node<SPACE_DIM>
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::PerformNodeMerge(Node<SPACE_DIM>* pNodeA, Node<SPACE_DIM>* pNodeB)
 {
+    typename VertexMesh<ELEMENT_DIM, SPACE_DIM>::GeometryCacheSuspender geometry_cache_suspender(*this);
+
     // Find the sets of elements containing each of the nodes, sorted by index
     std::set<unsigned> nodeA_elem_indices = pNodeA->rGetContainingElementIndices();
     std::set<unsigned> nodeB_elem_indices = pNodeB->rGetContainingElementIndices();
@@ -1441,6 +1466,8 @@ void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::PerformT1Swap(Node<SPACE_DIM>* p
                                                               Node<SPACE_DIM>* pNodeB,
                                                               std::set<unsigned>& rElementsContainingNodes)
 {
+    typename VertexMesh<ELEMENT_DIM, SPACE_DIM>::GeometryCacheSuspender geometry_cache_suspender(*this);
+
     // First compute and store the location of the T1 swap, which is at the midpoint of nodes A and B
     double distance_between_nodes_CD = mCellRearrangementRatio*mCellRearrangementThreshold;
 
@@ -1580,6 +1607,8 @@ void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::PerformT1Swap(Node<SPACE_DIM>* p
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::PerformIntersectionSwap(Node<SPACE_DIM>* pNode, unsigned elementIndex)
 {
+    typename VertexMesh<ELEMENT_DIM, SPACE_DIM>::GeometryCacheSuspender geometry_cache_suspender(*this);
+
     assert(SPACE_DIM == 2);
     assert(ELEMENT_DIM == SPACE_DIM);
 
@@ -1746,6 +1775,8 @@ void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::PerformIntersectionSwap(Node<SPA
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::PerformT2Swap(VertexElement<ELEMENT_DIM,SPACE_DIM>& rElement)
 {
+    typename VertexMesh<ELEMENT_DIM, SPACE_DIM>::GeometryCacheSuspender geometry_cache_suspender(*this);
+
     // The given element must be triangular for us to be able to perform a T2 swap on it
     assert(rElement.GetNumNodes() == 3);
 
@@ -1814,6 +1845,8 @@ void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::PerformT2Swap(VertexElement<ELEM
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::PerformT3Swap(Node<SPACE_DIM>* pNode, unsigned elementIndex)
 {
+    typename VertexMesh<ELEMENT_DIM, SPACE_DIM>::GeometryCacheSuspender geometry_cache_suspender(*this);
+
     assert(SPACE_DIM == 2);
     assert(ELEMENT_DIM == SPACE_DIM);
     assert(pNode->IsBoundaryNode());
@@ -2521,6 +2554,8 @@ void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::PerformT3Swap(Node<SPACE_DIM>* p
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::PerformVoidRemoval(Node<SPACE_DIM>* pNodeA, Node<SPACE_DIM>* pNodeB, Node<SPACE_DIM>* pNodeC)
 {
+    typename VertexMesh<ELEMENT_DIM, SPACE_DIM>::GeometryCacheSuspender geometry_cache_suspender(*this);
+
     // Calculate void centroid
     c_vector<double, SPACE_DIM> nodes_midpoint = pNodeA->rGetLocation()
             + this->GetVectorFromAtoB(pNodeA->rGetLocation(), pNodeB->rGetLocation()) / 3.0
@@ -2559,6 +2594,8 @@ void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::PerformVoidRemoval(Node<SPACE_DI
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::HandleHighOrderJunctions(Node<SPACE_DIM>* pNodeA, Node<SPACE_DIM>* pNodeB)
 {
+    typename VertexMesh<ELEMENT_DIM, SPACE_DIM>::GeometryCacheSuspender geometry_cache_suspender(*this);
+
     unsigned node_a_rank = pNodeA->rGetContainingElementIndices().size();
     unsigned node_b_rank = pNodeB->rGetContainingElementIndices().size();
 
@@ -2578,6 +2615,8 @@ void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::HandleHighOrderJunctions(Node<SP
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::PerformRosetteRankIncrease(Node<SPACE_DIM>* pNodeA, Node<SPACE_DIM>* pNodeB)
 {
+    typename VertexMesh<ELEMENT_DIM, SPACE_DIM>::GeometryCacheSuspender geometry_cache_suspender(*this);
+
     /*
      * One of the nodes will have 3 containing element indices, the other
      * will have at least four. We first identify which node is which.
@@ -2665,6 +2704,8 @@ void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::PerformRosetteRankIncrease(Node<
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::PerformProtorosetteResolution(Node<SPACE_DIM>* pProtorosetteNode)
 {
+    typename VertexMesh<ELEMENT_DIM, SPACE_DIM>::GeometryCacheSuspender geometry_cache_suspender(*this);
+
     // Double check we are dealing with a protorosette
     assert(pProtorosetteNode->rGetContainingElementIndices().size() == 4);
 
@@ -2851,6 +2892,8 @@ void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::PerformProtorosetteResolution(No
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::PerformRosetteRankDecrease(Node<SPACE_DIM>* pRosetteNode)
 {
+    typename VertexMesh<ELEMENT_DIM, SPACE_DIM>::GeometryCacheSuspender geometry_cache_suspender(*this);
+
     unsigned rosette_rank = pRosetteNode->rGetContainingElementIndices().size();
 
     // Double check we're dealing with a rosette
@@ -3026,6 +3069,8 @@ void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::PerformRosetteRankDecrease(Node<
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 void MutableVertexMesh<ELEMENT_DIM, SPACE_DIM>::CheckForRosettes()
 {
+    typename VertexMesh<ELEMENT_DIM, SPACE_DIM>::GeometryCacheSuspender geometry_cache_suspender(*this);
+
     /**
      * First, we loop over each node and populate vectors of protorosette and rosette nodes which need to undergo
      * resolution.
@@ -40,7 +40,10 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 VertexMesh<ELEMENT_DIM, SPACE_DIM>::VertexMesh(std::vector<Node<SPACE_DIM>*> nodes,
                                                std::vector<VertexElement<ELEMENT_DIM,SPACE_DIM>*> vertexElements)
-    : mpDelaunayMesh(NULL)
+    : mpDelaunayMesh(NULL),
+      mUseGeometryCache(false),
+      mGeometryCacheGeneration(1),
+      mGeometryCacheSuspendCount(0)
 {
 
     // Reset member variables and clear mNodes and mElements
@@ -105,7 +108,10 @@ template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 VertexMesh<ELEMENT_DIM, SPACE_DIM>::VertexMesh(std::vector<Node<SPACE_DIM>*> nodes,
                            std::vector<VertexElement<ELEMENT_DIM-1, SPACE_DIM>*> faces,
                            std::vector<VertexElement<ELEMENT_DIM, SPACE_DIM>*> vertexElements)
-    : mpDelaunayMesh(NULL)
+    : mpDelaunayMesh(NULL),
+      mUseGeometryCache(false),
+      mGeometryCacheGeneration(1),
+      mGeometryCacheSuspendCount(0)
 {
     // Reset member variables and clear mNodes, mFaces and mElements
     Clear();
@@ -152,7 +158,10 @@ VertexMesh<ELEMENT_DIM, SPACE_DIM>::VertexMesh(std::vector<Node<SPACE_DIM>*> nod
  */
 template<>
 VertexMesh<2,2>::VertexMesh(TetrahedralMesh<2,2>& rMesh, bool isPeriodic)
-    : mpDelaunayMesh(&rMesh)
+    : mpDelaunayMesh(&rMesh),
+      mUseGeometryCache(false),
+      mGeometryCacheGeneration(1),
+      mGeometryCacheSuspendCount(0)
 {
     //Note  !isPeriodic is not used except through polymorphic calls in rMesh
 
@@ -242,7 +251,10 @@ VertexMesh<2,2>::VertexMesh(TetrahedralMesh<2,2>& rMesh, bool isPeriodic)
  */
 template<>
 VertexMesh<3,3>::VertexMesh(TetrahedralMesh<3,3>& rMesh)
-    : mpDelaunayMesh(&rMesh)
+    : mpDelaunayMesh(&rMesh),
+      mUseGeometryCache(false),
+      mGeometryCacheGeneration(1),
+      mGeometryCacheSuspendCount(0)
 {
     // Reset member variables and clear mNodes, mFaces and mElements
     Clear();
@@ -463,6 +475,9 @@ double VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetElongationShapeFactorOfElement(uns
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 VertexMesh<ELEMENT_DIM, SPACE_DIM>::VertexMesh()
+    : mUseGeometryCache(false),
+      mGeometryCacheGeneration(1),
+      mGeometryCacheSuspendCount(0)
 {
     mpDelaunayMesh = NULL;
     this->mMeshChangesDuringSimulation = false;
@@ -604,6 +619,8 @@ void VertexMesh<ELEMENT_DIM, SPACE_DIM>::Clear()
         delete this->mNodes[i];
     }
     this->mNodes.clear();
+
+    mElementGeometryCache.clear();
 }
 
 
@@ -653,6 +670,17 @@ VertexElement<ELEMENT_DIM-1, SPACE_DIM>* VertexMesh<ELEMENT_DIM, SPACE_DIM>::Get
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 c_vector<double, SPACE_DIM> VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetCentroidOfElement(unsigned index)
+{
+    if (IsGeometryCacheActive())
+    {
+        return rGetElementGeometry(index).centroid;
+    }
+    return CalculateCentroidOfElement(index);
+}
+
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+c_vector<double, SPACE_DIM> VertexMesh<ELEMENT_DIM, SPACE_DIM>::CalculateCentroidOfElement(unsigned index)
 {
     VertexElement<ELEMENT_DIM, SPACE_DIM>* p_element = GetElement(index);
     unsigned num_nodes = p_element->GetNumNodes();
@@ -723,6 +751,101 @@ c_vector<double, SPACE_DIM> VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetCentroidOfEle
 }
 
 
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void VertexMesh<ELEMENT_DIM, SPACE_DIM>::SetUseGeometryCache(bool useGeometryCache)
+{
+    mUseGeometryCache = useGeometryCache;
+    InvalidateGeometryCache();
+}
+
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+bool VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetUseGeometryCache() const
+{
+    return mUseGeometryCache;
+}
+
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void VertexMesh<ELEMENT_DIM, SPACE_DIM>::InvalidateGeometryCache()
+{
+    mGeometryCacheGeneration++;
+}
+
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void VertexMesh<ELEMENT_DIM, SPACE_DIM>::RefreshMesh()
+{
+    InvalidateGeometryCache();
+}
+
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+void VertexMesh<ELEMENT_DIM, SPACE_DIM>::InvalidateGeometryCacheForNode(unsigned nodeIndex)
+{
+    if (mElementGeometryCache.empty())
+    {
+        return;
+    }
+
+    const std::set<unsigned>& r_containing_elements = this->GetNode(nodeIndex)->rGetContainingElementIndices();
+    for (std::set<unsigned>::const_iterator iter = r_containing_elements.begin();
+         iter != r_containing_elements.end();
+         ++iter)
+    {
+        if (*iter < mElementGeometryCache.size())
+        {
+            mElementGeometryCache[*iter].generation = 0;
+        }
+    }
+}
+
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+bool VertexMesh<ELEMENT_DIM, SPACE_DIM>::IsGeometryCacheActive() const
+{
+    return (mUseGeometryCache && mGeometryCacheSuspendCount == 0);
+}
+
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+const typename VertexMesh<ELEMENT_DIM, SPACE_DIM>::ElementGeometry& VertexMesh<ELEMENT_DIM, SPACE_DIM>::rGetElementGeometry(unsigned index)
+{
+    assert(index < mElements.size());
+    if (index >= mElementGeometryCache.size())
+    {
+        ElementGeometry empty_entry;
+        empty_entry.generation = 0;
+        mElementGeometryCache.resize(mElements.size(), empty_entry);
+    }
+
+    ElementGeometry& r_geometry = mElementGeometryCache[index];
+    if (r_geometry.generation != mGeometryCacheGeneration)
+    {
+        r_geometry.volume = CalculateVolumeOfElement(index);
+        r_geometry.surfaceArea = CalculateSurfaceAreaOfElement(index);
+        r_geometry.centroid = CalculateCentroidOfElement(index);
+
+        if (SPACE_DIM == 2)
+        {
+            VertexElement<ELEMENT_DIM, SPACE_DIM>* p_element = GetElement(index);
+            unsigned num_nodes = p_element->GetNumNodes();
+            r_geometry.edgeVectors.resize(num_nodes);
+            r_geometry.edgeLengths.resize(num_nodes);
+            for (unsigned local_index=0; local_index<num_nodes; local_index++)
+            {
+                r_geometry.edgeVectors[local_index] = GetVectorFromAtoB(p_element->GetNodeLocation(local_index),
+                                                                        p_element->GetNodeLocation((local_index+1)%num_nodes));
+                r_geometry.edgeLengths[local_index] = norm_2(r_geometry.edgeVectors[local_index]);
+            }
+        }
+
+        r_geometry.generation = mGeometryCacheGeneration;
+    }
+    return r_geometry;
+}
+
+
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 std::set<unsigned> VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetNeighbouringNodeIndices(unsigned nodeIndex)
 {
@@ -1052,6 +1175,17 @@ c_vector<double, SPACE_DIM> VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetVectorFromAto
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 double VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetVolumeOfElement(unsigned index)
+{
+    if (IsGeometryCacheActive())
+    {
+        return rGetElementGeometry(index).volume;
+    }
+    return CalculateVolumeOfElement(index);
+}
+
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+double VertexMesh<ELEMENT_DIM, SPACE_DIM>::CalculateVolumeOfElement(unsigned index)
 {
     assert(SPACE_DIM == 2 || SPACE_DIM == 3);
 
@@ -1112,6 +1246,17 @@ double VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetVolumeOfElement(unsigned index)
 
 template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
 double VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetSurfaceAreaOfElement(unsigned index)
+{
+    if (IsGeometryCacheActive())
+    {
+        return rGetElementGeometry(index).surfaceArea;
+    }
+    return CalculateSurfaceAreaOfElement(index);
+}
+
+
+template<unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+double VertexMesh<ELEMENT_DIM, SPACE_DIM>::CalculateSurfaceAreaOfElement(unsigned index)
 {
     assert(SPACE_DIM == 2 || SPACE_DIM == 3);
 
@@ -1449,6 +1594,18 @@ c_vector<double, SPACE_DIM> VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetAreaGradientO
     // We add an extra num_nodes_in_element in the line below as otherwise this term can be negative, which breaks the % operator
     unsigned previous_local_index = (num_nodes_in_element+localIndex-1)%num_nodes_in_element;
 
+    if (IsGeometryCacheActive())
+    {
+        // The vector from the previous to the next node is the sum of the two edges meeting at this node
+        const ElementGeometry& r_geometry = rGetElementGeometry(pElement->GetIndex());
+        c_vector<double, SPACE_DIM> difference_vector = r_geometry.edgeVectors[previous_local_index] + r_geometry.edgeVectors[localIndex];
+
+        c_vector<double, SPACE_DIM> area_gradient;
+        area_gradient[0] = 0.5*difference_vector[1];
+        area_gradient[1] = -0.5*difference_vector[0];
+        return area_gradient;
+    }
+
     c_vector<double, SPACE_DIM> previous_node_location = pElement->GetNodeLocation(previous_local_index);
     c_vector<double, SPACE_DIM> next_node_location = pElement->GetNodeLocation(next_local_index);
     c_vector<double, SPACE_DIM> difference_vector = this->GetVectorFromAtoB(previous_node_location, next_node_location);
@@ -1472,6 +1629,13 @@ c_vector<double, SPACE_DIM> VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetPreviousEdgeG
     // We add an extra num_nodes_in_element-1 in the line below as otherwise this term can be negative, which breaks the % operator
     unsigned previous_local_index = (num_nodes_in_element+localIndex-1)%num_nodes_in_element;
 
+    if (IsGeometryCacheActive())
+    {
+        const ElementGeometry& r_geometry = rGetElementGeometry(pElement->GetIndex());
+        assert(r_geometry.edgeLengths[previous_local_index] > DBL_EPSILON);
+        return r_geometry.edgeVectors[previous_local_index]/r_geometry.edgeLengths[previous_local_index];
+    }
+
     unsigned this_global_index = pElement->GetNodeGlobalIndex(localIndex);
     unsigned previous_global_index = pElement->GetNodeGlobalIndex(previous_local_index);
 
@@ -1491,6 +1655,13 @@ c_vector<double, SPACE_DIM> VertexMesh<ELEMENT_DIM, SPACE_DIM>::GetNextEdgeGradi
 
     unsigned next_local_index = (localIndex+1)%(pElement->GetNumNodes());
 
+    if (IsGeometryCacheActive())
+    {
+        const ElementGeometry& r_geometry = rGetElementGeometry(pElement->GetIndex());
+        assert(r_geometry.edgeLengths[localIndex] > DBL_EPSILON);
+        return -r_geometry.edgeVectors[localIndex]/r_geometry.edgeLengths[localIndex];
+    }
+
     unsigned this_global_index = pElement->GetNodeGlobalIndex(localIndex);
     unsigned next_global_index = pElement->GetNodeGlobalIndex(next_local_index);
 
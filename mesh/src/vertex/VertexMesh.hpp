@@ -101,6 +101,120 @@ protected:
      */
     TetrahedralMesh<ELEMENT_DIM, SPACE_DIM>* mpDelaunayMesh;
 
+    /**
+     * Geometric quantities of an element, stored by the geometry cache.
+     * In 2D the edge vectors and lengths are also stored, so that the area
+     * and perimeter gradients at each node can be looked up rather than
+     * recomputed.
+     */
+    struct ElementGeometry
+    {
+        /** Value of mGeometryCacheGeneration when this entry was computed (0 if never). */
+        unsigned generation;
+
+        /** The volume (area in 2D) of the element. */
+        double volume;
+
+        /** The surface area (perimeter in 2D) of the element. */
+        double surfaceArea;
+
+        /** The centroid of the element. */
+        c_vector<double, SPACE_DIM> centroid;
+
+        /** In 2D, the vector from local node i to local node i+1 of the element. */
+        std::vector<c_vector<double, SPACE_DIM> > edgeVectors;
+
+        /** In 2D, the length of each edge vector. */
+        std::vector<double> edgeLengths;
+    };
+
+    /** Whether to cache element volumes, surface areas, centroids and edges. Defaults to false. */
+    bool mUseGeometryCache;
+
+    /**
+     * Generation counter for the geometry cache. A cache entry is only valid
+     * if its generation matches this value, so incrementing it invalidates
+     * every entry at once.
+     */
+    unsigned mGeometryCacheGeneration;
+
+    /**
+     * While this is non-zero the geometry cache is bypassed. Used to guard
+     * topology changes, during which nodes are moved directly.
+     */
+    unsigned mGeometryCacheSuspendCount;
+
+    /** The geometry cache, indexed by element index. */
+    std::vector<ElementGeometry> mElementGeometryCache;
+
+    /**
+     * Helper that suspends the geometry cache for its lifetime and invalidates
+     * the whole cache when it goes out of scope (including via an exception).
+     * Methods that change the mesh topology create one of these on entry.
+     */
+    class GeometryCacheSuspender
+    {
+    private:
+        /** The mesh whose cache is suspended. */
+        VertexMesh<ELEMENT_DIM, SPACE_DIM>& mrMesh;
+
+    public:
+        /**
+         * Constructor.
+         *
+         * @param rMesh the mesh whose cache is suspended
+         */
+        GeometryCacheSuspender(VertexMesh<ELEMENT_DIM, SPACE_DIM>& rMesh)
+            : mrMesh(rMesh)
+        {
+            mrMesh.mGeometryCacheSuspendCount++;
+        }
+
+        /** Destructor. */
+        ~GeometryCacheSuspender()
+        {
+            mrMesh.mGeometryCacheSuspendCount--;
+            mrMesh.InvalidateGeometryCache();
+        }
+    };
+
+    /**
+     * @return whether the geometry cache is in use and not suspended
+     */
+    bool IsGeometryCacheActive() const;
+
+    /**
+     * Get the cached geometry of an element, recomputing it if it is out of date.
+     *
+     * @param index the global index of the element
+     * @return the cached geometry
+     */
+    const ElementGeometry& rGetElementGeometry(unsigned index);
+
+    /**
+     * Compute the centroid of an element, bypassing the geometry cache.
+     *
+     * @param index the global index of the element
+     * @return the centroid
+     */
+    c_vector<double, SPACE_DIM> CalculateCentroidOfElement(unsigned index);
+
+    /**
+     * Compute the volume of an element, bypassing the geometry cache.
+     *
+     * @param index the global index of the element
+     * @return the volume
+     */
+    double CalculateVolumeOfElement(unsigned index);
+
+    /**
+     * Compute the surface area of an element, bypassing the geometry cache.
+     *
+     * @param index the global index of the element
+     * @return the surface area
+     */
+    double CalculateSurfaceAreaOfElement(unsigned index);
+
     /**
      * Solve node mapping method. This overridden method is required
      * as it is pure virtual in the base class.
@@ -327,6 +441,46 @@ public:
      */
     virtual c_vector<double, SPACE_DIM> GetCentroidOfElement(unsigned index);
 
+    /**
+     * Set whether to cache element geometry (volume, surface area, centroid
+     * and, in 2D, the edges used to compute area and perimeter gradients).
+     *
+     * When the cache is in use each quantity is computed at most once per
+     * element between node movements, so force calculations, modifiers and
+     * writers that query the same element repeatedly only walk its nodes once.
+     * Entries are invalidated by SetNode(), by Scale(), Translate() and Rotate()
+     * (through RefreshMesh()) and by topology changes in MutableVertexMesh. If
+     * node locations are changed in any other way (e.g. via
+     * Node::rGetModifiableLocation()), InvalidateGeometryCache() or RefreshMesh()
+     * must be called before geometry is next queried.
+     *
+     * @param useGeometryCache whether to use the cache (defaults to true)
+     */
+    void SetUseGeometryCache(bool useGeometryCache=true);
+
+    /**
+     * @return whether element geometry is being cached
+     */
+    bool GetUseGeometryCache() const;
+
+    /**
+     * Mark the cached geometry of every element as out of date.
+     */
+    void InvalidateGeometryCache();
+
+    /**
+     * Overridden RefreshMesh() method, called after the whole mesh has been
+     * scaled, translated or rotated, which invalidates any cached geometry.
+     */
+    virtual void RefreshMesh();
+
+    /**
+     * Mark the cached geometry of every element containing a given node as out of date.
+     *
+     * @param nodeIndex the global index of the node
+     */
+    void InvalidateGeometryCacheForNode(unsigned nodeIndex);
+
     /**
      * Construct the mesh using a MeshReader.
      *
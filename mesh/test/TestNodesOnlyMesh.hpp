@@ -659,6 +659,66 @@ public:
         }
     }
 
+    void TestReorderNodesAlongMortonCurve() throw (Exception)
+    {
+        EXIT_IF_PARALLEL;
+
+        // A 4 by 4 grid of nodes, given in an order unrelated to their positions
+        std::vector<Node<2>*> nodes;
+        for (unsigned i=0; i<16; i++)
+        {
+            unsigned j = (7*i + 3) % 16;
+            nodes.push_back(new Node<2>(i, false, (double)(j%4), (double)(j/4)));
+        }
+
+        NodesOnlyMesh<2> mesh;
+        mesh.ConstructNodesWithoutMesh(nodes, 1.5);
+
+        for (AbstractMesh<2,2>::NodeIterator node_iter = mesh.GetNodeIteratorBegin();
+             node_iter != mesh.GetNodeIteratorEnd();
+             ++node_iter)
+        {
+            node_iter->SetRadius(0.1*node_iter->GetIndex());
+        }
+
+        mesh.ReorderNodesAlongMortonCurve();
+        TS_ASSERT_EQUALS(mesh.GetNumNodes(), 16u);
+
+        // Node indices, locations and attributes are unchanged
+        for (unsigned i=0; i<16; i++)
+        {
+            Node<2>* p_node = mesh.GetNode(i);
+            TS_ASSERT_EQUALS(p_node->GetIndex(), i);
+            TS_ASSERT_DELTA(norm_2(p_node->rGetLocation() - nodes[i]->rGetLocation()), 0.0, 1e-12);
+            TS_ASSERT_DELTA(p_node->GetRadius(), 0.1*i, 1e-12);
+        }
+
+        // Each quadrant of the grid is now contiguous, starting with the lower left
+        unsigned local_index = 0;
+        for (AbstractMesh<2,2>::NodeIterator node_iter = mesh.GetNodeIteratorBegin();
+             node_iter != mesh.GetNodeIteratorEnd();
+             ++node_iter)
+        {
+            TS_ASSERT_EQUALS(mesh.SolveNodeMapping(node_iter->GetIndex()), local_index);
+
+            unsigned quadrant = (node_iter->rGetLocation()[0] > 1.5 ? 1 : 0) + (node_iter->rGetLocation()[1] > 1.5 ? 2 : 0);
+            TS_ASSERT_EQUALS(quadrant, local_index/4);
+            local_index++;
+        }
+
+        // The boxes can be refilled with the new nodes
+        mesh.UpdateBoxCollection();
+        std::vector<std::pair<Node<2>*, Node<2>*> > node_pairs;
+        mesh.CalculateInteriorNodePairs(node_pairs);
+        mesh.CalculateBoundaryNodePairs(node_pairs);
+        TS_ASSERT(!node_pairs.empty());
+
+        for (unsigned i=0; i<nodes.size(); i++)
+        {
+            delete nodes[i];
+        }
+    }
+
     void TestCleanDeleteAndAddNode()    throw(Exception)
     {
         std::vector<Node<2>*> nodes;
@@ -266,6 +266,97 @@ public:
         mesh.ReMesh(map);
     }
 
+    void TestReMeshOnCylinderMatchesMirrorNodeReMesh() throw (Exception)
+    {
+        unsigned cells_across = 8;
+        unsigned cells_up = 10;
+        unsigned thickness_of_ghost_layer = 0;
+
+        CylindricalHoneycombMeshGenerator generator1(cells_across, cells_up, thickness_of_ghost_layer);
+        Cylindrical2dMesh* p_mirror_mesh = generator1.GetCylindricalMesh();
+        CylindricalHoneycombMeshGenerator generator2(cells_across, cells_up, thickness_of_ghost_layer);
+        Cylindrical2dMesh* p_periodic_mesh = generator2.GetCylindricalMesh();
+
+        // Move the nodes of both meshes in the same way, so the triangulation is not degenerate
+        for (unsigned i=0; i<p_mirror_mesh->GetNumNodes(); i++)
+        {
+            c_vector<double,2> location = p_mirror_mesh->GetNode(i)->rGetLocation();
+            location[0] += 0.15*sin(1.3*i);
+            location[1] += 0.15*cos(2.1*i);
+            ChastePoint<2> point(location);
+            p_mirror_mesh->SetNode(i, point, false);
+            p_periodic_mesh->SetNode(i, point, false);
+        }
+
+        // Delete a node from each, so that the node maps are not the identity
+        p_mirror_mesh->DeleteNodePriorToReMesh(17);
+        p_periodic_mesh->DeleteNodePriorToReMesh(17);
+
+        NodeMap mirror_map(p_mirror_mesh->GetNumAllNodes());
+        p_mirror_mesh->ReMeshUsingMirrorNodes(mirror_map);
+
+        NodeMap periodic_map(p_periodic_mesh->GetNumAllNodes());
+        TS_ASSERT_EQUALS(p_periodic_mesh->ReMeshOnCylinder(periodic_map), true);
+
+        // The node maps agree
+        TS_ASSERT_EQUALS(periodic_map.GetSize(), mirror_map.GetSize());
+        for (unsigned i=0; i<mirror_map.GetSize(); i++)
+        {
+            TS_ASSERT_EQUALS(periodic_map.IsDeleted(i), mirror_map.IsDeleted(i));
+            if (!mirror_map.IsDeleted(i))
+            {
+                TS_ASSERT_EQUALS(periodic_map.GetNewIndex(i), mirror_map.GetNewIndex(i));
+            }
+        }
+
+        // The meshes have the same nodes, boundary nodes and elements
+        TS_ASSERT_EQUALS(p_periodic_mesh->GetNumNodes(), p_mirror_mesh->GetNumNodes());
+        TS_ASSERT_EQUALS(p_periodic_mesh->GetNumAllNodes(), p_periodic_mesh->GetNumNodes());
+        for (unsigned i=0; i<p_mirror_mesh->GetNumNodes(); i++)
+        {
+            TS_ASSERT_EQUALS(p_periodic_mesh->GetNode(i)->GetIndex(), i);
+            TS_ASSERT_DELTA(p_periodic_mesh->GetNode(i)->rGetLocation()[0], p_mirror_mesh->GetNode(i)->rGetLocation()[0], 1e-12);
+            TS_ASSERT_DELTA(p_periodic_mesh->GetNode(i)->rGetLocation()[1], p_mirror_mesh->GetNode(i)->rGetLocation()[1], 1e-12);
+            TS_ASSERT_EQUALS(p_periodic_mesh->GetNode(i)->IsBoundaryNode(), p_mirror_mesh->GetNode(i)->IsBoundaryNode());
+            TS_ASSERT_EQUALS(p_periodic_mesh->GetNode(i)->GetNumContainingElements(), p_mirror_mesh->GetNode(i)->GetNumContainingElements());
+        }
+
+        TS_ASSERT_EQUALS(p_periodic_mesh->GetNumElements(), p_mirror_mesh->GetNumElements());
+        TS_ASSERT_EQUALS(p_periodic_mesh->GetNumAllElements(), p_periodic_mesh->GetNumElements());
+        TS_ASSERT_EQUALS(p_periodic_mesh->GetNumBoundaryElements(), 1u);
+
+        std::set<std::set<unsigned> > mirror_elements;
+        for (MutableMesh<2,2>::ElementIterator elem_iter = p_mirror_mesh->GetElementIteratorBegin();
+             elem_iter != p_mirror_mesh->GetElementIteratorEnd();
+             ++elem_iter)
+        {
+            std::set<unsigned> element_nodes;
+            for (unsigned j=0; j<3; j++)
+            {
+                element_nodes.insert(elem_iter->GetNodeGlobalIndex(j));
+            }
+            mirror_elements.insert(element_nodes);
+        }
+
+        for (MutableMesh<2,2>::ElementIterator elem_iter = p_periodic_mesh->GetElementIteratorBegin();
+             elem_iter != p_periodic_mesh->GetElementIteratorEnd();
+             ++elem_iter)
+        {
+            std::set<unsigned> element_nodes;
+            for (unsigned j=0; j<3; j++)
+            {
+                element_nodes.insert(elem_iter->GetNodeGlobalIndex(j));
+            }
+            TS_ASSERT(mirror_elements.find(element_nodes) != mirror_elements.end());
+
+            // Elements straddling the periodic boundary still have a positive cached Jacobian determinant
+            c_matrix<double, 2, 2> jacobian;
+            double determinant;
+            p_periodic_mesh->GetJacobianForElement(elem_iter->GetIndex(), jacobian, determinant);
+            TS_ASSERT_LESS_THAN(0.0, determinant);
+        }
+    }
+
     void TestCylindricalReMeshAfterDelete() throw (Exception)
     {
         unsigned cells_across = 6;
@@ -44,6 +44,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "VertexMeshReader.hpp"
 #include "VertexMeshWriter.hpp"
 #include "MutableVertexMesh.hpp"
+#include "HoneycombVertexMeshGenerator.hpp"
 #include "ArchiveOpener.hpp"
 
 //This test is always run sequentially (never in parallel)
@@ -375,6 +376,96 @@ public:
         TS_ASSERT_DELTA(point3[1], 1.9, 1e-6);
     }
 
+    void TestGeometryCache() throw (Exception)
+    {
+        // Create two identical meshes, one of which caches element geometry
+        HoneycombVertexMeshGenerator generator(3, 3);
+        MutableVertexMesh<2,2>* p_mesh = generator.GetMesh();
+        HoneycombVertexMeshGenerator cached_generator(3, 3);
+        MutableVertexMesh<2,2>* p_cached_mesh = cached_generator.GetMesh();
+
+        TS_ASSERT_EQUALS(p_cached_mesh->GetUseGeometryCache(), false);
+        p_cached_mesh->SetUseGeometryCache();
+        TS_ASSERT_EQUALS(p_cached_mesh->GetUseGeometryCache(), true);
+
+        for (unsigned step=0; step<6; step++)
+        {
+            if (step == 1)
+            {
+                // Moving a node through SetNode() invalidates the elements containing it
+                ChastePoint<2> point = p_mesh->GetNode(8)->GetPoint();
+                point.SetCoordinate(0, point[0] + 0.1);
+                point.SetCoordinate(1, point[1] - 0.05);
+                p_mesh->SetNode(8, point);
+                p_cached_mesh->SetNode(8, point);
+            }
+            else if (step == 2)
+            {
+                // Dividing an element changes the topology
+                c_vector<double, 2> axis;
+                axis[0] = 0.0;
+                axis[1] = 1.0;
+                p_mesh->DivideElementAlongGivenAxis(p_mesh->GetElement(4), axis);
+                p_cached_mesh->DivideElementAlongGivenAxis(p_cached_mesh->GetElement(4), axis);
+            }
+            else if (step == 3)
+            {
+                // Translating, scaling or rotating the whole mesh invalidates every element
+                p_mesh->Translate(0.5, -0.2);
+                p_cached_mesh->Translate(0.5, -0.2);
+            }
+            else if (step == 4)
+            {
+                p_mesh->Scale(2.0, 0.5);
+                p_cached_mesh->Scale(2.0, 0.5);
+            }
+            else if (step == 5)
+            {
+                p_mesh->Rotate(0.3);
+                p_cached_mesh->Rotate(0.3);
+            }
+
+            TS_ASSERT_EQUALS(p_cached_mesh->GetNumElements(), p_mesh->GetNumElements());
+            for (unsigned elem_index=0; elem_index<p_mesh->GetNumElements(); elem_index++)
+            {
+                // Query each quantity twice so that the second value comes from the cache
+                for (unsigned repeat=0; repeat<2; repeat++)
+                {
+                    TS_ASSERT_DELTA(p_cached_mesh->GetVolumeOfElement(elem_index), p_mesh->GetVolumeOfElement(elem_index), 1e-12);
+                    TS_ASSERT_DELTA(p_cached_mesh->GetSurfaceAreaOfElement(elem_index), p_mesh->GetSurfaceAreaOfElement(elem_index), 1e-12);
+
+                    c_vector<double, 2> centroid = p_mesh->GetCentroidOfElement(elem_index);
+                    c_vector<double, 2> cached_centroid = p_cached_mesh->GetCentroidOfElement(elem_index);
+                    TS_ASSERT_DELTA(cached_centroid[0], centroid[0], 1e-12);
+                    TS_ASSERT_DELTA(cached_centroid[1], centroid[1], 1e-12);
+                }
+
+                VertexElement<2,2>* p_element = p_mesh->GetElement(elem_index);
+                VertexElement<2,2>* p_cached_element = p_cached_mesh->GetElement(elem_index);
+                for (unsigned local_index=0; local_index<p_element->GetNumNodes(); local_index++)
+                {
+                    c_vector<double, 2> area_gradient = p_mesh->GetAreaGradientOfElementAtNode(p_element, local_index);
+                    c_vector<double, 2> cached_area_gradient = p_cached_mesh->GetAreaGradientOfElementAtNode(p_cached_element, local_index);
+                    TS_ASSERT_DELTA(cached_area_gradient[0], area_gradient[0], 1e-12);
+                    TS_ASSERT_DELTA(cached_area_gradient[1], area_gradient[1], 1e-12);
+
+                    c_vector<double, 2> perimeter_gradient = p_mesh->GetPerimeterGradientOfElementAtNode(p_element, local_index);
+                    c_vector<double, 2> cached_perimeter_gradient = p_cached_mesh->GetPerimeterGradientOfElementAtNode(p_cached_element, local_index);
+                    TS_ASSERT_DELTA(cached_perimeter_gradient[0], perimeter_gradient[0], 1e-12);
+                    TS_ASSERT_DELTA(cached_perimeter_gradient[1], perimeter_gradient[1], 1e-12);
+                }
+            }
+        }
+
+        // Moving a node directly requires the cache to be invalidated explicitly
+        unsigned elem_index = *(p_cached_mesh->GetNode(0)->rGetContainingElementIndices().begin());
+        double old_volume = p_cached_mesh->GetVolumeOfElement(elem_index);
+        p_cached_mesh->GetNode(0)->rGetModifiableLocation()[1] -= 0.1;
+        TS_ASSERT_DELTA(p_cached_mesh->GetVolumeOfElement(elem_index), old_volume, 1e-12);
+        p_cached_mesh->InvalidateGeometryCache();
+        TS_ASSERT_LESS_THAN(1e-3, fabs(p_cached_mesh->GetVolumeOfElement(elem_index) - old_volume));
+    }
+
     void TestAddNodeAndReMesh() throw (Exception)
     {
         // Create mesh
@@ -71,3 +71,8 @@ double AbstractIvpOdeSolver::GetStoppingTime()
 {
     return mStoppingTime;
 }
+
+boost::shared_ptr<AbstractIvpOdeSolver> AbstractIvpOdeSolver::Clone() const
+{
+    return boost::shared_ptr<AbstractIvpOdeSolver>();
+}
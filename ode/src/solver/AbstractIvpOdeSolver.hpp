@@ -37,6 +37,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #define _ABSTRACTIVPODESOLVER_HPP_
 
 #include <vector>
+#include <boost/shared_ptr.hpp>
 
 #include "ChasteSerialization.hpp"
 #include "ClassIsAbstract.hpp"
@@ -154,6 +155,15 @@ public:
      */
     double GetStoppingTime();
 
+    /**
+     * Make a new solver of the same type and with the same settings, but with its own
+     * working memory, so that the two may be used at the same time (e.g. by different
+     * threads).  Solvers which do not support this return an empty pointer.
+     *
+     * @return the new solver
+     */
+    virtual boost::shared_ptr<AbstractIvpOdeSolver> Clone() const;
+
     /**
      * Constructor.
      */
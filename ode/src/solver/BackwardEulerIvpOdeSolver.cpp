@@ -250,6 +250,15 @@ void BackwardEulerIvpOdeSolver::ForceUseOfNumericalJacobian()
     mForceUseOfNumericalJacobian = true;
 }
 
+boost::shared_ptr<AbstractIvpOdeSolver> BackwardEulerIvpOdeSolver::Clone() const
+{
+    // The working memory is allocated by the constructor, so can't just be copied
+    BackwardEulerIvpOdeSolver* p_solver = new BackwardEulerIvpOdeSolver(mSizeOfOdeSystem);
+    p_solver->mNumericalJacobianEpsilon = mNumericalJacobianEpsilon;
+    p_solver->mForceUseOfNumericalJacobian = mForceUseOfNumericalJacobian;
+    return boost::shared_ptr<AbstractIvpOdeSolver>(p_solver);
+}
+
 
 // Serialization for Boost >= 1.36
 #include "SerializationExportWrapperForCpp.hpp"
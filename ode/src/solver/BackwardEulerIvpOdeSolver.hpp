@@ -213,6 +213,11 @@ public:
      * @return the size of the system
      */
      unsigned GetSystemSize() const {return mSizeOfOdeSystem;};
+
+    /**
+     * @return a new solver like this one, with its own working memory (see AbstractIvpOdeSolver::Clone())
+     */
+    boost::shared_ptr<AbstractIvpOdeSolver> Clone() const;
 };
 
 #include "SerializationExportWrapper.hpp"
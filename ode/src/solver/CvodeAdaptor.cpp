@@ -515,6 +515,18 @@ long int CvodeAdaptor::GetMaxSteps()
     return mMaxSteps;
 }
 
+boost::shared_ptr<AbstractIvpOdeSolver> CvodeAdaptor::Clone() const
+{
+    // Only the settings are copied; the new solver will set up CVODE afresh on first use
+    CvodeAdaptor* p_solver = new CvodeAdaptor(mRelTol, mAbsTol);
+    p_solver->mMaxSteps = mMaxSteps;
+    p_solver->mCheckForRoots = mCheckForRoots;
+    p_solver->mForceReset = mForceReset;
+    p_solver->mForceMinimalReset = mForceMinimalReset;
+    return boost::shared_ptr<AbstractIvpOdeSolver>(p_solver);
+}
+
+
 // Serialization for Boost >= 1.36
 #include "SerializationExportWrapperForCpp.hpp"
 CHASTE_CLASS_EXPORT(CvodeAdaptor)
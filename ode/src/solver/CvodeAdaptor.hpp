@@ -312,6 +312,12 @@ public:
      */
     long int GetMaxSteps();
 
+    /**
+     * @return a new solver with the same settings, and its own CVODE memory
+     *     (see AbstractIvpOdeSolver::Clone())
+     */
+    boost::shared_ptr<AbstractIvpOdeSolver> Clone() const;
+
 };
 
 #include "SerializationExportWrapper.hpp"
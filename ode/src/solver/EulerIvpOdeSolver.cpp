@@ -56,6 +56,11 @@ void EulerIvpOdeSolver::CalculateNextYValue(AbstractOdeSystem* pAbstractOdeSyste
     }
 }
 
+boost::shared_ptr<AbstractIvpOdeSolver> EulerIvpOdeSolver::Clone() const
+{
+    return boost::shared_ptr<AbstractIvpOdeSolver>(new EulerIvpOdeSolver(*this));
+}
+
 
 // Serialization for Boost >= 1.36
 #include "SerializationExportWrapperForCpp.hpp"
@@ -99,6 +99,11 @@ public:
      */
     virtual ~EulerIvpOdeSolver()
     {}
+
+    /**
+     * @return a new solver like this one, with its own working memory (see AbstractIvpOdeSolver::Clone())
+     */
+    boost::shared_ptr<AbstractIvpOdeSolver> Clone() const;
 };
 
 #include "SerializationExportWrapper.hpp"
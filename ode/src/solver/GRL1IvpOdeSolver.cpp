@@ -94,6 +94,11 @@ void GRL1IvpOdeSolver::CalculateNextYValue(AbstractOdeSystem* pAbstractOdeSystem
     }
 }
 
+boost::shared_ptr<AbstractIvpOdeSolver> GRL1IvpOdeSolver::Clone() const
+{
+    return boost::shared_ptr<AbstractIvpOdeSolver>(new GRL1IvpOdeSolver(*this));
+}
+
 
 // Serialization for Boost >= 1.36
 #include "SerializationExportWrapperForCpp.hpp"
@@ -107,6 +107,11 @@ public:
     GRL1IvpOdeSolver()
     {}
 
+    /**
+     * @return a new solver like this one, with its own working memory (see AbstractIvpOdeSolver::Clone())
+     */
+    boost::shared_ptr<AbstractIvpOdeSolver> Clone() const;
+
 };
 
 #include "SerializationExportWrapper.hpp"
@@ -123,6 +123,12 @@ void GRL2IvpOdeSolver::CalculateNextYValue(AbstractOdeSystem* pAbstractOdeSystem
     }
 }
 
+boost::shared_ptr<AbstractIvpOdeSolver> GRL2IvpOdeSolver::Clone() const
+{
+    return boost::shared_ptr<AbstractIvpOdeSolver>(new GRL2IvpOdeSolver(*this));
+}
+
+
 // Serialization for Boost >= 1.36
 #include "SerializationExportWrapperForCpp.hpp"
 CHASTE_CLASS_EXPORT(GRL2IvpOdeSolver)
@@ -74,6 +74,11 @@ void HeunIvpOdeSolver::CalculateNextYValue(AbstractOdeSystem* pAbstractOdeSystem
     }
 }
 
+boost::shared_ptr<AbstractIvpOdeSolver> HeunIvpOdeSolver::Clone() const
+{
+    return boost::shared_ptr<AbstractIvpOdeSolver>(new HeunIvpOdeSolver(*this));
+}
+
 
 // Serialization for Boost >= 1.36
 #include "SerializationExportWrapperForCpp.hpp"
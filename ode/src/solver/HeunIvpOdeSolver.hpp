@@ -89,6 +89,11 @@ public:
     HeunIvpOdeSolver()
     {}
 
+    /**
+     * @return a new solver like this one, with its own working memory (see AbstractIvpOdeSolver::Clone())
+     */
+    boost::shared_ptr<AbstractIvpOdeSolver> Clone() const;
+
 };
 
 #include "SerializationExportWrapper.hpp"
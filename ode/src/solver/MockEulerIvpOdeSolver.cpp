@@ -62,6 +62,11 @@ void MockEulerIvpOdeSolver::InternalSolve(AbstractOdeSystem* pAbstractOdeSystem,
                                      timeStep);
 }
 
+boost::shared_ptr<AbstractIvpOdeSolver> MockEulerIvpOdeSolver::Clone() const
+{
+    return boost::shared_ptr<AbstractIvpOdeSolver>(new MockEulerIvpOdeSolver(*this));
+}
+
 
 // Serialization for Boost >= 1.36
 #include "SerializationExportWrapperForCpp.hpp"
@@ -109,6 +109,11 @@ public:
     virtual ~MockEulerIvpOdeSolver()
     {}
 
+    /**
+     * @return a new solver like this one, with its own working memory (see AbstractIvpOdeSolver::Clone())
+     */
+    boost::shared_ptr<AbstractIvpOdeSolver> Clone() const;
+
 };
 
 #include "SerializationExportWrapper.hpp"
@@ -70,6 +70,11 @@ void RungeKutta2IvpOdeSolver::CalculateNextYValue(AbstractOdeSystem* pAbstractOd
     }
 }
 
+boost::shared_ptr<AbstractIvpOdeSolver> RungeKutta2IvpOdeSolver::Clone() const
+{
+    return boost::shared_ptr<AbstractIvpOdeSolver>(new RungeKutta2IvpOdeSolver(*this));
+}
+
 
 // Serialization for Boost >= 1.36
 #include "SerializationExportWrapperForCpp.hpp"
@@ -89,6 +89,13 @@ private:
     std::vector<double> k4;  /**< Working memory: expression k4 in the RK4 method. */
     std::vector<double> yki; /**< Working memory: expression yki in the RK4 method. */
 
+public:
+
+    /**
+     * @return a new solver like this one, with its own working memory (see AbstractIvpOdeSolver::Clone())
+     */
+    boost::shared_ptr<AbstractIvpOdeSolver> Clone() const;
+
 };
 
 #include "SerializationExportWrapper.hpp"
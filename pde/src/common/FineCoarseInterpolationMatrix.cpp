@@ -0,0 +1,132 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "FineCoarseInterpolationMatrix.hpp"
+#include "PetscTools.hpp"
+#include "PetscMatTools.hpp"
+
+template<unsigned DIM>
+FineCoarseInterpolationMatrix<DIM>::FineCoarseInterpolationMatrix(FineCoarseMeshPair<DIM>& rMeshPair,
+                                                                  DistributedVectorFactory* pFineFactory,
+                                                                  unsigned stride,
+                                                                  int numLocalRows)
+{
+    std::vector<ElementAndWeights<DIM> >& r_elements_and_weights = rMeshPair.rGetElementsAndWeights();
+    const AbstractTetrahedralMesh<DIM,DIM>& r_fine_mesh = rMeshPair.GetFineMesh();
+    assert(pFineFactory->GetProblemSize() == r_fine_mesh.GetNumNodes());
+    assert(stride > 0);
+
+    unsigned num_rows = r_elements_and_weights.size();
+    unsigned num_columns = stride*pFineFactory->GetProblemSize();
+
+    // Each row has an entry for each vertex of the containing fine element
+    PetscTools::SetupMat(mMatrix, num_rows, num_columns, DIM+1,
+                         numLocalRows, stride*pFineFactory->GetLocalOwnership());
+
+    PetscInt lo, hi;
+    PetscMatTools::GetOwnershipRange(mMatrix, lo, hi);
+    for (PetscInt row=lo; row<hi; row++)
+    {
+        Element<DIM,DIM>* p_element = r_fine_mesh.GetElement(r_elements_and_weights[row].ElementNum);
+        for (unsigned node_index=0; node_index<DIM+1; node_index++)
+        {
+            PetscInt column = p_element->GetNodeGlobalIndex(node_index)*stride;
+            PetscMatTools::SetElement(mMatrix, row, column, r_elements_and_weights[row].Weights(node_index));
+        }
+    }
+    PetscMatTools::Finalise(mMatrix);
+
+    mResult = PetscTools::CreateVec(num_rows, hi-lo);
+}
+
+template<unsigned DIM>
+FineCoarseInterpolationMatrix<DIM>::FineCoarseInterpolationMatrix(const std::vector<unsigned>& rCoarseElementsForFineNodes,
+                                                                  unsigned numCoarseElements,
+                                                                  DistributedVectorFactory* pFineFactory)
+{
+    assert(rCoarseElementsForFineNodes.size() == pFineFactory->GetProblemSize());
+
+    unsigned num_rows = pFineFactory->GetProblemSize();
+    PetscTools::SetupMat(mMatrix, num_rows, numCoarseElements, 1, pFineFactory->GetLocalOwnership());
+
+    for (unsigned row=pFineFactory->GetLow(); row<pFineFactory->GetHigh(); row++)
+    {
+        assert(rCoarseElementsForFineNodes[row] < numCoarseElements);
+        PetscMatTools::SetElement(mMatrix, row, rCoarseElementsForFineNodes[row], 1.0);
+    }
+    PetscMatTools::Finalise(mMatrix);
+
+    mResult = pFineFactory->CreateVec();
+}
+
+template<unsigned DIM>
+FineCoarseInterpolationMatrix<DIM>::~FineCoarseInterpolationMatrix()
+{
+    PetscTools::Destroy(mMatrix);
+    PetscTools::Destroy(mResult);
+}
+
+template<unsigned DIM>
+void FineCoarseInterpolationMatrix<DIM>::Interpolate(Vec input, Vec output)
+{
+    MatMult(mMatrix, input, output);
+}
+
+template<unsigned DIM>
+void FineCoarseInterpolationMatrix<DIM>::Interpolate(Vec input, std::vector<double>& rOutput)
+{
+    MatMult(mMatrix, input, mResult);
+    mReplicatedResult.ReplicatePetscVector(mResult);
+
+    rOutput.resize(mReplicatedResult.GetSize());
+    for (unsigned i=0; i<rOutput.size(); i++)
+    {
+        rOutput[i] = mReplicatedResult[i];
+    }
+}
+
+template<unsigned DIM>
+Mat FineCoarseInterpolationMatrix<DIM>::GetMatrix()
+{
+    return mMatrix;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// Explicit instantiation
+/////////////////////////////////////////////////////////////////////////////
+
+template class FineCoarseInterpolationMatrix<1>;
+template class FineCoarseInterpolationMatrix<2>;
+template class FineCoarseInterpolationMatrix<3>;
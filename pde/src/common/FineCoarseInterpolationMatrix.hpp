@@ -0,0 +1,136 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef FINECOARSEINTERPOLATIONMATRIX_HPP_
+#define FINECOARSEINTERPOLATIONMATRIX_HPP_
+
+#include <vector>
+#include <petscmat.h>
+#include <petscvec.h>
+
+#include "FineCoarseMeshPair.hpp"
+#include "DistributedVectorFactory.hpp"
+#include "ReplicatableVector.hpp"
+
+/**
+ * A sparse (PETSc) matrix which interpolates between the two meshes of a FineCoarseMeshPair,
+ * assembled once from the point location information in the mesh pair so that each
+ * subsequent interpolation is a single parallel matrix-vector product.
+ *
+ * Two kinds of operator can be made:
+ *
+ * -# FINE MESH NODES ---> POINTS LOCATED IN THE FINE MESH (coarse quadrature points or coarse nodes),
+ *    with a row per point holding the interpolation weights of its containing fine element,
+ *    from rGetElementsAndWeights().
+ * -# COARSE ELEMENTS ---> FINE NODES, for quantities that are constant on each coarse element,
+ *    with a single unit entry per fine node from rGetCoarseElementsForFineNodes().
+ *
+ * The columns of the first operator are distributed as the fine mesh nodes, so a distributed
+ * fine-mesh Vec can be interpolated without replicating it: only the entries needed by the
+ * local rows are communicated.
+ */
+template<unsigned DIM>
+class FineCoarseInterpolationMatrix
+{
+private:
+
+    /** The interpolation matrix. */
+    Mat mMatrix;
+
+    /** Work vector holding the result of the last interpolation, distributed as the rows. */
+    Vec mResult;
+
+    /** Replicated copy of #mResult, for Interpolate() into a std::vector. */
+    ReplicatableVector mReplicatedResult;
+
+public:
+
+    /**
+     * Make the operator taking nodal values on the fine mesh to the points located by
+     * ComputeFineElementsAndWeightsForCoarseQuadPoints() or ComputeFineElementsAndWeightsForCoarseNodes().
+     *
+     * @param rMeshPair The mesh pair, after one of the above has been called
+     * @param pFineFactory The distribution of the fine mesh nodes (and so of the input vectors)
+     * @param stride The number of interleaved values per fine node in the input vectors; the first
+     *     is interpolated (e.g. 2 to interpolate the voltage from a bidomain solution)
+     * @param numLocalRows The number of points whose values should be owned by this process, if
+     *     the output vectors are to match an existing distribution (defaults to PETSc's choice)
+     */
+    FineCoarseInterpolationMatrix(FineCoarseMeshPair<DIM>& rMeshPair,
+                                  DistributedVectorFactory* pFineFactory,
+                                  unsigned stride=1,
+                                  int numLocalRows=PETSC_DECIDE);
+
+    /**
+     * Make the operator taking values on each coarse element to the fine nodes.
+     *
+     * @param rCoarseElementsForFineNodes The coarse element containing each fine node, from
+     *     rGetCoarseElementsForFineNodes()
+     * @param numCoarseElements The number of coarse elements
+     * @param pFineFactory The distribution of the fine mesh nodes (and so of the output vectors)
+     */
+    FineCoarseInterpolationMatrix(const std::vector<unsigned>& rCoarseElementsForFineNodes,
+                                  unsigned numCoarseElements,
+                                  DistributedVectorFactory* pFineFactory);
+
+    /**
+     * Destructor frees the PETSc objects.
+     */
+    ~FineCoarseInterpolationMatrix();
+
+    /**
+     * Interpolate into a vector distributed as the rows of the matrix.
+     *
+     * @param input The values to interpolate, distributed as the columns
+     * @param output The interpolated values
+     */
+    void Interpolate(Vec input, Vec output);
+
+    /**
+     * Interpolate and replicate the result on every process. Only the (interpolated) output
+     * is replicated, never the input.
+     *
+     * @param input The values to interpolate, distributed as the columns
+     * @param rOutput Filled in with all the interpolated values
+     */
+    void Interpolate(Vec input, std::vector<double>& rOutput);
+
+    /**
+     * @return the interpolation matrix
+     */
+    Mat GetMatrix();
+};
+
+#endif /*FINECOARSEINTERPOLATIONMATRIX_HPP_*/
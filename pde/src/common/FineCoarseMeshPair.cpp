@@ -35,12 +35,21 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include "FineCoarseMeshPair.hpp"
 
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 template<unsigned DIM>
 FineCoarseMeshPair<DIM>::FineCoarseMeshPair(AbstractTetrahedralMesh<DIM,DIM>& rFineMesh, AbstractTetrahedralMesh<DIM,DIM>& rCoarseMesh)
     : mrFineMesh(rFineMesh),
       mrCoarseMesh(rCoarseMesh),
       mpFineMeshBoxCollection(NULL),
-      mpCoarseMeshBoxCollection(NULL)
+      mpCoarseMeshBoxCollection(NULL),
+      mUseBatchedPointLocation(true)
 {
     ResetStatisticsVariables();
 }
@@ -100,6 +109,12 @@ void FineCoarseMeshPair<DIM>::SetUpBoxesOnCoarseMesh(double boxWidth)
     SetUpBoxes(mrCoarseMesh, boxWidth, mpCoarseMeshBoxCollection);
 }
 
+template<unsigned DIM>
+void FineCoarseMeshPair<DIM>::SetUseBatchedPointLocation(bool useBatchedPointLocation)
+{
+    mUseBatchedPointLocation = useBatchedPointLocation;
+}
+
 template<unsigned DIM>
 void FineCoarseMeshPair<DIM>::SetUpBoxes(AbstractTetrahedralMesh<DIM, DIM>& rMesh,
                                          double boxWidth,
@@ -181,7 +196,7 @@ void FineCoarseMeshPair<DIM>::SetUpBoxes(AbstractTetrahedralMesh<DIM, DIM>& rMes
 // and
 // ComputeFineElementsAndWeightsForCoarseNodes()
 // and
-// common method
+// common methods
 ////////////////////////////////////////////////////////////////////////////////////
 
 template<unsigned DIM>
@@ -208,27 +223,39 @@ void FineCoarseMeshPair<DIM>::ComputeFineElementsAndWeightsForCoarseQuadPoints(G
 
 
     ResetStatisticsVariables();
-    for (unsigned i=0; i<quad_point_posns.Size(); i++)
+    if (mUseBatchedPointLocation)
     {
-        #define COVERAGE_IGNORE
-        if(CommandLineArguments::Instance()->OptionExists("-mesh_pair_verbose"))
+        std::vector<c_vector<double,DIM> > points(quad_point_posns.Size());
+        for (unsigned i=0; i<quad_point_posns.Size(); i++)
         {
-            std::cout << "\t" << i << " of " << quad_point_posns.Size() << std::flush;
+            points[i] = quad_point_posns.rGet(i);
         }
-        #undef COVERAGE_IGNORE
-
-        // Get the box this point is in
-        unsigned box_for_this_point = mpFineMeshBoxCollection->CalculateContainingBox( quad_point_posns.rGet(i) );
-        if (mpFineMeshBoxCollection->IsBoxOwned(box_for_this_point))
+        ComputeFineElementsAndWeightsForPoints(points, safeMode);
+    }
+    else
+    {
+        for (unsigned i=0; i<quad_point_posns.Size(); i++)
         {
-            // A chaste point version of the c-vector is needed for the GetContainingElement call.
-            ChastePoint<DIM> point(quad_point_posns.rGet(i));
+            #define COVERAGE_IGNORE
+            if(CommandLineArguments::Instance()->OptionExists("-mesh_pair_verbose"))
+            {
+                std::cout << "\t" << i << " of " << quad_point_posns.Size() << std::flush;
+            }
+            #undef COVERAGE_IGNORE
 
-            ComputeFineElementAndWeightForGivenPoint(point, safeMode, box_for_this_point, i);
-        }
-        else
-        {
-            assert(mFineMeshElementsAndWeights[i].ElementNum == 0u); // and the weight is zero too...
+            // Get the box this point is in
+            unsigned box_for_this_point = mpFineMeshBoxCollection->CalculateContainingBox( quad_point_posns.rGet(i) );
+            if (mpFineMeshBoxCollection->IsBoxOwned(box_for_this_point))
+            {
+                // A chaste point version of the c-vector is needed for the GetContainingElement call.
+                ChastePoint<DIM> point(quad_point_posns.rGet(i));
+
+                ComputeFineElementAndWeightForGivenPoint(point, safeMode, box_for_this_point, i);
+            }
+            else
+            {
+                assert(mFineMeshElementsAndWeights[i].ElementNum == 0u); // and the weight is zero too...
+            }
         }
     }
     ShareFineElementData();
@@ -258,124 +285,94 @@ void FineCoarseMeshPair<DIM>::ComputeFineElementsAndWeightsForCoarseNodes(bool s
 
 
     ResetStatisticsVariables();
-    for (unsigned i=0; i<mrCoarseMesh.GetNumNodes(); i++)
+    if (mUseBatchedPointLocation)
     {
-        #define COVERAGE_IGNORE
-        if(CommandLineArguments::Instance()->OptionExists("-mesh_pair_verbose"))
+        std::vector<c_vector<double,DIM> > points(mrCoarseMesh.GetNumNodes());
+        for (unsigned i=0; i<mrCoarseMesh.GetNumNodes(); i++)
         {
-            std::cout << "\t" << i << " of " << mrCoarseMesh.GetNumNodes() << std::flush;
+            points[i] = mrCoarseMesh.GetNode(i)->rGetLocation();
         }
-        #undef COVERAGE_IGNORE
+        ComputeFineElementsAndWeightsForPoints(points, safeMode);
+    }
+    else
+    {
+        for (unsigned i=0; i<mrCoarseMesh.GetNumNodes(); i++)
+        {
+            #define COVERAGE_IGNORE
+            if(CommandLineArguments::Instance()->OptionExists("-mesh_pair_verbose"))
+            {
+                std::cout << "\t" << i << " of " << mrCoarseMesh.GetNumNodes() << std::flush;
+            }
+            #undef COVERAGE_IGNORE
 
-        Node<DIM>* p_node = mrCoarseMesh.GetNode(i);
+            Node<DIM>* p_node = mrCoarseMesh.GetNode(i);
 
-        // Get the box this point is in
-        unsigned box_for_this_point = mpFineMeshBoxCollection->CalculateContainingBox( p_node->rGetModifiableLocation() );
-        if (mpFineMeshBoxCollection->IsBoxOwned(box_for_this_point))
-        {
-            // A chaste point version of the c-vector is needed for the GetContainingElement call
-            ChastePoint<DIM> point(p_node->rGetLocation());
+            // Get the box this point is in
+            unsigned box_for_this_point = mpFineMeshBoxCollection->CalculateContainingBox( p_node->rGetModifiableLocation() );
+            if (mpFineMeshBoxCollection->IsBoxOwned(box_for_this_point))
+            {
+                // A chaste point version of the c-vector is needed for the GetContainingElement call
+                ChastePoint<DIM> point(p_node->rGetLocation());
 
-            ComputeFineElementAndWeightForGivenPoint(point, safeMode, box_for_this_point, i);
+                ComputeFineElementAndWeightForGivenPoint(point, safeMode, box_for_this_point, i);
+            }
         }
     }
     ShareFineElementData();
 }
 
-/**
- * \todo: could possibly merge with ComputeCoarseElementForGivenPoint(). Difference between
- * the methods are: this uses fine mesh and fine mesh box, computes weights as well (and sets
- * the element and weight in the vec), rather than returning the element, and this method
- * saves information in mStatisticsCounters.
- */
 template<unsigned DIM>
 void FineCoarseMeshPair<DIM>::ComputeFineElementAndWeightForGivenPoint(ChastePoint<DIM>& rPoint,
                                                                        bool safeMode,
                                                                        unsigned boxForThisPoint,
                                                                        unsigned index)
 {
-    std::set<unsigned> test_element_indices;
-
-    /*
-     * The elements to try (initially) are those contained in the box the point is in.
-     *
-     * Note: it is possible the point to be in an element not 'in' this box, as it is
-     * possible for all element nodes to be in different boxes.
-     */
-    CollectElementsInContainingBox(mpFineMeshBoxCollection, boxForThisPoint, test_element_indices);
-
     unsigned elem_index;
-    c_vector<double,DIM+1> weight;
+    bool found = LocatePointUsingBoxes(mrFineMesh, mpFineMeshBoxCollection, rPoint, safeMode, boxForThisPoint, elem_index);
+    c_vector<double,DIM+1> weight = mrFineMesh.GetElement(elem_index)->CalculateInterpolationWeights(rPoint);
 
-    try
+    if (found)
     {
-        //std::cout << "\n" << "# test elements initially " << test_element_indices.size() << "\n";
-        // Try these elements only, initially
-        elem_index = mrFineMesh.GetContainingElementIndex(rPoint,
-                                                          false,
-                                                          test_element_indices,
-                                                          true /* quit if not in test_elements */);
-        weight = mrFineMesh.GetElement(elem_index)->CalculateInterpolationWeights(rPoint);
-
         mStatisticsCounters[0]++;
     }
-    catch(Exception&) //not_in_box
+    else
     {
-        // Now try all elements, trying the elements contained in the boxes local to this element first
-        test_element_indices.clear();
-
-        CollectElementsInLocalBoxes(mpFineMeshBoxCollection, boxForThisPoint, test_element_indices);
-
-        try
-        {
-            elem_index = mrFineMesh.GetContainingElementIndex(rPoint, false, test_element_indices, true);
-            weight = mrFineMesh.GetElement(elem_index)->CalculateInterpolationWeights(rPoint);
-            mStatisticsCounters[0]++;
-        }
-        catch(Exception&) //not_in_local_boxes
-        {
-            if (safeMode)
-            {
-                // Try the remaining elements
-                try
-                {
-                    elem_index = mrFineMesh.GetContainingElementIndex(rPoint, false);
-                    weight = mrFineMesh.GetElement(elem_index)->CalculateInterpolationWeights(rPoint);
-                    mStatisticsCounters[0]++;
-
-                }
-                catch (Exception&) // not_in_mesh
-                {
-                    // The point is not in ANY element, so store the nearest element and corresponding weights
-                    elem_index = mrFineMesh.GetNearestElementIndexFromTestElements(rPoint,test_element_indices);
-                    weight = mrFineMesh.GetElement(elem_index)->CalculateInterpolationWeights(rPoint);
+        // The point is not in any element searched, so store the nearest element and corresponding weights
+        mNotInMesh.push_back(index);
+        mNotInMeshNearestElementWeights.push_back(weight);
+        mStatisticsCounters[1]++;
+    }
 
-                    mNotInMesh.push_back(index);
-                    mNotInMeshNearestElementWeights.push_back(weight);
-                    mStatisticsCounters[1]++;
-                }
-            }
-            else
-            {
-                assert(test_element_indices.size() > 0); // boxes probably too small if this fails
+    mFineMeshElementsAndWeights[index].ElementNum = elem_index;
+    mFineMeshElementsAndWeights[index].Weights = weight;
+}
 
-                /*
-                 * Immediately assume it isn't in the rest of the mesh - this should be the
-                 * case assuming the box width was chosen suitably. Store the nearest element
-                 * and corresponding weights.
-                 */
-                elem_index = mrFineMesh.GetNearestElementIndexFromTestElements(rPoint,test_element_indices);
-                weight = mrFineMesh.GetElement(elem_index)->CalculateInterpolationWeights(rPoint);
+template<unsigned DIM>
+void FineCoarseMeshPair<DIM>::ComputeFineElementsAndWeightsForPoints(std::vector<c_vector<double,DIM> >& rPoints,
+                                                                     bool safeMode)
+{
+    std::vector<unsigned> element_indices;
+    std::vector<double> weights;
+    std::vector<unsigned> not_in_mesh;
+    unsigned num_owned = LocatePoints(mrFineMesh, mpFineMeshBoxCollection, rPoints, safeMode, true,
+                                      element_indices, weights, not_in_mesh);
 
-                mNotInMesh.push_back(index);
-                mNotInMeshNearestElementWeights.push_back(weight);
-                mStatisticsCounters[1]++;
-            }
+    for (unsigned i=0; i<rPoints.size(); i++)
+    {
+        mFineMeshElementsAndWeights[i].ElementNum = element_indices[i];
+        for (unsigned j=0; j<DIM+1; j++)
+        {
+            mFineMeshElementsAndWeights[i].Weights[j] = weights[i*(DIM+1)+j];
         }
     }
 
-    mFineMeshElementsAndWeights[index].ElementNum = elem_index;
-    mFineMeshElementsAndWeights[index].Weights = weight;
+    for (unsigned i=0; i<not_in_mesh.size(); i++)
+    {
+        mNotInMesh.push_back(not_in_mesh[i]);
+        mNotInMeshNearestElementWeights.push_back(mFineMeshElementsAndWeights[not_in_mesh[i]].Weights);
+    }
+    mStatisticsCounters[0] += num_owned - not_in_mesh.size();
+    mStatisticsCounters[1] += not_in_mesh.size();
 }
 
 ////////////////////////////////////////////////////////////////////////////////////
@@ -383,7 +380,7 @@ void FineCoarseMeshPair<DIM>::ComputeFineElementAndWeightForGivenPoint(ChastePoi
 // and
 // ComputeCoarseElementsForFineElementCentroids
 // and
-// common method
+// common methods
 ////////////////////////////////////////////////////////////////////////////////////
 
 template<unsigned DIM>
@@ -404,22 +401,34 @@ void FineCoarseMeshPair<DIM>::ComputeCoarseElementsForFineNodes(bool safeMode)
     mCoarseElementsForFineNodes.resize(mrFineMesh.GetNumNodes(), 0.0);
 
     ResetStatisticsVariables();
-    for (unsigned i=0; i<mCoarseElementsForFineNodes.size(); i++)
+    if (mUseBatchedPointLocation)
     {
-        #define COVERAGE_IGNORE
-        if(CommandLineArguments::Instance()->OptionExists("-mesh_pair_verbose"))
+        std::vector<c_vector<double,DIM> > points(mrFineMesh.GetNumNodes());
+        for (unsigned i=0; i<mrFineMesh.GetNumNodes(); i++)
         {
-            std::cout << "\t" << i << " of " << mCoarseElementsForFineNodes.size() << std::flush;
+            points[i] = mrFineMesh.GetNode(i)->rGetLocation();
         }
-        #undef COVERAGE_IGNORE
+        ComputeCoarseElementsForPoints(points, safeMode, mCoarseElementsForFineNodes);
+    }
+    else
+    {
+        for (unsigned i=0; i<mCoarseElementsForFineNodes.size(); i++)
+        {
+            #define COVERAGE_IGNORE
+            if(CommandLineArguments::Instance()->OptionExists("-mesh_pair_verbose"))
+            {
+                std::cout << "\t" << i << " of " << mCoarseElementsForFineNodes.size() << std::flush;
+            }
+            #undef COVERAGE_IGNORE
 
-        ChastePoint<DIM> point = mrFineMesh.GetNode(i)->GetPoint();
+            ChastePoint<DIM> point = mrFineMesh.GetNode(i)->GetPoint();
 
-        // Get the box this point is in
-        unsigned box_for_this_point = mpCoarseMeshBoxCollection->CalculateContainingBox(mrFineMesh.GetNode(i)->rGetModifiableLocation());
-        if (mpCoarseMeshBoxCollection->IsBoxOwned(box_for_this_point))
-        {
-            mCoarseElementsForFineNodes[i] = ComputeCoarseElementForGivenPoint(point, safeMode, box_for_this_point);
+            // Get the box this point is in
+            unsigned box_for_this_point = mpCoarseMeshBoxCollection->CalculateContainingBox(mrFineMesh.GetNode(i)->rGetModifiableLocation());
+            if (mpCoarseMeshBoxCollection->IsBoxOwned(box_for_this_point))
+            {
+                mCoarseElementsForFineNodes[i] = ComputeCoarseElementForGivenPoint(point, safeMode, box_for_this_point);
+            }
         }
     }
     ShareCoarseElementData();
@@ -444,24 +453,36 @@ void FineCoarseMeshPair<DIM>::ComputeCoarseElementsForFineElementCentroids(bool
     mCoarseElementsForFineElementCentroids.resize(mrFineMesh.GetNumElements(), 0.0);
 
     ResetStatisticsVariables();
-    for (unsigned i=0; i<mrFineMesh.GetNumElements(); i++)
+    if (mUseBatchedPointLocation)
     {
-        #define COVERAGE_IGNORE
-        if(CommandLineArguments::Instance()->OptionExists("-mesh_pair_verbose"))
+        std::vector<c_vector<double,DIM> > points(mrFineMesh.GetNumElements());
+        for (unsigned i=0; i<mrFineMesh.GetNumElements(); i++)
         {
-            std::cout << "\t" << i << " of " << mrFineMesh.GetNumElements() << std::flush;
+            points[i] = mrFineMesh.GetElement(i)->CalculateCentroid();
         }
-        #undef COVERAGE_IGNORE
+        ComputeCoarseElementsForPoints(points, safeMode, mCoarseElementsForFineElementCentroids);
+    }
+    else
+    {
+        for (unsigned i=0; i<mrFineMesh.GetNumElements(); i++)
+        {
+            #define COVERAGE_IGNORE
+            if(CommandLineArguments::Instance()->OptionExists("-mesh_pair_verbose"))
+            {
+                std::cout << "\t" << i << " of " << mrFineMesh.GetNumElements() << std::flush;
+            }
+            #undef COVERAGE_IGNORE
 
-        c_vector<double,DIM> point_cvec = mrFineMesh.GetElement(i)->CalculateCentroid();
-        ChastePoint<DIM> point(point_cvec);
+            c_vector<double,DIM> point_cvec = mrFineMesh.GetElement(i)->CalculateCentroid();
+            ChastePoint<DIM> point(point_cvec);
 
-        // Get the box this point is in
-        unsigned box_for_this_point = mpCoarseMeshBoxCollection->CalculateContainingBox( point_cvec );
+            // Get the box this point is in
+            unsigned box_for_this_point = mpCoarseMeshBoxCollection->CalculateContainingBox( point_cvec );
 
-        if (mpCoarseMeshBoxCollection->IsBoxOwned(box_for_this_point))
-        {
-            mCoarseElementsForFineElementCentroids[i] = ComputeCoarseElementForGivenPoint(point, safeMode, box_for_this_point);
+            if (mpCoarseMeshBoxCollection->IsBoxOwned(box_for_this_point))
+            {
+                mCoarseElementsForFineElementCentroids[i] = ComputeCoarseElementForGivenPoint(point, safeMode, box_for_this_point);
+            }
         }
     }
     ShareCoarseElementData();
@@ -472,36 +493,73 @@ unsigned FineCoarseMeshPair<DIM>::ComputeCoarseElementForGivenPoint(ChastePoint<
                                                                     bool safeMode,
                                                                     unsigned boxForThisPoint)
 {
-    /**
-     * \todo: could possibly merge with ComputeFineElementAndWeightForGivenPoint(). Differences
-     * between the methods are: the other method uses fine mesh and fine mesh box, computes
-     * weights as well (and sets the element and weight in the vec), rather than returning the
-     * element, and that method saves information in mStatisticsCounters.
-     */
+    unsigned elem_index;
+    if (LocatePointUsingBoxes(mrCoarseMesh, mpCoarseMeshBoxCollection, rPoint, safeMode, boxForThisPoint, elem_index))
+    {
+        mStatisticsCounters[0]++;
+    }
+    else
+    {
+        mStatisticsCounters[1]++;
+    }
+    return elem_index;
+}
+
+template<unsigned DIM>
+void FineCoarseMeshPair<DIM>::ComputeCoarseElementsForPoints(std::vector<c_vector<double,DIM> >& rPoints,
+                                                             bool safeMode,
+                                                             std::vector<unsigned>& rCoarseElements)
+{
+    std::vector<double> unused_weights;
+    std::vector<unsigned> not_in_mesh;
+    unsigned num_owned = LocatePoints(mrCoarseMesh, mpCoarseMeshBoxCollection, rPoints, safeMode, false,
+                                      rCoarseElements, unused_weights, not_in_mesh);
+
+    mStatisticsCounters[0] += num_owned - not_in_mesh.size();
+    mStatisticsCounters[1] += not_in_mesh.size();
+}
+
+////////////////////////////////////////////////////////////////////////////////////
+// Point location
+////////////////////////////////////////////////////////////////////////////////////
+
+template<unsigned DIM>
+bool FineCoarseMeshPair<DIM>::LocatePointUsingBoxes(AbstractTetrahedralMesh<DIM,DIM>& rMesh,
+                                                    DistributedBoxCollection<DIM>*& rpBoxCollection,
+                                                    ChastePoint<DIM>& rPoint,
+                                                    bool safeMode,
+                                                    unsigned boxForThisPoint,
+                                                    unsigned& rElementIndex)
+{
     std::set<unsigned> test_element_indices;
-    CollectElementsInContainingBox(mpCoarseMeshBoxCollection, boxForThisPoint, test_element_indices);
 
-    unsigned elem_index;
+    /*
+     * The elements to try (initially) are those contained in the box the point is in.
+     *
+     * Note: it is possible the point to be in an element not 'in' this box, as it is
+     * possible for all element nodes to be in different boxes.
+     */
+    CollectElementsInContainingBox(rpBoxCollection, boxForThisPoint, test_element_indices);
 
     try
     {
-        elem_index = mrCoarseMesh.GetContainingElementIndex(rPoint,
-                                                            false,
-                                                            test_element_indices,
-                                                            true /* quit if not in test_elements */);
-
-        mStatisticsCounters[0]++;
+        // Try these elements only, initially
+        rElementIndex = rMesh.GetContainingElementIndex(rPoint,
+                                                        false,
+                                                        test_element_indices,
+                                                        true /* quit if not in test_elements */);
+        return true;
     }
     catch(Exception&) // not_in_box
     {
         // Now try all elements, trying the elements contained in the boxes local to this element first
         test_element_indices.clear();
-        CollectElementsInLocalBoxes(mpCoarseMeshBoxCollection, boxForThisPoint, test_element_indices);
+        CollectElementsInLocalBoxes(rpBoxCollection, boxForThisPoint, test_element_indices);
 
         try
         {
-            elem_index = mrCoarseMesh.GetContainingElementIndex(rPoint, false, test_element_indices, true);
-            mStatisticsCounters[0]++;
+            rElementIndex = rMesh.GetContainingElementIndex(rPoint, false, test_element_indices, true);
+            return true;
         }
         catch(Exception&) // not_in_local_boxes
         {
@@ -510,15 +568,13 @@ unsigned FineCoarseMeshPair<DIM>::ComputeCoarseElementForGivenPoint(ChastePoint<
                 // Try the remaining elements
                 try
                 {
-                    elem_index = mrCoarseMesh.GetContainingElementIndex(rPoint, false);
-
-                    mStatisticsCounters[0]++;
+                    rElementIndex = rMesh.GetContainingElementIndex(rPoint, false);
+                    return true;
                 }
                 catch (Exception&) // not_in_mesh
                 {
-                    // The point is not in ANY element, so store the nearest element and corresponding weights
-                    elem_index = mrCoarseMesh.GetNearestElementIndexFromTestElements(rPoint,test_element_indices);
-                    mStatisticsCounters[1]++;
+                    // The point is not in ANY element, so use the nearest element
+                    rElementIndex = rMesh.GetNearestElementIndexFromTestElements(rPoint, test_element_indices);
                 }
             }
             else
@@ -527,16 +583,267 @@ unsigned FineCoarseMeshPair<DIM>::ComputeCoarseElementForGivenPoint(ChastePoint<
 
                 /*
                  * Immediately assume it isn't in the rest of the mesh - this should be the
-                 * case assuming the box width was chosen suitably. Store the nearest element
-                 * and corresponding weights.
+                 * case assuming the box width was chosen suitably. Use the nearest element.
                  */
-                elem_index = mrCoarseMesh.GetNearestElementIndexFromTestElements(rPoint,test_element_indices);
-                mStatisticsCounters[1]++;
+                rElementIndex = rMesh.GetNearestElementIndexFromTestElements(rPoint, test_element_indices);
             }
         }
     }
+    return false;
+}
 
-    return elem_index;
+template<unsigned DIM>
+bool FineCoarseMeshPair<DIM>::WalkToContainingElement(AbstractTetrahedralMesh<DIM,DIM>& rMesh,
+                                                      ChastePoint<DIM>& rPoint,
+                                                      unsigned startElementIndex,
+                                                      unsigned& rElementIndex)
+{
+    // A walk may circle a point in a badly shaped mesh, so give up after a generous number of steps
+    unsigned max_steps = 100u + 10u*(unsigned)(pow((double)rMesh.GetNumElements(), 1.0/DIM));
+
+    unsigned current_index = startElementIndex;
+    for (unsigned step=0; step<max_steps; step++)
+    {
+        Element<DIM,DIM>* p_element = rMesh.GetElement(current_index);
+        c_vector<double,DIM+1> weights = p_element->CalculateInterpolationWeights(rPoint);
+
+        unsigned most_negative = 0;
+        for (unsigned j=1; j<DIM+1; j++)
+        {
+            if (weights[j] < weights[most_negative])
+            {
+                most_negative = j;
+            }
+        }
+
+        // The same test as Element::IncludesPoint(rPoint, false)
+        if (weights[most_negative] >= -2*DBL_EPSILON)
+        {
+            rElementIndex = current_index;
+            return true;
+        }
+
+        // Move to the neighbour across the face opposite the most negative weight, if there is one
+        unsigned first_face_node = (most_negative+1)%(DIM+1);
+        std::set<unsigned>& r_candidates = p_element->GetNode(first_face_node)->rGetContainingElementIndices();
+        bool found_neighbour = false;
+        for (std::set<unsigned>::iterator iter = r_candidates.begin();
+             iter != r_candidates.end() && !found_neighbour;
+             ++iter)
+        {
+            if (*iter == current_index)
+            {
+                continue;
+            }
+            bool shares_face = true;
+            for (unsigned j=0; j<DIM+1; j++)
+            {
+                if (j != most_negative && j != first_face_node
+                    && p_element->GetNode(j)->rGetContainingElementIndices().count(*iter) == 0)
+                {
+                    shares_face = false;
+                    break;
+                }
+            }
+            if (shares_face)
+            {
+                current_index = *iter;
+                found_neighbour = true;
+            }
+        }
+        if (!found_neighbour)
+        {
+            // The walk has reached the boundary of the mesh
+            return false;
+        }
+    }
+    return false;
+}
+
+template<unsigned DIM>
+bool FineCoarseMeshPair<DIM>::LocatePointFromContainingElement(AbstractTetrahedralMesh<DIM,DIM>& rMesh,
+                                                               DistributedBoxCollection<DIM>*& rpBoxCollection,
+                                                               ChastePoint<DIM>& rPoint,
+                                                               bool safeMode,
+                                                               unsigned boxForThisPoint,
+                                                               unsigned containingElementIndex,
+                                                               unsigned& rElementIndex)
+{
+    // All the elements containing the point, in increasing index order
+    std::set<unsigned> candidate_indices;
+    Element<DIM,DIM>* p_containing_element = rMesh.GetElement(containingElementIndex);
+    for (unsigned j=0; j<DIM+1; j++)
+    {
+        std::set<unsigned>& r_indices = p_containing_element->GetNode(j)->rGetContainingElementIndices();
+        candidate_indices.insert(r_indices.begin(), r_indices.end());
+    }
+    std::vector<Element<DIM,DIM>*> containing_elements;
+    for (std::set<unsigned>::iterator iter = candidate_indices.begin(); iter != candidate_indices.end(); ++iter)
+    {
+        Element<DIM,DIM>* p_element = rMesh.GetElement(*iter);
+        if (p_element->IncludesPoint(rPoint, false))
+        {
+            containing_elements.push_back(p_element);
+        }
+    }
+    assert(!containing_elements.empty());
+
+    // The first of these in the box containing the point...
+    std::set<Element<DIM,DIM>*>& r_elements_in_box = rpBoxCollection->rGetBox(boxForThisPoint).rGetElementsContained();
+    for (unsigned i=0; i<containing_elements.size(); i++)
+    {
+        if (r_elements_in_box.count(containing_elements[i]) > 0)
+        {
+            rElementIndex = containing_elements[i]->GetIndex();
+            return true;
+        }
+    }
+
+    // ...or else in any of the local boxes...
+    std::set<unsigned>& r_local_boxes = rpBoxCollection->rGetLocalBoxes(boxForThisPoint);
+    for (unsigned i=0; i<containing_elements.size(); i++)
+    {
+        for (std::set<unsigned>::iterator box_iter = r_local_boxes.begin(); box_iter != r_local_boxes.end(); ++box_iter)
+        {
+            if (rpBoxCollection->rGetBox(*box_iter).rGetElementsContained().count(containing_elements[i]) > 0)
+            {
+                rElementIndex = containing_elements[i]->GetIndex();
+                return true;
+            }
+        }
+    }
+
+    // ...or else, in safe mode, anywhere in the mesh
+    if (safeMode)
+    {
+        rElementIndex = containing_elements[0]->GetIndex();
+        return true;
+    }
+
+    // Otherwise the point is taken to be outside the mesh, as in LocatePointUsingBoxes()
+    std::set<unsigned> test_element_indices;
+    CollectElementsInLocalBoxes(rpBoxCollection, boxForThisPoint, test_element_indices);
+    assert(test_element_indices.size() > 0); // boxes probably too small if this fails
+    rElementIndex = rMesh.GetNearestElementIndexFromTestElements(rPoint, test_element_indices);
+    return false;
+}
+
+template<unsigned DIM>
+unsigned FineCoarseMeshPair<DIM>::LocatePoints(AbstractTetrahedralMesh<DIM,DIM>& rMesh,
+                                               DistributedBoxCollection<DIM>*& rpBoxCollection,
+                                               std::vector<c_vector<double,DIM> >& rPoints,
+                                               bool safeMode,
+                                               bool computeWeights,
+                                               std::vector<unsigned>& rElementIndices,
+                                               std::vector<double>& rWeights,
+                                               std::vector<unsigned>& rNotInMesh)
+{
+    unsigned num_points = rPoints.size();
+    rElementIndices.assign(num_points, 0u);
+    rWeights.assign(computeWeights ? num_points*(DIM+1) : 0u, 0.0);
+    rNotInMesh.clear();
+
+    // Sort the points in boxes owned by this process by box, so that consecutive points are close together
+    std::vector<std::pair<unsigned, unsigned> > boxes_and_points;
+    boxes_and_points.reserve(num_points);
+    for (unsigned i=0; i<num_points; i++)
+    {
+        unsigned box_for_this_point = rpBoxCollection->CalculateContainingBox(rPoints[i]);
+        if (rpBoxCollection->IsBoxOwned(box_for_this_point))
+        {
+            boxes_and_points.push_back(std::make_pair(box_for_this_point, i));
+        }
+    }
+    std::sort(boxes_and_points.begin(), boxes_and_points.end());
+    unsigned num_owned = boxes_and_points.size();
+
+    #define COVERAGE_IGNORE
+    if(CommandLineArguments::Instance()->OptionExists("-mesh_pair_verbose"))
+    {
+        std::cout << "\tLocating " << num_owned << " of " << num_points << " points\n" << std::flush;
+    }
+    #undef COVERAGE_IGNORE
+
+    unsigned num_threads = 1u;
+#ifdef _OPENMP
+    num_threads = omp_get_max_threads();
+#endif
+    std::vector<std::vector<unsigned> > not_in_mesh_each_thread(num_threads);
+
+    // Each thread takes a contiguous range of the sorted points, and only writes to the entries for those points
+#ifdef _OPENMP
+#pragma omp parallel num_threads(num_threads)
+#endif
+    {
+        unsigned thread = 0u;
+        unsigned team_size = 1u;
+#ifdef _OPENMP
+        thread = omp_get_thread_num();
+        team_size = omp_get_num_threads(); // may be fewer than requested
+#endif
+        unsigned begin = (unsigned)(((unsigned long)num_owned*thread)/team_size);
+        unsigned end = (unsigned)(((unsigned long)num_owned*(thread+1))/team_size);
+
+        bool have_previous_element = false;
+        unsigned previous_element = 0u;
+        for (unsigned k=begin; k<end; k++)
+        {
+            unsigned box_for_this_point = boxes_and_points[k].first;
+            unsigned i = boxes_and_points[k].second;
+            ChastePoint<DIM> point(rPoints[i]);
+
+            // Walk from the element containing the previous point or, failing that, from an element in this box
+            bool have_start = have_previous_element;
+            unsigned start_element = previous_element;
+            if (!have_start)
+            {
+                std::set<Element<DIM,DIM>*>& r_elements_in_box = rpBoxCollection->rGetBox(box_for_this_point).rGetElementsContained();
+                if (!r_elements_in_box.empty())
+                {
+                    start_element = (*r_elements_in_box.begin())->GetIndex();
+                    have_start = true;
+                }
+            }
+
+            unsigned containing_element;
+            unsigned elem_index;
+            bool found;
+            if (have_start && WalkToContainingElement(rMesh, point, start_element, containing_element))
+            {
+                found = LocatePointFromContainingElement(rMesh, rpBoxCollection, point, safeMode,
+                                                         box_for_this_point, containing_element, elem_index);
+                previous_element = containing_element;
+                have_previous_element = true;
+            }
+            else
+            {
+                // Probably outside the mesh (or a non-convex part of it), so search as usual
+                found = LocatePointUsingBoxes(rMesh, rpBoxCollection, point, safeMode, box_for_this_point, elem_index);
+            }
+
+            rElementIndices[i] = elem_index;
+            if (computeWeights)
+            {
+                c_vector<double,DIM+1> weight = rMesh.GetElement(elem_index)->CalculateInterpolationWeights(point);
+                for (unsigned j=0; j<DIM+1; j++)
+                {
+                    rWeights[i*(DIM+1)+j] = weight[j];
+                }
+            }
+            if (!found)
+            {
+                not_in_mesh_each_thread[thread].push_back(i);
+            }
+        }
+    }
+
+    for (unsigned thread=0; thread<num_threads; thread++)
+    {
+        rNotInMesh.insert(rNotInMesh.end(), not_in_mesh_each_thread[thread].begin(), not_in_mesh_each_thread[thread].end());
+    }
+    std::sort(rNotInMesh.begin(), rNotInMesh.end());
+
+    return num_owned;
 }
 
 ////////////////////////////////////////////////////////////////////////////////////
@@ -101,6 +101,11 @@ struct ElementAndWeights
  * To see progression for any of these methods, run test from the command line with '-mesh_pair_verbose' as
  * a command line parameter
  *
+ * By default the points are located in bulk (see SetUseBatchedPointLocation()): they are sorted by
+ * containing box and each is found by walking across element faces from the element containing the
+ * previous point, with the results written into flat arrays (and the work shared between OpenMP threads
+ * if available). The results are identical to locating each point separately using the boxes.
+ *
  */
 template <unsigned DIM>
 class FineCoarseMeshPair
@@ -167,6 +172,9 @@ private:
      */
     std::vector<unsigned> mCoarseElementsForFineElementCentroids;
 
+    /** Whether to locate points in bulk using LocatePoints() (the default), or one at a time. */
+    bool mUseBatchedPointLocation;
+
     /**
      * For a given point, compute the containing element and corresponding weight
      * in the fine mesh.
@@ -192,6 +200,116 @@ private:
                                                bool safeMode,
                                                unsigned boxForThisPoint);
 
+    /**
+     * Find the element of the given mesh containing a point using the box collection: first try the
+     * elements in the box containing the point, then those in the local boxes, then (in safe mode)
+     * the whole mesh. If the point is in none of these, the nearest of the elements in the local boxes
+     * is returned instead.
+     *
+     * This method does not alter any member variables, so may be called from several threads at once.
+     *
+     * @param rMesh The mesh to search (mrFineMesh or mrCoarseMesh)
+     * @param rpBoxCollection The box collection on that mesh
+     * @param rPoint The point
+     * @param safeMode See documentation for ComputeFineElementsAndWeightsForCoarseQuadPoints()
+     * @param boxForThisPoint The box in the box collection containing this point
+     * @param rElementIndex Filled in with the containing (or nearest) element
+     * @return whether a containing element was found
+     */
+    bool LocatePointUsingBoxes(AbstractTetrahedralMesh<DIM,DIM>& rMesh,
+                               DistributedBoxCollection<DIM>*& rpBoxCollection,
+                               ChastePoint<DIM>& rPoint,
+                               bool safeMode,
+                               unsigned boxForThisPoint,
+                               unsigned& rElementIndex);
+
+    /**
+     * Walk across element faces from a starting element towards a point, each time leaving
+     * through the face opposite the most negative interpolation weight.
+     *
+     * @param rMesh The mesh to walk through
+     * @param rPoint The point
+     * @param startElementIndex The element to start from
+     * @param rElementIndex Filled in with an element containing the point, if one is reached
+     * @return false if the walk left the mesh or did not arrive within a fixed number of steps
+     */
+    bool WalkToContainingElement(AbstractTetrahedralMesh<DIM,DIM>& rMesh,
+                                 ChastePoint<DIM>& rPoint,
+                                 unsigned startElementIndex,
+                                 unsigned& rElementIndex);
+
+    /**
+     * Given an element known to contain a point, choose the element LocatePointUsingBoxes() would
+     * have returned for that point. Any other element containing the point shares a vertex with
+     * the given one (for a conforming mesh), so only these are tested, in increasing index order,
+     * against the same sequence of box, local boxes and (in safe mode) the whole mesh.
+     *
+     * @param rMesh The mesh (mrFineMesh or mrCoarseMesh)
+     * @param rpBoxCollection The box collection on that mesh
+     * @param rPoint The point
+     * @param safeMode See documentation for ComputeFineElementsAndWeightsForCoarseQuadPoints()
+     * @param boxForThisPoint The box in the box collection containing this point
+     * @param containingElementIndex An element containing the point
+     * @param rElementIndex Filled in with the chosen (or, if none is acceptable, nearest) element
+     * @return whether a containing element was chosen
+     */
+    bool LocatePointFromContainingElement(AbstractTetrahedralMesh<DIM,DIM>& rMesh,
+                                          DistributedBoxCollection<DIM>*& rpBoxCollection,
+                                          ChastePoint<DIM>& rPoint,
+                                          bool safeMode,
+                                          unsigned boxForThisPoint,
+                                          unsigned containingElementIndex,
+                                          unsigned& rElementIndex);
+
+    /**
+     * Locate a batch of points in the given mesh, with the same results as calling
+     * LocatePointUsingBoxes() for each point in turn.
+     *
+     * The points in boxes owned by this process are sorted by box, then each is located
+     * by walking from the element found for the previous point, falling back to
+     * LocatePointUsingBoxes() if the walk fails. Points not in an owned box are given
+     * element 0 and zero weights.
+     *
+     * @param rMesh The mesh to search (mrFineMesh or mrCoarseMesh)
+     * @param rpBoxCollection The box collection on that mesh
+     * @param rPoints The points
+     * @param safeMode See documentation for ComputeFineElementsAndWeightsForCoarseQuadPoints()
+     * @param computeWeights Whether to compute interpolation weights
+     * @param rElementIndices Filled in with the containing (or nearest) element of each point
+     * @param rWeights Filled in with the (DIM+1) weights of each point in turn, if computeWeights
+     * @param rNotInMesh Filled in with the (sorted) indices of the points found to be outside the mesh
+     * @return the number of points in owned boxes
+     */
+    unsigned LocatePoints(AbstractTetrahedralMesh<DIM,DIM>& rMesh,
+                          DistributedBoxCollection<DIM>*& rpBoxCollection,
+                          std::vector<c_vector<double,DIM> >& rPoints,
+                          bool safeMode,
+                          bool computeWeights,
+                          std::vector<unsigned>& rElementIndices,
+                          std::vector<double>& rWeights,
+                          std::vector<unsigned>& rNotInMesh);
+
+    /**
+     * Store the results of LocatePoints() on the fine mesh in mFineMeshElementsAndWeights,
+     * mNotInMesh, mNotInMeshNearestElementWeights and mStatisticsCounters.
+     *
+     * @param rPoints The points
+     * @param safeMode See documentation for ComputeFineElementsAndWeightsForCoarseQuadPoints()
+     */
+    void ComputeFineElementsAndWeightsForPoints(std::vector<c_vector<double,DIM> >& rPoints, bool safeMode);
+
+    /**
+     * Store the results of LocatePoints() on the coarse mesh in the given vector,
+     * and update mStatisticsCounters.
+     *
+     * @param rPoints The points
+     * @param safeMode See documentation for ComputeCoarseElementsForFineNodes()
+     * @param rCoarseElements The vector to fill in (already of the right size)
+     */
+    void ComputeCoarseElementsForPoints(std::vector<c_vector<double,DIM> >& rPoints,
+                                        bool safeMode,
+                                        std::vector<unsigned>& rCoarseElements);
+
     /**
      * Set up a box collection on the given mesh. Should only be called using either
      *   SetUpBoxes(*mpFineMesh, boxWidth, mpFineBoxCollection)  (from SetUpBoxesOnFineMesh)
@@ -290,6 +408,14 @@ public:
      */
     void SetUpBoxesOnCoarseMesh(double boxWidth = -1);
 
+    /**
+     * Set whether the Compute methods locate their points in bulk (the default) or one at a time.
+     * The results are the same either way; locating one at a time is much slower on large meshes.
+     *
+     * @param useBatchedPointLocation whether to locate points in bulk
+     */
+    void SetUseBatchedPointLocation(bool useBatchedPointLocation=true);
+
     /**
      * Set up the containing (fine) elements and corresponding weights for all the
      * quadrature points in the coarse mesh. Call GetElementsAndWeights() after calling this
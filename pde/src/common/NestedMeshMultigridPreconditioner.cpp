@@ -0,0 +1,106 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include "NestedMeshMultigridPreconditioner.hpp"
+#include "PetscTools.hpp"
+#include "PetscMatTools.hpp"
+#include "Exception.hpp"
+
+template<unsigned DIM>
+NestedMeshMultigridPreconditioner<DIM>::NestedMeshMultigridPreconditioner(std::vector<TetrahedralMesh<DIM,DIM>*> coarseMeshes,
+                                                                          AbstractTetrahedralMesh<DIM,DIM>& rFineMesh)
+{
+    for (unsigned level=0; level<coarseMeshes.size(); level++)
+    {
+        if (level+1 < coarseMeshes.size())
+        {
+            AddInterpolation(MakeInterpolation(*(coarseMeshes[level]), *(coarseMeshes[level+1])));
+        }
+        else
+        {
+            AddInterpolation(MakeInterpolation(*(coarseMeshes[level]), rFineMesh));
+        }
+    }
+}
+
+template<unsigned DIM>
+Mat NestedMeshMultigridPreconditioner<DIM>::MakeInterpolation(TetrahedralMesh<DIM,DIM>& rCoarseMesh,
+                                                              AbstractTetrahedralMesh<DIM,DIM>& rFinerMesh)
+{
+    DistributedVectorFactory* p_coarse_factory = rCoarseMesh.GetDistributedVectorFactory();
+    DistributedVectorFactory* p_finer_factory = rFinerMesh.GetDistributedVectorFactory();
+
+    // Each row has an entry for each vertex of the containing coarse element
+    Mat interpolation;
+    PetscTools::SetupMat(interpolation, rFinerMesh.GetNumNodes(), rCoarseMesh.GetNumNodes(), DIM+1,
+                         p_finer_factory->GetLocalOwnership(), p_coarse_factory->GetLocalOwnership());
+
+    // Consecutive nodes are usually close together, so the last element found is a good guess
+    unsigned element_guess = 0;
+    for (unsigned node_index=p_finer_factory->GetLow(); node_index<p_finer_factory->GetHigh(); node_index++)
+    {
+        ChastePoint<DIM> point = rFinerMesh.GetNode(node_index)->GetPoint();
+
+        c_vector<double, DIM+1> weights;
+        try
+        {
+            element_guess = rCoarseMesh.GetContainingElementIndexWithInitialGuess(point, element_guess);
+            weights = rCoarseMesh.GetElement(element_guess)->CalculateInterpolationWeights(point);
+        }
+        catch (Exception&)
+        {
+            // Outside the coarse mesh
+            element_guess = rCoarseMesh.GetNearestElementIndex(point);
+            weights = rCoarseMesh.GetElement(element_guess)->CalculateInterpolationWeightsWithProjection(point);
+        }
+
+        Element<DIM,DIM>* p_element = rCoarseMesh.GetElement(element_guess);
+        for (unsigned i=0; i<DIM+1; i++)
+        {
+            PetscMatTools::SetElement(interpolation, node_index, p_element->GetNodeGlobalIndex(i), weights(i));
+        }
+    }
+    PetscMatTools::Finalise(interpolation);
+
+    return interpolation;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// Explicit instantiation
+/////////////////////////////////////////////////////////////////////////////
+
+template class NestedMeshMultigridPreconditioner<1>;
+template class NestedMeshMultigridPreconditioner<2>;
+template class NestedMeshMultigridPreconditioner<3>;
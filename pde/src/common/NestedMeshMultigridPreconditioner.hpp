@@ -0,0 +1,85 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef NESTEDMESHMULTIGRIDPRECONDITIONER_HPP_
+#define NESTEDMESHMULTIGRIDPRECONDITIONER_HPP_
+
+#include <vector>
+#include <petscmat.h>
+
+#include "GeometricMultigridPreconditioner.hpp"
+#include "TetrahedralMesh.hpp"
+#include "AbstractTetrahedralMesh.hpp"
+
+/**
+ * Geometric multigrid on a hierarchy of tetrahedral meshes, for a linear (nodal)
+ * scalar unknown on the finest mesh.
+ *
+ * The meshes need not be nested in the strict sense: the interpolation from one
+ * level to the next finer one evaluates the coarser mesh's linear basis functions at
+ * each node of the finer mesh.  Finer nodes lying outside the coarser mesh (e.g. on a
+ * curved boundary) take the values of the nearest coarse element, projected onto it.
+ *
+ * The coarse meshes must be (replicated) TetrahedralMeshes, since every process needs
+ * to locate its own fine nodes in them.  The finest mesh may be distributed; the
+ * unknowns on each coarse level are distributed as its DistributedVectorFactory.
+ */
+template<unsigned DIM>
+class NestedMeshMultigridPreconditioner : public GeometricMultigridPreconditioner
+{
+private:
+
+    /**
+     * Make the interpolation matrix from one level to the next finer one.
+     *
+     * @param rCoarseMesh  the coarser mesh
+     * @param rFinerMesh  the finer mesh
+     * @return the interpolation matrix, with a row per finer node and a column per coarser node
+     */
+    Mat MakeInterpolation(TetrahedralMesh<DIM,DIM>& rCoarseMesh, AbstractTetrahedralMesh<DIM,DIM>& rFinerMesh);
+
+public:
+
+    /**
+     * Constructor.  Makes the interpolation operators.
+     *
+     * @param coarseMeshes  the coarse meshes, coarsest first
+     * @param rFineMesh  the mesh on which the problem is solved
+     */
+    NestedMeshMultigridPreconditioner(std::vector<TetrahedralMesh<DIM,DIM>*> coarseMeshes,
+                                      AbstractTetrahedralMesh<DIM,DIM>& rFineMesh);
+};
+
+#endif /*NESTEDMESHMULTIGRIDPRECONDITIONER_HPP_*/
@@ -0,0 +1,280 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#include <iomanip>
+#include <map>
+#include <sstream>
+
+#include "Hdf5ToVtkSeriesConverter.hpp"
+#include "PetscTools.hpp"
+#include "Exception.hpp"
+#include "DistributedTetrahedralMesh.hpp"
+
+#ifdef CHASTE_VTK
+#define _BACKWARD_BACKWARD_WARNING_H 1 //Cut out the strstream deprecated warning for now (gcc4.3)
+#include <vtkVersion.h>
+#include <vtkDoubleArray.h>
+#include <vtkPointData.h>
+#include <vtkPoints.h>
+#include <vtkTetra.h>
+#include <vtkTriangle.h>
+#include <vtkLine.h>
+#include <vtkUnstructuredGrid.h>
+#include <vtkXMLUnstructuredGridWriter.h>
+#include <vtkXMLPUnstructuredGridWriter.h>
+#include <vtkXMLWriter.h>
+#endif //CHASTE_VTK
+
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+Hdf5ToVtkSeriesConverter<ELEMENT_DIM, SPACE_DIM>::Hdf5ToVtkSeriesConverter(const FileFinder& rInputDirectory,
+                                                                           const std::string& rFileBaseName,
+                                                                           AbstractTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>* pMesh,
+                                                                           bool compressData,
+                                                                           bool usingOriginalNodeOrdering)
+    : AbstractHdf5Converter<ELEMENT_DIM,SPACE_DIM>(rInputDirectory, rFileBaseName, pMesh, "vtk_output", 0u)
+{
+#ifdef CHASTE_VTK // Requires "sudo aptitude install libvtk5-dev" or similar
+
+    DistributedTetrahedralMesh<ELEMENT_DIM,SPACE_DIM>* p_distributed_mesh = dynamic_cast<DistributedTetrahedralMesh<ELEMENT_DIM,SPACE_DIM>*>(pMesh);
+    bool write_pieces = (p_distributed_mesh != NULL) && PetscTools::IsParallel();
+
+    /*
+     * If the data were written in the original node ordering then the row of each node is
+     * found through the inverse of the mesh's node permutation (if it has one).
+     */
+    const std::vector<unsigned>& r_permutation = pMesh->rGetNodePermutation();
+    std::vector<unsigned> original_indices;
+    if (usingOriginalNodeOrdering && !r_permutation.empty())
+    {
+        original_indices.resize(r_permutation.size());
+        for (unsigned original_index=0; original_index<r_permutation.size(); original_index++)
+        {
+            original_indices[r_permutation[original_index]] = original_index;
+        }
+    }
+
+    /*
+     * Make the VTK mesh for this process once: the owned nodes (all nodes if the mesh is
+     * not distributed) followed by any halo nodes, and the local elements.  The rows of
+     * the data to read for these points are kept in data_indices.
+     */
+    std::vector<unsigned> data_indices;
+    std::map<unsigned, unsigned> global_to_point_index;
+    vtkPoints* p_pts = vtkPoints::New(VTK_DOUBLE);
+    p_pts->GetData()->SetName("Vertex positions");
+
+    std::vector<Node<SPACE_DIM>*> nodes_to_write;
+    for (typename AbstractMesh<ELEMENT_DIM,SPACE_DIM>::NodeIterator node_iter = pMesh->GetNodeIteratorBegin();
+         node_iter != pMesh->GetNodeIteratorEnd();
+         ++node_iter)
+    {
+        nodes_to_write.push_back(&(*node_iter));
+    }
+    if (p_distributed_mesh)
+    {
+        for (typename DistributedTetrahedralMesh<ELEMENT_DIM, SPACE_DIM>::HaloNodeIterator halo_iter = p_distributed_mesh->GetHaloNodeIteratorBegin();
+             halo_iter != p_distributed_mesh->GetHaloNodeIteratorEnd();
+             ++halo_iter)
+        {
+            nodes_to_write.push_back(*halo_iter);
+        }
+    }
+    for (unsigned i=0; i<nodes_to_write.size(); i++)
+    {
+        unsigned global_index = nodes_to_write[i]->GetIndex();
+        global_to_point_index[global_index] = data_indices.size();
+        data_indices.push_back(original_indices.empty() ? global_index : original_indices[global_index]);
+
+        c_vector<double, SPACE_DIM> location = nodes_to_write[i]->rGetLocation();
+        double point[3] = {0.0, 0.0, 0.0};
+        for (unsigned dim=0; dim<SPACE_DIM; dim++)
+        {
+            point[dim] = location[dim];
+        }
+        p_pts->InsertNextPoint(point);
+    }
+
+    vtkUnstructuredGrid* p_grid = vtkUnstructuredGrid::New();
+    p_grid->SetPoints(p_pts);
+    p_pts->Delete(); // Reference counted
+
+    for (typename AbstractTetrahedralMesh<ELEMENT_DIM,SPACE_DIM>::ElementIterator elem_iter = pMesh->GetElementIteratorBegin();
+         elem_iter != pMesh->GetElementIteratorEnd();
+         ++elem_iter)
+    {
+        vtkCell* p_cell = NULL;
+        if (ELEMENT_DIM == 3)
+        {
+            p_cell = vtkTetra::New();
+        }
+        else if (ELEMENT_DIM == 2)
+        {
+            p_cell = vtkTriangle::New();
+        }
+        else // (ELEMENT_DIM == 1)
+        {
+            p_cell = vtkLine::New();
+        }
+        vtkIdList* p_cell_id_list = p_cell->GetPointIds();
+        for (unsigned j=0; j<ELEMENT_DIM+1; j++)
+        {
+            p_cell_id_list->SetId(j, global_to_point_index[elem_iter->GetNodeGlobalIndex(j)]);
+        }
+        p_grid->InsertNextCell(p_cell->GetCellType(), p_cell_id_list);
+        p_cell->Delete(); // Reference counted
+    }
+
+    std::string output_directory = this->mpOutputFileHandler->GetOutputDirectoryFullPath();
+
+    do // Loop over datasets via MoveOntoNextDataset method in the abstract class
+    {
+        // Make sure that we are never trying to write from an incomplete HDF5 dataset.
+        assert(this->mpReader->GetNumberOfRows() == pMesh->GetNumNodes());
+
+        // As for the .info file, the "Data" dataset keeps the original base name
+        std::string series_name = this->mFileBaseName;
+        if (this->mDatasetNames[this->mOpenDatasetIndex] != "Data")
+        {
+            series_name = this->mDatasetNames[this->mOpenDatasetIndex];
+        }
+
+        std::vector<double> times = this->mpReader->GetUnlimitedDimensionValues();
+        std::vector<std::string> file_names;
+
+        // Loop over time steps
+        for (unsigned time_step=0; time_step<times.size(); time_step++)
+        {
+            std::ostringstream file_name;
+            file_name << series_name << "_" << std::setw(6) << std::setfill('0') << time_step << (write_pieces ? ".pvtu" : ".vtu");
+            file_names.push_back(file_name.str());
+
+            // Without pieces, processes take it in turns to write whole time steps
+            if (!write_pieces && (time_step % PetscTools::GetNumProcs() != PetscTools::GetMyRank()))
+            {
+                continue;
+            }
+
+            vtkPointData* p_point_data = p_grid->GetPointData();
+            p_point_data->Initialize();
+
+            // Loop over variables
+            for (unsigned variable=0; variable<this->mNumVariables; variable++)
+            {
+                std::string variable_name = this->mpReader->GetVariableNames()[variable];
+                std::vector<double> values = this->mpReader->GetVariableOverNodes(variable_name, time_step, data_indices);
+
+                vtkDoubleArray* p_scalars = vtkDoubleArray::New();
+                p_scalars->SetName(variable_name.c_str());
+                p_scalars->SetNumberOfTuples(values.size());
+                for (unsigned i=0; i<values.size(); i++)
+                {
+                    p_scalars->SetValue(i, values[i]);
+                }
+                p_point_data->AddArray(p_scalars);
+                p_scalars->Delete(); // Reference counted
+            }
+
+            vtkXMLWriter* p_writer;
+            if (write_pieces)
+            {
+                // Writes the piece [name]_[rank].vtu, and the master also writes the .pvtu file
+                vtkXMLPUnstructuredGridWriter* p_parallel_writer = vtkXMLPUnstructuredGridWriter::New();
+                p_parallel_writer->SetNumberOfPieces(PetscTools::GetNumProcs());
+                p_parallel_writer->SetStartPiece(PetscTools::GetMyRank());
+                p_parallel_writer->SetEndPiece(PetscTools::GetMyRank());
+                p_writer = p_parallel_writer;
+            }
+            else
+            {
+                p_writer = vtkXMLUnstructuredGridWriter::New();
+            }
+
+            if (compressData)
+            {
+                // VTK compresses with zlib by default
+                p_writer->SetDataModeToBinary();
+            }
+            else
+            {
+                p_writer->SetDataModeToAppended();
+                p_writer->EncodeAppendedDataOff();
+                p_writer->SetCompressor(NULL);
+            }
+
+#if VTK_MAJOR_VERSION >= 6
+            p_writer->SetInputData(p_grid);
+#else
+            p_writer->SetInput(p_grid);
+#endif
+            std::string full_path = output_directory + file_name.str();
+            p_writer->SetFileName(full_path.c_str());
+            p_writer->Write();
+            p_writer->Delete(); // Reference counted
+        }
+
+        // The master lists the whole series in a .pvd file
+        if (PetscTools::AmMaster())
+        {
+            out_stream p_pvd_file = this->mpOutputFileHandler->OpenOutputFile(series_name + ".pvd");
+            *p_pvd_file << "<?xml version=\"1.0\"?>\n";
+            *p_pvd_file << "<VTKFile type=\"Collection\" version=\"0.1\" byte_order=\"LittleEndian\">\n";
+            *p_pvd_file << "    <Collection>\n";
+            for (unsigned time_step=0; time_step<times.size(); time_step++)
+            {
+                *p_pvd_file << "        <DataSet timestep=\"" << times[time_step] << "\" group=\"\" part=\"0\" file=\"" << file_names[time_step] << "\"/>\n";
+            }
+            *p_pvd_file << "    </Collection>\n";
+            *p_pvd_file << "</VTKFile>\n";
+            p_pvd_file->close();
+        }
+    }
+    while (this->MoveOntoNextDataset());
+
+    p_grid->Delete(); // Reference counted
+
+    PetscTools::Barrier("Hdf5ToVtkSeriesConverter");
+#endif //CHASTE_VTK
+}
+
+/////////////////////////////////////////////////////////////////////
+// Explicit instantiation
+/////////////////////////////////////////////////////////////////////
+
+template class Hdf5ToVtkSeriesConverter<1,1>;
+template class Hdf5ToVtkSeriesConverter<1,2>;
+template class Hdf5ToVtkSeriesConverter<2,2>;
+template class Hdf5ToVtkSeriesConverter<1,3>;
+template class Hdf5ToVtkSeriesConverter<2,3>;
+template class Hdf5ToVtkSeriesConverter<3,3>;
@@ -0,0 +1,80 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef HDF5TOVTKSERIESCONVERTER_HPP_
+#define HDF5TOVTKSERIESCONVERTER_HPP_
+
+#include "AbstractHdf5Converter.hpp"
+
+/**
+ * This class converts from Hdf5 format to a series of Vtk files, one per time step,
+ * listed in a .pvd collection file.
+ *
+ * Unlike Hdf5ToVtkConverter, no process ever holds a whole time step of data unless it
+ * writes the whole mesh, and there is no communication between processes:
+ *  - with a DistributedTetrahedralMesh in parallel, every process writes its own part
+ *    of the mesh (owned and halo nodes) as a .vtu piece for each time step, with a .pvtu
+ *    file listing the pieces;
+ *  - otherwise every process holds the whole mesh, so the time steps are shared out
+ *    between processes and each writes whole-mesh .vtu files for its own time steps.
+ *
+ * The data are read straight from the HDF5 file on each process, using the mesh's node
+ * permutation to find each node's data if they were written in the original node ordering.
+ */
+template <unsigned ELEMENT_DIM, unsigned SPACE_DIM>
+class Hdf5ToVtkSeriesConverter : public AbstractHdf5Converter<ELEMENT_DIM, SPACE_DIM>
+{
+public:
+    /**
+     * Constructor, which does the conversion and writes the files.
+     *
+     * @note This method is collective, and hence must be called by all processes.
+     *
+     * @param rInputDirectory The input directory, where the .h5 file has been written
+     * @param rFileBaseName The base name of the data file.
+     * @param pMesh Pointer to the mesh.
+     * @param compressData Whether to write zlib-compressed binary data (the default), rather
+     *     than uncompressed raw binary data appended to the end of each file
+     * @param usingOriginalNodeOrdering Whether the data were written in the original node
+     *     ordering, rather than that of the (possibly permuted) mesh
+     */
+    Hdf5ToVtkSeriesConverter(const FileFinder& rInputDirectory,
+                             const std::string& rFileBaseName,
+                             AbstractTetrahedralMesh<ELEMENT_DIM,SPACE_DIM>* pMesh,
+                             bool compressData=true,
+                             bool usingOriginalNodeOrdering=false);
+};
+
+#endif /*HDF5TOVTKSERIESCONVERTER_HPP_*/
@@ -38,6 +38,8 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 
 #include <cxxtest/TestSuite.h>
 #include "FineCoarseMeshPair.hpp"
+#include "FineCoarseInterpolationMatrix.hpp"
+#include "DistributedVector.hpp"
 #include "TetrahedralMesh.hpp"
 #include "QuadraticMesh.hpp"
 #include "PetscSetupAndFinalize.hpp"
@@ -589,6 +591,138 @@ public:
         TS_ASSERT_EQUALS(mesh_pair.mStatisticsCounters[0], 9u);
         TS_ASSERT_EQUALS(mesh_pair.mStatisticsCounters[1], 0u);
     }
+
+    // Locating points in bulk must give exactly the same answers as locating them one at a time
+    void TestBatchedPointLocationMatchesOneAtATime() throw(Exception)
+    {
+        TetrahedralMesh<3,3> fine_mesh;
+        fine_mesh.ConstructRegularSlabMesh(0.1, 1.0, 1.0, 1.0);
+
+        // Some of the coarse mesh is outside the fine mesh, and vice versa
+        QuadraticMesh<3> coarse_mesh(0.25, 1.0, 1.0, 1.0);
+        coarse_mesh.Scale(1.03, 1.0, 0.98);
+
+        GaussianQuadratureRule<3> quad_rule(3);
+
+        for (unsigned safe=0; safe<2; safe++)
+        {
+            FineCoarseMeshPair<3> batched_pair(fine_mesh, coarse_mesh);
+            FineCoarseMeshPair<3> single_pair(fine_mesh, coarse_mesh);
+            single_pair.SetUseBatchedPointLocation(false);
+
+            batched_pair.SetUpBoxesOnFineMesh();
+            single_pair.SetUpBoxesOnFineMesh();
+            batched_pair.SetUpBoxesOnCoarseMesh();
+            single_pair.SetUpBoxesOnCoarseMesh();
+
+            // Fine elements and weights for coarse quadrature points, then coarse nodes
+            for (unsigned points=0; points<2; points++)
+            {
+                if (points == 0)
+                {
+                    batched_pair.ComputeFineElementsAndWeightsForCoarseQuadPoints(quad_rule, safe);
+                    single_pair.ComputeFineElementsAndWeightsForCoarseQuadPoints(quad_rule, safe);
+                }
+                else
+                {
+                    batched_pair.ComputeFineElementsAndWeightsForCoarseNodes(safe);
+                    single_pair.ComputeFineElementsAndWeightsForCoarseNodes(safe);
+                }
+
+                std::vector<ElementAndWeights<3> >& r_batched = batched_pair.rGetElementsAndWeights();
+                std::vector<ElementAndWeights<3> >& r_single = single_pair.rGetElementsAndWeights();
+                TS_ASSERT_EQUALS(r_batched.size(), r_single.size());
+                for (unsigned i=0; i<r_single.size(); i++)
+                {
+                    TS_ASSERT_EQUALS(r_batched[i].ElementNum, r_single[i].ElementNum);
+                    for (unsigned j=0; j<4; j++)
+                    {
+                        TS_ASSERT_EQUALS(r_batched[i].Weights(j), r_single[i].Weights(j));
+                    }
+                }
+
+                TS_ASSERT_EQUALS(batched_pair.mNotInMesh, single_pair.mNotInMesh);
+                TS_ASSERT_EQUALS(batched_pair.mStatisticsCounters, single_pair.mStatisticsCounters);
+            }
+
+            // Coarse elements for fine nodes and fine element centroids
+            batched_pair.ComputeCoarseElementsForFineNodes(safe);
+            single_pair.ComputeCoarseElementsForFineNodes(safe);
+            TS_ASSERT_EQUALS(batched_pair.rGetCoarseElementsForFineNodes(), single_pair.rGetCoarseElementsForFineNodes());
+
+            batched_pair.ComputeCoarseElementsForFineElementCentroids(safe);
+            single_pair.ComputeCoarseElementsForFineElementCentroids(safe);
+            TS_ASSERT_EQUALS(batched_pair.rGetCoarseElementsForFineElementCentroids(),
+                             single_pair.rGetCoarseElementsForFineElementCentroids());
+            TS_ASSERT_EQUALS(batched_pair.mStatisticsCounters, single_pair.mStatisticsCounters);
+        }
+        Warnings::Instance()->QuietDestroy();
+    }
+
+    void TestInterpolationMatrices() throw(Exception)
+    {
+        TetrahedralMesh<2,2> fine_mesh;
+        fine_mesh.ConstructRegularSlabMesh(0.1, 1.0, 1.0);
+
+        QuadraticMesh<2> coarse_mesh(0.5, 1.0, 1.0); // 8 elements
+
+        FineCoarseMeshPair<2> mesh_pair(fine_mesh, coarse_mesh);
+        mesh_pair.SetUpBoxesOnFineMesh();
+        GaussianQuadratureRule<2> quad_rule(2);
+        mesh_pair.ComputeFineElementsAndWeightsForCoarseQuadPoints(quad_rule, false);
+
+        // A linear function is interpolated exactly. The second of each pair of interleaved values should be ignored.
+        DistributedVectorFactory* p_factory = fine_mesh.GetDistributedVectorFactory();
+        Vec fine_values = p_factory->CreateVec(2);
+        DistributedVector distributed_fine_values = p_factory->CreateDistributedVector(fine_values);
+        DistributedVector::Stripe linear(distributed_fine_values, 0);
+        DistributedVector::Stripe other(distributed_fine_values, 1);
+        for (DistributedVector::Iterator index = distributed_fine_values.Begin();
+             index != distributed_fine_values.End();
+             ++index)
+        {
+            c_vector<double,2> x = fine_mesh.GetNode(index.Global)->rGetLocation();
+            linear[index] = 1.0 + x(0) + 2.0*x(1);
+            other[index] = 1e6;
+        }
+        distributed_fine_values.Restore();
+
+        FineCoarseInterpolationMatrix<2> quad_point_matrix(mesh_pair, p_factory, 2);
+        std::vector<double> values_at_quad_points;
+        quad_point_matrix.Interpolate(fine_values, values_at_quad_points);
+
+        QuadraturePointsGroup<2> quad_point_posns(coarse_mesh, quad_rule);
+        TS_ASSERT_EQUALS(values_at_quad_points.size(), quad_point_posns.Size());
+        for (unsigned i=0; i<quad_point_posns.Size(); i++)
+        {
+            c_vector<double,2> x = quad_point_posns.rGet(i);
+            TS_ASSERT_DELTA(values_at_quad_points[i], 1.0 + x(0) + 2.0*x(1), 1e-12);
+        }
+
+        // Values constant on each coarse element are copied to the fine nodes they contain
+        mesh_pair.SetUpBoxesOnCoarseMesh();
+        mesh_pair.ComputeCoarseElementsForFineNodes(false);
+        FineCoarseInterpolationMatrix<2> node_matrix(mesh_pair.rGetCoarseElementsForFineNodes(),
+                                                     coarse_mesh.GetNumElements(), p_factory);
+
+        std::vector<double> element_values(coarse_mesh.GetNumElements());
+        for (unsigned i=0; i<element_values.size(); i++)
+        {
+            element_values[i] = 10.0 + i;
+        }
+        Vec coarse_element_values = PetscTools::CreateVec(element_values);
+        std::vector<double> values_at_fine_nodes;
+        node_matrix.Interpolate(coarse_element_values, values_at_fine_nodes);
+
+        TS_ASSERT_EQUALS(values_at_fine_nodes.size(), fine_mesh.GetNumNodes());
+        for (unsigned i=0; i<fine_mesh.GetNumNodes(); i++)
+        {
+            TS_ASSERT_EQUALS(values_at_fine_nodes[i], 10.0 + mesh_pair.rGetCoarseElementsForFineNodes()[i]);
+        }
+
+        PetscTools::Destroy(fine_values);
+        PetscTools::Destroy(coarse_element_values);
+    }
 };
 
 #endif /*TESTFINECOARSEMESHPAIR_HPP_*/
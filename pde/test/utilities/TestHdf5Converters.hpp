@@ -40,6 +40,7 @@ OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "UblasCustomFunctions.hpp"
 #include "PetscSetupAndFinalize.hpp"
 #include "Hdf5ToVtkConverter.hpp"
+#include "Hdf5ToVtkSeriesConverter.hpp"
 #include "Hdf5ToTxtConverter.hpp"
 #include "Hdf5ToMeshalyzerConverter.hpp"
 #include "Hdf5ToXdmfConverter.hpp"
@@ -257,6 +258,156 @@ public:
 
 
 
+    /**
+     * This tests the conversion of HDF5 to a series of VTK files, one per time step,
+     * using a 2D example taken from a monodomain simulation.
+     */
+    void TestMonodomainVtkSeriesConversion2D() throw(Exception)
+    {
+#ifdef CHASTE_VTK // Requires  "sudo aptitude install libvtk5-dev" or similar
+        std::string working_directory = "TestHdf5ToVtkSeriesConverter_monodomain2D";
+        CopyToTestOutputDirectory("pde/test/data/2D_0_to_1mm_400_elements.h5",
+                                  working_directory);
+
+        TrianglesMeshReader<2,2> mesh_reader("mesh/test/data/2D_0_to_1mm_400_elements");
+        std::string test_output_directory = OutputFileHandler::GetChasteTestOutputDirectory();
+        std::string output_directory = test_output_directory + working_directory + "/vtk_output/";
+
+        // With a replicated mesh, each process writes whole time steps
+        {
+            TetrahedralMesh<2,2> mesh;
+            mesh.ConstructFromMeshReader(mesh_reader);
+
+            Hdf5ToVtkSeriesConverter<2,2> converter(FileFinder(working_directory, RelativeTo::ChasteTestOutput),
+                                                    "2D_0_to_1mm_400_elements", &mesh);
+
+            // Any process can read any of the files, wherever they were written
+            VtkMeshReader<2,2> vtk_mesh_reader(output_directory + "2D_0_to_1mm_400_elements_000020.vtu");
+            TS_ASSERT_EQUALS(vtk_mesh_reader.GetNumNodes(), 221u);
+            TS_ASSERT_EQUALS(vtk_mesh_reader.GetNumElements(), 400u);
+
+            std::vector<double> v_at_last;
+            vtk_mesh_reader.GetPointData("V", v_at_last);
+            TS_ASSERT_DELTA(v_at_last[0],   -83.8534, 1e-3);
+            TS_ASSERT_DELTA(v_at_last[110], -83.8534, 1e-3);
+            TS_ASSERT_DELTA(v_at_last[220], -83.8530, 1e-3);
+
+            FileFinder pvd_file(output_directory + "2D_0_to_1mm_400_elements.pvd", RelativeTo::Absolute);
+            TS_ASSERT(pvd_file.IsFile());
+        }
+
+        // Uncompressed, appended data gives the same values
+        {
+            TetrahedralMesh<2,2> mesh;
+            mesh_reader.Reset();
+            mesh.ConstructFromMeshReader(mesh_reader);
+
+            Hdf5ToVtkSeriesConverter<2,2> converter(FileFinder(working_directory, RelativeTo::ChasteTestOutput),
+                                                    "2D_0_to_1mm_400_elements", &mesh, false);
+
+            VtkMeshReader<2,2> vtk_mesh_reader(output_directory + "2D_0_to_1mm_400_elements_000020.vtu");
+            std::vector<double> v_at_last;
+            vtk_mesh_reader.GetPointData("V", v_at_last);
+            TS_ASSERT_DELTA(v_at_last[110], -83.8534, 1e-3);
+        }
+
+        // With a distributed mesh in parallel, each process writes its own piece of every time step
+        {
+            DistributedTetrahedralMesh<2,2> mesh(DistributedTetrahedralMeshPartitionType::DUMB);
+            mesh_reader.Reset();
+            mesh.ConstructFromMeshReader(mesh_reader);
+
+            Hdf5ToVtkSeriesConverter<2,2> converter(FileFinder(working_directory, RelativeTo::ChasteTestOutput),
+                                                    "2D_0_to_1mm_400_elements", &mesh);
+
+            std::stringstream filepath;
+            filepath << output_directory << "2D_0_to_1mm_400_elements_000020";
+            if (!PetscTools::IsSequential())
+            {
+                filepath << "_" << PetscTools::GetMyRank();
+            }
+            filepath << ".vtu";
+
+            VtkMeshReader<2,2> vtk_mesh_reader(filepath.str());
+            TS_ASSERT_EQUALS(vtk_mesh_reader.GetNumNodes(), mesh.GetNumLocalNodes() + mesh.GetNumHaloNodes());
+            TS_ASSERT_EQUALS(vtk_mesh_reader.GetNumElements(), mesh.GetNumLocalElements());
+
+            std::vector<double> v_at_last;
+            vtk_mesh_reader.GetPointData("V", v_at_last);
+            TS_ASSERT_EQUALS(v_at_last.size(), mesh.GetNumLocalNodes() + mesh.GetNumHaloNodes());
+            if (PetscTools::IsSequential())
+            {
+                TS_ASSERT_DELTA(v_at_last[0],   -83.8534, 1e-3);
+                TS_ASSERT_DELTA(v_at_last[220], -83.8530, 1e-3);
+            }
+        }
+#else
+        std::cout << "This test was not run, as VTK is not enabled." << std::endl;
+        std::cout << "If required please install and alter your hostconfig settings to switch on chaste VTK support." << std::endl;
+#endif //CHASTE_VTK
+    }
+
+    /**
+     * This tests the conversion of HDF5 to a series of VTK files when the data are in the
+     * original node ordering but the mesh has been permuted.
+     */
+    void TestVtkSeriesConversionWithOriginalNodeOrdering() throw(Exception)
+    {
+#ifdef CHASTE_VTK // Requires  "sudo aptitude install libvtk5-dev" or similar
+        std::string working_directory = "TestHdf5ToVtkSeriesConverter_permuted";
+        CopyToTestOutputDirectory("pde/test/data/2D_0_to_1mm_400_elements.h5",
+                                  working_directory);
+
+        TrianglesMeshReader<2,2> mesh_reader("mesh/test/data/2D_0_to_1mm_400_elements");
+        std::string output_file = OutputFileHandler::GetChasteTestOutputDirectory() + working_directory
+                                  + "/vtk_output/2D_0_to_1mm_400_elements_000020.vtu";
+
+        // Convert using the unpermuted mesh, in which the two orderings agree
+        std::vector<double> v_original;
+        {
+            TetrahedralMesh<2,2> mesh;
+            mesh.ConstructFromMeshReader(mesh_reader);
+
+            Hdf5ToVtkSeriesConverter<2,2> converter(FileFinder(working_directory, RelativeTo::ChasteTestOutput),
+                                                    "2D_0_to_1mm_400_elements", &mesh);
+
+            VtkMeshReader<2,2> vtk_mesh_reader(output_file);
+            vtk_mesh_reader.GetPointData("V", v_original);
+        }
+
+        // Reverse the node ordering of the mesh
+        TetrahedralMesh<2,2> mesh;
+        mesh_reader.Reset();
+        mesh.ConstructFromMeshReader(mesh_reader);
+        unsigned num_nodes = mesh.GetNumNodes();
+        std::vector<unsigned> permutation(num_nodes);
+        for (unsigned i=0; i<num_nodes; i++)
+        {
+            permutation[i] = num_nodes - 1 - i;
+        }
+        mesh.PermuteNodes(permutation);
+
+        Hdf5ToVtkSeriesConverter<2,2> converter(FileFinder(working_directory, RelativeTo::ChasteTestOutput),
+                                                "2D_0_to_1mm_400_elements", &mesh, true, true);
+
+        // Point i of the output is the node with new index i, whose original index is num_nodes-1-i
+        VtkMeshReader<2,2> vtk_mesh_reader(output_file);
+        std::vector<double> v_permuted;
+        vtk_mesh_reader.GetPointData("V", v_permuted);
+        TS_ASSERT_EQUALS(v_permuted.size(), num_nodes);
+        for (unsigned i=0; i<num_nodes; i++)
+        {
+            TS_ASSERT_DELTA(v_permuted[i], v_original[num_nodes - 1 - i], 1e-12);
+            std::vector<double> location = vtk_mesh_reader.GetNextNode();
+            TS_ASSERT_DELTA(location[0], mesh.GetNode(i)->rGetLocation()[0], 1e-12);
+            TS_ASSERT_DELTA(location[1], mesh.GetNode(i)->rGetLocation()[1], 1e-12);
+        }
+#else
+        std::cout << "This test was not run, as VTK is not enabled." << std::endl;
+        std::cout << "If required please install and alter your hostconfig settings to switch on chaste VTK support." << std::endl;
+#endif //CHASTE_VTK
+    }
+
     /**
      * This tests the HDF5 to .txt converter using a 3D example
      * taken from a bidomain simulation.
@@ -0,0 +1,139 @@
+/*
+
+Copyright (c) 2005-2016, University of Oxford.
+All rights reserved.
+
+University of Oxford means the Chancellor, Masters and Scholars of the
+University of Oxford, having an administrative office at Wellington
+Square, Oxford OX1 2JD, UK.
+
+This file is part of Chaste.
+
+Redistribution and use in source and binary forms, with or without
+modification, are permitted provided that the following conditions are met:
+ * Redistributions of source code must retain the above copyright notice,
+   this list of conditions and the following disclaimer.
+ * Redistributions in binary form must reproduce the above copyright notice,
+   this list of conditions and the following disclaimer in the documentation
+   and/or other materials provided with the distribution.
+ * Neither the name of the University of Oxford nor the names of its
+   contributors may be used to endorse or promote products derived from this
+   software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE
+ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE
+GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION)
+HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT
+LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT
+OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+*/
+
+#ifndef TESTNESTEDMESHMULTIGRIDPRECONDITIONER_HPP_
+#define TESTNESTEDMESHMULTIGRIDPRECONDITIONER_HPP_
+
+#include <cxxtest/TestSuite.h>
+#include "NestedMeshMultigridPreconditioner.hpp"
+#include "TetrahedralMesh.hpp"
+#include "DistributedTetrahedralMesh.hpp"
+#include "DistributedVector.hpp"
+#include "PetscSetupAndFinalize.hpp"
+
+class TestNestedMeshMultigridPreconditioner : public CxxTest::TestSuite
+{
+private:
+
+    /**
+     * Check that the interpolation from rCoarseMesh to rFineMesh reproduces the linear
+     * function a + b x + c y exactly.
+     */
+    void CheckInterpolatesLinearFunction(Mat interpolation, TetrahedralMesh<2,2>& rCoarseMesh,
+                                         AbstractTetrahedralMesh<2,2>& rFineMesh, double a, double b, double c)
+    {
+        DistributedVectorFactory* p_coarse_factory = rCoarseMesh.GetDistributedVectorFactory();
+        DistributedVectorFactory* p_fine_factory = rFineMesh.GetDistributedVectorFactory();
+
+        Vec coarse_values = p_coarse_factory->CreateVec();
+        Vec fine_values = p_fine_factory->CreateVec();
+        {
+            DistributedVector distributed_coarse = p_coarse_factory->CreateDistributedVector(coarse_values);
+            for (DistributedVector::Iterator index = distributed_coarse.Begin();
+                 index != distributed_coarse.End();
+                 ++index)
+            {
+                c_vector<double,2> location = rCoarseMesh.GetNode(index.Global)->rGetLocation();
+                distributed_coarse[index] = a + b*location[0] + c*location[1];
+            }
+            distributed_coarse.Restore();
+        }
+
+        MatMult(interpolation, coarse_values, fine_values);
+
+        {
+            DistributedVector distributed_fine = p_fine_factory->CreateDistributedVector(fine_values);
+            for (DistributedVector::Iterator index = distributed_fine.Begin();
+                 index != distributed_fine.End();
+                 ++index)
+            {
+                c_vector<double,2> location = rFineMesh.GetNode(index.Global)->rGetLocation();
+                TS_ASSERT_DELTA(distributed_fine[index], a + b*location[0] + c*location[1], 1e-12);
+            }
+        }
+
+        PetscTools::Destroy(coarse_values);
+        PetscTools::Destroy(fine_values);
+    }
+
+public:
+
+    void TestInterpolationBetweenLevels() throw(Exception)
+    {
+        TetrahedralMesh<2,2> coarsest_mesh;
+        coarsest_mesh.ConstructRegularSlabMesh(0.5, 1.0, 1.0);
+        TetrahedralMesh<2,2> coarse_mesh;
+        coarse_mesh.ConstructRegularSlabMesh(0.25, 1.0, 1.0);
+        DistributedTetrahedralMesh<2,2> fine_mesh;
+        fine_mesh.ConstructRegularSlabMesh(0.125, 1.0, 1.0);
+
+        std::vector<TetrahedralMesh<2,2>*> coarse_meshes;
+        coarse_meshes.push_back(&coarsest_mesh);
+        coarse_meshes.push_back(&coarse_mesh);
+
+        NestedMeshMultigridPreconditioner<2> multigrid(coarse_meshes, fine_mesh);
+        TS_ASSERT_EQUALS(multigrid.GetNumLevels(), 3u);
+
+        PetscInt num_rows, num_columns;
+        MatGetSize(multigrid.GetInterpolation(0), &num_rows, &num_columns);
+        TS_ASSERT_EQUALS((unsigned)num_rows, coarse_mesh.GetNumNodes());
+        TS_ASSERT_EQUALS((unsigned)num_columns, coarsest_mesh.GetNumNodes());
+        MatGetSize(multigrid.GetInterpolation(1), &num_rows, &num_columns);
+        TS_ASSERT_EQUALS((unsigned)num_rows, fine_mesh.GetNumNodes());
+        TS_ASSERT_EQUALS((unsigned)num_columns, coarse_mesh.GetNumNodes());
+
+        // Linear functions are in every level's space
+        CheckInterpolatesLinearFunction(multigrid.GetInterpolation(0), coarsest_mesh, coarse_mesh, 1.0, 2.0, -3.0);
+        CheckInterpolatesLinearFunction(multigrid.GetInterpolation(1), coarse_mesh, fine_mesh, 1.0, 2.0, -3.0);
+    }
+
+    void TestFineNodesOutsideCoarseMesh() throw(Exception)
+    {
+        TetrahedralMesh<2,2> coarse_mesh;
+        coarse_mesh.ConstructRegularSlabMesh(0.5, 1.0, 1.0);
+        TetrahedralMesh<2,2> fine_mesh;
+        fine_mesh.ConstructRegularSlabMesh(0.1, 1.2, 1.0);
+
+        std::vector<TetrahedralMesh<2,2>*> coarse_meshes;
+        coarse_meshes.push_back(&coarse_mesh);
+        NestedMeshMultigridPreconditioner<2> multigrid(coarse_meshes, fine_mesh);
+        TS_ASSERT_EQUALS(multigrid.GetNumLevels(), 2u);
+
+        // Nodes with x>1 are projected onto the coarse mesh, so constants are still reproduced
+        CheckInterpolatesLinearFunction(multigrid.GetInterpolation(0), coarse_mesh, fine_mesh, 1.0, 0.0, 0.0);
+    }
+};
+
+#endif /*TESTNESTEDMESHMULTIGRIDPRECONDITIONER_HPP_*/
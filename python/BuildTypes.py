@@ -1512,6 +1512,10 @@ def GetBuildType(buildType):
                 obj.build_dir += '_warn'
             except ValueError:
                 pass
+        elif extra == 'openmp':
+            obj._cc_flags.append('-fopenmp')
+            obj._link_flags.append('-fopenmp')
+            obj.build_dir += '_openmp'
         elif extra == 'barriers':
             obj._cc_flags.append('-DCHASTE_EVENT_BARRIERS')
             obj.build_dir += '_barriers'